@@ -32,6 +32,7 @@ option(QGC_BUILD_INSTALLER "Build platform installers/packages" ON)
 cmake_dependent_option(QGC_BUILD_TESTING "Enable unit tests" ON "CMAKE_BUILD_TYPE STREQUAL Debug" OFF)
 cmake_dependent_option(QGC_DEBUG_QML "Enable QML debugging/profiling" ON "CMAKE_BUILD_TYPE STREQUAL Debug" OFF)
 cmake_dependent_option(QGC_ENABLE_COVERAGE "Enable code coverage instrumentation" OFF "CMAKE_BUILD_TYPE STREQUAL Debug" OFF)
+cmake_dependent_option(QGC_BUILD_BENCHMARKS "Enable QtTest benchmarks (run with the 'benchmark' target)" OFF "QGC_BUILD_TESTING" OFF)
 
 # ============================================================================
 # Feature Flags
@@ -75,6 +75,7 @@ message(STATUS "Build & Feature Flags:")
 OptionOutput("Stable build                          " QGC_STABLE_BUILD)
 OptionOutput("Use build caching                     " QGC_USE_CACHE)
 OptionOutput("Enable testing                        " QGC_BUILD_TESTING)
+OptionOutput("Enable benchmarks                     " QGC_BUILD_BENCHMARKS)
 OptionOutput("Enable QML debugging                  " QGC_DEBUG_QML)
 OptionOutput("Enable QML linting                    " QGC_ENABLE_QMLLINT)
 OptionOutput("Enable 3D Viewer                      " QGC_VIEWER3D)
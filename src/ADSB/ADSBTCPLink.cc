@@ -14,6 +14,8 @@
 #include <QtCore/QTimer>
 #include <QtNetwork/QTcpSocket>
 
+#include <array>
+
 QGC_LOGGING_CATEGORY(ADSBTCPLinkLog, "ADSB.ADSBTCPLink")
 
 ADSBTCPLink::ADSBTCPLink(const QHostAddress &hostAddress, quint16 port, QObject *parent)
@@ -78,13 +80,37 @@ bool ADSBTCPLink::init()
     return true;
 }
 
+qsizetype ADSBTCPLink::parseSBS(QByteArrayView data, QHash<uint32_t, ADSB::VehicleInfo_t> &updates, int maxLines)
+{
+    qsizetype consumed = 0;
+    int linesParsed = 0;
+    while (linesParsed < maxLines) {
+        const qsizetype lineEnd = data.indexOf('\n', consumed);
+        if (lineEnd < 0) {
+            break;
+        }
+
+        QByteArrayView line = data.sliced(consumed, lineEnd - consumed);
+        if (line.endsWith('\r')) {
+            line.chop(1);
+        }
+        _parseLine(line, updates);
+
+        consumed = lineEnd + 1;
+        ++linesParsed;
+    }
+
+    return consumed;
+}
+
 void ADSBTCPLink::_readBytes()
 {
-    while (_socket && _socket->canReadLine()) {
-        const QByteArray bytes = _socket->readLine();
-        (void) _lineBuffer.append(QString::fromLocal8Bit(bytes));
+    if (!_socket) {
+        return;
     }
 
+    (void) _rxBuffer.append(_socket->readAll());
+
     // Start or restart the timer to process lines
     if (!_processTimer->isActive()) {
         _processTimer->start();
@@ -93,49 +119,66 @@ void ADSBTCPLink::_readBytes()
 
 void ADSBTCPLink::_processLines()
 {
-    int linesProcessed = 0;
-    while (!_lineBuffer.isEmpty() && (linesProcessed < _maxLinesToProcess)) {
-        const QString line = _lineBuffer.takeFirst();
-        _parseLine(line);
-        ++linesProcessed;
+    const qsizetype consumed = parseSBS(_rxBuffer, _pendingUpdates, _maxLinesToProcess);
+    if (consumed > 0) {
+        (void) _rxBuffer.remove(0, consumed);
     }
 
-    // Stop the timer if there are no more lines to process
-    if (_lineBuffer.isEmpty()) {
+    if (!_pendingUpdates.isEmpty()) {
+        emit adsbVehiclesUpdate(_pendingUpdates.values());
+        _pendingUpdates.clear();
+    }
+
+    // Stop the timer if there are no more complete lines to process
+    if (!_rxBuffer.contains('\n')) {
         _processTimer->stop();
     }
 }
 
-void ADSBTCPLink::_parseLine(const QString &line)
+void ADSBTCPLink::_parseLine(QByteArrayView line, QHash<uint32_t, ADSB::VehicleInfo_t> &updates)
 {
     if (line.size() <= 4) {
         return;
     }
 
-    if (!line.startsWith(QStringLiteral("MSG"))) {
+    if (!line.startsWith("MSG")) {
         return;
     }
 
-    const int msgType = line.at(4).digitValue();
-    if (msgType == ADSB::Unsupported) {
-        qCDebug(ADSBTCPLinkLog) << "ADSB Invalid message type" << msgType;
+    const char msgTypeChar = line.at(4);
+    if ((msgTypeChar < '0') || (msgTypeChar > '9')) {
+        qCDebug(ADSBTCPLinkLog) << "ADSB Invalid message type" << msgTypeChar;
         return;
     }
 
     // Skip unsupported mesg types to avoid parsing
+    const int msgType = msgTypeChar - '0';
     if ((msgType == ADSB::SurfacePosition) || (msgType > ADSB::SurveillanceId)) {
         return;
     }
 
     qCDebug(ADSBTCPLinkLog) << "ADSB SBS-1" << line;
 
-    const QStringList values = line.split(QChar(','));
-    if (values.size() <= 4) {
+    // Tokenize in place, the fields reference the line
+    std::array<QByteArrayView, _maxFields> fields;
+    int fieldCount = 0;
+    qsizetype fieldStart = 0;
+    while (fieldCount < _maxFields) {
+        const qsizetype comma = line.indexOf(',', fieldStart);
+        if (comma < 0) {
+            fields[fieldCount++] = line.sliced(fieldStart);
+            break;
+        }
+        fields[fieldCount++] = line.sliced(fieldStart, comma - fieldStart);
+        fieldStart = comma + 1;
+    }
+
+    if (fieldCount <= 4) {
         return;
     }
 
     bool icaoOk;
-    const uint32_t icaoAddress = values.at(4).toUInt(&icaoOk, 16);
+    const uint32_t icaoAddress = fields[4].toUInt(&icaoOk, 16);
     if (!icaoOk) {
         return;
     }
@@ -147,39 +190,65 @@ void ADSBTCPLink::_parseLine(const QString &line)
     case ADSB::IdentificationAndCategory:
     case ADSB::SurveillanceAltitude:
     case ADSB::SurveillanceId:
-        _parseAndEmitCallsign(adsbInfo, values);
+        _parseCallsign(adsbInfo, fields.data(), fieldCount);
         break;
     case ADSB::AirbornePosition:
-        _parseAndEmitLocation(adsbInfo, values);
+        _parseLocation(adsbInfo, fields.data(), fieldCount);
         break;
     case ADSB::AirborneVelocity:
-        _parseAndEmitHeading(adsbInfo, values);
+        _parseHeading(adsbInfo, fields.data(), fieldCount);
         break;
     default:
         break;
     }
+
+    if (!adsbInfo.availableFlags) {
+        return;
+    }
+
+    auto it = updates.find(icaoAddress);
+    if (it == updates.end()) {
+        (void) updates.insert(icaoAddress, adsbInfo);
+        return;
+    }
+
+    // Merge with the earlier updates for this vehicle from the same processing tick
+    ADSB::VehicleInfo_t &pendingInfo = it.value();
+    pendingInfo.availableFlags |= adsbInfo.availableFlags;
+    if (adsbInfo.availableFlags & ADSB::CallsignAvailable) {
+        pendingInfo.callsign = adsbInfo.callsign;
+    }
+    if (adsbInfo.availableFlags & ADSB::LocationAvailable) {
+        pendingInfo.location = adsbInfo.location;
+        pendingInfo.alert = adsbInfo.alert;
+    }
+    if (adsbInfo.availableFlags & ADSB::HeadingAvailable) {
+        pendingInfo.heading = adsbInfo.heading;
+        pendingInfo.velocity = adsbInfo.velocity;
+    }
+    if (adsbInfo.availableFlags & ADSB::VerticalVelAvailable) {
+        pendingInfo.verticalVel = adsbInfo.verticalVel;
+    }
 }
 
-void ADSBTCPLink::_parseAndEmitCallsign(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values)
+void ADSBTCPLink::_parseCallsign(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount)
 {
-    if (values.size() <= 10) {
+    if (fieldCount <= 10) {
         return;
     }
 
-    const QString callsign = values.at(10).trimmed();
+    const QByteArrayView callsign = fields[10].trimmed();
     if (callsign.isEmpty()) {
         return;
     }
 
-    adsbInfo.callsign = callsign;
+    adsbInfo.callsign = QString::fromLatin1(callsign);
     adsbInfo.availableFlags = ADSB::CallsignAvailable;
-
-    emit adsbVehicleUpdate(adsbInfo);
 }
 
-void ADSBTCPLink::_parseAndEmitLocation(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values)
+void ADSBTCPLink::_parseLocation(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount)
 {
-    if (values.size() <= 19) {
+    if (fieldCount <= 19) {
         return;
     }
 
@@ -188,16 +257,16 @@ void ADSBTCPLink::_parseAndEmitLocation(ADSB::VehicleInfo_t &adsbInfo, const QSt
     // If altitude ends with H, we have HAE
     // There's a slight difference between Barometric alt and HAE, but it would require
     // knowledge about Geoid shape in particular Lat, Lon. It's not worth complicating the code
-    QString altitudeStr = values.at(11);
+    QByteArrayView altitudeStr = fields[11];
     if (altitudeStr.endsWith('H')) {
-        (void) altitudeStr.chop(1);
+        altitudeStr.chop(1);
     }
 
     bool altOk, latOk, lonOk, alertOk;
     const int modeCAltitude = altitudeStr.toInt(&altOk);
-    const double lat = values.at(14).toDouble(&latOk);
-    const double lon = values.at(15).toDouble(&lonOk);
-    const int alert = values.at(19).toInt(&alertOk);
+    const double lat = fields[14].toDouble(&latOk);
+    const double lon = fields[15].toDouble(&lonOk);
+    const int alert = fields[19].toInt(&alertOk);
 
     if (!altOk || !latOk || !lonOk || !alertOk) {
         return;
@@ -213,19 +282,17 @@ void ADSBTCPLink::_parseAndEmitLocation(ADSB::VehicleInfo_t &adsbInfo, const QSt
     adsbInfo.location = location;
     adsbInfo.alert = (alert == 1);
     adsbInfo.availableFlags = ADSB::LocationAvailable | ADSB::AltitudeAvailable | ADSB::AlertAvailable;
-
-    emit adsbVehicleUpdate(adsbInfo);
 }
 
-void ADSBTCPLink::_parseAndEmitHeading(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values)
+void ADSBTCPLink::_parseHeading(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount)
 {
-    if (values.size() <= 13) {
+    if (fieldCount <= 13) {
         return;
     }
 
     bool headingOk = false, speedOk = false;
-    const double heading = values.at(13).toDouble(&headingOk);
-    const double speedKnots = values.at(12).toDouble(&speedOk);
+    const double heading = fields[13].toDouble(&headingOk);
+    const double speedKnots = fields[12].toDouble(&speedOk);
     if (!headingOk || !speedOk) {
         return;
     }
@@ -234,14 +301,12 @@ void ADSBTCPLink::_parseAndEmitHeading(ADSB::VehicleInfo_t &adsbInfo, const QStr
     adsbInfo.velocity = speedKnots * 0.514444;
     adsbInfo.availableFlags = ADSB::HeadingAvailable | ADSB::VelocityAvailable;
 
-    if (values.size() > 16) {
+    if (fieldCount > 16) {
         bool vertOk = false;
-        const double verticalRate = values.at(16).toDouble(&vertOk);
+        const double verticalRate = fields[16].toDouble(&vertOk);
         if (vertOk) {
             adsbInfo.verticalVel = verticalRate * 0.00508;
             adsbInfo.availableFlags |= ADSB::VerticalVelAvailable;
         }
     }
-
-    emit adsbVehicleUpdate(adsbInfo);
 }
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
+#include <QtCore/QHash>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
 #include <QtNetwork/QHostAddress>
@@ -39,10 +42,18 @@ class ADSBTCPLink : public QObject
     /// Attempts connection to a host.
     bool init();
 
+    /// Parses the complete SBS-1 lines at the start of the data in place, merging all updates for the same
+    /// ICAO address into a single entry of updates.
+    ///     @param data Raw SBS-1 stream data, may end with a partial line
+    ///     @param updates Pending updates keyed by ICAO address
+    ///     @param maxLines Maximum number of lines to parse
+    /// @return Number of bytes consumed
+    static qsizetype parseSBS(QByteArrayView data, QHash<uint32_t, ADSB::VehicleInfo_t> &updates, int maxLines);
+
 signals:
-    /// Emitted when an ADS-B vehicle update is received.
-    ///     @param vehicleInfo The updated vehicle information.
-    void adsbVehicleUpdate(const ADSB::VehicleInfo_t &vehicleInfo);
+    /// Emitted once per processing interval with the merged updates for each ADS-B vehicle.
+    ///     @param vehicleInfos The updated vehicle information.
+    void adsbVehiclesUpdate(const QList<ADSB::VehicleInfo_t> &vehicleInfos);
 
     /// Emitted when an error occurs.
     ///     @param errorMsg The error message.
@@ -57,31 +68,34 @@ private slots:
 
 private:
     /// Parses a line of ADS-B data.
-    ///     @param line The line to parse.
-    void _parseLine(const QString &line);
+    ///     @param line The line to parse, without the line terminator.
+    ///     @param updates Pending updates to merge the line into.
+    static void _parseLine(QByteArrayView line, QHash<uint32_t, ADSB::VehicleInfo_t> &updates);
 
-    /// Parses and emits the callsign from ADS-B data.
+    /// Parses the callsign from ADS-B data.
     ///     @param adsbInfo The ADS-B vehicle info structure to update.
-    ///     @param values The values parsed from the line.
-    void _parseAndEmitCallsign(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values);
+    ///     @param fields The fields of the line.
+    static void _parseCallsign(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount);
 
-    /// Parses and emits the location from ADS-B data.
+    /// Parses the location from ADS-B data.
     ///     @param adsbInfo The ADS-B vehicle info structure to update.
-    ///     @param values The values parsed from the line.
-    void _parseAndEmitLocation(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values);
+    ///     @param fields The fields of the line.
+    static void _parseLocation(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount);
 
-    /// Parses and emits the heading from ADS-B data.
+    /// Parses the heading from ADS-B data.
     ///     @param adsbInfo The ADS-B vehicle info structure to update.
-    ///     @param values The values parsed from the line.
-    void _parseAndEmitHeading(ADSB::VehicleInfo_t &adsbInfo, const QStringList &values);
+    ///     @param fields The fields of the line.
+    static void _parseHeading(ADSB::VehicleInfo_t &adsbInfo, const QByteArrayView *fields, int fieldCount);
 
     QHostAddress _hostAddress;
     quint16 _port = 30003;
 
     QTcpSocket *_socket = nullptr;     ///< Pointer to the TCP socket used for connection
     QTimer *_processTimer = nullptr;   ///< Timer for periodic processing of ADS-B data
-    QStringList _lineBuffer;           ///< Buffer for storing incoming lines of ADS-B data
+    QByteArray _rxBuffer;              ///< Raw incoming ADS-B data which has not been processed yet
+    QHash<uint32_t, ADSB::VehicleInfo_t> _pendingUpdates;   ///< Updates merged per ICAO address for the current processing tick
 
     static constexpr int _processInterval = 50;     ///< Interval for processing lines
-    static constexpr int _maxLinesToProcess = 100;  ///< Maximum number of lines to process per timer timeout
+    static constexpr int _maxLinesToProcess = 1000; ///< Maximum number of lines to process per timer timeout
+    static constexpr int _maxFields = 22;           ///< Number of fields in an SBS-1 line
 };
@@ -0,0 +1,265 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ADSBTargetStore.h"
+
+#include <QtCore/QtMath>
+
+namespace {
+    constexpr double kMetersPerDegreeLatitude = 111320.0;
+}
+
+bool ADSBTargetStore::update(const ADSB::VehicleInfo_t &vehicleInfo, qint64 nowMsecs)
+{
+    const uint32_t icaoAddress = vehicleInfo.icaoAddress;
+    const bool locationAvailable = vehicleInfo.availableFlags.testFlag(ADSB::LocationAvailable);
+
+    qsizetype index = _indexByIcao.value(icaoAddress, -1);
+    const bool added = (index == -1);
+    if (added) {
+        if (!locationAvailable) {
+            return false;
+        }
+
+        index = _icao.count();
+        ADSB::VehicleInfo_t info{};
+        info.icaoAddress = icaoAddress;
+        (void) _icao.append(icaoAddress);
+        (void) _latitude.append(qQNaN());
+        (void) _longitude.append(qQNaN());
+        (void) _lastUpdateMsecs.append(nowMsecs);
+        (void) _cell.append(0);
+        (void) _info.append(info);
+        (void) _indexByIcao.insert(icaoAddress, index);
+    }
+
+    ADSB::VehicleInfo_t &info = _info[index];
+    info.availableFlags |= vehicleInfo.availableFlags;
+    info.lastContact = vehicleInfo.lastContact;
+    info.simulated = vehicleInfo.simulated;
+    info.baro = vehicleInfo.baro;
+    info.altitudeeType = vehicleInfo.altitudeeType;
+    info.emitterType = vehicleInfo.emitterType;
+
+    if (locationAvailable) {
+        info.location.setLatitude(vehicleInfo.location.latitude());
+        info.location.setLongitude(vehicleInfo.location.longitude());
+        _latitude[index] = vehicleInfo.location.latitude();
+        _longitude[index] = vehicleInfo.location.longitude();
+
+        const quint64 cellKey = _cellKey(_latCell(_latitude[index]), _lonCell(_longitude[index]));
+        if (added) {
+            _cell[index] = cellKey;
+            _addToCell(cellKey, icaoAddress);
+        } else if (cellKey != _cell[index]) {
+            _removeFromCell(_cell[index], icaoAddress);
+            _cell[index] = cellKey;
+            _addToCell(cellKey, icaoAddress);
+        }
+    }
+    if (vehicleInfo.availableFlags & ADSB::AltitudeAvailable) {
+        info.location.setAltitude(vehicleInfo.location.altitude());
+    }
+    if (vehicleInfo.availableFlags & ADSB::HeadingAvailable) {
+        info.heading = vehicleInfo.heading;
+    }
+    if (vehicleInfo.availableFlags & ADSB::VelocityAvailable) {
+        info.velocity = vehicleInfo.velocity;
+    }
+    if (vehicleInfo.availableFlags & ADSB::CallsignAvailable) {
+        info.callsign = vehicleInfo.callsign;
+    }
+    if (vehicleInfo.availableFlags & ADSB::SquawkAvailable) {
+        info.squawk = vehicleInfo.squawk;
+    }
+    if (vehicleInfo.availableFlags & ADSB::VerticalVelAvailable) {
+        info.verticalVel = vehicleInfo.verticalVel;
+    }
+    if (vehicleInfo.availableFlags & ADSB::AlertAvailable) {
+        info.alert = vehicleInfo.alert;
+    }
+
+    _lastUpdateMsecs[index] = nowMsecs;
+
+    return added;
+}
+
+bool ADSBTargetStore::remove(uint32_t icaoAddress)
+{
+    const qsizetype index = _indexByIcao.value(icaoAddress, -1);
+    if (index == -1) {
+        return false;
+    }
+
+    _removeAt(index);
+    return true;
+}
+
+QList<uint32_t> ADSBTargetStore::removeExpired(qint64 nowMsecs, qint64 timeoutMsecs)
+{
+    QList<uint32_t> removed;
+
+    for (qsizetype i = _lastUpdateMsecs.count() - 1; i >= 0; i--) {
+        if ((nowMsecs - _lastUpdateMsecs[i]) > timeoutMsecs) {
+            (void) removed.append(_icao[i]);
+            _removeAt(i);
+        }
+    }
+
+    return removed;
+}
+
+QList<uint32_t> ADSBTargetStore::targetsWithinRadius(const QGeoCoordinate &center, double radiusMeters) const
+{
+    QList<uint32_t> targets;
+
+    if (!center.isValid() || (radiusMeters < 0)) {
+        return targets;
+    }
+
+    const double latDelta = radiusMeters / kMetersPerDegreeLatitude;
+    const double lonDelta = radiusMeters / (kMetersPerDegreeLatitude * qMax(qCos(qDegreesToRadians(center.latitude())), 0.01));
+
+    const auto visitor = [&](qsizetype index) {
+        if (center.distanceTo(QGeoCoordinate(_latitude[index], _longitude[index])) <= radiusMeters) {
+            (void) targets.append(_icao[index]);
+        }
+    };
+
+    const double minLon = center.longitude() - lonDelta;
+    const double maxLon = center.longitude() + lonDelta;
+    if ((minLon < -180.) || (maxLon > 180.)) {
+        // Wraps the antimeridian, fall back to checking everything
+        for (qsizetype i = 0; i < _icao.count(); i++) {
+            visitor(i);
+        }
+    } else {
+        _cellRangeQuery(_latCell(center.latitude() - latDelta), _latCell(center.latitude() + latDelta), _lonCell(minLon), _lonCell(maxLon), visitor);
+    }
+
+    return targets;
+}
+
+QList<uint32_t> ADSBTargetStore::targetsWithinRegion(const QGeoRectangle &region) const
+{
+    QList<uint32_t> targets;
+
+    if (!region.isValid()) {
+        return targets;
+    }
+
+    const auto visitor = [&](qsizetype index) {
+        if (region.contains(QGeoCoordinate(_latitude[index], _longitude[index]))) {
+            (void) targets.append(_icao[index]);
+        }
+    };
+
+    const int minLatCell = _latCell(region.bottomLeft().latitude());
+    const int maxLatCell = _latCell(region.topRight().latitude());
+    const int minLonCell = _lonCell(region.bottomLeft().longitude());
+    const int maxLonCell = _lonCell(region.topRight().longitude());
+    const qint64 cellCount = static_cast<qint64>(maxLatCell - minLatCell + 1) * static_cast<qint64>(maxLonCell - minLonCell + 1);
+
+    if ((minLonCell > maxLonCell) || (cellCount > _icao.count())) {
+        // Region wraps the antimeridian or is zoomed out far enough that scanning the targets is cheaper than the cells
+        for (qsizetype i = 0; i < _icao.count(); i++) {
+            visitor(i);
+        }
+    } else {
+        _cellRangeQuery(minLatCell, maxLatCell, minLonCell, maxLonCell, visitor);
+    }
+
+    return targets;
+}
+
+void ADSBTargetStore::clear()
+{
+    _icao.clear();
+    _latitude.clear();
+    _longitude.clear();
+    _lastUpdateMsecs.clear();
+    _cell.clear();
+    _info.clear();
+    _indexByIcao.clear();
+    _cells.clear();
+}
+
+quint64 ADSBTargetStore::_cellKey(int latCell, int lonCell)
+{
+    return (static_cast<quint64>(static_cast<quint32>(latCell)) << 32) | static_cast<quint32>(lonCell);
+}
+
+int ADSBTargetStore::_latCell(double latitude)
+{
+    return qFloor(qBound(-90., latitude, 90.) / kCellSizeDegrees);
+}
+
+int ADSBTargetStore::_lonCell(double longitude)
+{
+    return qFloor(qBound(-180., longitude, 180.) / kCellSizeDegrees);
+}
+
+void ADSBTargetStore::_addToCell(quint64 cellKey, uint32_t icaoAddress)
+{
+    (void) _cells[cellKey].append(icaoAddress);
+}
+
+void ADSBTargetStore::_removeFromCell(quint64 cellKey, uint32_t icaoAddress)
+{
+    auto it = _cells.find(cellKey);
+    if (it == _cells.end()) {
+        return;
+    }
+
+    (void) it->removeOne(icaoAddress);
+    if (it->isEmpty()) {
+        (void) _cells.erase(it);
+    }
+}
+
+void ADSBTargetStore::_removeAt(qsizetype index)
+{
+    const uint32_t icaoAddress = _icao[index];
+    _removeFromCell(_cell[index], icaoAddress);
+    (void) _indexByIcao.remove(icaoAddress);
+
+    // Swap the last target into the hole to keep the arrays packed
+    const qsizetype lastIndex = _icao.count() - 1;
+    if (index != lastIndex) {
+        _icao[index] = _icao[lastIndex];
+        _latitude[index] = _latitude[lastIndex];
+        _longitude[index] = _longitude[lastIndex];
+        _lastUpdateMsecs[index] = _lastUpdateMsecs[lastIndex];
+        _cell[index] = _cell[lastIndex];
+        _info[index] = _info[lastIndex];
+        _indexByIcao[_icao[index]] = index;
+    }
+
+    _icao.removeLast();
+    _latitude.removeLast();
+    _longitude.removeLast();
+    _lastUpdateMsecs.removeLast();
+    _cell.removeLast();
+    _info.removeLast();
+}
+
+void ADSBTargetStore::_cellRangeQuery(int minLatCell, int maxLatCell, int minLonCell, int maxLonCell, const std::function<void(qsizetype)> &visitor) const
+{
+    for (int latCell = minLatCell; latCell <= maxLatCell; latCell++) {
+        for (int lonCell = minLonCell; lonCell <= maxLonCell; lonCell++) {
+            const auto it = _cells.constFind(_cellKey(latCell, lonCell));
+            if (it == _cells.constEnd()) {
+                continue;
+            }
+            for (const uint32_t icaoAddress: *it) {
+                visitor(_indexByIcao.value(icaoAddress));
+            }
+        }
+    }
+}
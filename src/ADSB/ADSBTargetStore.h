@@ -0,0 +1,73 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtPositioning/QGeoCoordinate>
+#include <QtPositioning/QGeoRectangle>
+
+#include "ADSB.h"
+
+/// The ADSBTargetStore class holds all known ADS-B targets as compact arrays along with a uniform lat/lon grid index.
+/// Positions and update times are kept in separate arrays so stale target scans and spatial queries never touch
+/// the remaining target info. Busy airspace can easily contain many hundreds of targets.
+class ADSBTargetStore
+{
+public:
+    /// Merges the available fields of the specified info into the target, creating the target if needed.
+    /// Targets are only created once their location is known.
+    ///     @param nowMsecs Current time used for expiration
+    /// @return true: target was created
+    bool update(const ADSB::VehicleInfo_t &vehicleInfo, qint64 nowMsecs);
+
+    bool remove(uint32_t icaoAddress);
+
+    /// Removes all targets which have not been updated within the specified timeout
+    /// @return ICAO addresses of the removed targets
+    QList<uint32_t> removeExpired(qint64 nowMsecs, qint64 timeoutMsecs);
+
+    /// @return ICAO addresses of all targets within the specified distance of the center
+    QList<uint32_t> targetsWithinRadius(const QGeoCoordinate &center, double radiusMeters) const;
+
+    /// @return ICAO addresses of all targets within the specified region
+    QList<uint32_t> targetsWithinRegion(const QGeoRectangle &region) const;
+
+    bool contains(uint32_t icaoAddress) const { return _indexByIcao.contains(icaoAddress); }
+    /// @return Merged info for the target, must only be called for known targets
+    const ADSB::VehicleInfo_t &vehicleInfo(uint32_t icaoAddress) const { return _info[_indexByIcao.value(icaoAddress)]; }
+    const QList<uint32_t> &icaoAddresses() const { return _icao; }
+    qsizetype count() const { return _icao.count(); }
+    void clear();
+
+    static constexpr double kCellSizeDegrees = 0.25;    ///< Roughly 28km at the equator
+
+private:
+    static quint64 _cellKey(int latCell, int lonCell);
+    static int _latCell(double latitude);
+    static int _lonCell(double longitude);
+    void _addToCell(quint64 cellKey, uint32_t icaoAddress);
+    void _removeFromCell(quint64 cellKey, uint32_t icaoAddress);
+    void _removeAt(qsizetype index);
+    void _cellRangeQuery(int minLatCell, int maxLatCell, int minLonCell, int maxLonCell, const std::function<void(qsizetype)> &visitor) const;
+
+    // Target arrays, all indexed the same
+    QList<uint32_t> _icao;
+    QList<double> _latitude;
+    QList<double> _longitude;
+    QList<qint64> _lastUpdateMsecs;
+    QList<quint64> _cell;
+    QList<ADSB::VehicleInfo_t> _info;
+
+    QHash<uint32_t, qsizetype> _indexByIcao;
+    QHash<quint64, QList<uint32_t>> _cells;     ///< Grid cell -> ICAO addresses of targets within the cell
+};
@@ -14,6 +14,8 @@
 #include "ADSBTCPLink.h"
 #include "ADSBVehicle.h"
 #include "QmlObjectListModel.h"
+#include "MultiVehicleManager.h"
+#include "Vehicle.h"
 #include "QGCLoggingCategory.h"
 
 #include <QtCore/QApplicationStatic>
@@ -29,6 +31,7 @@ ADSBVehicleManager::ADSBVehicleManager(ADSBVehicleManagerSettings *settings, QOb
     , _adsbSettings(settings)
     , _adsbVehicleCleanupTimer(new QTimer(this))
     , _adsbVehicles(new QmlObjectListModel(this))
+    , _publishTimer(new QTimer(this))
 {
     // qCDebug(ADSBVehicleManagerLog) << Q_FUNC_INFO << this;
 
@@ -38,6 +41,12 @@ ADSBVehicleManager::ADSBVehicleManager(ADSBVehicleManagerSettings *settings, QOb
     _adsbVehicleCleanupTimer->setInterval(1000);
     (void) connect(_adsbVehicleCleanupTimer, &QTimer::timeout, this, &ADSBVehicleManager::_cleanupStaleVehicles);
 
+    _publishTimer->setSingleShot(true);
+    _publishTimer->setInterval(kPublishIntervalMs);
+    (void) connect(_publishTimer, &QTimer::timeout, this, &ADSBVehicleManager::_publishTimeout);
+
+    _clock.start();
+
     Fact* const adsbEnabled = _adsbSettings->adsbServerConnectEnabled();
     Fact* const hostAddress = _adsbSettings->adsbServerHostAddress();
     Fact* const port = _adsbSettings->adsbServerPort();
@@ -145,18 +154,113 @@ void ADSBVehicleManager::_handleADSBVehicle(const mavlink_message_t &message)
 }
 
 void ADSBVehicleManager::adsbVehicleUpdate(const ADSB::VehicleInfo_t &vehicleInfo)
+{
+    if (_updateTarget(vehicleInfo)) {
+        _schedulePublish();
+    }
+}
+
+void ADSBVehicleManager::adsbVehiclesUpdate(const QList<ADSB::VehicleInfo_t> &vehicleInfos)
+{
+    bool dirty = false;
+    for (const ADSB::VehicleInfo_t &vehicleInfo: vehicleInfos) {
+        dirty |= _updateTarget(vehicleInfo);
+    }
+
+    if (dirty) {
+        _schedulePublish();
+    }
+}
+
+bool ADSBVehicleManager::_updateTarget(const ADSB::VehicleInfo_t &vehicleInfo)
 {
     const uint32_t icaoAddress = vehicleInfo.icaoAddress;
-    if (_adsbICAOMap.contains(icaoAddress)) {
-        _adsbICAOMap[icaoAddress]->update(vehicleInfo);
-        return;
+    if (_targetStore.update(vehicleInfo, _clock.elapsed())) {
+        qCDebug(ADSBVehicleManagerLog) << "Added" << QString::number(icaoAddress);
+    } else if (!_targetStore.contains(icaoAddress)) {
+        // Traffic is only tracked once the location is known
+        return false;
     }
 
-    if (vehicleInfo.availableFlags & ADSB::LocationAvailable) {
-        ADSBVehicle* const adsbVehicle = new ADSBVehicle(vehicleInfo, this);
-        _adsbICAOMap[icaoAddress] = adsbVehicle;
-        _adsbVehicles->append(adsbVehicle);
-        qCDebug(ADSBVehicleManagerLog) << "Added" << QString::number(adsbVehicle->icaoAddress());
+    (void) _dirtyTargets.insert(icaoAddress);
+    _publishPending = true;
+    return true;
+}
+
+void ADSBVehicleManager::setVisibleRegion(const QGeoShape &region)
+{
+    const QGeoRectangle visibleRegion = region.isValid() ? region.boundingGeoRectangle() : QGeoRectangle();
+    if (visibleRegion != _visibleRegion) {
+        _visibleRegion = visibleRegion;
+        _schedulePublish();
+    }
+}
+
+void ADSBVehicleManager::_schedulePublish()
+{
+    // The first change after a quiet period is published immediately, changes after that are coalesced until the timer fires
+    if (_publishTimer->isActive()) {
+        _publishPending = true;
+    } else {
+        _publishVehicles();
+        _publishTimer->start();
+    }
+}
+
+void ADSBVehicleManager::_publishTimeout()
+{
+    // Region changes are pending as well, not only traffic updates
+    if (_publishPending || !_dirtyTargets.isEmpty()) {
+        _publishVehicles();
+        _publishTimer->start();
+    }
+}
+
+void ADSBVehicleManager::_publishVehicles()
+{
+    QList<uint32_t> visibleTargets;
+    if (_visibleRegion.isValid()) {
+        visibleTargets = _targetStore.targetsWithinRegion(_visibleRegion);
+
+        const Vehicle* const activeVehicle = MultiVehicleManager::instance()->activeVehicle();
+        if (activeVehicle) {
+            visibleTargets += _targetStore.targetsWithinRadius(activeVehicle->coordinate(), kAlertRadiusMeters);
+        }
+    } else {
+        visibleTargets = _targetStore.icaoAddresses();
+    }
+
+    const QSet<uint32_t> visibleSet(visibleTargets.constBegin(), visibleTargets.constEnd());
+
+    // Traffic which moved out of view
+    const QList<uint32_t> publishedTargets = _adsbICAOMap.keys();
+    for (const uint32_t icaoAddress: publishedTargets) {
+        if (!visibleSet.contains(icaoAddress)) {
+            _unpublishVehicle(icaoAddress);
+        }
+    }
+
+    for (const uint32_t icaoAddress: visibleSet) {
+        ADSBVehicle* const adsbVehicle = _adsbICAOMap.value(icaoAddress, nullptr);
+        if (!adsbVehicle) {
+            ADSBVehicle* const newVehicle = new ADSBVehicle(_targetStore.vehicleInfo(icaoAddress), this);
+            _adsbICAOMap[icaoAddress] = newVehicle;
+            _adsbVehicles->append(newVehicle);
+        } else if (_dirtyTargets.contains(icaoAddress)) {
+            adsbVehicle->update(_targetStore.vehicleInfo(icaoAddress));
+        }
+    }
+
+    _dirtyTargets.clear();
+    _publishPending = false;
+}
+
+void ADSBVehicleManager::_unpublishVehicle(uint32_t icaoAddress)
+{
+    ADSBVehicle* const adsbVehicle = _adsbICAOMap.take(icaoAddress);
+    if (adsbVehicle) {
+        (void) _adsbVehicles->removeOne(adsbVehicle);
+        adsbVehicle->deleteLater();
     }
 }
 
@@ -173,7 +277,7 @@ void ADSBVehicleManager::_start(const QString &hostAddress, quint16 port)
     }
 
     _adsbTcpLink = adsbTcpLink;
-    (void) connect(_adsbTcpLink, &ADSBTCPLink::adsbVehicleUpdate, this, &ADSBVehicleManager::adsbVehicleUpdate, Qt::AutoConnection);
+    (void) connect(_adsbTcpLink, &ADSBTCPLink::adsbVehiclesUpdate, this, &ADSBVehicleManager::adsbVehiclesUpdate, Qt::AutoConnection);
     (void) connect(_adsbTcpLink, &ADSBTCPLink::errorOccurred, this, &ADSBVehicleManager::_linkError, Qt::AutoConnection);
 
     _adsbVehicleCleanupTimer->start();
@@ -186,21 +290,22 @@ void ADSBVehicleManager::_stop()
     _adsbTcpLink = nullptr;
 
     _adsbVehicleCleanupTimer->stop();
+    _publishTimer->stop();
 
     _adsbVehicles->clearAndDeleteContents();
     _adsbICAOMap.clear();
+    _targetStore.clear();
+    _dirtyTargets.clear();
+    _publishPending = false;
 }
 
 void ADSBVehicleManager::_cleanupStaleVehicles()
 {
-    for (qsizetype i = _adsbVehicles->count() - 1; i >= 0; i--) {
-        ADSBVehicle* const adsbVehicle = _adsbVehicles->value<ADSBVehicle*>(i);
-        if (adsbVehicle->expired()) {
-            qCDebug(ADSBVehicleManagerLog) << "Expired" << QString::number(adsbVehicle->icaoAddress());
-            (void) _adsbVehicles->removeAt(i);
-            (void) _adsbICAOMap.remove(adsbVehicle->icaoAddress());
-            adsbVehicle->deleteLater();
-        }
+    const QList<uint32_t> expiredTargets = _targetStore.removeExpired(_clock.elapsed(), kExpirationTimeoutMs);
+    for (const uint32_t icaoAddress: expiredTargets) {
+        qCDebug(ADSBVehicleManagerLog) << "Expired" << QString::number(icaoAddress);
+        (void) _dirtyTargets.remove(icaoAddress);
+        _unpublishVehicle(icaoAddress);
     }
 }
 
@@ -9,10 +9,15 @@
 
 #pragma once
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtPositioning/QGeoRectangle>
+#include <QtPositioning/QGeoShape>
 
 #include "ADSB.h"
+#include "ADSBTargetStore.h"
 #include "MAVLinkLib.h"
 
 Q_DECLARE_LOGGING_CATEGORY(ADSBVehicleManagerLog)
@@ -40,24 +45,47 @@ class ADSBVehicleManager : public QObject
 
     void mavlinkMessageReceived(const mavlink_message_t &message);
 
+    /// Only traffic within the visible map region, plus traffic near the active vehicle, is published to adsbVehicles
+    ///     @param region Visible map region, an invalid region publishes all traffic
+    Q_INVOKABLE void setVisibleRegion(const QGeoShape &region);
+
+    /// @return ICAO addresses of all known traffic within the specified distance
+    QList<uint32_t> trafficWithinRadius(const QGeoCoordinate &center, double radiusMeters) const { return _targetStore.targetsWithinRadius(center, radiusMeters); }
+
 public slots:
     void adsbVehicleUpdate(const ADSB::VehicleInfo_t &vehicleInfo);
+    void adsbVehiclesUpdate(const QList<ADSB::VehicleInfo_t> &vehicleInfos);
 
 private slots:
     void _cleanupStaleVehicles();
     void _linkError(const QString &errorMsg, bool stopped = false);
+    void _publishTimeout();
 
 private:
     void _start(const QString &hostAddress, quint16 port);
     void _stop();
     void _handleADSBVehicle(const mavlink_message_t &message);
+    /// @return true: traffic is tracked and needs to be published
+    bool _updateTarget(const ADSB::VehicleInfo_t &vehicleInfo);
+    void _schedulePublish();
+    void _publishVehicles();
+    void _unpublishVehicle(uint32_t icaoAddress);
 
     ADSBVehicleManagerSettings *_adsbSettings = nullptr;
     QTimer *_adsbVehicleCleanupTimer = nullptr;
     QmlObjectListModel *_adsbVehicles = nullptr;
 
-    QMap<uint32_t, ADSBVehicle*> _adsbICAOMap;
+    ADSBTargetStore _targetStore;                   ///< All known traffic
+    QMap<uint32_t, ADSBVehicle*> _adsbICAOMap;      ///< Traffic currently published to adsbVehicles
+    QSet<uint32_t> _dirtyTargets;                   ///< Traffic updated since the last publish
+    bool _publishPending = false;                   ///< Traffic or visible region changed while publishing was throttled
+    QTimer *_publishTimer = nullptr;
+    QElapsedTimer _clock;
+    QGeoRectangle _visibleRegion;
     ADSBTCPLink *_adsbTcpLink = nullptr;
 
     static constexpr uint8_t kMaxTimeSinceLastSeen = 15;
+    static constexpr int kPublishIntervalMs = 100;              ///< Maximum rate traffic updates are pushed to the ui
+    static constexpr double kAlertRadiusMeters = 10000.;        ///< Traffic within this distance of the active vehicle is always published
+    static constexpr qint64 kExpirationTimeoutMs = 120000;      ///< Traffic with no update within this time is removed
 };
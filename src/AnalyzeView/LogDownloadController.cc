@@ -239,93 +239,58 @@ void LogDownloadController::_logData(uint32_t ofs, uint16_t id, uint8_t count, c
         return;
     }
 
-    bool result = false;
-    if (ofs <= _downloadData->entry->size()) {
-        const uint32_t chunk = ofs / LogDownloadData::kChunkSize;
-        // qCDebug(LogDownloadControllerLog) << "Received data - Offset:" << ofs << "Chunk:" << chunk;
-        if (chunk != _downloadData->current_chunk) {
-            qCWarning(LogDownloadControllerLog) << "Ignored packet for out of order chunk actual:expected" << chunk << _downloadData->current_chunk;
-            return;
-        }
-
-        const uint16_t bin = (ofs - (chunk * LogDownloadData::kChunkSize)) / MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
-        if (bin >= _downloadData->chunk_table.size()) {
-            qCWarning(LogDownloadControllerLog) << "Out of range bin received";
-        } else {
-            _downloadData->chunk_table.setBit(bin);
-        }
+    // Data is accepted for any bin in the file, the vehicle streams the whole requested range without waiting for us
+    const uint32_t bin = ofs / MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
+    if ((bin >= _downloadData->numBins()) || ((ofs + count) > _downloadData->entry->size())) {
+        qCWarning(LogDownloadControllerLog) << "Received log offset greater than expected" << ofs;
+        return;
+    }
 
-        if (_downloadData->file.pos() != ofs) {
-            if (!_downloadData->file.seek(ofs)) {
-                qCWarning(LogDownloadControllerLog) << "Error while seeking log file offset";
-                return;
-            }
-        }
+    _retries = 0;
+    _timer->start(kTimeOutMs);
 
-        if (_downloadData->file.write(reinterpret_cast<const char*>(data), count)) {
-            _downloadData->written += count;
-            _downloadData->rate_bytes += count;
-            _updateDataRate();
-
-            result = true;
-            _retries = 0;
-
-            _timer->start(kTimeOutMs);
-            if (_logComplete()) {
-                _downloadData->entry->setStatus(tr("Downloaded"));
-                _receivedAllData();
-            } else if (_chunkComplete()) {
-                _downloadData->advanceChunk();
-                _requestLogData(_downloadData->ID,
-                                _downloadData->current_chunk * LogDownloadData::kChunkSize,
-                                _downloadData->chunk_table.size() * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN);
-            } else if ((bin < (_downloadData->chunk_table.size() - 1)) && _downloadData->chunk_table.at(bin + 1)) {
-                // Likely to be grabbing fragments and got to the end of a gap
-                _findMissingData();
-            }
-        } else {
-            qCWarning(LogDownloadControllerLog) << "Error while writing log file chunk";
-        }
-    } else {
-        qCWarning(LogDownloadControllerLog) << "Received log offset greater than expected";
+    if (_downloadData->setBinReceived(bin)) {
+        _downloadData->write(ofs, data, count);
+        _downloadData->written += count;
+        _downloadData->rate_bytes += count;
+        _updateDataRate();
     }
 
-    if (!result) {
-        _downloadData->entry->setStatus(tr("Error"));
+    if (_downloadData->complete()) {
+        _finishLogDownload();
+    } else if ((bin + 1) >= _downloadData->requestEndBin) {
+        // End of the streamed range, immediately ask for whatever was lost along the way
+        _requestMissingData();
     }
 }
 
 void LogDownloadController::_findMissingData()
 {
-    if (_logComplete()) {
-        _receivedAllData();
+    if (_downloadData->complete()) {
+        _finishLogDownload();
         return;
     }
 
-    if (_chunkComplete()) {
-        _downloadData->advanceChunk();
-    }
-
     _retries++;
 
     _updateDataRate();
 
-    uint16_t start = 0, end = 0;
-    const int size = _downloadData->chunk_table.size();
-    for (; start < size; start++) {
-        if (!_downloadData->chunk_table.testBit(start)) {
-            break;
-        }
-    }
+    _requestMissingData();
+}
 
-    for (end = start; end < size; end++) {
-        if (_downloadData->chunk_table.testBit(end)) {
-            break;
-        }
+void LogDownloadController::_requestMissingData()
+{
+    uint32_t startBin = 0;
+    uint32_t endBin = 0;
+    if (!_downloadData->nextMissingRange(startBin, endBin)) {
+        return;
     }
 
-    const uint32_t pos = (_downloadData->current_chunk * LogDownloadData::kChunkSize) + (start * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN);
-    const uint32_t len = (end - start) * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
+    _downloadData->requestEndBin = endBin;
+    _downloadData->requestedBins += endBin - startBin;
+
+    const uint32_t pos = startBin * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
+    const uint32_t len = qMin((endBin - startBin) * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN, _downloadData->entry->size() - pos);
     _requestLogData(_downloadData->ID, pos, len, _retries);
 }
 
@@ -346,21 +311,41 @@ void LogDownloadController::_updateDataRate()
     _downloadData->elapsed.start();
 }
 
-bool LogDownloadController::_chunkComplete() const
+void LogDownloadController::_finishLogDownload()
 {
-    return _downloadData->chunkEquals(true);
-}
+    _timer->stop();
 
-bool LogDownloadController::_logComplete() const
-{
-    return (_chunkComplete() && ((_downloadData->current_chunk + 1) == _downloadData->numChunks()));
+    if (!_downloadData->finishWrites()) {
+        _downloadData->entry->setStatus(tr("Error"));
+        _receivedAllData();
+        return;
+    }
+
+    const qreal seconds = qMax(_downloadData->totalElapsed.elapsed() / 1000.0, 0.001);
+    const uint32_t numBins = _downloadData->numBins();
+    const uint32_t resentBins = (_downloadData->requestedBins > numBins) ? (_downloadData->requestedBins - numBins) : 0;
+    const qreal lossPct = (numBins > 0) ? ((100.0 * resentBins) / numBins) : 0.;
+
+    qCDebug(LogDownloadControllerLog) << "Log download complete - bytes:" << _downloadData->written
+                                      << "secs:" << seconds
+                                      << "bytes/sec:" << (_downloadData->written / seconds)
+                                      << "resent bins:" << resentBins
+                                      << "duplicate bins:" << _downloadData->duplicateBins;
+
+    _downloadData->entry->setStatus(tr("Downloaded %1 in %2s (%3/s, %4% resent)")
+                                    .arg(qgcApp()->bigSizeToString(_downloadData->written))
+                                    .arg(seconds, 0, 'f', 1)
+                                    .arg(qgcApp()->bigSizeToString(static_cast<quint64>(_downloadData->written / seconds)))
+                                    .arg(lossPct, 0, 'f', 1));
+
+    _receivedAllData();
 }
 
 void LogDownloadController::_receivedAllData()
 {
     _timer->stop();
     if (_prepareLogDownload()) {
-        _requestLogData(_downloadData->ID, 0, _downloadData->chunk_table.size() * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN);
+        _requestMissingData();
         _timer->start(kTimeOutMs);
     } else {
         _resetSelection();
@@ -415,9 +400,9 @@ bool LogDownloadController::_prepareLogDownload()
     } else if (!_downloadData->file.resize(entry->size())) {
         qCWarning(LogDownloadControllerLog) << "Failed to allocate space for log file:" <<  _downloadData->filename;
     } else {
-        _downloadData->current_chunk = 0;
-        _downloadData->chunk_table = QBitArray(_downloadData->chunkBins(), false);
+        _downloadData->bin_table = QBitArray(_downloadData->numBins(), false);
         _downloadData->elapsed.start();
+        _downloadData->totalElapsed.start();
         result = true;
     }
 
@@ -462,6 +447,7 @@ void LogDownloadController::cancel()
     _receivedAllEntries();
 
     if (_downloadData) {
+        (void) _downloadData->finishWrites();
         _downloadData->entry->setStatus(QStringLiteral("Canceled"));
         if (_downloadData->file.exists()) {
             (void) _downloadData->file.remove();
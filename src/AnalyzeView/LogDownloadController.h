@@ -61,13 +61,14 @@ private slots:
     bool _getRequestingList() const { return _requestingLogEntries; }
     bool _getDownloadingLogs() const { return _downloadingLogs; }
 
-    bool _chunkComplete() const;
     bool _entriesComplete() const;
-    bool _logComplete() const;
     bool _prepareLogDownload();
     void _downloadToDirectory(const QString &dir);
     void _findMissingData();
     void _findMissingEntries();
+    void _finishLogDownload();
+    /// Requests the next coalesced range of missing bins as a single streamed LOG_REQUEST_DATA
+    void _requestMissingData();
     void _receivedAllData();
     void _receivedAllEntries();
     void _requestLogData(uint16_t id, uint32_t offset, uint32_t count, int retryCount = 0);
@@ -20,34 +20,107 @@ LogDownloadData::LogDownloadData(QGCLogEntry * const entry)
     , entry(entry)
 {
     // qCDebug(LogEntryLog) << Q_FUNC_INFO << this;
+
+    _writerPool.setMaxThreadCount(1);
+    _writerPool.setObjectName("LogDownloadWriter");
 }
 
 LogDownloadData::~LogDownloadData()
 {
+    _writerPool.waitForDone();
+
     // qCDebug(LogEntryLog) << Q_FUNC_INFO << this;
 }
 
-void LogDownloadData::advanceChunk()
+uint32_t LogDownloadData::numBins() const
 {
-    ++current_chunk;
-    chunk_table = QBitArray(chunkBins(), false);
+    const qreal num = static_cast<qreal>(entry->size()) / static_cast<qreal>(MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN);
+    return qCeil(num);
 }
 
-uint32_t LogDownloadData::chunkBins() const
+bool LogDownloadData::setBinReceived(uint32_t bin)
 {
-    const qreal num = static_cast<qreal>((entry->size() - (current_chunk * kChunkSize))) / static_cast<qreal>(MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN);
-    return qMin(static_cast<uint32_t>(qCeil(num)), kTableBins);
+    if (bin_table.testBit(bin)) {
+        duplicateBins++;
+        return false;
+    }
+
+    bin_table.setBit(bin);
+    binsReceived++;
+    return true;
 }
 
-uint32_t LogDownloadData::numChunks() const
+bool LogDownloadData::nextMissingRange(uint32_t &startBin, uint32_t &endBin) const
 {
-    const qreal num = static_cast<qreal>(entry->size()) / static_cast<qreal>(kChunkSize);
-    return qCeil(num);
+    const uint32_t bins = static_cast<uint32_t>(bin_table.size());
+
+    uint32_t start = 0;
+    while ((start < bins) && bin_table.testBit(start)) {
+        start++;
+    }
+
+    if (start >= bins) {
+        return false;
+    }
+
+    uint32_t lastMissing = start;
+    for (uint32_t bin = start + 1; bin < bins; bin++) {
+        if (!bin_table.testBit(bin)) {
+            lastMissing = bin;
+        } else if ((bin - lastMissing) > kCoalesceBins) {
+            break;
+        }
+    }
+
+    startBin = start;
+    endBin = lastMissing + 1;
+    return true;
 }
 
-bool LogDownloadData::chunkEquals(const bool val) const
+void LogDownloadData::write(uint32_t offset, const uint8_t *data, uint8_t count)
 {
-    return (chunk_table == QBitArray(chunk_table.size(), val));
+    if (!_writeBuffer.isEmpty() && (offset != (_writeBufferOffset + _writeBuffer.size()))) {
+        _flushWriteBuffer();
+    }
+
+    if (_writeBuffer.isEmpty()) {
+        _writeBufferOffset = offset;
+    }
+    (void) _writeBuffer.append(reinterpret_cast<const char*>(data), count);
+
+    if (_writeBuffer.size() >= kWriteBlockSize) {
+        _flushWriteBuffer();
+    }
+}
+
+void LogDownloadData::_flushWriteBuffer()
+{
+    if (_writeBuffer.isEmpty()) {
+        return;
+    }
+
+    const QByteArray block = std::move(_writeBuffer);
+    const uint32_t offset = _writeBufferOffset;
+    _writeBuffer.clear();
+
+    _writerPool.start([this, block, offset]() {
+        if (!file.seek(offset) || (file.write(block) != block.size())) {
+            qCWarning(LogEntryLog) << "Error while writing log file block" << offset << file.errorString();
+            _writeError = true;
+        }
+    });
+}
+
+bool LogDownloadData::finishWrites()
+{
+    _flushWriteBuffer();
+    _writerPool.waitForDone();
+
+    if (file.isOpen()) {
+        (void) file.flush();
+    }
+
+    return !_writeError;
 }
 
 /*===========================================================================*/
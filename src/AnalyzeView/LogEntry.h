@@ -15,10 +15,13 @@
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QThreadPool>
 #include <QtQmlIntegration/QtQmlIntegration>
 
 #include "MAVLinkLib.h"
 
+#include <atomic>
+
 class QGCLogEntry;
 
 Q_DECLARE_LOGGING_CATEGORY(LogEntryLog)
@@ -28,31 +31,56 @@ struct LogDownloadData
     explicit LogDownloadData(QGCLogEntry * const entry);
     ~LogDownloadData();
 
-    void advanceChunk();
+    /// The number of MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN bins in the file
+    uint32_t numBins() const;
+
+    /// True if every bin in the file has been received
+    bool complete() const { return (binsReceived == numBins()); }
+
+    /// Marks a bin as received
+    ///     @return false if the bin was already received
+    bool setBinReceived(uint32_t bin);
 
-    /// The number of MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN bins in the current chunk
-    uint32_t chunkBins() const;
+    /// Finds the first range of missing bins. Gaps separated by fewer than kCoalesceBins received bins are
+    /// merged into a single range since re-sending a few bins is cheaper than another request round trip.
+    ///     @param[out] startBin First missing bin
+    ///     @param[out] endBin One past the last missing bin of the range
+    ///     @return false if no bins are missing
+    bool nextMissingRange(uint32_t &startBin, uint32_t &endBin) const;
 
-    /// The number of kChunkSize chunks in the file
-    uint32_t numChunks() const;
+    /// Queues data for the background writer. Contiguous data is batched into kWriteBlockSize blocks.
+    void write(uint32_t offset, const uint8_t *data, uint8_t count);
 
-    /// True if all bins in the chunk have been set to val
-    bool chunkEquals(const bool val) const;
+    /// Flushes all queued data and waits for the background writer to finish
+    ///     @return false if any write failed
+    bool finishWrites();
 
     uint ID = 0;
     QGCLogEntry *const entry = nullptr;
 
-    QBitArray chunk_table;
-    uint32_t current_chunk = 0;
+    QBitArray bin_table;            ///< One bit per bin for the whole file
+    uint32_t binsReceived = 0;
+    uint32_t requestEndBin = 0;     ///< One past the last bin of the outstanding LOG_REQUEST_DATA
+    uint32_t requestedBins = 0;     ///< Total bins requested including re-requests
+    uint32_t duplicateBins = 0;     ///< Bins received more than once
     QFile file;
     QString filename;
     uint written = 0;
     size_t rate_bytes = 0;
     qreal rate_avg = 0.;
     QElapsedTimer elapsed;
+    QElapsedTimer totalElapsed;
+
+    static constexpr uint32_t kCoalesceBins = 64;
+    static constexpr qsizetype kWriteBlockSize = 64 * 1024;
+
+private:
+    void _flushWriteBuffer();
 
-    static constexpr uint32_t kTableBins = 512;
-    static constexpr uint32_t kChunkSize = kTableBins * MAVLINK_MSG_LOG_DATA_FIELD_DATA_LEN;
+    QByteArray _writeBuffer;
+    uint32_t _writeBufferOffset = 0;
+    QThreadPool _writerPool;                ///< Single thread so writes stay ordered
+    std::atomic<bool> _writeError = false;
 };
 
 /*===========================================================================*/
@@ -43,6 +43,7 @@ MAVLinkInspectorController::Range_st::Range_st(const QString &label_, qreal rang
 MAVLinkInspectorController::MAVLinkInspectorController(QObject *parent)
     : QObject(parent)
     , _updateFrequencyTimer(new QTimer(this))
+    , _updateFieldsTimer(new QTimer(this))
     , _systems(new QmlObjectListModel(this))
 {
     // qCDebug(MAVLinkInspectorControllerLog) << Q_FUNC_INFO << this;
@@ -60,6 +61,11 @@ MAVLinkInspectorController::MAVLinkInspectorController(QObject *parent)
     _updateFrequencyTimer->setSingleShot(false);
     _updateFrequencyTimer->start();
 
+    (void) connect(_updateFieldsTimer, &QTimer::timeout, this, &MAVLinkInspectorController::_refreshFields);
+    _updateFieldsTimer->setInterval(kUpdateFieldsMsecs);
+    _updateFieldsTimer->setSingleShot(false);
+    _updateFieldsTimer->start();
+
     _timeScaleSt.append(new TimeScale_st(tr("5 Sec"),   5 * 1000));
     _timeScaleSt.append(new TimeScale_st(tr("10 Sec"), 10 * 1000));
     _timeScaleSt.append(new TimeScale_st(tr("30 Sec"), 30 * 1000));
@@ -155,12 +161,24 @@ void MAVLinkInspectorController::_refreshFrequency()
     }
 }
 
+void MAVLinkInspectorController::_refreshFields()
+{
+    if (!_activeSystem) {
+        return;
+    }
+
+    QGCMAVLinkMessage *const msg = _activeSystem->selectedMsg();
+    if (msg) {
+        msg->refreshFields();
+    }
+}
+
 void MAVLinkInspectorController::_vehicleAdded(Vehicle *vehicle)
 {
     QGCMAVLinkSystem *sys = _findVehicle(static_cast<uint8_t>(vehicle->id()));
 
     if (sys) {
-        sys->messages()->clearAndDeleteContents();
+        sys->clearMessages();
     } else {
         sys = new QGCMAVLinkSystem(static_cast<uint8_t>(vehicle->id()), this);
         _systems->append(sys);
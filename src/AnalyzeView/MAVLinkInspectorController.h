@@ -82,6 +82,7 @@ class MAVLinkInspectorController : public QObject
 private slots:
     void _receiveMessage(LinkInterface *link, const mavlink_message_t &message);
     void _refreshFrequency();
+    void _refreshFields();
     void _setActiveVehicle(Vehicle *vehicle);
     void _vehicleAdded(Vehicle *vehicle);
     void _vehicleRemoved(const Vehicle *vehicle);
@@ -98,5 +99,8 @@ private slots:
     QList<Range_st*> _rangeSt;
     QGCMAVLinkSystem *_activeSystem = nullptr;
     QTimer *_updateFrequencyTimer = nullptr;
+    QTimer *_updateFieldsTimer = nullptr;
     QmlObjectListModel *_systems = nullptr;     ///< List of QGCMAVLinkSystem
+
+    static constexpr int kUpdateFieldsMsecs = 100;  ///< Display rate for decoding the shown message
 };
@@ -32,7 +32,27 @@ QGCMAVLinkMessage::QGCMAVLinkMessage(const mavlink_message_t &message, QObject *
 
     _name = QString(msgInfo->name);
     qCDebug(MAVLinkMessageLog) << "New Message:" << _name;
+}
+
+QGCMAVLinkMessage::~QGCMAVLinkMessage()
+{
+    _fields->clearAndDeleteContents();
+
+    qCDebug(MAVLinkMessageLog) << this;
+}
 
+void QGCMAVLinkMessage::_buildFields()
+{
+    if (_fields->count() > 0) {
+        return;
+    }
+
+    const mavlink_message_info_t *const msgInfo = mavlink_get_message_info(&_message);
+    if (!msgInfo) {
+        return;
+    }
+
+    // Field objects are only created once the message is shown, most received messages never are
     for (unsigned int i = 0; i < msgInfo->num_fields; ++i) {
         QString type = QStringLiteral("?");
         switch (msgInfo->fields[i].type) {
@@ -54,13 +74,6 @@ QGCMAVLinkMessage::QGCMAVLinkMessage(const mavlink_message_t &message, QObject *
     }
 }
 
-QGCMAVLinkMessage::~QGCMAVLinkMessage()
-{
-    _fields->clearAndDeleteContents();
-
-    qCDebug(MAVLinkMessageLog) << this;
-}
-
 void QGCMAVLinkMessage::updateFieldSelection()
 {
     bool sel = false;
@@ -88,13 +101,21 @@ void QGCMAVLinkMessage::updateFreq()
     if (_actualRateHz != lastRateHz) {
         emit actualRateHzChanged();
     }
+
+    if (_countDirty) {
+        _countDirty = false;
+        emit countChanged();
+    }
 }
 
 void QGCMAVLinkMessage::setSelected(bool sel)
 {
     if (sel != _selected) {
         _selected = sel;
-        _updateFields();
+        if (_selected) {
+            _buildFields();
+            _updateFields();
+        }
         emit selectedChanged();
     }
 }
@@ -111,16 +132,70 @@ void QGCMAVLinkMessage::update(const mavlink_message_t &message)
 {
     _count++;
     _message = message;
+    _countDirty = true;
 
-    if (_selected || _fieldSelected) {
-        // Don't update field info unless selected to reduce perf hit of message processing
+    if (_selected) {
+        _fieldsDirty = true;
+    }
+
+    if (_fieldSelected) {
+        // Charts need every sample, but only the charted fields are decoded and no strings are built
+        _updateChartedFields();
+    }
+}
+
+void QGCMAVLinkMessage::refreshFields()
+{
+    if (_countDirty) {
+        _countDirty = false;
+        emit countChanged();
+    }
+
+    if (_selected && _fieldsDirty) {
         _updateFields();
     }
-    emit countChanged();
+}
+
+void QGCMAVLinkMessage::_updateChartedFields()
+{
+    const mavlink_message_info_t *const msgInfo = mavlink_get_message_info(&_message);
+    if (!msgInfo || (_fields->count() != static_cast<int>(msgInfo->num_fields))) {
+        return;
+    }
+
+    const uint8_t *const msg = reinterpret_cast<const uint8_t*>(&_message.payload64[0]);
+    for (unsigned int i = 0; i < msgInfo->num_fields; ++i) {
+        QGCMAVLinkMessageField *const field = qobject_cast<QGCMAVLinkMessageField*>(_fields->get(static_cast<int>(i)));
+        if (!field || !field->selected()) {
+            continue;
+        }
+
+        // Arrays are charted using their first element
+        const uint8_t *const data = msg + msgInfo->fields[i].wire_offset;
+        qreal v = 0;
+        switch (msgInfo->fields[i].type) {
+        case MAVLINK_TYPE_UINT8_T:  v = static_cast<qreal>(*data); break;
+        case MAVLINK_TYPE_INT8_T:   v = static_cast<qreal>(*reinterpret_cast<const int8_t*>(data)); break;
+        case MAVLINK_TYPE_UINT16_T: { uint16_t n; (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_INT16_T:  { int16_t n;  (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_UINT32_T: { uint32_t n; (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_INT32_T:  { int32_t n;  (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_FLOAT:    { float n;    (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_DOUBLE:   { double n;   (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_UINT64_T: { uint64_t n; (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        case MAVLINK_TYPE_INT64_T:  { int64_t n;  (void) memcpy(&n, data, sizeof(n)); v = static_cast<qreal>(n); break; }
+        default:
+            continue;
+        }
+
+        field->appendSample(v);
+    }
 }
 
 void QGCMAVLinkMessage::_updateFields()
 {
+    _fieldsDirty = false;
+
     const mavlink_message_info_t *msgInfo = mavlink_get_message_info(&_message);
     if (!msgInfo) {
         qCWarning(MAVLinkMessageLog) << "QGCMAVLinkMessage::update NULL msgInfo msgid" << _message.msgid;
@@ -150,11 +225,11 @@ void QGCMAVLinkMessage::_updateFields()
                 char *const str = reinterpret_cast<char*>(msg + offset);
                 str[array_length - 1] = '\0';
                 const QString v(str);
-                field->updateValue(v, 0);
+                field->updateValue(v);
             } else {
                 char b = *(reinterpret_cast<char*>(msg + offset));
                 const QString v(b);
-                field->updateValue(v, 0);
+                field->updateValue(v);
             }
             break;
         case MAVLINK_TYPE_UINT8_T:
@@ -166,10 +241,10 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 const uint8_t u = *(msg + offset);
-                field->updateValue(QString::number(u), static_cast<qreal>(u));
+                field->updateValue(QString::number(u));
             }
             break;
         case MAVLINK_TYPE_INT8_T:
@@ -181,10 +256,10 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 const int8_t n = *(reinterpret_cast<int8_t*>(msg + offset));
-                field->updateValue(QString::number(n), static_cast<qreal>(n));
+                field->updateValue(QString::number(n));
             }
             break;
         case MAVLINK_TYPE_UINT16_T:
@@ -197,11 +272,11 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 uint16_t n = 0;
                 (void) memcpy(&n, msg + offset, sizeof(uint16_t));
-                field->updateValue(QString::number(n), static_cast<qreal>(n));
+                field->updateValue(QString::number(n));
             }
             break;
         case MAVLINK_TYPE_INT16_T:
@@ -214,11 +289,11 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 int16_t n;
                 memcpy(&n, msg + offset, sizeof(int16_t));
-                field->updateValue(QString::number(n), static_cast<qreal>(n));
+                field->updateValue(QString::number(n));
             }
             break;
         case MAVLINK_TYPE_UINT32_T:
@@ -231,15 +306,15 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 uint32_t n;
                 (void) memcpy(&n, msg + offset, sizeof(uint32_t));
                 if (_message.msgid == MAVLINK_MSG_ID_SYSTEM_TIME) {
                     const QDateTime d = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(n), QTimeZone::utc());
-                    field->updateValue(d.toString("HH:mm:ss"), static_cast<qreal>(n));
+                    field->updateValue(d.toString("HH:mm:ss"));
                 } else {
-                    field->updateValue(QString::number(n), static_cast<qreal>(n));
+                    field->updateValue(QString::number(n));
                 }
             }
             break;
@@ -253,11 +328,11 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 int32_t n;
                 (void) memcpy(&n, msg + offset, sizeof(int32_t));
-                field->updateValue(QString::number(n), static_cast<qreal>(n));
+                field->updateValue(QString::number(n));
             }
             break;
         case MAVLINK_TYPE_FLOAT:
@@ -270,11 +345,11 @@ void QGCMAVLinkMessage::_updateFields()
                    string += tmp.arg(static_cast<double>(nums[j]));
                 }
                 string += QString::number(static_cast<double>(nums[array_length - 1]));
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 float fv;
                 (void) memcpy(&fv, msg + offset, sizeof(float));
-                field->updateValue(QString::number(static_cast<double>(fv)), static_cast<qreal>(fv));
+                field->updateValue(QString::number(static_cast<double>(fv)));
             }
             break;
         case MAVLINK_TYPE_DOUBLE:
@@ -287,11 +362,11 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(static_cast<double>(nums[array_length - 1]));
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 double d;
                 (void) memcpy(&d, msg + offset, sizeof(double));
-                field->updateValue(QString::number(d), static_cast<qreal>(d));
+                field->updateValue(QString::number(d));
             }
             break;
         case MAVLINK_TYPE_UINT64_T:
@@ -304,15 +379,15 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 uint64_t n;
                 (void) memcpy(&n, msg + offset, sizeof(uint64_t));
                 if(_message.msgid == MAVLINK_MSG_ID_SYSTEM_TIME) {
                     const QDateTime d = QDateTime::fromMSecsSinceEpoch(n / 1000, QTimeZone::utc());
-                    field->updateValue(d.toString("yyyy MM dd HH:mm:ss"), static_cast<qreal>(n));
+                    field->updateValue(d.toString("yyyy MM dd HH:mm:ss"));
                 } else {
-                    field->updateValue(QString::number(n), static_cast<qreal>(n));
+                    field->updateValue(QString::number(n));
                 }
             }
             break;
@@ -326,11 +401,11 @@ void QGCMAVLinkMessage::_updateFields()
                     string += tmp.arg(nums[j]);
                 }
                 string += QString::number(nums[array_length - 1]);
-                field->updateValue(string, static_cast<qreal>(nums[0]));
+                field->updateValue(string);
             } else {
                 int64_t n;
                 (void) memcpy(&n, msg + offset, sizeof(int64_t));
-                field->updateValue(QString::number(n), static_cast<qreal>(n));
+                field->updateValue(QString::number(n));
             }
             break;
         default:
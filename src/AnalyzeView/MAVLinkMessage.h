@@ -53,7 +53,12 @@ class QGCMAVLinkMessage : public QObject
     bool selected() const { return _selected; }
 
     void updateFieldSelection();
+    /// Receive path: only records the count and latest raw payload. Charted fields are sampled here,
+    /// everything else is decoded later from refreshFields().
     void update(const mavlink_message_t &message);
+    /// Decodes and formats all fields if a newer payload arrived since the last refresh.
+    /// Called at display rate for the message currently shown in the inspector.
+    void refreshFields();
     void updateFreq();
     void setSelected(bool sel);
     void setTargetRateHz(int32_t rate);
@@ -66,7 +71,9 @@ class QGCMAVLinkMessage : public QObject
     void selectedChanged();
 
 private:
+    void _buildFields();
     void _updateFields();
+    void _updateChartedFields();
 
     mavlink_message_t _message{};
     QmlObjectListModel *_fields = nullptr;
@@ -77,4 +84,6 @@ class QGCMAVLinkMessage : public QObject
     uint64_t _lastCount = 0;
     bool _fieldSelected = false;
     bool _selected = false;
+    bool _fieldsDirty = false;      ///< Latest payload has not been decoded into _fields yet
+    bool _countDirty = false;       ///< countChanged has not been signalled for latest payload
 };
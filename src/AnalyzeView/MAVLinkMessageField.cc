@@ -85,13 +85,16 @@ int QGCMAVLinkMessageField::chartIndex() const
     return 0;
 }
 
-void QGCMAVLinkMessageField::updateValue(const QString &newValue, qreal v)
+void QGCMAVLinkMessageField::updateValue(const QString &newValue)
 {
     if (_value != newValue) {
         _value = newValue;
         emit valueChanged();
     }
+}
 
+void QGCMAVLinkMessageField::appendSample(qreal v)
+{
     if (!_pSeries || !_chartController) {
         return;
     }
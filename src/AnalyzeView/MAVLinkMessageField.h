@@ -51,7 +51,10 @@ class QGCMAVLinkMessageField : public QObject
     int chartIndex() const;
 
     void setSelectable(bool sel);
-    void updateValue(const QString &newValue, qreal v);
+    /// Updates the displayed string value. Only called for the message currently shown in the inspector.
+    void updateValue(const QString &newValue);
+    /// Appends a chart sample. Only called while the field is charted.
+    void appendSample(qreal v);
 
     void addSeries(MAVLinkChartController *chartController, QAbstractSeries *series);
     void delSeries();
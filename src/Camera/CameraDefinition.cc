@@ -0,0 +1,469 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "CameraDefinition.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QXmlStreamReader>
+
+QGC_LOGGING_CATEGORY(CameraDefinitionLog, "Camera.CameraDefinition")
+
+namespace
+{
+
+constexpr quint32 kCacheMagic = 0x51434446; // "QCDF"
+constexpr quint32 kCacheFormatVersion = 1;  ///< Bump when the serialized layout changes
+
+bool readAttribute(const QXmlStreamReader &xml, QLatin1StringView name, QString &target)
+{
+    const QXmlStreamAttributes attributes = xml.attributes();
+    if (!attributes.hasAttribute(name)) {
+        return false;
+    }
+
+    target = attributes.value(name).toString();
+    return true;
+}
+
+/// Reads the non-empty texts of the named child elements, skipping anything else
+QStringList readTextList(QXmlStreamReader &xml, QLatin1StringView childName)
+{
+    QStringList texts;
+    while (xml.readNextStartElement()) {
+        if (xml.name() == childName) {
+            const QString text = xml.readElementText(QXmlStreamReader::IncludeChildElements);
+            if (!text.isEmpty()) {
+                texts.append(text);
+            }
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    return texts;
+}
+
+bool parseRanges(QXmlStreamReader &xml, const QString &factName, QList<CameraDefinition::Range> &ranges, QString &errorString)
+{
+    while (xml.readNextStartElement()) {
+        if (xml.name() != QLatin1StringView("parameterrange")) {
+            xml.skipCurrentElement();
+            continue;
+        }
+
+        CameraDefinition::Range range;
+        if (!readAttribute(xml, QLatin1StringView("parameter"), range.parameter)) {
+            errorString = QStringLiteral("Malformed option range for parameter %1").arg(factName);
+            return false;
+        }
+        (void) readAttribute(xml, QLatin1StringView("condition"), range.condition);
+
+        while (xml.readNextStartElement()) {
+            if (xml.name() != QLatin1StringView("roption")) {
+                xml.skipCurrentElement();
+                continue;
+            }
+
+            QString optName;
+            QString optValue;
+            if (!readAttribute(xml, QLatin1StringView("name"), optName)) {
+                errorString = QStringLiteral("Malformed roption for parameter %1").arg(factName);
+                return false;
+            }
+            if (!readAttribute(xml, QLatin1StringView("value"), optValue)) {
+                errorString = QStringLiteral("Malformed rvalue for parameter %1").arg(factName);
+                return false;
+            }
+            range.optNames.append(optName);
+            range.optValues.append(optValue);
+            xml.skipCurrentElement();
+        }
+
+        if (!range.optNames.isEmpty()) {
+            ranges.append(range);
+        }
+    }
+
+    return true;
+}
+
+bool parseOptions(QXmlStreamReader &xml, const QString &factName, QList<CameraDefinition::Option> &options, QString &errorString)
+{
+    while (xml.readNextStartElement()) {
+        if (xml.name() != QLatin1StringView("option")) {
+            xml.skipCurrentElement();
+            continue;
+        }
+
+        CameraDefinition::Option option;
+        if (!readAttribute(xml, QLatin1StringView("name"), option.name)) {
+            errorString = QStringLiteral("Malformed option for parameter %1").arg(factName);
+            return false;
+        }
+        if (!readAttribute(xml, QLatin1StringView("value"), option.value)) {
+            errorString = QStringLiteral("Malformed value for parameter %1").arg(factName);
+            return false;
+        }
+
+        bool haveExclusions = false;
+        bool haveRanges = false;
+        while (xml.readNextStartElement()) {
+            if ((xml.name() == QLatin1StringView("exclusions")) && !haveExclusions) {
+                haveExclusions = true;
+                option.exclusions = readTextList(xml, QLatin1StringView("exclude"));
+            } else if ((xml.name() == QLatin1StringView("parameterranges")) && !haveRanges) {
+                haveRanges = true;
+                if (!parseRanges(xml, factName, option.ranges, errorString)) {
+                    return false;
+                }
+            } else {
+                xml.skipCurrentElement();
+            }
+        }
+
+        options.append(option);
+    }
+
+    return true;
+}
+
+bool parseParameter(QXmlStreamReader &xml, CameraDefinition::Parameter &parameter, QString &errorString)
+{
+    for (const QXmlStreamAttribute &attribute : xml.attributes()) {
+        parameter.attributes.insert(attribute.name().toString(), attribute.value().toString());
+    }
+
+    const QString factName = parameter.attributes.value(QStringLiteral("name"));
+    if (!parameter.attributes.contains(QStringLiteral("name"))) {
+        errorString = QStringLiteral("Parameter entry missing parameter name");
+        return false;
+    }
+
+    bool haveDescription = false;
+    bool haveUpdates = false;
+    bool haveOptions = false;
+    while (xml.readNextStartElement()) {
+        if ((xml.name() == QLatin1StringView("description")) && !haveDescription) {
+            haveDescription = true;
+            parameter.description = xml.readElementText(QXmlStreamReader::IncludeChildElements);
+        } else if ((xml.name() == QLatin1StringView("updates")) && !haveUpdates) {
+            haveUpdates = true;
+            parameter.updates = readTextList(xml, QLatin1StringView("update"));
+        } else if ((xml.name() == QLatin1StringView("options")) && !haveOptions) {
+            haveOptions = true;
+            if (!parseOptions(xml, factName, parameter.options, errorString)) {
+                return false;
+            }
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    if (!haveDescription) {
+        errorString = QStringLiteral("Parameter %1 missing parameter description").arg(factName);
+        return false;
+    }
+
+    return true;
+}
+
+bool parseDefinition(QXmlStreamReader &xml, CameraDefinition &definition, QString &errorString)
+{
+    QString version;
+    if (!readAttribute(xml, QLatin1StringView("version"), version)) {
+        errorString = QStringLiteral("Camera definition missing version");
+        return false;
+    }
+    definition.version = version.toInt();
+
+    bool haveModel = false;
+    bool haveVendor = false;
+    while (xml.readNextStartElement()) {
+        if ((xml.name() == QLatin1StringView("model")) && !haveModel) {
+            haveModel = true;
+            definition.model = xml.readElementText(QXmlStreamReader::IncludeChildElements);
+        } else if ((xml.name() == QLatin1StringView("vendor")) && !haveVendor) {
+            haveVendor = true;
+            definition.vendor = xml.readElementText(QXmlStreamReader::IncludeChildElements);
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    if (!haveModel || !haveVendor) {
+        errorString = QStringLiteral("Camera definition missing model or vendor");
+        return false;
+    }
+
+    return true;
+}
+
+void parseLocalization(QXmlStreamReader &xml, QList<CameraDefinition::Locale> &locales)
+{
+    while (xml.readNextStartElement()) {
+        if (xml.name() != QLatin1StringView("locale")) {
+            xml.skipCurrentElement();
+            continue;
+        }
+
+        CameraDefinition::Locale locale;
+        if (!readAttribute(xml, QLatin1StringView("name"), locale.name)) {
+            qCWarning(CameraDefinitionLog) << "Localization entry is missing its name attribute";
+            xml.skipCurrentElement();
+            continue;
+        }
+
+        while (xml.readNextStartElement()) {
+            QString original;
+            QString translated;
+            if ((xml.name() == QLatin1StringView("strings")) &&
+                readAttribute(xml, QLatin1StringView("original"), original) &&
+                readAttribute(xml, QLatin1StringView("translated"), translated)) {
+                locale.strings.append({ original, translated });
+            }
+            xml.skipCurrentElement();
+        }
+
+        locales.append(locale);
+    }
+}
+
+} // namespace
+
+// Kept at global scope so the QList stream operators find them through argument dependent lookup
+static QDataStream &operator<<(QDataStream &stream, const CameraDefinition::Range &range)
+{
+    return stream << range.parameter << range.condition << range.optNames << range.optValues;
+}
+
+static QDataStream &operator>>(QDataStream &stream, CameraDefinition::Range &range)
+{
+    return stream >> range.parameter >> range.condition >> range.optNames >> range.optValues;
+}
+
+static QDataStream &operator<<(QDataStream &stream, const CameraDefinition::Option &option)
+{
+    return stream << option.name << option.value << option.exclusions << option.ranges;
+}
+
+static QDataStream &operator>>(QDataStream &stream, CameraDefinition::Option &option)
+{
+    return stream >> option.name >> option.value >> option.exclusions >> option.ranges;
+}
+
+static QDataStream &operator<<(QDataStream &stream, const CameraDefinition::Parameter &parameter)
+{
+    return stream << parameter.attributes << parameter.description << parameter.updates << parameter.options;
+}
+
+static QDataStream &operator>>(QDataStream &stream, CameraDefinition::Parameter &parameter)
+{
+    return stream >> parameter.attributes >> parameter.description >> parameter.updates >> parameter.options;
+}
+
+static QDataStream &operator<<(QDataStream &stream, const CameraDefinition::Locale &locale)
+{
+    return stream << locale.name << locale.strings;
+}
+
+static QDataStream &operator>>(QDataStream &stream, CameraDefinition::Locale &locale)
+{
+    return stream >> locale.name >> locale.strings;
+}
+
+bool CameraDefinition::parse(const QByteArray &xmlBytes, QString &errorString)
+{
+    *this = CameraDefinition();
+
+    // Like the spec only the first <definition>, <parameters> and <localization> elements are used, wherever they are
+    bool haveDefinition = false;
+    bool haveLocalization = false;
+
+    QXmlStreamReader xml(xmlBytes);
+    while (!xml.atEnd()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+
+        if ((xml.name() == QLatin1StringView("definition")) && !haveDefinition) {
+            haveDefinition = true;
+            if (!parseDefinition(xml, *this, errorString)) {
+                return false;
+            }
+        } else if ((xml.name() == QLatin1StringView("parameters")) && !hasParameters) {
+            hasParameters = true;
+            while (xml.readNextStartElement()) {
+                if (xml.name() != QLatin1StringView("parameter")) {
+                    xml.skipCurrentElement();
+                    continue;
+                }
+
+                Parameter parameter;
+                if (!parseParameter(xml, parameter, errorString)) {
+                    return false;
+                }
+                parameters.append(parameter);
+            }
+        } else if ((xml.name() == QLatin1StringView("localization")) && !haveLocalization) {
+            haveLocalization = true;
+            parseLocalization(xml, locales);
+        }
+    }
+
+    if (xml.hasError()) {
+        errorString = QStringLiteral("Unable to parse camera definition file on line %1: %2").arg(xml.lineNumber()).arg(xml.errorString());
+        return false;
+    }
+    if (!haveDefinition) {
+        errorString = QStringLiteral("Unable to load camera constants from camera definition");
+        return false;
+    }
+
+    return true;
+}
+
+void CameraDefinition::localize(const QString &localeName)
+{
+    const QString name = localeName.toLower().replace(QLatin1Char('-'), QLatin1Char('_'));
+    if ((name == QStringLiteral("en_us")) || locales.isEmpty()) {
+        return;
+    }
+
+    // Direct match first, otherwise the first locale for the same language
+    const Locale *locale = nullptr;
+    for (const Locale &candidate : std::as_const(locales)) {
+        if (candidate.name.toLower().replace(QLatin1Char('-'), QLatin1Char('_')) == name) {
+            locale = &candidate;
+            break;
+        }
+    }
+    if (!locale) {
+        const QString language = name.left(3);
+        for (const Locale &candidate : std::as_const(locales)) {
+            if (candidate.name.toLower().startsWith(language)) {
+                locale = &candidate;
+                break;
+            }
+        }
+    }
+    if (!locale) {
+        qCWarning(CameraDefinitionLog) << "No match for" << localeName << "in camera definition file";
+        return;
+    }
+
+    QHash<QString, QString> translations;
+    for (const QPair<QString, QString> &string : locale->strings) {
+        if (!translations.contains(string.first)) {
+            translations.insert(string.first, string.second);
+        }
+    }
+
+    const auto translate = [&translations](QString &text) {
+        const auto it = translations.constFind(text);
+        if (it != translations.cend()) {
+            text = it.value();
+        }
+    };
+    const auto translateList = [&translate](QStringList &texts) {
+        for (QString &text : texts) {
+            translate(text);
+        }
+    };
+
+    translate(model);
+    translate(vendor);
+    for (Parameter &parameter : parameters) {
+        for (QString &value : parameter.attributes) {
+            translate(value);
+        }
+        translate(parameter.description);
+        translateList(parameter.updates);
+        for (Option &option : parameter.options) {
+            translate(option.name);
+            translate(option.value);
+            translateList(option.exclusions);
+            for (Range &range : option.ranges) {
+                translate(range.parameter);
+                translate(range.condition);
+                translateList(range.optNames);
+                translateList(range.optValues);
+            }
+        }
+    }
+}
+
+bool CameraDefinition::save(const QString &fileName) const
+{
+    if (!QDir().mkpath(QFileInfo(fileName).absolutePath())) {
+        qCWarning(CameraDefinitionLog) << "Could not create cache directory for" << fileName;
+        return false;
+    }
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(CameraDefinitionLog) << "Could not save cache file" << fileName << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << kCacheMagic << kCacheFormatVersion;
+    stream << static_cast<qint32>(version) << model << vendor << hasParameters << parameters << locales;
+
+    return ((stream.status() == QDataStream::Ok) && file.commit());
+}
+
+bool CameraDefinition::load(const QString &fileName)
+{
+    *this = CameraDefinition();
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 formatVersion = 0;
+    stream >> magic >> formatVersion;
+    if ((magic != kCacheMagic) || (formatVersion != kCacheFormatVersion)) {
+        qCDebug(CameraDefinitionLog) << "Ignoring cache file with unknown format" << fileName;
+        return false;
+    }
+
+    qint32 cachedVersion = 0;
+    stream >> cachedVersion >> model >> vendor >> hasParameters >> parameters >> locales;
+    version = cachedVersion;
+
+    if (stream.status() != QDataStream::Ok) {
+        *this = CameraDefinition();
+        return false;
+    }
+
+    return true;
+}
+
+QString CameraDefinition::cacheFileName(const QString &uri, int version)
+{
+    const QByteArray uriHash = QCryptographicHash::hash(uri.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+    return QStringLiteral("%1/QGCCameraDefinitionCache/%2_%3.bin")
+        .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation), QString::fromLatin1(uriHash))
+        .arg(version, 3, 10, QLatin1Char('0'));
+}
@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+Q_DECLARE_LOGGING_CATEGORY(CameraDefinitionLog)
+
+/// Contents of a MAVLink camera definition file. Parsed with a streaming reader so it can be built off the main
+/// thread, and serialized to a binary cache so the xml is only downloaded and parsed once per uri and version.
+struct CameraDefinition
+{
+    /// <parameterrange>: limits the options of another parameter while the owning option is selected
+    struct Range {
+        QString parameter;
+        QString condition;
+        QStringList optNames;
+        QStringList optValues;
+    };
+
+    /// <option>
+    struct Option {
+        QString name;
+        QString value;
+        QStringList exclusions;
+        QList<Range> ranges;
+    };
+
+    /// <parameter>
+    struct Parameter {
+        QMap<QString, QString> attributes;  ///< All attributes of the element: name, type, default, min, max...
+        QString description;
+        QStringList updates;
+        QList<Option> options;
+    };
+
+    /// <locale>: original to translated string pairs
+    struct Locale {
+        QString name;
+        QList<QPair<QString, QString>> strings;
+    };
+
+    /// Parses the camera definition xml
+    ///     @return false: definition is invalid, errorString has the reason
+    bool parse(const QByteArray &xml, QString &errorString);
+
+    /// Replaces strings with the translations for the locale, if the definition has any. Whole attribute values and
+    /// element texts are matched just like the translation rules in the definition spec.
+    ///     @param localeName Locale name such as "de_DE"
+    void localize(const QString &localeName);
+
+    /// Writes the parsed definition to a binary cache file
+    bool save(const QString &fileName) const;
+    /// Reads a definition from a cache file written by save
+    bool load(const QString &fileName);
+
+    /// @return Cache file for the definition identified by the CAMERA_INFORMATION definition uri and version
+    static QString cacheFileName(const QString &uri, int version);
+
+    int version = 0;
+    QString model;
+    QString vendor;
+    bool hasParameters = false;     ///< true: <parameters> element was present
+    QList<Parameter> parameters;
+    QList<Locale> locales;
+};
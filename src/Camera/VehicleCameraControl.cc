@@ -29,16 +29,19 @@
 #include "MAVLinkProtocol.h"
 #include "QGCVideoStreamInfo.h"
 #include "MissionCommandTree.h"
+#include "CameraDefinition.h"
 
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtCore/QDir>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QSettings>
-#include <QtXml/QDomDocument>
-#include <QtXml/QDomNodeList>
 #include <QtQml/QQmlEngine>
 #include <QtNetwork/QNetworkProxy>
 #include <QtNetwork/QNetworkReply>
 
+#include <optional>
+
 //-----------------------------------------------------------------------------
 QGCCameraOptionExclusion::QGCCameraOptionExclusion(QObject* parent, QString param_, QString value_, QStringList exclusions_)
     : QObject(parent)
@@ -62,62 +65,51 @@ QGCCameraOptionRange::QGCCameraOptionRange(QObject* parent, QString param_, QStr
 
 //-----------------------------------------------------------------------------
 static bool
-read_attribute(QDomNode& node, const char* tagName, bool& target)
+read_attribute(const CameraDefinition::Parameter& parameter, const char* tagName, bool& target)
 {
-    QDomNamedNodeMap attrs = node.attributes();
-    if(!attrs.count()) {
-        return false;
-    }
-    QDomNode subNode = attrs.namedItem(tagName);
-    if(subNode.isNull()) {
+    const auto it = parameter.attributes.constFind(QString::fromLatin1(tagName));
+    if(it == parameter.attributes.cend()) {
         return false;
     }
-    target = subNode.nodeValue() != "0";
+    target = it.value() != "0";
     return true;
 }
 
 //-----------------------------------------------------------------------------
 static bool
-read_attribute(QDomNode& node, const char* tagName, int& target)
+read_attribute(const CameraDefinition::Parameter& parameter, const char* tagName, QString& target)
 {
-    QDomNamedNodeMap attrs = node.attributes();
-    if(!attrs.count()) {
+    const auto it = parameter.attributes.constFind(QString::fromLatin1(tagName));
+    if(it == parameter.attributes.cend()) {
         return false;
     }
-    QDomNode subNode = attrs.namedItem(tagName);
-    if(subNode.isNull()) {
-        return false;
-    }
-    target = subNode.nodeValue().toInt();
+    target = it.value();
     return true;
 }
 
 //-----------------------------------------------------------------------------
-static bool
-read_attribute(QDomNode& node, const char* tagName, QString& target)
+/// Runs on a worker thread. Parses the definition xml, or reads back the parsed cache when no xml is given.
+static std::optional<CameraDefinition>
+load_camera_definition(const QByteArray& bytes, const QString& cacheFile, const QString& localeName)
 {
-    QDomNamedNodeMap attrs = node.attributes();
-    if(!attrs.count()) {
-        return false;
-    }
-    QDomNode subNode = attrs.namedItem(tagName);
-    if(subNode.isNull()) {
-        return false;
-    }
-    target = subNode.nodeValue();
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-static bool
-read_value(QDomNode& element, const char* tagName, QString& target)
-{
-    QDomElement de = element.firstChildElement(tagName);
-    if(de.isNull()) {
-        return false;
+    CameraDefinition definition;
+    if(bytes.isEmpty()) {
+        if(!definition.load(cacheFile)) {
+            return std::nullopt;
+        }
+    } else {
+        QString errorString;
+        if(!definition.parse(bytes, errorString)) {
+            qCCritical(CameraControlLog) << errorString;
+            return std::nullopt;
+        }
+        if(!cacheFile.isEmpty()) {
+            qCDebug(CameraControlLog) << "Saving camera definition cache" << cacheFile;
+            (void) definition.save(cacheFile);
+        }
     }
-    target = de.text();
-    return true;
+    definition.localize(localeName);
+    return definition;
 }
 
 //-----------------------------------------------------------------------------
@@ -130,13 +122,9 @@ VehicleCameraControl::VehicleCameraControl(const mavlink_camera_information_t *i
     connect(this, &VehicleCameraControl::dataReady, this, &VehicleCameraControl::_dataReady);
     _vendor = QString(reinterpret_cast<const char*>(info->vendor_name));
     _modelName = QString(reinterpret_cast<const char*>(info->model_name));
-    int ver = static_cast<int>(_info.cam_definition_version);
-    _cacheFile = QString::asprintf("%s/%s_%s_%03d.xml",
-        SettingsManager::instance()->appSettings()->parameterSavePath().toStdString().c_str(),
-        _vendor.toStdString().c_str(),
-        _modelName.toStdString().c_str(),
-        ver);
     if(info->cam_definition_uri[0] != 0) {
+        _cacheFile = CameraDefinition::cacheFileName(QString(info->cam_definition_uri), static_cast<int>(_info.cam_definition_version));
+        _removeLegacyCacheFile();
         //-- Process camera definition file
         _handleDefinitionFile(info->cam_definition_uri);
     } else {
@@ -784,93 +772,76 @@ VehicleCameraControl::_setPhotoStatus(PhotoCaptureStatus status)
 }
 
 //-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_loadCameraDefinitionFile(QByteArray& bytes)
+void
+VehicleCameraControl::_loadCameraDefinitionFile(const QByteArray& bytes, bool cache)
 {
-    QByteArray originalData(bytes);
-    //-- Handle localization
-    if(!_handleLocalization(bytes)) {
-        return false;
-    }
+    //-- Find out where we are
+    QLocale locale = QLocale::system();
+#if defined (Q_OS_MACOS)
+    locale = QLocale(locale.name());
+#endif
+    qCDebug(CameraControlLog) << "Current locale:" << locale.name();
+    //-- Parse off the main thread, large definitions would otherwise stall the UI at connect
+    QFutureWatcher<std::optional<CameraDefinition>>* watcher = new QFutureWatcher<std::optional<CameraDefinition>>(this);
+    (void) connect(watcher, &QFutureWatcher<std::optional<CameraDefinition>>::finished, this, [this, watcher]() {
+        const std::optional<CameraDefinition> definition = watcher->result();
+        watcher->deleteLater();
+        if(definition) {
+            _cameraDefinitionLoaded(*definition);
+        } else if(_cached) {
+            //-- Unusable cache, go get the definition again
+            qCWarning(CameraControlLog) << "Could not read cached camera definition file:" << _cacheFile;
+            if(!QFile::remove(_cacheFile)) {
+                qCWarning(CameraControlLog) << "Could not remove cached camera definition file:" << _cacheFile;
+            }
+            _cached = false;
+            //-- Download directly, the cache check would pick up the same file again if it could not be removed
+            _downloadDefinitionFile(QString(_info.cam_definition_uri));
+            return;
+        }
+        _initWhenReady();
+    });
+    watcher->setFuture(QtConcurrent::run(&load_camera_definition, bytes, cache ? _cacheFile : QString(), locale.name()));
+}
 
-    QDomDocument doc;
-    const QDomDocument::ParseResult result = doc.setContent(bytes, QDomDocument::ParseOption::Default);
-    if (!result) {
-        qCCritical(CameraControlLog) << "Unable to parse camera definition file on line:" << result.errorLine;
-        qCCritical(CameraControlLog) << result.errorMessage;
-        return false;
-    }
+//-----------------------------------------------------------------------------
+void
+VehicleCameraControl::_cameraDefinitionLoaded(const CameraDefinition& definition)
+{
     //-- Load camera constants
-    QDomNodeList defElements = doc.elementsByTagName(kDefnition);
-    if(!defElements.size() || !_loadConstants(defElements)) {
-        qCWarning(CameraControlLog) <<  "Unable to load camera constants from camera definition";
-        return false;
-    }
+    _version   = definition.version;
+    _modelName = definition.model;
+    _vendor    = definition.vendor;
     //-- Load camera parameters
-    QDomNodeList paramElements = doc.elementsByTagName(kParameters);
-    if(!paramElements.size()) {
+    if(!definition.hasParameters) {
         qCDebug(CameraControlLog) <<  "No parameters to load from camera";
-        return false;
+        return;
     }
-    if(!_loadSettings(paramElements)) {
+    if(!_loadSettings(definition)) {
         qCWarning(CameraControlLog) <<  "Unable to load camera parameters from camera definition";
-        return false;
-    }
-    //-- If this is new, cache it
-    if(!_cached) {
-        qCDebug(CameraControlLog) << "Saving camera definition file" << _cacheFile;
-        QFile file(_cacheFile);
-        if (!file.open(QIODevice::WriteOnly)) {
-            qWarning() << QString("Could not save cache file %1. Error: %2").arg(_cacheFile).arg(file.errorString());
-        } else {
-            file.write(originalData);
+        //-- The worker caches the definition before it is validated here, don't keep one we can't use
+        if(!_cacheFile.isEmpty() && QFile::exists(_cacheFile) && !QFile::remove(_cacheFile)) {
+            qCWarning(CameraControlLog) << "Could not remove cached camera definition file:" << _cacheFile;
         }
     }
-    return true;
 }
 
 //-----------------------------------------------------------------------------
 bool
-VehicleCameraControl::_loadConstants(const QDomNodeList nodeList)
+VehicleCameraControl::_loadSettings(const CameraDefinition& definition)
 {
-    QDomNode node = nodeList.item(0);
-    if(!read_attribute(node, kVersion, _version)) {
-        return false;
-    }
-    if(!read_value(node, kModel, _modelName)) {
-        return false;
-    }
-    if(!read_value(node, kVendor, _vendor)) {
-        return false;
-    }
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_loadSettings(const QDomNodeList nodeList)
-{
-    QDomNode node = nodeList.item(0);
-    QDomElement elem = node.toElement();
-    QDomNodeList parameters = elem.elementsByTagName(kParameter);
-    //-- Pre-process settings (maintain order and skip non-controls)
-    for(int i = 0; i < parameters.size(); i++) {
-        QDomNode parameterNode = parameters.item(i);
+    //-- Pre-process settings (maintain order and skip non-controls). Parameter names are checked by the parser.
+    for(const CameraDefinition::Parameter& parameterNode: definition.parameters) {
         QString name;
-        if(read_attribute(parameterNode, kName, name)) {
-            bool control = true;
-            read_attribute(parameterNode, kControl, control);
-            if(control) {
-                _settings << name;
-            }
-        } else {
-            qCritical() << "Parameter entry missing parameter name";
-            return false;
+        read_attribute(parameterNode, kName, name);
+        bool control = true;
+        read_attribute(parameterNode, kControl, control);
+        if(control) {
+            _settings << name;
         }
     }
     //-- Load parameters
-    for(int i = 0; i < parameters.size(); i++) {
-        QDomNode parameterNode = parameters.item(i);
+    for(const CameraDefinition::Parameter& parameterNode: definition.parameters) {
         QString factName;
         read_attribute(parameterNode, kName, factName);
         QString type;
@@ -903,13 +874,9 @@ VehicleCameraControl::_loadSettings(const QDomNodeList nodeList)
             control = false;
         }
         //-- Description
-        QString description;
-        if(!read_value(parameterNode, kDescription, description)) {
-            qCritical() << QString("Parameter %1 missing parameter description").arg(factName);
-            return false;
-        }
+        const QString description = parameterNode.description;
         //-- Check for updates
-        QStringList updates = _loadUpdates(parameterNode);
+        const QStringList updates = parameterNode.updates;
         if(updates.size()) {
             qCDebug(CameraControlVerboseLog) << "Parameter" << factName << "requires updates for:" << updates;
             _requestUpdates[factName] = updates;
@@ -923,38 +890,26 @@ VehicleCameraControl::_loadSettings(const QDomNodeList nodeList)
         metaData->setReadOnly(readOnly);
         metaData->setWriteOnly(writeOnly);
         //-- Options (enums)
-        QDomElement optionElem = parameterNode.toElement();
-        QDomNodeList optionsRoot = optionElem.elementsByTagName(kOptions);
-        if(optionsRoot.size()) {
-            //-- Iterate options
-            QDomNode node = optionsRoot.item(0);
-            QDomElement elem = node.toElement();
-            QDomNodeList options = elem.elementsByTagName(kOption);
-            for(int i = 0; i < options.size(); i++) {
-                QDomNode option = options.item(i);
-                QString optName;
-                QString optValue;
-                QVariant optVariant;
-                if(!_loadNameValue(option, factName, metaData, optName, optValue, optVariant)) {
-                    delete metaData;
-                    return false;
-                }
-                metaData->addEnumInfo(optName, optVariant);
-                _originalOptNames[factName]  << optName;
-                _originalOptValues[factName] << optVariant;
-                //-- Check for exclusions
-                QStringList exclusions = _loadExclusions(option);
-                if(exclusions.size()) {
-                    qCDebug(CameraControlVerboseLog) << "New exclusions:" << factName << optValue << exclusions;
-                    QGCCameraOptionExclusion* pExc = new QGCCameraOptionExclusion(this, factName, optValue, exclusions);
-                    QQmlEngine::setObjectOwnership(pExc, QQmlEngine::CppOwnership);
-                    _valueExclusions.append(pExc);
-                }
-                //-- Check for range rules
-                if(!_loadRanges(option, factName, optValue)) {
-                    delete metaData;
-                    return false;
-                }
+        for(const CameraDefinition::Option& option: parameterNode.options) {
+            const QString& optName  = option.name;
+            const QString& optValue = option.value;
+            QVariant optVariant;
+            _loadNameValue(factName, metaData, optValue, optVariant);
+            metaData->addEnumInfo(optName, optVariant);
+            _originalOptNames[factName]  << optName;
+            _originalOptValues[factName] << optVariant;
+            //-- Check for exclusions
+            if(option.exclusions.size()) {
+                qCDebug(CameraControlVerboseLog) << "New exclusions:" << factName << optValue << option.exclusions;
+                QGCCameraOptionExclusion* pExc = new QGCCameraOptionExclusion(this, factName, optValue, option.exclusions);
+                QQmlEngine::setObjectOwnership(pExc, QQmlEngine::CppOwnership);
+                _valueExclusions.append(pExc);
+            }
+            //-- Check for range rules
+            for(const CameraDefinition::Range& range: option.ranges) {
+                QGCCameraOptionRange* pRange = new QGCCameraOptionRange(this, factName, optValue, range.parameter, range.condition, range.optNames, range.optValues);
+                _optionRanges.append(pRange);
+                qCDebug(CameraControlVerboseLog) << "New range limit:" << factName << optValue << range.parameter << range.condition << range.optNames << range.optValues;
             }
         }
         QString defaultValue;
@@ -1068,89 +1023,6 @@ VehicleCameraControl::_loadSettings(const QDomNodeList nodeList)
     return false;
 }
 
-//-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_handleLocalization(QByteArray& bytes)
-{
-    QDomDocument doc;
-    const QDomDocument::ParseResult result = doc.setContent(bytes, QDomDocument::ParseOption::Default);
-    if (!result) {
-        qCritical() << "Unable to parse camera definition file on line:" << result.errorLine;
-        qCritical() << result.errorMessage;
-        return false;
-    }
-    //-- Find out where we are
-    QLocale locale = QLocale::system();
-#if defined (Q_OS_MACOS)
-    locale = QLocale(locale.name());
-#endif
-    QString localeName = locale.name().toLower().replace("-", "_");
-    qCDebug(CameraControlLog) << "Current locale:" << localeName;
-    if(localeName == "en_us") {
-        // Nothing to do
-        return true;
-    }
-    QDomNodeList locRoot = doc.elementsByTagName(kLocalization);
-    if(!locRoot.size()) {
-        // Nothing to do
-        return true;
-    }
-    //-- Iterate locales
-    QDomNode node = locRoot.item(0);
-    QDomElement elem = node.toElement();
-    QDomNodeList locales = elem.elementsByTagName(kLocale);
-    for(int i = 0; i < locales.size(); i++) {
-        QDomNode locale = locales.item(i);
-        QString name;
-        if(!read_attribute(locale, kName, name)) {
-            qWarning() << "Localization entry is missing its name attribute";
-            continue;
-        }
-        // If we found a direct match, deal with it now
-        if(localeName == name.toLower().replace("-", "_")) {
-            return _replaceLocaleStrings(locale, bytes);
-        }
-    }
-    //-- No direct match. Pick first matching language (if any)
-    localeName = localeName.left(3);
-    for(int i = 0; i < locales.size(); i++) {
-        QDomNode locale = locales.item(i);
-        QString name;
-        read_attribute(locale, kName, name);
-        if(name.toLower().startsWith(localeName)) {
-            return _replaceLocaleStrings(locale, bytes);
-        }
-    }
-    //-- Could not find a language to use
-    qWarning() <<  "No match for" << QLocale::system().name() << "in camera definition file";
-    //-- Just use default, en_US
-    return true;
-}
-
-//-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_replaceLocaleStrings(const QDomNode node, QByteArray& bytes)
-{
-    QDomElement stringElem = node.toElement();
-    QDomNodeList strings = stringElem.elementsByTagName(kStrings);
-    for(int i = 0; i < strings.size(); i++) {
-        QDomNode stringNode = strings.item(i);
-        QString original;
-        QString translated;
-        if(read_attribute(stringNode, kOriginal, original)) {
-            if(read_attribute(stringNode, kTranslated, translated)) {
-                QString o; o = "\"" + original + "\"";
-                QString t; t = "\"" + translated + "\"";
-                bytes.replace(o.toUtf8(), t.toUtf8());
-                o = ">" + original + "<";
-                t = ">" + translated + "<";
-                bytes.replace(o.toUtf8(), t.toUtf8());
-            }
-        }
-    }
-    return true;
-}
-
 //-----------------------------------------------------------------------------
 void
 VehicleCameraControl::_requestAllParameters()
@@ -1947,100 +1819,6 @@ VehicleCameraControl::_storageInfoTimeout()
     _requestStorageInfo();
 }
 
-//-----------------------------------------------------------------------------
-QStringList
-VehicleCameraControl::_loadExclusions(QDomNode option)
-{
-    QStringList exclusionList;
-    QDomElement optionElem = option.toElement();
-    QDomNodeList excRoot = optionElem.elementsByTagName(kExclusions);
-    if(excRoot.size()) {
-        //-- Iterate exclusions
-        QDomNode node = excRoot.item(0);
-        QDomElement elem = node.toElement();
-        QDomNodeList exclusions = elem.elementsByTagName(kExclusion);
-        for(int i = 0; i < exclusions.size(); i++) {
-            QString exclude = exclusions.item(i).toElement().text();
-            if(!exclude.isEmpty()) {
-                exclusionList << exclude;
-            }
-        }
-    }
-    return exclusionList;
-}
-
-//-----------------------------------------------------------------------------
-QStringList
-VehicleCameraControl::_loadUpdates(QDomNode option)
-{
-    QStringList updateList;
-    QDomElement optionElem = option.toElement();
-    QDomNodeList updateRoot = optionElem.elementsByTagName(kUpdates);
-    if(updateRoot.size()) {
-        //-- Iterate updates
-        QDomNode node = updateRoot.item(0);
-        QDomElement elem = node.toElement();
-        QDomNodeList updates = elem.elementsByTagName(kUpdate);
-        for(int i = 0; i < updates.size(); i++) {
-            QString update = updates.item(i).toElement().text();
-            if(!update.isEmpty()) {
-                updateList << update;
-            }
-        }
-    }
-    return updateList;
-}
-
-//-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_loadRanges(QDomNode option, const QString factName, QString paramValue)
-{
-    QDomElement optionElem = option.toElement();
-    QDomNodeList rangeRoot = optionElem.elementsByTagName(kParameterranges);
-    if(rangeRoot.size()) {
-        QDomNode node = rangeRoot.item(0);
-        QDomElement elem = node.toElement();
-        QDomNodeList parameterRanges = elem.elementsByTagName(kParameterrange);
-        //-- Iterate parameter ranges
-        for(int i = 0; i < parameterRanges.size(); i++) {
-            QString param;
-            QString condition;
-            QDomNode paramRange = parameterRanges.item(i);
-            if(!read_attribute(paramRange, kParameter, param)) {
-                qCritical() << QString("Malformed option range for parameter %1").arg(factName);
-                return false;
-            }
-            read_attribute(paramRange, kCondition, condition);
-            QDomElement pelem = paramRange.toElement();
-            QDomNodeList rangeOptions = pelem.elementsByTagName(kRoption);
-            QStringList  optNames;
-            QStringList  optValues;
-            //-- Iterate options
-            for(int i = 0; i < rangeOptions.size(); i++) {
-                QString optName;
-                QString optValue;
-                QDomNode roption = rangeOptions.item(i);
-                if(!read_attribute(roption, kName, optName)) {
-                    qCritical() << QString("Malformed roption for parameter %1").arg(factName);
-                    return false;
-                }
-                if(!read_attribute(roption, kValue, optValue)) {
-                    qCritical() << QString("Malformed rvalue for parameter %1").arg(factName);
-                    return false;
-                }
-                optNames  << optName;
-                optValues << optValue;
-            }
-            if(optNames.size()) {
-                QGCCameraOptionRange* pRange = new QGCCameraOptionRange(this, factName, paramValue, param, condition, optNames, optValues);
-                _optionRanges.append(pRange);
-                qCDebug(CameraControlVerboseLog) << "New range limit:" << factName << paramValue << param << condition << optNames << optValues;
-            }
-        }
-    }
-    return true;
-}
-
 //-----------------------------------------------------------------------------
 void
 VehicleCameraControl::_processRanges()
@@ -2066,17 +1844,9 @@ VehicleCameraControl::_processRanges()
 }
 
 //-----------------------------------------------------------------------------
-bool
-VehicleCameraControl::_loadNameValue(QDomNode option, const QString factName, FactMetaData* metaData, QString& optName, QString& optValue, QVariant& optVariant)
+void
+VehicleCameraControl::_loadNameValue(const QString factName, FactMetaData* metaData, const QString& optValue, QVariant& optVariant)
 {
-    if(!read_attribute(option, kName, optName)) {
-        qCritical() << QString("Malformed option for parameter %1").arg(factName);
-        return false;
-    }
-    if(!read_attribute(option, kValue, optValue)) {
-        qCritical() << QString("Malformed value for parameter %1").arg(factName);
-        return false;
-    }
     QString  errorString;
     if (!metaData->convertAndValidateRaw(optValue, false, optVariant, errorString)) {
         qWarning() << "Invalid option value, name:" << factName
@@ -2084,7 +1854,6 @@ VehicleCameraControl::_loadNameValue(QDomNode option, const QString factName, Fa
                    << " value:" << optValue
                    << " error:" << errorString;
     }
-    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -2092,10 +1861,22 @@ void
 VehicleCameraControl::_handleDefinitionFile(const QString &url)
 {
     //-- First check and see if we have it cached
-    QFile xmlFile(_cacheFile);
+    if (QFile::exists(_cacheFile)) {
+        qCDebug(CameraControlLog) << "Using cached camera definition file:" << _cacheFile;
+        _cached = true;
+        _loadCameraDefinitionFile(QByteArray(), false);
+        return;
+    }
+
+    _downloadDefinitionFile(url);
+}
 
+//-----------------------------------------------------------------------------
+void
+VehicleCameraControl::_downloadDefinitionFile(const QString &url)
+{
     QString ftpPrefix(QStringLiteral("%1://").arg(FTPManager::mavlinkFTPScheme));
-    if (!xmlFile.exists() && url.startsWith(ftpPrefix, Qt::CaseInsensitive)) {
+    if (url.startsWith(ftpPrefix, Qt::CaseInsensitive)) {
         qCDebug(CameraControlLog) << "No camera definition file cached, attempt ftp download";
         int ver = static_cast<int>(_info.cam_definition_version);
         QString ext = "";
@@ -2113,28 +1894,26 @@ VehicleCameraControl::_handleDefinitionFile(const QString &url)
         return;
     }
 
-    if (!xmlFile.exists()) {
-        qCDebug(CameraControlLog) << "No camera definition file cached, attempt http download";
-        _httpRequest(url);
-        return;
-    }
-    if (!xmlFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Could not read cached camera definition file:" << _cacheFile;
-        _httpRequest(url);
-        return;
-    }
-    QByteArray bytes = xmlFile.readAll();
-    QDomDocument doc;
-    const QDomDocument::ParseResult result = doc.setContent(bytes, QDomDocument::ParseOption::Default);
-    if (!result) {
-        qWarning() << "Could not parse cached camera definition file:" << _cacheFile;
-        _httpRequest(url);
-        return;
+    qCDebug(CameraControlLog) << "No camera definition file cached, attempt http download";
+    _httpRequest(url);
+}
+
+//-----------------------------------------------------------------------------
+void
+VehicleCameraControl::_removeLegacyCacheFile()
+{
+    //-- Definitions used to be cached as the raw xml named after vendor, model and version
+    const QString legacyCacheFile = QString::asprintf("%s/%s_%s_%03d.xml",
+        SettingsManager::instance()->appSettings()->parameterSavePath().toStdString().c_str(),
+        _vendor.toStdString().c_str(),
+        _modelName.toStdString().c_str(),
+        static_cast<int>(_info.cam_definition_version));
+    if(QFile::exists(legacyCacheFile)) {
+        qCDebug(CameraControlLog) << "Removing legacy camera definition cache file:" << legacyCacheFile;
+        if(!QFile::remove(legacyCacheFile)) {
+            qCWarning(CameraControlLog) << "Could not remove legacy camera definition cache file:" << legacyCacheFile;
+        }
     }
-    //-- We have it
-    qCDebug(CameraControlLog) << "Using cached camera definition file:" << _cacheFile;
-    _cached = true;
-    emit dataReady(bytes);
 }
 
 //-----------------------------------------------------------------------------
@@ -2213,8 +1992,10 @@ void VehicleCameraControl::_ftpDownloadComplete(const QString& fileName, const Q
         return;
     }
 
-    _cached = true;
     QByteArray bytes = xmlFile.readAll();
+    xmlFile.close();
+    //-- The parsed definition is cached, the downloaded xml is no longer needed
+    (void) xmlFile.remove();
     emit dataReady(bytes);
 }
 
@@ -2224,21 +2005,21 @@ VehicleCameraControl::_dataReady(QByteArray data)
 {
     if(data.size()) {
         qCDebug(CameraControlLog) << "Parsing camera definition";
-        _loadCameraDefinitionFile(data);
-    } else {
-        qCDebug(CameraControlLog) << "No camera definition received, trying to search on our own...";
-        QFile definitionFile;
-        if(QGCCorePlugin::instance()->getOfflineCameraDefinitionFile(_modelName, definitionFile)) {
-            qCDebug(CameraControlLog) << "Found offline definition file for: " << _modelName << ", loading: " << definitionFile.fileName();
-            if (definitionFile.open(QIODevice::ReadOnly)) {
-                QByteArray newData = definitionFile.readAll();
-                _loadCameraDefinitionFile(newData);
-            } else {
-                qCDebug(CameraControlLog) << "error opening offline definition file for: " << _modelName;
-            }
-        } else {
-            qCDebug(CameraControlLog) << "No offline camera definition file found";
+        _loadCameraDefinitionFile(data, true);
+        return;
+    }
+    qCDebug(CameraControlLog) << "No camera definition received, trying to search on our own...";
+    QFile definitionFile;
+    if(QGCCorePlugin::instance()->getOfflineCameraDefinitionFile(_modelName, definitionFile)) {
+        qCDebug(CameraControlLog) << "Found offline definition file for: " << _modelName << ", loading: " << definitionFile.fileName();
+        if (definitionFile.open(QIODevice::ReadOnly)) {
+            //-- Not cached, the definition uri should still be tried on the next connection
+            _loadCameraDefinitionFile(definitionFile.readAll(), false);
+            return;
         }
+        qCDebug(CameraControlLog) << "error opening offline definition file for: " << _modelName;
+    } else {
+        qCDebug(CameraControlLog) << "No offline camera definition file found";
     }
     _initWhenReady();
 }
@@ -14,8 +14,7 @@
 
 class QGCVideoStreamInfo;
 class QNetworkAccessManager;
-class QDomNode;
-class QDomNodeList;
+struct CameraDefinition;
 
 //-----------------------------------------------------------------------------
 /// Camera option exclusions
@@ -232,24 +231,21 @@ protected slots:
     virtual void    _checkForVideoStreams   ();
 
 private:
-    bool    _handleLocalization             (QByteArray& bytes);
-    bool    _replaceLocaleStrings           (const QDomNode node, QByteArray& bytes);
-    bool    _loadCameraDefinitionFile       (QByteArray& bytes);
-    bool    _loadConstants                  (const QDomNodeList nodeList);
-    bool    _loadSettings                   (const QDomNodeList nodeList);
+    void    _loadCameraDefinitionFile       (const QByteArray& bytes, bool cache);
+    void    _cameraDefinitionLoaded         (const CameraDefinition& definition);
+    bool    _loadSettings                   (const CameraDefinition& definition);
     void    _processRanges                  ();
     bool    _processCondition               (const QString condition);
     bool    _processConditionTest           (const QString conditionTest);
-    bool    _loadNameValue                  (QDomNode option, const QString factName, FactMetaData* metaData, QString& optName, QString& optValue, QVariant& optVariant);
-    bool    _loadRanges                     (QDomNode option, const QString factName, QString paramValue);
+    void    _loadNameValue                  (const QString factName, FactMetaData* metaData, const QString& optValue, QVariant& optVariant);
     void    _updateActiveList               ();
     void    _updateRanges                   (Fact* pFact);
     void    _httpRequest                    (const QString& url);
     void    _handleDefinitionFile           (const QString& url);
+    void    _downloadDefinitionFile         (const QString& url);
+    void    _removeLegacyCacheFile          ();
     void    _ftpDownloadComplete            (const QString& fileName, const QString& errorMsg);
 
-    QStringList     _loadExclusions         (QDomNode option);
-    QStringList     _loadUpdates            (QDomNode option);
     QString         _getParamName           (const char* param_id);
 
 protected:
@@ -266,7 +262,7 @@ protected slots:
     QNetworkAccessManager*              _netManager         = nullptr;
     QString                             _modelName;
     QString                             _vendor;
-    QString                             _cacheFile;
+    QString                             _cacheFile;         ///< Parsed camera definition cache, keyed by definition uri and version
     StorageStatus                       _storageStatus      = STORAGE_NOT_SUPPORTED;
     QStringList                         _activeSettings;
     QStringList                         _settings;
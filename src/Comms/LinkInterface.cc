@@ -11,10 +11,14 @@
 #include "LinkManager.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
+#include "QGCTrace.h"
 #include "MAVLinkSigning.h"
+#include "MAVLinkSha256.h"
 #include "SettingsManager.h"
 #include "MavlinkSettings.h"
+#include "TelemetryLatency.h"
 
+#include <QtCore/QThread>
 #include <QtQml/QQmlEngine>
 
 QGC_LOGGING_CATEGORY(LinkInterfaceLog, "Comms.LinkInterface")
@@ -58,7 +62,7 @@ bool LinkInterface::initMavlinkSigning()
             if (signingKeyBytes.isEmpty()) {
                 qCDebug(LinkInterfaceLog) << "Signing disabled on channel" << _mavlinkChannel;
             } else {
-                qCDebug(LinkInterfaceLog) << "Signing enabled on channel" << _mavlinkChannel;
+                qCDebug(LinkInterfaceLog) << "Signing enabled on channel" << _mavlinkChannel << "sha256:" << MAVLinkSha256::backendName(MAVLinkSha256::backend());
             }
         } else {
             qCWarning(LinkInterfaceLog) << "Failed To enable Signing on channel" << _mavlinkChannel;
@@ -105,10 +109,80 @@ void LinkInterface::_freeMavlinkChannel()
     _mavlinkChannel = LinkManager::invalidMavlinkChannel();
 }
 
-void LinkInterface::writeBytesThreadSafe(const char *bytes, int length)
+void LinkInterface::writeBytesThreadSafe(const char *bytes, int length, WritePriority priority)
 {
+    QGC_TRACE(LinkBytesSent, _mavlinkChannel, length);
+
+    // Messages are written one at a time, a signed MAVLink 2 frame has the signed flag in its incompat flags
+    if ((length > 2) && (static_cast<uint8_t>(bytes[0]) == MAVLINK_STX) && (bytes[2] & MAVLINK_IFLAG_SIGNED)) {
+        (void) _signingSentCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
     const QByteArray data(bytes, length);
-    (void) QMetaObject::invokeMethod(this, "_writeBytes", Qt::AutoConnection, data);
+
+    QMutexLocker locker(&_outboundMutex);
+
+    // Write straight through when on the write thread and nothing of the same or higher priority is waiting
+    QObject *const writeContext = _writeContext();
+    bool writeNow = (QThread::currentThread() == writeContext->thread());
+    for (int i = priority; writeNow && (i < WritePriorityCount); i++) {
+        writeNow = _outboundQueue[i].isEmpty();
+    }
+    if (writeNow) {
+        locker.unlock();
+        _writeBytes(data);
+        return;
+    }
+
+    _outboundQueue[priority].append({ data, TelemetryLatency::nowNsecs() });
+    if (!_outboundWriteScheduled) {
+        _outboundWriteScheduled = true;
+        (void) QMetaObject::invokeMethod(writeContext, [this]() { _writeOutboundQueue(); }, Qt::QueuedConnection);
+    }
+}
+
+void LinkInterface::_writeOutboundQueue()
+{
+    while (true) {
+        QByteArray data;
+        {
+            QMutexLocker locker(&_outboundMutex);
+
+            int priority = WritePriorityCount - 1;
+            while ((priority >= 0) && _outboundQueue[priority].isEmpty()) {
+                priority--;
+            }
+            if (priority < 0) {
+                _outboundWriteScheduled = false;
+                return;
+            }
+
+            const OutboundWrite_s write = _outboundQueue[priority].takeFirst();
+            if (priority == HighPriority) {
+                _highPriorityMaxWaitNsecs = qMax(_highPriorityMaxWaitNsecs, TelemetryLatency::nowNsecs() - write.queuedNsecs);
+            }
+            data = write.bytes;
+        }
+
+        _writeBytes(data);
+    }
+}
+
+qint64 LinkInterface::takeHighPriorityMaxWaitNsecs()
+{
+    QMutexLocker locker(&_outboundMutex);
+
+    const qint64 maxWaitNsecs = _highPriorityMaxWaitNsecs;
+    _highPriorityMaxWaitNsecs = 0;
+
+    return maxWaitNsecs;
+}
+
+void LinkInterface::_emitBytesReceived(const QByteArray &data, qint64 readNsecs)
+{
+    _receiveTimestampNsecs = readNsecs;
+    emit bytesReceived(this, data);
+    _receiveTimestampNsecs = 0;
 }
 
 void LinkInterface::removeVehicleReference()
@@ -140,3 +214,44 @@ void LinkInterface::setSigningSignatureFailure(bool failure)
         }
     }
 }
+
+LinkInterface::SigningStats &LinkInterface::SigningStats::operator+=(const SigningStats &other)
+{
+    signedAccepted += other.signedAccepted;
+    unsignedAccepted += other.unsignedAccepted;
+    unsignedRejected += other.unsignedRejected;
+    badSignature += other.badSignature;
+    replayRejected += other.replayRejected;
+    streamRejected += other.streamRejected;
+    signedSent += other.signedSent;
+
+    return *this;
+}
+
+LinkInterface::SigningStats LinkInterface::signingStats() const
+{
+    SigningStats stats = _signingReceiveStats;
+    stats.signedSent = _signingSentCount.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void LinkInterface::addSigningReceiveStats(const SigningStats &stats)
+{
+    _signingReceiveStats += stats;
+}
+
+QVariantMap LinkInterface::signingStatsMap() const
+{
+    const SigningStats stats = signingStats();
+
+    return QVariantMap{
+        { QStringLiteral("signedAccepted"), stats.signedAccepted },
+        { QStringLiteral("unsignedAccepted"), stats.unsignedAccepted },
+        { QStringLiteral("unsignedRejected"), stats.unsignedRejected },
+        { QStringLiteral("badSignature"), stats.badSignature },
+        { QStringLiteral("replayRejected"), stats.replayRejected },
+        { QStringLiteral("streamRejected"), stats.streamRejected },
+        { QStringLiteral("signedSent"), stats.signedSent },
+    };
+}
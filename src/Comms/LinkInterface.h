@@ -9,11 +9,16 @@
 
 #pragma once
 
+#include <QtCore/QList>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QVariantMap>
 #include <QtQmlIntegration/QtQmlIntegration>
 
 #include "LinkConfiguration.h"
 
+#include <atomic>
+
 class LinkManager;
 
 Q_DECLARE_LOGGING_CATEGORY(LinkInterfaceLog)
@@ -27,6 +32,26 @@ class LinkInterface : public QObject
     friend class LinkManager;
 
 public:
+    /// Priority for writes which are queued on their way to the thread which writes to the link
+    enum WritePriority {
+        NormalPriority,
+        HighPriority,       ///< Time critical traffic such as RTCM corrections, written ahead of pending normal priority bytes
+        WritePriorityCount
+    };
+
+    /// MAVLink 2 signing counters for the link
+    struct SigningStats {
+        quint64 signedAccepted = 0;     ///< Signed messages which passed verification
+        quint64 unsignedAccepted = 0;   ///< Unsigned messages let through by the accept unsigned callback
+        quint64 unsignedRejected = 0;   ///< Unsigned messages dropped because the link requires signing
+        quint64 badSignature = 0;       ///< Signed messages with a signature mismatch
+        quint64 replayRejected = 0;     ///< Signed messages rejected for an old or replayed timestamp
+        quint64 streamRejected = 0;     ///< Signed messages rejected because the signing stream table is full
+        quint64 signedSent = 0;         ///< Signed messages written to the link
+
+        SigningStats &operator+=(const SigningStats &other);
+    };
+
     virtual ~LinkInterface();
 
     Q_INVOKABLE virtual void disconnect() = 0; // Implementations should guard against multiple calls
@@ -41,11 +66,19 @@ class LinkInterface : public QObject
     bool mavlinkChannelIsSet() const;
     bool decodedFirstMavlinkPacket() const { return _decodedFirstMavlinkPacket; }
     void setDecodedFirstMavlinkPacket(bool decodedFirstMavlinkPacket) { _decodedFirstMavlinkPacket = decodedFirstMavlinkPacket; }
-    void writeBytesThreadSafe(const char *bytes, int length);
+    /// @return TelemetryLatency::nowNsecs() when the bytes currently being delivered by bytesReceived were read, 0 if unknown
+    qint64 receiveTimestampNsecs() const { return _receiveTimestampNsecs; }
+    void writeBytesThreadSafe(const char *bytes, int length, WritePriority priority = NormalPriority);
+    /// @return Longest time a high priority write waited in the outbound queue since the last call, resets the value
+    qint64 takeHighPriorityMaxWaitNsecs();
     void addVehicleReference() { ++_vehicleReferenceCount; }
     void removeVehicleReference();
     bool initMavlinkSigning();
     void setSigningSignatureFailure(bool failure);
+    SigningStats signingStats() const;
+    /// Adds the receive side signing counters accumulated over a single link read
+    void addSigningReceiveStats(const SigningStats &stats);
+    Q_INVOKABLE QVariantMap signingStatsMap() const;
 
 signals:
     void bytesReceived(LinkInterface *link, const QByteArray &data);
@@ -66,11 +99,20 @@ class LinkInterface : public QObject
 
     void _connectionRemoved();
 
+    /// @return Object living on the thread which writes to the link, queued writes are drained there in priority order.
+    /// Links which write from a worker thread return their worker.
+    virtual QObject *_writeContext() { return this; }
+
+    /// Emits bytesReceived for data read at the specified time on the link worker thread
+    void _emitBytesReceived(const QByteArray &data, qint64 readNsecs);
+
     SharedLinkConfigurationPtr _config;
 
 private slots:
-    /// Not thread safe if called directly, only writeBytesThreadSafe is thread safe
+    /// Not thread safe if called directly, only writeBytesThreadSafe is thread safe. Called on the _writeContext() thread.
     virtual void _writeBytes(const QByteArray &bytes) = 0;
+    /// Writes the bytes queued by writeBytesThreadSafe, highest priority first. Runs on the _writeContext() thread.
+    void _writeOutboundQueue();
 
 private:
     /// connect is private since all links should be created through LinkManager::createConnectedLink calls
@@ -78,8 +120,20 @@ private slots:
 
     uint8_t _mavlinkChannel = std::numeric_limits<uint8_t>::max();
     bool _decodedFirstMavlinkPacket = false;
+    qint64 _receiveTimestampNsecs = 0;
     int _vehicleReferenceCount = 0;
     bool _signingSignatureFailure = false;
+    SigningStats _signingReceiveStats;
+    std::atomic<quint64> _signingSentCount = 0;     ///< Updated from writeBytesThreadSafe callers on any thread
+
+    struct OutboundWrite_s {
+        QByteArray bytes;
+        qint64 queuedNsecs;
+    };
+    QMutex _outboundMutex;
+    QList<OutboundWrite_s> _outboundQueue[WritePriorityCount];   ///< Protected by _outboundMutex
+    bool _outboundWriteScheduled = false;                       ///< Protected by _outboundMutex
+    qint64 _highPriorityMaxWaitNsecs = 0;                       ///< Protected by _outboundMutex
 };
 
 typedef std::shared_ptr<LinkInterface> SharedLinkInterfacePtr;
@@ -12,7 +12,10 @@
 #include "MultiVehicleManager.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
+#include "MAVLinkSigning.h"
 #include "QGCTemporaryFile.h"
+#include "QGCTrace.h"
+#include "TelemetryLatency.h"
 #include "SettingsManager.h"
 #include "MavlinkSettings.h"
 #include "AppSettings.h"
@@ -56,6 +59,8 @@ void MAVLinkProtocol::init()
 
     (void) connect(MultiVehicleManager::instance(), &MultiVehicleManager::vehicleRemoved, this, &MAVLinkProtocol::_vehicleCountChanged);
 
+    TelemetryLatency::instance()->init();
+
     _initialized = true;
 }
 
@@ -110,15 +115,30 @@ void MAVLinkProtocol::receiveBytes(LinkInterface *link, const QByteArray &data)
         return;
     }
 
+    QGC_TRACE(MAVLinkBytesReceived, link->mavlinkChannel(), data.size());
+
+    TelemetryLatency *const latency = TelemetryLatency::instance();
+    if (!link->decodedFirstMavlinkPacket()) {
+        latency->setChannelName(link->mavlinkChannel(), linkPtr->linkConfiguration()->name());
+    }
+
+    // Signature verification happens inside mavlink_parse_char, the outcome is collected for the whole read and
+    // handed to the link once
+    const uint8_t mavlinkChannel = link->mavlinkChannel();
+    LinkInterface::SigningStats signingStats;
+
     for (const uint8_t &byte: data) {
-        const uint8_t mavlinkChannel = link->mavlinkChannel();
         mavlink_message_t message{};
-        mavlink_status_t status{};
-
-        if (mavlink_parse_char(mavlinkChannel, byte, &message, &status) != MAVLINK_FRAMING_OK) {
+        const uint8_t framing = _parseChar(mavlinkChannel, byte, message, signingStats);
+        if (framing != MAVLINK_FRAMING_OK) {
             continue;
         }
 
+        QGC_TRACE(MAVLinkMessageReceived, mavlinkChannel,
+                  message.msgid | (static_cast<quint64>(message.seq) << 24) | (static_cast<quint64>(message.compid) << 32) | (static_cast<quint64>(message.sysid) << 40));
+
+        latency->messageParsed(mavlinkChannel, message.msgid, link->receiveTimestampNsecs());
+
         _updateVersion(link, mavlinkChannel);
         _updateCounters(mavlinkChannel, message);
         if (!linkPtr->linkConfiguration()->isForwarding()) {
@@ -131,6 +151,54 @@ void MAVLinkProtocol::receiveBytes(LinkInterface *link, const QByteArray &data)
             break;
         }
     }
+
+    if (mavlink_get_channel_status(mavlinkChannel)->signing) {
+        link->addSigningReceiveStats(signingStats);
+    }
+}
+
+uint8_t MAVLinkProtocol::_parseChar(uint8_t mavlinkChannel, uint8_t byte, mavlink_message_t &message, LinkInterface::SigningStats &signingStats)
+{
+    mavlink_signing_t *const signing = mavlink_get_channel_status(mavlinkChannel)->signing;
+    if (signing) {
+        signing->last_status = MAVLINK_SIGNING_STATUS_NONE;
+    }
+
+    mavlink_status_t status{};
+    const uint8_t framing = mavlink_parse_char(mavlinkChannel, byte, &message, &status);
+    if (signing) {
+        _updateSigningStats(signing->last_status, framing, message, signingStats);
+        // Unsigned messages are rejected before any signature check, so the signing status doesn't show them
+        signingStats.unsignedRejected += MAVLinkSigning::takeUnsignedRejectedCount(static_cast<mavlink_channel_t>(mavlinkChannel));
+    }
+
+    return framing;
+}
+
+void MAVLinkProtocol::_updateSigningStats(uint8_t signingStatus, uint8_t framing, const mavlink_message_t &message, LinkInterface::SigningStats &stats)
+{
+    switch (signingStatus) {
+    case MAVLINK_SIGNING_STATUS_OK:
+        stats.signedAccepted++;
+        break;
+    case MAVLINK_SIGNING_STATUS_BAD_SIGNATURE:
+        stats.badSignature++;
+        break;
+    case MAVLINK_SIGNING_STATUS_OLD_TIMESTAMP:
+    case MAVLINK_SIGNING_STATUS_REPLAY:
+        stats.replayRejected++;
+        break;
+    case MAVLINK_SIGNING_STATUS_NO_STREAMS:
+    case MAVLINK_SIGNING_STATUS_TOO_MANY_STREAMS:
+        stats.streamRejected++;
+        break;
+    case MAVLINK_SIGNING_STATUS_NONE:
+    default:
+        if ((framing == MAVLINK_FRAMING_OK) && !(message.incompat_flags & MAVLINK_IFLAG_SIGNED)) {
+            stats.unsignedAccepted++;
+        }
+        break;
+    }
 }
 
 void MAVLinkProtocol::_updateVersion(LinkInterface *link, uint8_t mavlinkChannel)
@@ -281,6 +349,7 @@ bool MAVLinkProtocol::_updateStatus(LinkInterface *link, const SharedLinkInterfa
     }
 
     emit messageReceived(link, message);
+    TelemetryLatency::instance()->messageDone();
 
     if (linkPtr.use_count() == 1) {
         return false;
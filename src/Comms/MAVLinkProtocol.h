@@ -28,6 +28,8 @@ class MAVLinkProtocol : public QObject
 {
     Q_OBJECT
 
+    friend class SigningTest;
+
 public:
     /// Constructs an MAVLinkProtocol object.
     ///     @param parent The parent QObject.
@@ -108,6 +110,9 @@ private slots:
     void _updateCounters(uint8_t mavlinkChannel, const mavlink_message_t &message);
     bool _updateStatus(LinkInterface *link, const SharedLinkInterfacePtr linkPtr, uint8_t mavlinkChannel, const mavlink_message_t &message);
     void _updateVersion(LinkInterface *link, uint8_t mavlinkChannel);
+    /// Parses a byte on the channel, collecting the signature verification outcome into signingStats if the channel has signing
+    static uint8_t _parseChar(uint8_t mavlinkChannel, uint8_t byte, mavlink_message_t &message, LinkInterface::SigningStats &signingStats);
+    static void _updateSigningStats(uint8_t signingStatus, uint8_t framing, const mavlink_message_t &message, LinkInterface::SigningStats &stats);
 
     void _saveTelemetryLog(const QString &tempLogfile);
     bool _checkTelemetrySavePath();
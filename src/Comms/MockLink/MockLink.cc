@@ -692,6 +692,9 @@ void MockLink::_handleIncomingMavlinkMsg(const mavlink_message_t &msg)
     case MAVLINK_MSG_ID_PARAM_MAP_RC:
         _handleParamMapRC(msg);
         break;
+    case MAVLINK_MSG_ID_GPS_RTCM_DATA:
+        _receivedGpsRtcmDataCount++;
+        break;
     default:
         break;
     }
@@ -1743,7 +1746,11 @@ void MockLink::_logDownloadWorker()
         bytesToRead,
         &buffer[0]
     );
-    respondWithMavlinkMessage(responseMsg);
+
+    _logDownloadPacketCount++;
+    if ((_logDownloadDropInterval == 0) || ((_logDownloadPacketCount % _logDownloadDropInterval) != 0)) {
+        respondWithMavlinkMessage(responseMsg);
+    }
 
     _logDownloadCurrentOffset += bytesToRead;
     _logDownloadBytesRemaining -= bytesToRead;
@@ -66,6 +66,12 @@ class MockLink : public LinkInterface
     ///     @param failureAckResult Error to send if one the ack error modes
     void setMissionItemFailureMode(MockLinkMissionItemHandler::FailureMode_t failureMode, MAV_MISSION_RESULT failureAckResult) const { _missionItemHandler->setFailureMode(failureMode, failureAckResult); }
 
+    /// Simulates a lossy, slow link for mission item transfers
+    void setMissionItemLinkSimulation(int latencyMsecs, int dropPercent) const { _missionItemHandler->setLinkSimulation(latencyMsecs, dropPercent); }
+
+    /// Rejects mission transfers which are not requested/sent in order, as PX4 does
+    void setMissionItemStrictOrdering(bool strictOrdering) const { _missionItemHandler->setStrictOrdering(strictOrdering); }
+
     /// Called to send a MISSION_ACK message while the MissionManager is in idle state
     void sendUnexpectedMissionAck(MAV_MISSION_RESULT ackType) const { _missionItemHandler->sendUnexpectedMissionAck(ackType); }
 
@@ -83,8 +89,15 @@ class MockLink : public LinkInterface
     /// Returns the filename for the simulated log file. Only available after a download is requested.
     QString logDownloadFile() const { return _logDownloadFilename; }
 
+    /// Sets the size of the simulated log file. Must be called before the log list is requested.
+    void setLogDownloadFileSize(uint32_t size) { _logDownloadFileSize = size; }
+
+    /// Drops every dropInterval'th LOG_DATA packet to simulate a lossy link, 0 = no loss
+    void setLogDownloadDropInterval(uint32_t dropInterval) { _logDownloadDropInterval = dropInterval; }
+
     void clearReceivedMavCommandCounts() { _receivedMavCommandCountMap.clear(); }
     int receivedMavCommandCount(MAV_CMD command) const { return _receivedMavCommandCountMap[command]; }
+    int receivedGpsRtcmDataCount() const { return _receivedGpsRtcmDataCount; }
 
     enum RequestMessageFailureMode_t {
         FailRequestMessageNone,
@@ -281,6 +294,9 @@ private slots:
     QString _logDownloadFilename;                       ///< Filename for log download which is in progress
     uint32_t _logDownloadCurrentOffset = 0;             ///< Current offset we are sending from
     uint32_t _logDownloadBytesRemaining = 0;            ///< Number of bytes still to send, 0 = send inactive
+    uint32_t _logDownloadFileSize = 1000;               ///< Size of simulated log file
+    uint32_t _logDownloadDropInterval = 0;              ///< Every Nth LOG_DATA packet is dropped, 0 = no loss
+    uint32_t _logDownloadPacketCount = 0;               ///< Number of LOG_DATA packets generated
 
     bool _sendGimbalManagerStatusNow = false;
     bool _sendGimbalDeviceAttitudeStatusNow = false;
@@ -292,6 +308,7 @@ private slots:
     bool _paramRequestReadFailureFirstAttemptPending = false;
 
     QMap<MAV_CMD, int> _receivedMavCommandCountMap;
+    int _receivedGpsRtcmDataCount = 0;
     QMap<int, QMap<QString, QVariant>> _mapParamName2Value;
     QMap<int, QMap<QString, MAV_PARAM_TYPE>> _mapParamName2MavParamType;
 
@@ -318,7 +335,6 @@ private slots:
     static constexpr uint8_t _vehicleComponentId = MAV_COMP_ID_AUTOPILOT1;
 
     static constexpr uint16_t _logDownloadLogId = 0;        ///< Id of siumulated log file
-    static constexpr uint32_t _logDownloadFileSize = 1000;  ///< Size of simulated log file
 
     static constexpr bool _mavlinkStarted = true;
 
@@ -12,6 +12,8 @@
 #include "QGCLoggingCategory.h"
 #include "QGCTemporaryFile.h"
 
+#include <QtCore/QTimer>
+
 QGC_LOGGING_CATEGORY(MockLinkFTPLog, "Comms.MockLink.MockLinkFTP")
 
 MockLinkFTP::MockLinkFTP(uint8_t systemIdServer, uint8_t componentIdServer, MockLink *mockLink)
@@ -241,6 +243,52 @@ void MockLinkFTP::_burstReadCommand(uint8_t senderSystemId, uint8_t senderCompon
     }
 }
 
+void MockLinkFTP::_createCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
+{
+    ensureNullTemination(request);
+    const QString path = reinterpret_cast<char*>(request->data);
+
+    const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
+
+    if (path.isEmpty()) {
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrFail, outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+        return;
+    }
+
+    _currentFile.close();
+    _uploadPath = path;
+    _uploadData.clear();
+
+    _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+}
+
+void MockLinkFTP::_writeCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
+{
+    const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
+
+    if ((request->hdr.session != _sessionId) || _uploadPath.isEmpty()) {
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrInvalidSession, outgoingSeqNumber, MavlinkFTP::kCmdWriteFile);
+        return;
+    }
+
+    const uint32_t writeOffset = request->hdr.offset;
+    const uint8_t cBytes = qMin(request->hdr.size, static_cast<uint8_t>(sizeof(request->data)));
+    if (static_cast<uint32_t>(_uploadData.size()) < writeOffset + cBytes) {
+        _uploadData.resize(writeOffset + cBytes);
+    }
+    (void) memcpy(_uploadData.data() + writeOffset, request->data, cBytes);
+
+    MavlinkFTP::Request response{};
+    response.hdr.opcode = MavlinkFTP::kRspAck;
+    response.hdr.req_opcode = MavlinkFTP::kCmdWriteFile;
+    response.hdr.session = _sessionId;
+    response.hdr.offset = writeOffset;
+    response.hdr.size = sizeof(uint32_t);
+    response.writeFileLength = cBytes;
+
+    _sendResponse(senderSystemId, senderComponentId, &response, outgoingSeqNumber);
+}
+
 void MockLinkFTP::_terminateCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
 {
     const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
@@ -250,6 +298,12 @@ void MockLinkFTP::_terminateCommand(uint8_t senderSystemId, uint8_t senderCompon
         return;
     }
 
+    if (!_uploadPath.isEmpty()) {
+        _uploadedFiles[_uploadPath] = _uploadData;
+        _uploadPath.clear();
+        _uploadData.clear();
+    }
+
     _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdTerminateSession);
 
     emit terminateCommandReceived();
@@ -281,19 +335,16 @@ void MockLinkFTP::mavlinkMessageReceived(const mavlink_message_t &message)
 
     MavlinkFTP::Request *request = reinterpret_cast<MavlinkFTP::Request*>(&requestFTP.payload[0]);
 
-    // kCmdOpenFileRO and kCmdResetSessions don't support retry so we can't drop those
-    if (_randomDropsEnabled && (request->hdr.opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.opcode != MavlinkFTP::kCmdResetSessions)) {
-        if ((rand() % 5) == 0) {
-            qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of incoming packet";
-            return;
-        }
+    if (_simulateDrop(request->hdr.opcode)) {
+        qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of incoming packet";
+        return;
     }
 
     if (_lastReplyValid && (request->hdr.seqNumber == (_lastReplySequence - 1))) {
         // This is the same request as the one we replied to last. It means the (n)ack got lost, and the GCS
         // resent the request
         qCDebug(MockLinkFTPLog) << "MockLinkFTP: resending response";
-        _mockLink->respondWithMavlinkMessage(_lastReply);
+        _respond(_lastReply);
         return;
     }
 
@@ -334,6 +385,12 @@ void MockLinkFTP::mavlinkMessageReceived(const mavlink_message_t &message)
     case MavlinkFTP::kCmdBurstReadFile:
         _burstReadCommand(message.sysid, message.compid, request, incomingSeqNumber);
         break;
+    case MavlinkFTP::kCmdCreateFile:
+        _createCommand(message.sysid, message.compid, request, incomingSeqNumber);
+        break;
+    case MavlinkFTP::kCmdWriteFile:
+        _writeCommand(message.sysid, message.compid, request, incomingSeqNumber);
+        break;
     case MavlinkFTP::kCmdTerminateSession:
         _terminateCommand(message.sysid, message.compid, request, incomingSeqNumber);
         break;
@@ -404,15 +461,34 @@ void MockLinkFTP::_sendResponse(uint8_t targetSystemId, uint8_t targetComponentI
         reinterpret_cast<uint8_t*>(request) // Payload
     );
 
-    // kCmdOpenFileRO and kCmdResetSessions don't support retry so we can't drop those
-    if (_randomDropsEnabled && (request->hdr.req_opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.req_opcode != MavlinkFTP::kCmdResetSessions)) {
-        if ((rand() % 5) == 0) {
-            qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of outgoing packet";
-            return;
-        }
+    if (_simulateDrop(request->hdr.req_opcode)) {
+        qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of outgoing packet";
+        return;
+    }
+
+    _respond(_lastReply);
+}
+
+bool MockLinkFTP::_simulateDrop(uint8_t opcode)
+{
+    // kCmdOpenFileRO, kCmdCreateFile and kCmdResetSessions don't support retry so we can't drop those
+    if ((_dropPercent <= 0) || (opcode == MavlinkFTP::kCmdOpenFileRO) || (opcode == MavlinkFTP::kCmdCreateFile) || (opcode == MavlinkFTP::kCmdResetSessions)) {
+        return false;
+    }
+
+    return (static_cast<int>(_dropGenerator.bounded(100)) < _dropPercent);
+}
+
+void MockLinkFTP::_respond(const mavlink_message_t &message)
+{
+    if (_latencyMsecs <= 0) {
+        _mockLink->respondWithMavlinkMessage(message);
+        return;
     }
 
-    _mockLink->respondWithMavlinkMessage(_lastReply);
+    QTimer::singleShot(_latencyMsecs, this, [this, message]() {
+        _mockLink->respondWithMavlinkMessage(message);
+    });
 }
 
 
@@ -9,9 +9,12 @@
 
 #pragma once
 
+#include <QtCore/QByteArray>
 #include <QtCore/QFile>
+#include <QtCore/QHash>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
+#include <QtCore/QRandomGenerator>
 #include <QtCore/QStringList>
 
 #include "MAVLinkFTP.h"
@@ -36,9 +39,18 @@ class MockLinkFTP : public QObject
     /// Called to handle an FTP message
     void mavlinkMessageReceived(const mavlink_message_t &message);
 
-    void enableRandromDrops(bool enable) { _randomDropsEnabled = enable; }
+    void enableRandromDrops(bool enable) { setLinkSimulation(_latencyMsecs, enable ? 20 : 0); }
     void enableBinParamFile(bool enable) { _BinParamFileEnabled = enable; }
 
+    /// Simulates a lossy, slow link
+    ///     @param latencyMsecs Delay applied to every response
+    ///     @param dropPercent  Percentage of incoming and outgoing packets which are dropped
+    /// The drop sequence is reseeded so a given test always loses the same packets.
+    void setLinkSimulation(int latencyMsecs, int dropPercent) { _latencyMsecs = latencyMsecs; _dropPercent = dropPercent; _dropGenerator.seed(_dropSeed); }
+
+    /// @return Contents of a file uploaded to the specified path, empty if no such upload completed
+    QByteArray uploadedFile(const QString &path) const { return _uploadedFiles.value(path); }
+
     /// By calling setErrorMode with one of these modes you can cause the server to simulate an error.
     enum ErrorMode_t {
         errModeNone,                        ///< No error, respond correctly
@@ -89,11 +101,17 @@ class MockLinkFTP : public QObject
     void _openCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _readCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _burstReadCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
+    void _createCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
+    void _writeCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _terminateCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _resetCommand(uint8_t senderSystemId, uint8_t senderComponentId, uint16_t seqNumber);
     /// Generates the next sequence number given an incoming sequence number. Handles generating
     /// bad sequence numbers when errModeBadSequence is set.
     uint16_t _nextSeqNumber(uint16_t seqNumber) const;
+    /// @return true if the simulated link loses this packet
+    bool _simulateDrop(uint8_t opcode);
+    /// Sends the message now, or after the simulated latency
+    void _respond(const mavlink_message_t &message);
     static QString _createTestTempFile(int size);
 
     /// if request is a string, this ensures it's null-terminated
@@ -105,12 +123,18 @@ class MockLinkFTP : public QObject
 
     bool _BinParamFileEnabled = false;
     bool _lastReplyValid = false;
-    bool _randomDropsEnabled = false;
+    int _dropPercent = 0;                       ///< Simulated packet loss, 0 for none
+    int _latencyMsecs = 0;                      ///< Simulated response latency, 0 for immediate
+    QRandomGenerator _dropGenerator;            ///< Deterministic source for simulated packet loss
     ErrorMode_t _errMode = errModeNone;         ///< Currently set error mode, as specified by setErrorMode
     mavlink_message_t _lastReply{};
     QFile _currentFile;
     QStringList _fileList;                      ///< List of files returned by List command
+    QString _uploadPath;                        ///< Path of the file being uploaded, empty if none
+    QByteArray _uploadData;                     ///< Data written so far to the file being uploaded
+    QHash<QString, QByteArray> _uploadedFiles;  ///< Completed uploads keyed by path
     uint16_t _lastReplySequence = 0;
 
     static constexpr uint8_t _sessionId = 1;    ///< We only support a single fixed session
+    static constexpr quint32 _dropSeed = 1;     ///< Seed for _dropGenerator
 };
@@ -23,6 +23,7 @@ MockLinkMissionItemHandler::MockLinkMissionItemHandler(MockLink *mockLink)
 
     Q_ASSERT(mockLink);
 
+    _missionItemResponseTimer.setSingleShot(true);
     (void) connect(&_missionItemResponseTimer, &QTimer::timeout, this, &MockLinkMissionItemHandler::_missionItemResponseTimeout);
 }
 
@@ -33,7 +34,24 @@ MockLinkMissionItemHandler::~MockLinkMissionItemHandler()
 
 void MockLinkMissionItemHandler::_startMissionItemResponseTimer()
 {
-    _missionItemResponseTimer.start(500);
+    _missionItemResponseTimer.start(500 + (2 * _latencyMsecs));
+}
+
+bool MockLinkMissionItemHandler::_simulateDrop() const
+{
+    return ((_dropPercent > 0) && ((rand() % 100) < _dropPercent));
+}
+
+void MockLinkMissionItemHandler::_respond(const mavlink_message_t &message)
+{
+    if (_latencyMsecs <= 0) {
+        _mockLink->respondWithMavlinkMessage(message);
+        return;
+    }
+
+    QTimer::singleShot(_latencyMsecs, this, [this, message]() {
+        _mockLink->respondWithMavlinkMessage(message);
+    });
 }
 
 bool MockLinkMissionItemHandler::handleMessage(const mavlink_message_t &msg)
@@ -124,6 +142,7 @@ void MockLinkMissionItemHandler::_handleMissionRequestList(const mavlink_message
     Q_ASSERT(request.target_system == _mockLink->vehicleId());
 
     _requestType = static_cast<MAV_MISSION_TYPE>(request.mission_type);
+    _readSequenceIndex = 0;
 
     int itemCount;
     switch (_requestType) {
@@ -156,7 +175,7 @@ void MockLinkMissionItemHandler::_handleMissionRequestList(const mavlink_message
         0
     );
 
-    _mockLink->respondWithMavlinkMessage(responseMsg);
+    _respond(responseMsg);
 }
 
 void MockLinkMissionItemHandler::_handleMissionRequest(const mavlink_message_t &msg)
@@ -168,6 +187,11 @@ void MockLinkMissionItemHandler::_handleMissionRequest(const mavlink_message_t &
 
     Q_ASSERT(request.target_system == _mockLink->vehicleId());
 
+    if (_simulateDrop()) {
+        qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionRequest simulated drop of incoming request" << request.seq;
+        return;
+    }
+
     if ((_failureMode == FailReadRequest0NoResponse) && (request.seq == 0)) {
         qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionRequest not responding due to failure mode FailReadRequest0NoResponse";
         return;
@@ -184,7 +208,15 @@ void MockLinkMissionItemHandler::_handleMissionRequest(const mavlink_message_t &
         return;
     }
 
-    // FIXME: Track whether all items are requested, or requested in sequence
+    if (_strictOrdering) {
+        if (request.seq == _readSequenceIndex) {
+            _readSequenceIndex++;
+        } else if (request.seq != _readSequenceIndex - 1) {
+            qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionRequest rejecting out of sequence request expected:actual" << _readSequenceIndex << request.seq;
+            _sendAck(MAV_MISSION_INVALID_SEQUENCE);
+            return;
+        }
+    }
 
     if (((_failureMode == FailReadRequest0IncorrectSequence) && (request.seq == 0)) ||
             ((_failureMode == FailReadRequest1IncorrectSequence) && (request.seq == 1))) {
@@ -240,7 +272,12 @@ void MockLinkMissionItemHandler::_handleMissionRequest(const mavlink_message_t &
         _requestType
     );
 
-    _mockLink->respondWithMavlinkMessage(responseMsg);
+    if (_simulateDrop()) {
+        qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionRequest simulated drop of outgoing item" << request.seq;
+        return;
+    }
+
+    _respond(responseMsg);
 }
 
 void MockLinkMissionItemHandler::_handleMissionCount(const mavlink_message_t &msg)
@@ -285,6 +322,7 @@ void MockLinkMissionItemHandler::_handleMissionCount(const mavlink_message_t &ms
 
     _failWriteMissionCountFirstResponse = true;
     _writeSequenceIndex = 0;
+    _writeRetryCount = 0;
     _requestNextMissionItem(_writeSequenceIndex);
 }
 
@@ -292,8 +330,12 @@ void MockLinkMissionItemHandler::_requestNextMissionItem(int sequenceNumber)
 {
     qCDebug(MockLinkMissionItemHandlerLog) << "write sequence sequenceNumber:" << sequenceNumber << "_failureMode:" << _failureMode;
 
+    // The failure modes below abandon the write by clearing _writeSequenceCount. Otherwise items which the ground station
+    // streams ahead of the requests would still complete the mission.
+
     if ((_failureMode == FailWriteRequest1NoResponse) && (sequenceNumber == 1)) {
         qCDebug(MockLinkMissionItemHandlerLog) << "_requestNextMissionItem not responding due to failure mode FailWriteRequest1NoResponse";
+        _writeSequenceCount = 0;
         return;
     }
 
@@ -305,11 +347,13 @@ void MockLinkMissionItemHandler::_requestNextMissionItem(int sequenceNumber)
     if (((_failureMode == FailWriteRequest0IncorrectSequence) && (sequenceNumber == 0)) ||
             ((_failureMode == FailWriteRequest1IncorrectSequence) && (sequenceNumber == 1))) {
         sequenceNumber++;
+        _writeSequenceCount = 0;
     }
 
     if (((_failureMode == FailWriteRequest0ErrorAck) && (sequenceNumber == 0)) ||
             ((_failureMode == FailWriteRequest1ErrorAck) && (sequenceNumber == 1))) {
         qCDebug(MockLinkMissionItemHandlerLog) << "_requestNextMissionItem sending ack error due to failure mode";
+        _writeSequenceCount = 0;
         _sendAck(_failureAckResult);
         return;
     }
@@ -325,13 +369,22 @@ void MockLinkMissionItemHandler::_requestNextMissionItem(int sequenceNumber)
         sequenceNumber,
         _requestType
     );
-    _mockLink->respondWithMavlinkMessage(message);
 
-    // If response with Mission Item doesn't come before timer fires it's an error
-    _startMissionItemResponseTimer();
+    // The request for the final item is never dropped. Like the final ack, the protocol has no way to recover it when the
+    // ground station has already streamed the item.
+    if ((sequenceNumber != _writeSequenceCount - 1) && _simulateDrop()) {
+        qCDebug(MockLinkMissionItemHandlerLog) << "_requestNextMissionItem simulated drop of outgoing request" << sequenceNumber;
+    } else {
+        _respond(message);
+    }
+
+    // If response with Mission Item doesn't come before timer fires the item is requested again
+    if (_writeSequenceCount > 0) {
+        _startMissionItemResponseTimer();
+    }
 }
 
-void MockLinkMissionItemHandler::_sendAck(MAV_MISSION_RESULT ackType) const
+void MockLinkMissionItemHandler::_sendAck(MAV_MISSION_RESULT ackType)
 {
     qCDebug(MockLinkMissionItemHandlerLog) << "_sendAck write sequence complete ackType:" << ackType;
 
@@ -348,21 +401,46 @@ void MockLinkMissionItemHandler::_sendAck(MAV_MISSION_RESULT ackType) const
         0
     );
 
-    _mockLink->respondWithMavlinkMessage(message);
+    _respond(message);
 }
 
 void MockLinkMissionItemHandler::_handleMissionItem(const mavlink_message_t &msg)
 {
     qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionItem write sequence";
 
-    _missionItemResponseTimer.stop();
-
     mavlink_mission_item_int_t missionItemInt{};
     mavlink_msg_mission_item_int_decode(&msg, &missionItemInt);
 
     const MAV_MISSION_TYPE missionType = static_cast<MAV_MISSION_TYPE>(missionItemInt.mission_type);
     const uint16_t seq = missionItemInt.seq;
 
+    if (_simulateDrop()) {
+        qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionItem simulated drop of incoming item" << seq;
+        return;
+    }
+
+    if (_writeSequenceCount == 0) {
+        qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionItem ignoring item, no write in progress" << seq;
+        _missionItemResponseTimer.stop();
+        return;
+    }
+
+    // Items are stored strictly in order, anything else is a duplicate or was streamed ahead of a lost item
+    if (seq != _writeSequenceIndex) {
+        if (_strictOrdering && (seq != _writeSequenceIndex - 1)) {
+            qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionItem rejecting out of sequence item expected:actual" << _writeSequenceIndex << seq;
+            _missionItemResponseTimer.stop();
+            _writeSequenceCount = 0;
+            _sendAck(MAV_MISSION_INVALID_SEQUENCE);
+            return;
+        }
+        qCDebug(MockLinkMissionItemHandlerLog) << "_handleMissionItem ignoring out of sequence item expected:actual" << _writeSequenceIndex << seq;
+        return;
+    }
+
+    _missionItemResponseTimer.stop();
+    _writeRetryCount = 0;
+
     switch (missionType) {
     case MAV_MISSION_TYPE_MISSION:
         _missionItems[seq] = missionItemInt;
@@ -383,6 +461,7 @@ void MockLinkMissionItemHandler::_handleMissionItem(const mavlink_message_t &msg
     if (_writeSequenceIndex < _writeSequenceCount) {
         if ((_failureMode == FailWriteFinalAckMissingRequests) && (_writeSequenceIndex == 3)) {
             // Send MAV_MISSION_ACCEPTED ack too early
+            _writeSequenceCount = 0;
             _sendAck(MAV_MISSION_ACCEPTED);
         } else {
             _requestNextMissionItem(_writeSequenceIndex);
@@ -391,6 +470,8 @@ void MockLinkMissionItemHandler::_handleMissionItem(const mavlink_message_t &msg
         return;
     }
 
+    _writeSequenceCount = 0;
+
     if (_failureMode != FailWriteFinalAckNoResponse) {
         MAV_MISSION_RESULT ack = MAV_MISSION_ACCEPTED;
 
@@ -404,8 +485,19 @@ void MockLinkMissionItemHandler::_handleMissionItem(const mavlink_message_t &msg
 
 void MockLinkMissionItemHandler::_missionItemResponseTimeout()
 {
-    qCWarning(MockLinkMissionItemHandlerLog) << "Timeout waiting for next MISSION_ITEM_INT";
-    Q_ASSERT(false);
+    if (_writeSequenceCount == 0) {
+        return;
+    }
+
+    if (_writeRetryCount >= _maxWriteRetryCount) {
+        qCWarning(MockLinkMissionItemHandlerLog) << "Timeout waiting for next MISSION_ITEM_INT, abandoning write" << _writeSequenceIndex;
+        _writeSequenceCount = 0;
+        return;
+    }
+
+    _writeRetryCount++;
+    qCDebug(MockLinkMissionItemHandlerLog) << "Timeout waiting for next MISSION_ITEM_INT, requesting again" << _writeSequenceIndex << _writeRetryCount;
+    _requestNextMissionItem(_writeSequenceIndex);
 }
 
 void MockLinkMissionItemHandler::sendUnexpectedMissionAck(MAV_MISSION_RESULT ackType)
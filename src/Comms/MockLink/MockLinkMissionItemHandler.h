@@ -64,6 +64,15 @@ class MockLinkMissionItemHandler : public QObject
     ///     @param failureAckResult Error to send if one the ack error modes
     void setFailureMode(FailureMode_t failureMode, MAV_MISSION_RESULT failureAckResult);
 
+    /// Simulates a lossy, slow link
+    ///     @param latencyMsecs Delay applied to every message sent by the vehicle
+    ///     @param dropPercent  Percentage of mission items and item requests which are dropped in either direction
+    void setLinkSimulation(int latencyMsecs, int dropPercent) { _latencyMsecs = latencyMsecs; _dropPercent = dropPercent; }
+
+    /// Enforces PX4 transfer ordering. Reads must request the next item or repeat the previous one and writes must
+    /// send the requested item, anything else is rejected with MAV_MISSION_INVALID_SEQUENCE and ends the transfer.
+    void setStrictOrdering(bool strictOrdering) { _strictOrdering = strictOrdering; }
+
     /// Called to send a MISSION_ACK message while the MissionManager is in idle state
     void sendUnexpectedMissionAck(MAV_MISSION_RESULT ackType);
 
@@ -88,13 +97,20 @@ private slots:
     void _handleMissionCount(const mavlink_message_t &msg);
     void _handleMissionClearAll(const mavlink_message_t &msg);
     void _requestNextMissionItem(int sequenceNumber);
-    void _sendAck(MAV_MISSION_RESULT ackType) const;
+    void _sendAck(MAV_MISSION_RESULT ackType);
     void _startMissionItemResponseTimer();
+    bool _simulateDrop() const;
+    /// Sends the message now, or after the simulated latency
+    void _respond(const mavlink_message_t &message);
 
     MockLink *_mockLink = nullptr;
 
-    int _writeSequenceCount = 0;    ///< Numbers of items about to be written
+    int _writeSequenceCount = 0;    ///< Numbers of items about to be written, 0 when no write is in progress
     int _writeSequenceIndex = 0;    ///< Current index being reqested
+    int _writeRetryCount = 0;       ///< Number of times the current index has been requested again
+    int _readSequenceIndex = 0;     ///< Next index expected to be requested during a read, used by strict ordering
+
+    static constexpr int _maxWriteRetryCount = 5;
 
     typedef QMap<uint16_t, mavlink_mission_item_int_t> MissionItemList_t;
 
@@ -110,4 +126,7 @@ private slots:
     bool _failReadRequestListFirstResponse = true;
     bool _failReadRequest1FirstResponse = true;
     bool _failWriteMissionCountFirstResponse = true;
+    int _dropPercent = 0;           ///< Simulated packet loss, 0 for none
+    int _latencyMsecs = 0;          ///< Simulated response latency, 0 for immediate
+    bool _strictOrdering = false;   ///< Reject out of order transfers like PX4
 };
@@ -10,6 +10,7 @@
 #include "SerialLink.h"
 #include "QGCLoggingCategory.h"
 #include "QGCSerialPortInfo.h"
+#include "TelemetryLatency.h"
 #include <QtCore/QSettings>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -344,10 +345,11 @@ void SerialWorker::_onPortDisconnected()
 
 void SerialWorker::_onPortReadyRead()
 {
+    const qint64 readNsecs = TelemetryLatency::nowNsecs();
     const QByteArray data = _port->readAll();
     if (!data.isEmpty()) {
         // qCDebug(SerialLinkLog) << data.size();
-        emit dataReceived(data);
+        emit dataReceived(data, readNsecs);
     }
 }
 
@@ -480,9 +482,9 @@ void SerialLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("Serial Link Error"), tr("Link %1: (Port: %2) %3").arg(_serialConfig->name(), _serialConfig->portName(), errorString));
 }
 
-void SerialLink::_onDataReceived(const QByteArray &data)
+void SerialLink::_onDataReceived(const QByteArray &data, qint64 readNsecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readNsecs);
 }
 
 void SerialLink::_onDataSent(const QByteArray &data)
@@ -492,5 +494,6 @@ void SerialLink::_onDataSent(const QByteArray &data)
 
 void SerialLink::_writeBytes(const QByteArray &data)
 {
-    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::QueuedConnection, Q_ARG(QByteArray, data));
+    // Queued writes are drained on the worker thread so this is normally a direct call
+    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::AutoConnection, Q_ARG(QByteArray, data));
 }
@@ -123,7 +123,7 @@ class SerialWorker : public QObject
 signals:
     void connected();
     void disconnected();
-    void dataReceived(const QByteArray &data);
+    void dataReceived(const QByteArray &data, qint64 readNsecs);
     void dataSent(const QByteArray &data);
     void errorOccurred(const QString &errorString);
 
@@ -169,13 +169,14 @@ public slots:
 private slots:
     void _onConnected();
     void _onDisconnected();
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readNsecs);
     void _onDataSent(const QByteArray &data);
     void _onErrorOccurred(const QString &errorString);
 
 private:
     bool _connect() override;
     void _writeBytes(const QByteArray &data) override;
+    QObject *_writeContext() override { return _worker; }
 
     const SerialConfiguration *_serialConfig = nullptr;
     SerialWorker *_worker = nullptr;
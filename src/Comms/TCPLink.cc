@@ -10,6 +10,7 @@
 #include "TCPLink.h"
 #include "DeviceInfo.h"
 #include "QGCLoggingCategory.h"
+#include "TelemetryLatency.h"
 
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -231,9 +232,10 @@ void TCPWorker::_onSocketDisconnected()
 
 void TCPWorker::_onSocketReadyRead()
 {
+    const qint64 readNsecs = TelemetryLatency::nowNsecs();
     const QByteArray data = _socket->readAll();
     if (!data.isEmpty()) {
-        emit dataReceived(data);
+        emit dataReceived(data, readNsecs);
     }
 }
 
@@ -329,9 +331,9 @@ void TCPLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("TCP Link Error"), tr("Link %1: (Host: %2 Port: %3) %4").arg(_tcpConfig->name(), _tcpConfig->host()).arg(_tcpConfig->port()).arg(errorString));
 }
 
-void TCPLink::_onDataReceived(const QByteArray &data)
+void TCPLink::_onDataReceived(const QByteArray &data, qint64 readNsecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readNsecs);
 }
 
 void TCPLink::_onDataSent(const QByteArray &data)
@@ -341,7 +343,8 @@ void TCPLink::_onDataSent(const QByteArray &data)
 
 void TCPLink::_writeBytes(const QByteArray& bytes)
 {
-    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::QueuedConnection, Q_ARG(QByteArray, bytes));
+    // Queued writes are drained on the worker thread so this is normally a direct call
+    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::AutoConnection, Q_ARG(QByteArray, bytes));
 }
 
 bool TCPLink::isSecureConnection() const
@@ -75,7 +75,7 @@ class TCPWorker : public QObject
     void connected();
     void disconnected();
     void errorOccurred(const QString &errorString);
-    void dataReceived(const QByteArray &data);
+    void dataReceived(const QByteArray &data, qint64 readNsecs);
     void dataSent(const QByteArray &data);
 
 public slots:
@@ -116,11 +116,12 @@ private slots:
     void _onConnected();
     void _onDisconnected();
     void _onErrorOccurred(const QString &errorString);
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readNsecs);
     void _onDataSent(const QByteArray &data);
 
 private:
     bool _connect() override;
+    QObject *_writeContext() override { return _worker; }
 
     const TCPConfiguration *_tcpConfig = nullptr;
     TCPWorker *_worker = nullptr;
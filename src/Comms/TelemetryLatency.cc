@@ -0,0 +1,315 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TelemetryLatency.h"
+#include "QGCLoggingCategory.h"
+#include "SettingsManager.h"
+#include "MavlinkSettings.h"
+
+#include <algorithm>
+#include <bit>
+
+#include <QtCore/QApplicationStatic>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QtMath>
+
+QGC_LOGGING_CATEGORY(TelemetryLatencyLog, "Comms.TelemetryLatency")
+
+Q_APPLICATION_STATIC(TelemetryLatency, _telemetryLatencyInstance);
+
+namespace {
+
+const QElapsedTimer &monotonicClock()
+{
+    static const QElapsedTimer clock = []() {
+        QElapsedTimer timer;
+        timer.start();
+        return timer;
+    }();
+    return clock;
+}
+
+QString msecsString(qint64 nsecs)
+{
+    return QString::number(nsecs / 1e6, 'f', 3);
+}
+
+} // namespace
+
+void TelemetryLatency::Histogram_t::add(qint64 nsecs)
+{
+    nsecs = qMax(nsecs, static_cast<qint64>(0));
+
+    const quint64 usecs = static_cast<quint64>(nsecs) / 1000;
+    const int bucket = (usecs == 0) ? 0 : qMin(static_cast<int>(std::bit_width(usecs)), kBucketCount - 1);
+    buckets[bucket]++;
+    count++;
+    totalNsecs += static_cast<quint64>(nsecs);
+    maxNsecs = qMax(maxNsecs, nsecs);
+}
+
+void TelemetryLatency::Histogram_t::merge(const Histogram_t &other)
+{
+    for (int i = 0; i < kBucketCount; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    totalNsecs += other.totalNsecs;
+    maxNsecs = qMax(maxNsecs, other.maxNsecs);
+}
+
+qint64 TelemetryLatency::Histogram_t::percentileNsecs(double percentile) const
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    const quint64 target = qMax(static_cast<quint64>(1), static_cast<quint64>(qCeil(percentile * count)));
+    quint64 seen = 0;
+    for (int i = 0; i < kBucketCount; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            // The max is a tighter bound for the top bucket
+            return qMin((static_cast<qint64>(1) << i) * 1000, maxNsecs);
+        }
+    }
+
+    return maxNsecs;
+}
+
+TelemetryLatency::TelemetryLatency(QObject *parent)
+    : QObject(parent)
+{
+    qCDebug(TelemetryLatencyLog) << this;
+
+    _statsTimer.setInterval(kStatsUpdateIntervalMSecs);
+    (void) connect(&_statsTimer, &QTimer::timeout, this, [this]() {
+        if (_statsDirty) {
+            _statsDirty = false;
+            emit statsChanged();
+        }
+    });
+    _statsTimer.start();
+}
+
+TelemetryLatency::~TelemetryLatency()
+{
+    qCDebug(TelemetryLatencyLog) << this;
+}
+
+TelemetryLatency *TelemetryLatency::instance()
+{
+    return _telemetryLatencyInstance();
+}
+
+qint64 TelemetryLatency::nowNsecs()
+{
+    return monotonicClock().nsecsElapsed();
+}
+
+void TelemetryLatency::init()
+{
+    if (_enabledFact) {
+        return;
+    }
+
+    _enabledFact = SettingsManager::instance()->mavlinkSettings()->telemetryLatencyEnabled();
+    _setEnabled(_enabledFact->rawValue().toBool());
+    (void) connect(_enabledFact, &Fact::rawValueChanged, this, [this](const QVariant &value) {
+        _setEnabled(value.toBool());
+    });
+}
+
+void TelemetryLatency::setEnabled(bool enabled)
+{
+    if (_enabledFact) {
+        // The setting is the only state, so the UI and the recorder can't disagree
+        _enabledFact->setRawValue(enabled);
+    } else {
+        _setEnabled(enabled);
+    }
+}
+
+void TelemetryLatency::_setEnabled(bool enabled)
+{
+    if (enabled != _enabled) {
+        _enabled = enabled;
+        messageDone();
+        emit enabledChanged(_enabled);
+    }
+}
+
+void TelemetryLatency::setChannelName(uint8_t channel, const QString &name)
+{
+    if (channel < MAVLINK_COMM_NUM_BUFFERS) {
+        _channelNames[channel] = name;
+    }
+}
+
+void TelemetryLatency::messageParsed(uint8_t channel, uint32_t msgId, qint64 readNsecs)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    _current = &_histograms[_key(channel, msgId)];
+    _currentReadNsecs = readNsecs;
+    _currentParsedNsecs = nowNsecs();
+    _currentDispatchedNsecs = 0;
+    _factPending = false;
+
+    if (_currentReadNsecs > 0) {
+        (*_current)[LinkToParser].add(_currentParsedNsecs - _currentReadNsecs);
+    }
+    _statsDirty = true;
+}
+
+void TelemetryLatency::messageDispatched()
+{
+    if (!_current || (_currentDispatchedNsecs != 0)) {
+        return;
+    }
+
+    _currentDispatchedNsecs = nowNsecs();
+    (*_current)[ParserToVehicle].add(_currentDispatchedNsecs - _currentParsedNsecs);
+    _factPending = true;
+}
+
+void TelemetryLatency::_recordFactValueChanged()
+{
+    _factPending = false;
+    if (!_current) {
+        return;
+    }
+
+    const qint64 now = nowNsecs();
+    (*_current)[VehicleToFact].add(now - _currentDispatchedNsecs);
+    (*_current)[LinkToFact].add(now - ((_currentReadNsecs > 0) ? _currentReadNsecs : _currentParsedNsecs));
+}
+
+TelemetryLatency::Histogram_t TelemetryLatency::stageHistogram(Stage stage) const
+{
+    Histogram_t result;
+    for (const StageHistograms_t &histograms : _histograms) {
+        result.merge(histograms[stage]);
+    }
+
+    return result;
+}
+
+TelemetryLatency::Histogram_t TelemetryLatency::histogram(uint8_t channel, uint32_t msgId, Stage stage) const
+{
+    const auto it = _histograms.constFind(_key(channel, msgId));
+    if (it == _histograms.constEnd()) {
+        return Histogram_t();
+    }
+
+    return (*it)[stage];
+}
+
+QVariantList TelemetryLatency::stageSummary() const
+{
+    QVariantList summary;
+
+    for (int stage = 0; stage < StageCount; stage++) {
+        const Histogram_t histogram = stageHistogram(static_cast<Stage>(stage));
+        QVariantMap entry;
+        entry[QStringLiteral("stage")] = stageName(static_cast<Stage>(stage));
+        entry[QStringLiteral("count")] = histogram.count;
+        entry[QStringLiteral("p50Msecs")] = histogram.percentileNsecs(0.50) / 1e6;
+        entry[QStringLiteral("p95Msecs")] = histogram.percentileNsecs(0.95) / 1e6;
+        entry[QStringLiteral("p99Msecs")] = histogram.percentileNsecs(0.99) / 1e6;
+        entry[QStringLiteral("maxMsecs")] = histogram.maxNsecs / 1e6;
+        summary.append(entry);
+    }
+
+    return summary;
+}
+
+QString TelemetryLatency::dump() const
+{
+    QString result;
+    QTextStream out(&result);
+
+    const auto writeRow = [&out](const QString &link, const QString &message, Stage stage, const Histogram_t &histogram) {
+        out << link << '\t' << message << '\t' << stageName(stage) << '\t' << histogram.count << '\t'
+            << msecsString(histogram.percentileNsecs(0.50)) << '\t' << msecsString(histogram.percentileNsecs(0.95)) << '\t'
+            << msecsString(histogram.percentileNsecs(0.99)) << '\t' << msecsString(histogram.maxNsecs) << '\n';
+    };
+
+    out << "link\tmessage\tstage\tcount\tp50_ms\tp95_ms\tp99_ms\tmax_ms\n";
+    for (int stage = 0; stage < StageCount; stage++) {
+        const Histogram_t histogram = stageHistogram(static_cast<Stage>(stage));
+        if (histogram.count > 0) {
+            writeRow(QStringLiteral("*"), QStringLiteral("*"), static_cast<Stage>(stage), histogram);
+        }
+    }
+
+    QList<quint32> keys = _histograms.keys();
+    std::sort(keys.begin(), keys.end());
+    for (const quint32 key : std::as_const(keys)) {
+        const uint8_t channel = static_cast<uint8_t>(key >> 24);
+        const uint32_t msgId = key & 0xFFFFFF;
+
+        QString link = (channel < MAVLINK_COMM_NUM_BUFFERS) ? _channelNames[channel] : QString();
+        if (link.isEmpty()) {
+            link = QStringLiteral("channel %1").arg(channel);
+        }
+        const mavlink_message_info_t *const msgInfo = mavlink_get_message_info_by_id(msgId);
+        const QString message = msgInfo ? QString(msgInfo->name) : QString::number(msgId);
+
+        const StageHistograms_t &histograms = *_histograms.constFind(key);
+        for (int stage = 0; stage < StageCount; stage++) {
+            if (histograms[stage].count > 0) {
+                writeRow(link, message, static_cast<Stage>(stage), histograms[stage]);
+            }
+        }
+    }
+
+    return result;
+}
+
+bool TelemetryLatency::dumpToFile(const QString &filePath) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qCWarning(TelemetryLatencyLog) << "Unable to write latency stats" << filePath << file.errorString();
+        return false;
+    }
+
+    return (file.write(dump().toUtf8()) >= 0);
+}
+
+void TelemetryLatency::reset()
+{
+    messageDone();
+    _histograms.clear();
+    _statsDirty = false;
+    emit statsChanged();
+}
+
+QString TelemetryLatency::stageName(Stage stage)
+{
+    switch (stage) {
+    case LinkToParser:
+        return QStringLiteral("LinkToParser");
+    case ParserToVehicle:
+        return QStringLiteral("ParserToVehicle");
+    case VehicleToFact:
+        return QStringLiteral("VehicleToFact");
+    case LinkToFact:
+        return QStringLiteral("LinkToFact");
+    case StageCount:
+        break;
+    }
+
+    return QString();
+}
@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <array>
+
+#include <QtCore/QHash>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVariantList>
+#include <QtQmlIntegration/QtQmlIntegration>
+
+#include "MAVLinkLib.h"
+
+Q_DECLARE_LOGGING_CATEGORY(TelemetryLatencyLog)
+
+class Fact;
+
+/// Latency histograms for each stage of the inbound telemetry pipeline, per link and per message id:
+///     LinkToParser:       bytes read from the socket/port on the link worker thread -> message framed in MAVLinkProtocol
+///     ParserToVehicle:    message framed -> Vehicle::_mavlinkMessageReceived
+///     VehicleToFact:      Vehicle::_mavlinkMessageReceived -> first Fact::valueChanged caused by the message
+///     LinkToFact:         end to end, bytes read -> first Fact::valueChanged
+/// All stages are recorded on the main thread, only the read timestamp comes from the link worker thread.
+class TelemetryLatency : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("")
+
+    Q_PROPERTY(bool         enabled         READ enabled        WRITE setEnabled    NOTIFY enabledChanged)
+    Q_PROPERTY(QVariantList stageSummary    READ stageSummary                       NOTIFY statsChanged)
+
+public:
+    explicit TelemetryLatency(QObject *parent = nullptr);
+    ~TelemetryLatency();
+
+    static TelemetryLatency *instance();
+
+    enum Stage {
+        LinkToParser,
+        ParserToVehicle,
+        VehicleToFact,
+        LinkToFact,
+        StageCount
+    };
+    Q_ENUM(Stage)
+
+    /// Log2 buckets of microseconds, bucket n holds latencies below 2^n usecs
+    struct Histogram_t {
+        static constexpr int kBucketCount = 32;
+
+        std::array<quint32, kBucketCount> buckets{};
+        quint64 count = 0;
+        quint64 totalNsecs = 0;
+        qint64 maxNsecs = 0;
+
+        void add(qint64 nsecs);
+        void merge(const Histogram_t &other);
+        /// @return Upper bound of the bucket holding the specified percentile (0-1)
+        qint64 percentileNsecs(double percentile) const;
+    };
+
+    /// Monotonic clock shared by all threads
+    static qint64 nowNsecs();
+
+    /// Binds recording to MavlinkSettings::telemetryLatencyEnabled
+    void init();
+
+    bool enabled() const { return _enabled; }
+    /// Writes MavlinkSettings::telemetryLatencyEnabled once init() was called, recording then follows the setting
+    void setEnabled(bool enabled);
+
+    void setChannelName(uint8_t channel, const QString &name);
+
+    /// Called by MAVLinkProtocol for each framed message
+    ///     @param readNsecs When the bytes holding the message were read from the link, 0 if unknown
+    void messageParsed(uint8_t channel, uint32_t msgId, qint64 readNsecs);
+    /// Called by Vehicle when it starts handling the current message
+    void messageDispatched();
+    /// Called by Fact for every value change, only the first change caused by the current message is recorded
+    void factValueChanged() { if (_factPending) { _recordFactValueChanged(); } }
+    /// Called by MAVLinkProtocol once the current message has been handed to all receivers
+    void messageDone() { _current = nullptr; _factPending = false; }
+
+    QVariantList stageSummary() const;
+    /// @return Stage histograms merged across all links and message ids
+    Histogram_t stageHistogram(Stage stage) const;
+    Histogram_t histogram(uint8_t channel, uint32_t msgId, Stage stage) const;
+
+    /// @return Human readable table of all histograms
+    Q_INVOKABLE QString dump() const;
+    Q_INVOKABLE bool dumpToFile(const QString &filePath) const;
+    Q_INVOKABLE void reset();
+
+    static QString stageName(Stage stage);
+
+signals:
+    void enabledChanged(bool enabled);
+    void statsChanged();
+
+private:
+    void _setEnabled(bool enabled);
+    void _recordFactValueChanged();
+    static quint32 _key(uint8_t channel, uint32_t msgId) { return (static_cast<quint32>(channel) << 24) | (msgId & 0xFFFFFF); }
+
+    using StageHistograms_t = std::array<Histogram_t, StageCount>;
+
+    bool _enabled = false;     ///< Driven by MavlinkSettings::telemetryLatencyEnabled
+    Fact *_enabledFact = nullptr;
+    QHash<quint32, StageHistograms_t> _histograms;     ///< Keyed by mavlink channel and message id
+    QString _channelNames[MAVLINK_COMM_NUM_BUFFERS];
+
+    // Current message context, valid between messageParsed and messageDone
+    StageHistograms_t *_current = nullptr;
+    qint64 _currentReadNsecs = 0;
+    qint64 _currentParsedNsecs = 0;
+    qint64 _currentDispatchedNsecs = 0;
+    bool _factPending = false;
+
+    bool _statsDirty = false;
+    QTimer _statsTimer;
+
+    static constexpr int kStatsUpdateIntervalMSecs = 1000;
+};
@@ -12,6 +12,7 @@
 #include "DeviceInfo.h"
 #include "QGCLoggingCategory.h"
 #include "SettingsManager.h"
+#include "TelemetryLatency.h"
 
 #include <QtCore/QMutexLocker>
 #include <QtCore/QThread>
@@ -441,17 +442,21 @@ void UDPWorker::_onSocketReadyRead()
     QElapsedTimer timer;
     timer.start();
     bool received = false;
+    qint64 bufferReadNsecs = 0;     // Latency is measured from the oldest datagram in the buffer
     while (_socket->hasPendingDatagrams()) {
         const QNetworkDatagram datagramIn = _socket->receiveDatagram();
         if (datagramIn.isNull() || datagramIn.data().isEmpty()) {
             continue;
         }
 
+        if (buffer.isEmpty()) {
+            bufferReadNsecs = TelemetryLatency::nowNsecs();
+        }
         (void) buffer.append(datagramIn.data());
 
         if ((buffer.size() > BUFFER_TRIGGER_SIZE) || (timer.elapsed() > RECEIVE_TIME_LIMIT_MS)) {
             received = true;
-            emit dataReceived(buffer);
+            emit dataReceived(buffer, bufferReadNsecs);
             buffer.clear();
             (void) timer.restart();
         }
@@ -472,7 +477,7 @@ void UDPWorker::_onSocketReadyRead()
         return;
     }
 
-    emit dataReceived(buffer);
+    emit dataReceived(buffer, bufferReadNsecs);
 }
 
 void UDPWorker::_onSocketBytesWritten(qint64 bytes)
@@ -634,9 +639,9 @@ void UDPLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("UDP Link Error"), tr("Link %1: %2").arg(_udpConfig->name(), errorString));
 }
 
-void UDPLink::_onDataReceived(const QByteArray &data)
+void UDPLink::_onDataReceived(const QByteArray &data, qint64 readNsecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readNsecs);
 }
 
 void UDPLink::_onDataSent(const QByteArray &data)
@@ -646,7 +651,8 @@ void UDPLink::_onDataSent(const QByteArray &data)
 
 void UDPLink::_writeBytes(const QByteArray& bytes)
 {
-    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::QueuedConnection, Q_ARG(QByteArray, bytes));
+    // Queued writes are drained on the worker thread so this is normally a direct call
+    (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::AutoConnection, Q_ARG(QByteArray, bytes));
 }
 
 bool UDPLink::isSecureConnection() const
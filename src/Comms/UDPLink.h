@@ -132,7 +132,7 @@ public slots:
     void connected();
     void disconnected();
     void errorOccurred(const QString &errorString);
-    void dataReceived(const QByteArray &data);
+    void dataReceived(const QByteArray &data, qint64 readNsecs);
     void dataSent(const QByteArray &data);
 
 private slots:
@@ -184,10 +184,12 @@ private slots:
     void _onConnected();
     void _onDisconnected();
     void _onErrorOccurred(const QString &errorString);
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readNsecs);
     void _onDataSent(const QByteArray &data);
 
 private:
+    QObject *_writeContext() override { return _worker; }
+
     const UDPConfiguration *_udpConfig = nullptr;
     UDPWorker *_worker = nullptr;
     QThread *_workerThread = nullptr;
@@ -8,11 +8,13 @@
  ****************************************************************************/
 
 #include "Fact.h"
+#include "FactGroup.h"
 #include "FactValueSliderListModel.h"
 #include "QGCApplication.h"
 #include "QGCCorePlugin.h"
 #include "QGCLoggingCategory.h"
 #include "SettingsManager.h"
+#include "TelemetryLatency.h"
 
 QGC_LOGGING_CATEGORY(FactLog, "FactSystem.Fact")
 
@@ -109,7 +111,7 @@ void Fact::forceSetRawValue(const QVariant &value)
 
         if (_metaData->convertAndValidateRaw(value, true /* convertOnly */, typedValue, errorString)) {
             _rawValue.setValue(typedValue);
-            _sendValueChangedSignal(cookedValue());
+            _sendValueChangedSignal();
             //-- Must be in this order
             emit containerRawValueChanged(rawValue());
             emit rawValueChanged(_rawValue);
@@ -128,7 +130,7 @@ void Fact::setRawValue(const QVariant &value)
         if (_metaData->convertAndValidateRaw(value, true /* convertOnly */, typedValue, errorString)) {
             if (typedValue != _rawValue) {
                 _rawValue.setValue(typedValue);
-                _sendValueChangedSignal(cookedValue());
+                _sendValueChangedSignal();
                 //-- Must be in this order
                 emit containerRawValueChanged(rawValue());
                 emit rawValueChanged(_rawValue);
@@ -139,6 +141,117 @@ void Fact::setRawValue(const QVariant &value)
     }
 }
 
+template<typename T>
+void Fact::_setTypedRawValue(T value)
+{
+    // Compare in place when the stored value already has the right type, which is the case after the first update
+    bool changed;
+    if (_rawValue.metaType() == QMetaType::fromType<T>()) {
+        const T current = *static_cast<const T*>(_rawValue.constData());
+        changed = (current != value);
+        if constexpr (std::is_floating_point_v<T>) {
+            // Telemetry reports unknown values as NaN, repeating one is not a change
+            changed = changed && !(qIsNaN(current) && qIsNaN(value));
+        }
+    } else {
+        changed = (QVariant::fromValue(value) != _rawValue);
+    }
+
+    if (changed) {
+        _rawValue.setValue(value);
+        _sendValueChangedSignal();
+        //-- Must be in this order
+        emit containerRawValueChanged(_rawValue);
+        emit rawValueChanged(_rawValue);
+    }
+}
+
+void Fact::_setRawValueDouble(double value)
+{
+    if (_metaData) {
+        switch (_metaData->type()) {
+        case FactMetaData::valueTypeDouble:
+        case FactMetaData::valueTypeElapsedTimeInSeconds:
+            _setTypedRawValue(value);
+            return;
+        case FactMetaData::valueTypeFloat:
+            _setTypedRawValue(static_cast<float>(value));
+            return;
+        default:
+            break;
+        }
+    }
+
+    setRawValue(QVariant(value));
+}
+
+void Fact::_setRawValueInt64(qint64 value)
+{
+    if (_metaData) {
+        switch (_metaData->type()) {
+        case FactMetaData::valueTypeInt8:
+        case FactMetaData::valueTypeInt16:
+        case FactMetaData::valueTypeInt32:
+            if ((value >= std::numeric_limits<int>::min()) && (value <= std::numeric_limits<int>::max())) {
+                _setTypedRawValue(static_cast<int>(value));
+                return;
+            }
+            break;
+        case FactMetaData::valueTypeInt64:
+            _setTypedRawValue(static_cast<qlonglong>(value));
+            return;
+        case FactMetaData::valueTypeUint8:
+        case FactMetaData::valueTypeUint16:
+        case FactMetaData::valueTypeUint32:
+            if ((value >= 0) && (value <= std::numeric_limits<uint>::max())) {
+                _setTypedRawValue(static_cast<uint>(value));
+                return;
+            }
+            break;
+        case FactMetaData::valueTypeUint64:
+            if (value >= 0) {
+                _setTypedRawValue(static_cast<qulonglong>(value));
+                return;
+            }
+            break;
+        case FactMetaData::valueTypeDouble:
+        case FactMetaData::valueTypeElapsedTimeInSeconds:
+            _setTypedRawValue(static_cast<double>(value));
+            return;
+        case FactMetaData::valueTypeFloat:
+            _setTypedRawValue(static_cast<float>(value));
+            return;
+        case FactMetaData::valueTypeBool:
+            _setTypedRawValue(value != 0);
+            return;
+        default:
+            break;
+        }
+    }
+
+    setRawValue(QVariant(static_cast<qlonglong>(value)));
+}
+
+void Fact::_setRawValueUInt64(quint64 value)
+{
+    if (value <= static_cast<quint64>(std::numeric_limits<qint64>::max())) {
+        _setRawValueInt64(static_cast<qint64>(value));
+    } else if (_metaData && (_metaData->type() == FactMetaData::valueTypeUint64)) {
+        _setTypedRawValue(static_cast<qulonglong>(value));
+    } else {
+        setRawValue(QVariant(static_cast<qulonglong>(value)));
+    }
+}
+
+void Fact::_setRawValueBool(bool value)
+{
+    if (_metaData && (_metaData->type() == FactMetaData::valueTypeBool)) {
+        _setTypedRawValue(value);
+    } else {
+        _setRawValueInt64(value ? 1 : 0);
+    }
+}
+
 void Fact::setCookedValue(const QVariant& value)
 {
     if (_metaData) {
@@ -178,7 +291,7 @@ void Fact::containerSetRawValue(const QVariant &value)
 {
     if (_rawValue != value) {
         _rawValue = value;
-        _sendValueChangedSignal(cookedValue());
+        _sendValueChangedSignal();
         emit rawValueChanged(_rawValue);
     }
 
@@ -189,6 +302,12 @@ void Fact::containerSetRawValue(const QVariant &value)
 QVariant Fact::cookedValue() const
 {
     if (_metaData) {
+        if (_metaData->rawTranslatorIsDefault()) {
+            return _rawValue;
+        }
+        if (const FactMetaData::NumericTranslator translator = _metaData->rawNumericTranslator()) {
+            return QVariant(translator(_rawValueDouble()));
+        }
         return _metaData->rawTranslator()(_rawValue);
     } else {
         qCWarning(FactLog) << kMissingMetadata << name();
@@ -196,6 +315,36 @@ QVariant Fact::cookedValue() const
     }
 }
 
+double Fact::cookedValueDouble() const
+{
+    if (_metaData) {
+        if (_metaData->rawTranslatorIsDefault()) {
+            return _rawValueDouble();
+        }
+        if (const FactMetaData::NumericTranslator translator = _metaData->rawNumericTranslator()) {
+            return translator(_rawValueDouble());
+        }
+        return _metaData->rawTranslator()(_rawValue).toDouble();
+    } else {
+        qCWarning(FactLog) << kMissingMetadata << name();
+        return _rawValue.toDouble();
+    }
+}
+
+double Fact::_rawValueDouble() const
+{
+    const QMetaType metaType = _rawValue.metaType();
+    if (metaType == QMetaType::fromType<double>()) {
+        return *static_cast<const double*>(_rawValue.constData());
+    } else if (metaType == QMetaType::fromType<float>()) {
+        return *static_cast<const float*>(_rawValue.constData());
+    } else if (metaType == QMetaType::fromType<int>()) {
+        return *static_cast<const int*>(_rawValue.constData());
+    }
+
+    return _rawValue.toDouble();
+}
+
 QString Fact::enumStringValue()
 {
     if (_metaData) {
@@ -645,13 +794,20 @@ void Fact::setSendValueChangedSignals(bool sendValueChangedSignals)
     }
 }
 
-void Fact::_sendValueChangedSignal(const QVariant &value)
+void Fact::_sendValueChangedSignal()
 {
     if (_sendValueChangedSignals) {
-        emit valueChanged(value);
+        if (TelemetryLatency *const latency = TelemetryLatency::instance()) {
+            latency->factValueChanged();
+        }
+        emit valueChanged(cookedValue());
         _deferredValueChangeSignal = false;
-    } else {
+    } else if (!_deferredValueChangeSignal) {
+        // The cooked value is not translated until the deferred signal is actually sent
         _deferredValueChangeSignal = true;
+        if (_deferredValueChangeGroup) {
+            _deferredValueChangeGroup->_factValueChangeDeferred(this);
+        }
     }
 }
 
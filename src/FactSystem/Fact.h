@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
 #include <QtCore/QString>
@@ -17,6 +19,7 @@
 
 #include "FactMetaData.h"
 
+class FactGroup;
 class FactValueSliderListModel;
 
 Q_DECLARE_LOGGING_CATEGORY(FactLog)
@@ -85,6 +88,7 @@ class Fact : public QObject
     /// Convert and clamp value
     Q_INVOKABLE QVariant clamp(const QString &cookedValue);
     QVariant cookedValue() const; /// Value after translation
+    double cookedValueDouble() const; /// Value after translation, without boxing it in a QVariant. For use by numeric Facts only.
     QVariant rawValue() const { return _rawValue; }  /// value prior to translation, careful
     int componentId() const { return _componentId; }
     int decimalPlaces() const;
@@ -137,6 +141,23 @@ class Fact : public QObject
     QString rawValueStringFullPrecision() const;
 
     void setRawValue(const QVariant &value);
+
+    /// Typed fast path for high rate telemetry. When the value fits the Fact type it is stored and compared in place,
+    /// skipping QVariant conversion and comparison. Any other combination goes through the QVariant version.
+    template<typename T> requires std::is_arithmetic_v<T>
+    void setRawValue(T value)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            _setRawValueBool(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            _setRawValueDouble(static_cast<double>(value));
+        } else if constexpr (std::is_signed_v<T>) {
+            _setRawValueInt64(static_cast<qint64>(value));
+        } else {
+            _setRawValueUInt64(static_cast<quint64>(value));
+        }
+    }
+
     void setCookedValue(const QVariant &value);
     void setEnumIndex(int index);
     void setEnumStringValue(const QString &value);
@@ -149,6 +170,8 @@ class Fact : public QObject
     bool deferredValueChangeSignal() const { return _deferredValueChangeSignal; }
     void clearDeferredValueChangeSignal() { _deferredValueChangeSignal = false; }
     void sendDeferredValueChangedSignal();
+    /// Group which is told the first time a value change is deferred, so it only needs to visit changed Facts
+    void setDeferredValueChangeGroup(FactGroup *factGroup) { _deferredValueChangeGroup = factGroup; }
 
     /// Sets and sends new value to vehicle even if value is the same
     void forceSetRawValue(const QVariant &value);
@@ -187,7 +210,7 @@ class Fact : public QObject
 
 protected:
     QString _variantToString(const QVariant &variant, int decimalPlaces) const;
-    void _sendValueChangedSignal(const QVariant &value);
+    void _sendValueChangedSignal();
 
     QString _name;
     int _componentId = -1;
@@ -196,6 +219,7 @@ class Fact : public QObject
     FactMetaData *_metaData = nullptr;
     bool _sendValueChangedSignals = true;
     bool _deferredValueChangeSignal = false;
+    FactGroup *_deferredValueChangeGroup = nullptr;
     FactValueSliderListModel *_valueSliderModel = nullptr;
 
     static constexpr const char *kMissingMetadata = "Meta data pointer missing";
@@ -205,4 +229,10 @@ private slots:
 
 private:
     void _init();
+    void _setRawValueDouble(double value);
+    void _setRawValueInt64(qint64 value);
+    void _setRawValueUInt64(quint64 value);
+    void _setRawValueBool(bool value);
+    template<typename T> void _setTypedRawValue(T value);
+    double _rawValueDouble() const;
 };
@@ -127,6 +127,10 @@ void FactGroup::_addFact(Fact *fact, const QString &name)
     }
 
     fact->setSendValueChangedSignals(_updateRateMSecs == 0);
+    fact->setDeferredValueChangeGroup(this);
+    if (fact->deferredValueChangeSignal()) {
+        _deferredFacts.append(fact);
+    }
     if (_nameToFactMetaDataMap.contains(name)) {
         fact->setMetaData(_nameToFactMetaDataMap[name], true /* setDefaultFromMetaData */);
     }
@@ -150,9 +154,22 @@ void FactGroup::_addFactGroup(FactGroup *factGroup, const QString &name)
 
 void FactGroup::_updateAllValues()
 {
-    for (Fact *fact: _nameToFactMap) {
-        fact->sendDeferredValueChangedSignal();
+    _sendDeferredValueChangedSignals();
+}
+
+void FactGroup::_sendDeferredValueChangedSignals()
+{
+    if (_deferredFacts.isEmpty()) {
+        return;
     }
+
+    // Indexed loop since valueChanged handlers may change other Facts in this group, those go out in this pass as well
+    for (qsizetype i = 0; i < _deferredFacts.size(); i++) {
+        _deferredFacts[i]->sendDeferredValueChangedSignal();
+    }
+    _deferredFacts.clear();
+
+    emit valuesUpdated();
 }
 
 void FactGroup::setLiveUpdates(bool liveUpdates)
@@ -170,6 +187,11 @@ void FactGroup::setLiveUpdates(bool liveUpdates)
     for (Fact *fact: _nameToFactMap) {
         fact->setSendValueChangedSignals(liveUpdates);
     }
+
+    if (liveUpdates) {
+        // Flush anything which was still waiting on the timer
+        _sendDeferredValueChangedSignals();
+    }
 }
 
 
@@ -64,6 +64,8 @@ class FactGroup : public QObject
     void factNamesChanged();
     void factGroupNamesChanged();
     void telemetryAvailableChanged(bool telemetryAvailable);
+    /// Signalled once per update interval after the deferred valueChanged signals of all Facts which changed have been sent
+    void valuesUpdated();
 
 protected slots:
     virtual void _updateAllValues();
@@ -84,10 +86,16 @@ protected slots:
     QStringList _factNames;
 
 private:
+    /// Called by Fact the first time a value change is deferred since the last update
+    void _factValueChangeDeferred(Fact *fact) { _deferredFacts.append(fact); }
+    void _sendDeferredValueChangedSignals();
     void _setupTimer();
     static QString _camelCase(const QString &text);
 
     QTimer _updateTimer;
+    QList<Fact*> _deferredFacts;    ///< Facts with a pending valueChanged signal, in the order they changed
     const bool _ignoreCamelCase = false;
     bool _telemetryAvailable = false;
+
+    friend class Fact;
 };
@@ -20,44 +20,44 @@ QGC_LOGGING_CATEGORY(FactMetaDataLog, "FactSystem.FactMetaData")
 
 // Built in translations for all Facts
 const FactMetaData::BuiltInTranslation_s FactMetaData::_rgBuiltInTranslations[] = {
-    { "centi-degrees",  "deg",  FactMetaData::_centiDegreesToDegrees,                   FactMetaData::_degreesToCentiDegrees },
-    { "radians",        "deg",  FactMetaData::_radiansToDegrees,                        FactMetaData::_degreesToRadians },
-    { "rad",            "deg",  FactMetaData::_radiansToDegrees,                        FactMetaData::_degreesToRadians },
-    { "gimbal-degrees", "deg",  FactMetaData::_mavlinkGimbalDegreesToUserGimbalDegrees, FactMetaData::_userGimbalDegreesToMavlinkGimbalDegrees },
-    { "norm",           "%",    FactMetaData::_normToPercent,                           FactMetaData::_percentToNorm },
-    { "centi-celsius",  "C",    FactMetaData::_centiCelsiusToCelsius,                   FactMetaData::_celsiusToCentiCelsius },
+    { "centi-degrees",  "deg",  FactMetaData::_numericToIntTranslators<FactMetaData::_centiDegreesToDegrees, FactMetaData::_degreesToCentiDegrees>() },
+    { "radians",        "deg",  FactMetaData::_numericTranslators<FactMetaData::_radiansToDegrees, FactMetaData::_degreesToRadians>() },
+    { "rad",            "deg",  FactMetaData::_numericTranslators<FactMetaData::_radiansToDegrees, FactMetaData::_degreesToRadians>() },
+    { "gimbal-degrees", "deg",  FactMetaData::_numericTranslators<FactMetaData::_mavlinkGimbalDegreesToUserGimbalDegrees, FactMetaData::_userGimbalDegreesToMavlinkGimbalDegrees>() },
+    { "norm",           "%",    FactMetaData::_numericTranslators<FactMetaData::_normToPercent, FactMetaData::_percentToNorm>() },
+    { "centi-celsius",  "C",    FactMetaData::_numericToIntTranslators<FactMetaData::_centiCelsiusToCelsius, FactMetaData::_celsiusToCentiCelsius>() },
 };
 
 // Translations driven by app settings
 const FactMetaData::AppSettingsTranslation_s FactMetaData::_rgAppSettingsTranslations[] = {
-    { "m",      "m",        FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "meter",  "meter",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "meters", "meters",   FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
+    { "m",      "m",        FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslators() },
+    { "meter",  "meter",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslators() },
+    { "meters", "meters",   FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslators() },
     // NOTE: we've coined an artificial "raw unit" of "vertical metre" to separate it from the horizontal metre - a bit awkward but this is all the design permits
-    { "vertical m",  "m",   FactMetaData::UnitVerticalDistance,      UnitsSettings::VerticalDistanceUnitsMeters,   FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "cm/px",  "cm/px",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "m/s",    "m/s",      FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsMetersPerSecond,     FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "C",      "C",        FactMetaData::UnitTemperature,           UnitsSettings::TemperatureUnitsCelsius,       FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "m^2",    "m^2",      FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareMeters,         FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "m",      "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_metersToFeet,                        FactMetaData::_feetToMeters },
-    { "meter",  "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_metersToFeet,                        FactMetaData::_feetToMeters },
-    { "meters", "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_metersToFeet,                        FactMetaData::_feetToMeters },
-    { "vertical m",  "ft",  FactMetaData::UnitVerticalDistance,      UnitsSettings::VerticalDistanceUnitsFeet,     FactMetaData::_metersToFeet,                        FactMetaData::_feetToMeters },
-    { "cm/px",  "in/px",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_centimetersToInches,                 FactMetaData::_inchesToCentimeters },
-    { "m^2",    "km^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareKilometers,     FactMetaData::_squareMetersToSquareKilometers,      FactMetaData::_squareKilometersToSquareMeters },
-    { "m^2",    "ha",       FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsHectares,             FactMetaData::_squareMetersToHectares,              FactMetaData::_hectaresToSquareMeters },
-    { "m^2",    "ft^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareFeet,           FactMetaData::_squareMetersToSquareFeet,            FactMetaData::_squareFeetToSquareMeters },
-    { "m^2",    "ac",       FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsAcres,                FactMetaData::_squareMetersToAcres,                 FactMetaData::_acresToSquareMeters },
-    { "m^2",    "mi^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareMiles,          FactMetaData::_squareMetersToSquareMiles,           FactMetaData::_squareMilesToSquareMeters },
-    { "m/s",    "ft/s",     FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsFeetPerSecond,       FactMetaData::_metersToFeet,                        FactMetaData::_feetToMeters },
-    { "m/s",    "mph",      FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsMilesPerHour,        FactMetaData::_metersPerSecondToMilesPerHour,       FactMetaData::_milesPerHourToMetersPerSecond },
-    { "m/s",    "km/h",     FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsKilometersPerHour,   FactMetaData::_metersPerSecondToKilometersPerHour,  FactMetaData::_kilometersPerHourToMetersPerSecond },
-    { "m/s",    "kn",       FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsKnots,               FactMetaData::_metersPerSecondToKnots,              FactMetaData::_knotsToMetersPerSecond },
-    { "C",      "F",        FactMetaData::UnitTemperature,           UnitsSettings::TemperatureUnitsFarenheit,     FactMetaData::_celsiusToFarenheit,                  FactMetaData::_farenheitToCelsius },
-    { "g",      "g",        FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsGrams,              FactMetaData::_defaultTranslator,                   FactMetaData::_defaultTranslator },
-    { "g",      "kg",       FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsKg,                 FactMetaData::_gramsToKilograms,                    FactMetaData::_kilogramsToGrams },
-    { "g",      "oz",       FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsOz,                 FactMetaData::_gramsToOunces,                       FactMetaData::_ouncesToGrams },
-    { "g",      "lbs",      FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsLbs,                FactMetaData::_gramsToPunds,                        FactMetaData::_poundsToGrams },
+    { "vertical m",  "m",   FactMetaData::UnitVerticalDistance,      UnitsSettings::VerticalDistanceUnitsMeters,   FactMetaData::_defaultTranslators() },
+    { "cm/px",  "cm/px",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsMeters, FactMetaData::_defaultTranslators() },
+    { "m/s",    "m/s",      FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsMetersPerSecond,     FactMetaData::_defaultTranslators() },
+    { "C",      "C",        FactMetaData::UnitTemperature,           UnitsSettings::TemperatureUnitsCelsius,       FactMetaData::_defaultTranslators() },
+    { "m^2",    "m^2",      FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareMeters,         FactMetaData::_defaultTranslators() },
+    { "m",      "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_numericTranslators<FactMetaData::_metersToFeet, FactMetaData::_feetToMeters>() },
+    { "meter",  "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_numericTranslators<FactMetaData::_metersToFeet, FactMetaData::_feetToMeters>() },
+    { "meters", "ft",       FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_numericTranslators<FactMetaData::_metersToFeet, FactMetaData::_feetToMeters>() },
+    { "vertical m",  "ft",  FactMetaData::UnitVerticalDistance,      UnitsSettings::VerticalDistanceUnitsFeet,     FactMetaData::_numericTranslators<FactMetaData::_metersToFeet, FactMetaData::_feetToMeters>() },
+    { "cm/px",  "in/px",    FactMetaData::UnitHorizontalDistance,    UnitsSettings::HorizontalDistanceUnitsFeet,   FactMetaData::_numericTranslators<FactMetaData::_centimetersToInches, FactMetaData::_inchesToCentimeters>() },
+    { "m^2",    "km^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareKilometers,     FactMetaData::_numericTranslators<FactMetaData::_squareMetersToSquareKilometers, FactMetaData::_squareKilometersToSquareMeters>() },
+    { "m^2",    "ha",       FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsHectares,             FactMetaData::_numericTranslators<FactMetaData::_squareMetersToHectares, FactMetaData::_hectaresToSquareMeters>() },
+    { "m^2",    "ft^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareFeet,           FactMetaData::_numericTranslators<FactMetaData::_squareMetersToSquareFeet, FactMetaData::_squareFeetToSquareMeters>() },
+    { "m^2",    "ac",       FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsAcres,                FactMetaData::_numericTranslators<FactMetaData::_squareMetersToAcres, FactMetaData::_acresToSquareMeters>() },
+    { "m^2",    "mi^2",     FactMetaData::UnitArea,                  UnitsSettings::AreaUnitsSquareMiles,          FactMetaData::_numericTranslators<FactMetaData::_squareMetersToSquareMiles, FactMetaData::_squareMilesToSquareMeters>() },
+    { "m/s",    "ft/s",     FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsFeetPerSecond,       FactMetaData::_numericTranslators<FactMetaData::_metersToFeet, FactMetaData::_feetToMeters>() },
+    { "m/s",    "mph",      FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsMilesPerHour,        FactMetaData::_numericTranslators<FactMetaData::_metersPerSecondToMilesPerHour, FactMetaData::_milesPerHourToMetersPerSecond>() },
+    { "m/s",    "km/h",     FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsKilometersPerHour,   FactMetaData::_numericTranslators<FactMetaData::_metersPerSecondToKilometersPerHour, FactMetaData::_kilometersPerHourToMetersPerSecond>() },
+    { "m/s",    "kn",       FactMetaData::UnitSpeed,                 UnitsSettings::SpeedUnitsKnots,               FactMetaData::_numericTranslators<FactMetaData::_metersPerSecondToKnots, FactMetaData::_knotsToMetersPerSecond>() },
+    { "C",      "F",        FactMetaData::UnitTemperature,           UnitsSettings::TemperatureUnitsFarenheit,     FactMetaData::_numericTranslators<FactMetaData::_celsiusToFarenheit, FactMetaData::_farenheitToCelsius>() },
+    { "g",      "g",        FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsGrams,              FactMetaData::_defaultTranslators() },
+    { "g",      "kg",       FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsKg,                 FactMetaData::_numericTranslators<FactMetaData::_gramsToKilograms, FactMetaData::_kilogramsToGrams>() },
+    { "g",      "oz",       FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsOz,                 FactMetaData::_numericTranslators<FactMetaData::_gramsToOunces, FactMetaData::_ouncesToGrams>() },
+    { "g",      "lbs",      FactMetaData::UnitWeight,                UnitsSettings::WeightUnitsLbs,                FactMetaData::_numericTranslators<FactMetaData::_gramsToPunds, FactMetaData::_poundsToGrams>() },
 };
 
 FactMetaData::FactMetaData(QObject *parent)
@@ -114,6 +114,8 @@ const FactMetaData &FactMetaData::operator=(const FactMetaData &other)
     _cookedUnits = other._cookedUnits;
     _rawTranslator = other._rawTranslator;
     _cookedTranslator = other._cookedTranslator;
+    _rawNumericTranslator = other._rawNumericTranslator;
+    _cookedNumericTranslator = other._cookedNumericTranslator;
     _vehicleRebootRequired = other._vehicleRebootRequired;
     _qgcRebootRequired = other._qgcRebootRequired;
     _rawIncrement = other._rawIncrement;
@@ -580,13 +582,25 @@ void FactMetaData::setTranslators(Translator rawTranslator, Translator cookedTra
 {
     _rawTranslator = rawTranslator;
     _cookedTranslator = cookedTranslator;
+
+    // Custom translators only have a QVariant form
+    _rawNumericTranslator = nullptr;
+    _cookedNumericTranslator = nullptr;
+}
+
+void FactMetaData::_setTranslators(const Translators_s &translators)
+{
+    _rawTranslator = translators.raw;
+    _cookedTranslator = translators.cooked;
+    _rawNumericTranslator = translators.rawNumeric;
+    _cookedNumericTranslator = translators.cookedNumeric;
 }
 
 void FactMetaData::setBuiltInTranslator()
 {
     if (_enumStrings.count() || _bitmaskStrings.count()) {
         // No translation if enum
-        setTranslators(_defaultTranslator, _defaultTranslator);
+        _setTranslators(_defaultTranslators());
         _cookedUnits = _rawUnits;
         return;
     } else {
@@ -595,7 +609,7 @@ void FactMetaData::setBuiltInTranslator()
 
             if (pBuiltInTranslation->rawUnits.toLower() == _rawUnits.toLower()) {
                 _cookedUnits = pBuiltInTranslation->cookedUnits;
-                setTranslators(pBuiltInTranslation->rawTranslator, pBuiltInTranslation->cookedTranslator);
+                _setTranslators(pBuiltInTranslation->translators);
                 return;
             }
         }
@@ -605,198 +619,198 @@ void FactMetaData::setBuiltInTranslator()
     _setAppSettingsTranslators();
 }
 
-QVariant FactMetaData::_degreesToRadians(const QVariant &degrees)
+double FactMetaData::_degreesToRadians(double degrees)
 {
-    return QVariant(qDegreesToRadians(degrees.toDouble()));
+    return qDegreesToRadians(degrees);
 }
 
-QVariant FactMetaData::_radiansToDegrees(const QVariant &radians)
+double FactMetaData::_radiansToDegrees(double radians)
 {
-    return QVariant(qRadiansToDegrees(radians.toDouble()));
+    return qRadiansToDegrees(radians);
 }
 
-QVariant FactMetaData::_centiDegreesToDegrees(const QVariant &centiDegrees)
+double FactMetaData::_centiDegreesToDegrees(double centiDegrees)
 {
-    return QVariant(centiDegrees.toReal() / 100.0);
+    return centiDegrees / 100.0;
 }
 
-QVariant FactMetaData::_degreesToCentiDegrees(const QVariant &degrees)
+double FactMetaData::_degreesToCentiDegrees(double degrees)
 {
-    return QVariant(qRound(degrees.toReal() * 100.0));
+    return qRound(degrees * 100.0);
 }
 
-QVariant FactMetaData::_centiCelsiusToCelsius(const QVariant &centiCelsius)
+double FactMetaData::_centiCelsiusToCelsius(double centiCelsius)
 {
-    return QVariant(centiCelsius.toReal() / 100.0);
+    return centiCelsius / 100.0;
 }
 
-QVariant FactMetaData::_celsiusToCentiCelsius(const QVariant &celsius)
+double FactMetaData::_celsiusToCentiCelsius(double celsius)
 {
-    return QVariant(qRound(celsius.toReal() * 100.0));
+    return qRound(celsius * 100.0);
 }
 
-QVariant FactMetaData::_userGimbalDegreesToMavlinkGimbalDegrees(const QVariant &userGimbalDegrees)
+double FactMetaData::_userGimbalDegreesToMavlinkGimbalDegrees(double userGimbalDegrees)
 {
     // User facing gimbal degree values are from 0 (level) to 90 (straight down)
     // Mavlink gimbal degree values are from 0 (level) to -90 (straight down)
-    return (userGimbalDegrees.toDouble() * -1.0);
+    return (userGimbalDegrees * -1.0);
 }
 
-QVariant FactMetaData::_mavlinkGimbalDegreesToUserGimbalDegrees(const QVariant& mavlinkGimbalDegrees)
+double FactMetaData::_mavlinkGimbalDegreesToUserGimbalDegrees(double mavlinkGimbalDegrees)
 {
     // User facing gimbal degree values are from 0 (level) to 90 (straight down)
     // Mavlink gimbal degree values are from 0 (level) to -90 (straight down)
-    return (mavlinkGimbalDegrees.toDouble() * -1.0);
+    return (mavlinkGimbalDegrees * -1.0);
 }
 
-QVariant FactMetaData::_metersToFeet(const QVariant &meters)
+double FactMetaData::_metersToFeet(double meters)
 {
-    return QVariant((meters.toDouble() * 1.0) / constants.feetToMeters);
+    return (meters * 1.0) / constants.feetToMeters;
 }
 
-QVariant FactMetaData::_feetToMeters(const QVariant &feet)
+double FactMetaData::_feetToMeters(double feet)
 {
-    return QVariant(feet.toDouble() * constants.feetToMeters);
+    return feet * constants.feetToMeters;
 }
 
-QVariant FactMetaData::_squareMetersToSquareKilometers(const QVariant &squareMeters)
+double FactMetaData::_squareMetersToSquareKilometers(double squareMeters)
 {
-    return QVariant(squareMeters.toDouble() * 0.000001);
+    return squareMeters * 0.000001;
 }
 
-QVariant FactMetaData::_squareKilometersToSquareMeters(const QVariant &squareKilometers)
+double FactMetaData::_squareKilometersToSquareMeters(double squareKilometers)
 {
-    return QVariant(squareKilometers.toDouble() * 1000000.0);
+    return squareKilometers * 1000000.0;
 }
 
-QVariant FactMetaData::_squareMetersToHectares(const QVariant &squareMeters)
+double FactMetaData::_squareMetersToHectares(double squareMeters)
 {
-    return QVariant(squareMeters.toDouble() * 0.0001);
+    return squareMeters * 0.0001;
 }
 
-QVariant FactMetaData::_hectaresToSquareMeters(const QVariant &hectares)
+double FactMetaData::_hectaresToSquareMeters(double hectares)
 {
-    return QVariant(hectares.toDouble() * 1000.0);
+    return hectares * 1000.0;
 }
 
-QVariant FactMetaData::_squareMetersToSquareFeet(const QVariant &squareMeters)
+double FactMetaData::_squareMetersToSquareFeet(double squareMeters)
 {
-    return QVariant(squareMeters.toDouble() * constants.squareMetersToSquareFeet);
+    return squareMeters * constants.squareMetersToSquareFeet;
 }
 
-QVariant FactMetaData::_squareFeetToSquareMeters(const QVariant &squareFeet)
+double FactMetaData::_squareFeetToSquareMeters(double squareFeet)
 {
-    return QVariant(squareFeet.toDouble() * constants.feetToSquareMeters);
+    return squareFeet * constants.feetToSquareMeters;
 }
 
-QVariant FactMetaData::_squareMetersToAcres(const QVariant &squareMeters)
+double FactMetaData::_squareMetersToAcres(double squareMeters)
 {
-    return QVariant(squareMeters.toDouble() * constants.squareMetersToAcres);
+    return squareMeters * constants.squareMetersToAcres;
 }
 
-QVariant FactMetaData::_acresToSquareMeters(const QVariant &acres)
+double FactMetaData::_acresToSquareMeters(double acres)
 {
-    return QVariant(acres.toDouble() * constants.acresToSquareMeters);
+    return acres * constants.acresToSquareMeters;
 }
 
-QVariant FactMetaData::_squareMetersToSquareMiles(const QVariant &squareMeters)
+double FactMetaData::_squareMetersToSquareMiles(double squareMeters)
 {
-    return QVariant(squareMeters.toDouble() * constants.squareMetersToSquareMiles);
+    return squareMeters * constants.squareMetersToSquareMiles;
 }
 
-QVariant FactMetaData::_squareMilesToSquareMeters(const QVariant &squareMiles)
+double FactMetaData::_squareMilesToSquareMeters(double squareMiles)
 {
-    return QVariant(squareMiles.toDouble() * constants.squareMilesToSquareMeters);
+    return squareMiles * constants.squareMilesToSquareMeters;
 }
 
-QVariant FactMetaData::_metersPerSecondToMilesPerHour(const QVariant &metersPerSecond)
+double FactMetaData::_metersPerSecondToMilesPerHour(double metersPerSecond)
 {
-    return QVariant(((metersPerSecond.toDouble() * 1.0) / constants.milesToMeters) * constants.secondsPerHour);
+    return ((metersPerSecond * 1.0) / constants.milesToMeters) * constants.secondsPerHour;
 }
 
-QVariant FactMetaData::_milesPerHourToMetersPerSecond(const QVariant &milesPerHour)
+double FactMetaData::_milesPerHourToMetersPerSecond(double milesPerHour)
 {
-    return QVariant((milesPerHour.toDouble() * constants.milesToMeters) / constants.secondsPerHour);
+    return (milesPerHour * constants.milesToMeters) / constants.secondsPerHour;
 }
 
-QVariant FactMetaData::_metersPerSecondToKilometersPerHour(const QVariant &metersPerSecond)
+double FactMetaData::_metersPerSecondToKilometersPerHour(double metersPerSecond)
 {
-    return QVariant((metersPerSecond.toDouble() / 1000.0) * constants.secondsPerHour);
+    return (metersPerSecond / 1000.0) * constants.secondsPerHour;
 }
 
-QVariant FactMetaData::_kilometersPerHourToMetersPerSecond(const QVariant &kilometersPerHour)
+double FactMetaData::_kilometersPerHourToMetersPerSecond(double kilometersPerHour)
 {
-    return QVariant((kilometersPerHour.toDouble() * 1000.0) / constants.secondsPerHour);
+    return (kilometersPerHour * 1000.0) / constants.secondsPerHour;
 }
 
-QVariant FactMetaData::_metersPerSecondToKnots(const QVariant &metersPerSecond)
+double FactMetaData::_metersPerSecondToKnots(double metersPerSecond)
 {
-    return QVariant((metersPerSecond.toDouble() * constants.secondsPerHour) / (1000.0 * constants.knotsToKPH));
+    return (metersPerSecond * constants.secondsPerHour) / (1000.0 * constants.knotsToKPH);
 }
 
-QVariant FactMetaData::_knotsToMetersPerSecond(const QVariant& knots)
+double FactMetaData::_knotsToMetersPerSecond(double knots)
 {
-    return QVariant(knots.toDouble() * (1000.0 * constants.knotsToKPH / constants.secondsPerHour));
+    return knots * (1000.0 * constants.knotsToKPH / constants.secondsPerHour);
 }
 
-QVariant FactMetaData::_percentToNorm(const QVariant &percent)
+double FactMetaData::_percentToNorm(double percent)
 {
-    return QVariant(percent.toDouble() / 100.0);
+    return percent / 100.0;
 }
 
-QVariant FactMetaData::_normToPercent(const QVariant &normalized)
+double FactMetaData::_normToPercent(double normalized)
 {
-    return QVariant(normalized.toDouble() * 100.0);
+    return normalized * 100.0;
 }
 
-QVariant FactMetaData::_centimetersToInches(const QVariant &centimeters)
+double FactMetaData::_centimetersToInches(double centimeters)
 {
-    return QVariant((centimeters.toDouble() * 1.0) / constants.inchesToCentimeters);
+    return (centimeters * 1.0) / constants.inchesToCentimeters;
 }
 
-QVariant FactMetaData::_inchesToCentimeters(const QVariant &inches)
+double FactMetaData::_inchesToCentimeters(double inches)
 {
-    return QVariant(inches.toDouble() * constants.inchesToCentimeters);
+    return inches * constants.inchesToCentimeters;
 }
 
-QVariant FactMetaData::_celsiusToFarenheit(const QVariant &celsius)
+double FactMetaData::_celsiusToFarenheit(double celsius)
 {
-    return QVariant((celsius.toDouble() * (9.0 / 5.0)) + 32);
+    return (celsius * (9.0 / 5.0)) + 32;
 }
 
-QVariant FactMetaData::_farenheitToCelsius(const QVariant &farenheit)
+double FactMetaData::_farenheitToCelsius(double farenheit)
 {
-    return QVariant((farenheit.toDouble() - 32) * (5.0 / 9.0));
+    return (farenheit - 32) * (5.0 / 9.0);
 }
 
-QVariant FactMetaData::_kilogramsToGrams(const QVariant &kg)
+double FactMetaData::_kilogramsToGrams(double kg)
 {
-    return QVariant(kg.toDouble() * 1000);
+    return kg * 1000;
 }
 
-QVariant FactMetaData::_ouncesToGrams(const QVariant &oz)
+double FactMetaData::_ouncesToGrams(double oz)
 {
-    return QVariant(oz.toDouble() * constants.ouncesToGrams);
+    return oz * constants.ouncesToGrams;
 }
 
-QVariant FactMetaData::_poundsToGrams(const QVariant &lbs)
+double FactMetaData::_poundsToGrams(double lbs)
 {
-    return QVariant(lbs.toDouble() * constants.poundsToGrams);
+    return lbs * constants.poundsToGrams;
 }
 
-QVariant FactMetaData::_gramsToKilograms(const QVariant &g)
+double FactMetaData::_gramsToKilograms(double g)
 {
-    return QVariant(g.toDouble() / 1000);
+    return g / 1000;
 }
 
-QVariant FactMetaData::_gramsToOunces(const QVariant &g)
+double FactMetaData::_gramsToOunces(double g)
 {
-    return QVariant(g.toDouble() / constants.ouncesToGrams);
+    return g / constants.ouncesToGrams;
 }
 
-QVariant FactMetaData::_gramsToPunds(const QVariant &g)
+double FactMetaData::_gramsToPunds(double g)
 {
-    return QVariant(g.toDouble() / constants.poundsToGrams);
+    return g / constants.poundsToGrams;
 }
 
 void FactMetaData::setRawUnits(const QString &rawUnits)
@@ -897,7 +911,7 @@ void FactMetaData::_setAppSettingsTranslators()
 
             if (settingsUnits == pAppSettingsTranslation->unitOption) {
                 _cookedUnits = pAppSettingsTranslation->cookedUnits;
-                setTranslators(pAppSettingsTranslation->rawTranslator, pAppSettingsTranslation->cookedTranslator);
+                _setTranslators(pAppSettingsTranslation->translators);
                 return;
             }
         }
@@ -948,7 +962,7 @@ QVariant FactMetaData::metersToAppSettingsHorizontalDistanceUnits(const QVariant
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m", UnitHorizontalDistance);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->rawTranslator(meters);
+        return pAppSettingsTranslation->translators.raw(meters);
     } else {
         return meters;
     }
@@ -958,7 +972,7 @@ QVariant FactMetaData::metersToAppSettingsVerticalDistanceUnits(const QVariant &
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("vertical m", UnitVerticalDistance);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->rawTranslator(meters);
+        return pAppSettingsTranslation->translators.raw(meters);
     } else {
         return meters;
     }
@@ -968,7 +982,7 @@ QVariant FactMetaData::appSettingsHorizontalDistanceUnitsToMeters(const QVariant
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m", UnitHorizontalDistance);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->cookedTranslator(distance);
+        return pAppSettingsTranslation->translators.cooked(distance);
     } else {
         return distance;
     }
@@ -978,7 +992,7 @@ QVariant FactMetaData::appSettingsVerticalDistanceUnitsToMeters(const QVariant &
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("vertical m", UnitVerticalDistance);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->cookedTranslator(distance);
+        return pAppSettingsTranslation->translators.cooked(distance);
     } else {
         return distance;
     }
@@ -1018,7 +1032,7 @@ QVariant FactMetaData::squareMetersToAppSettingsAreaUnits(const QVariant &square
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m^2", UnitArea);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->rawTranslator(squareMeters);
+        return pAppSettingsTranslation->translators.raw(squareMeters);
     } else {
         return squareMeters;
     }
@@ -1028,7 +1042,7 @@ QVariant FactMetaData::appSettingsAreaUnitsToSquareMeters(const QVariant &area)
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m^2", UnitArea);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->cookedTranslator(area);
+        return pAppSettingsTranslation->translators.cooked(area);
     } else {
         return area;
     }
@@ -1047,7 +1061,7 @@ QString FactMetaData::appSettingsAreaUnitsString()
 QVariant FactMetaData::gramsToAppSettingsWeightUnits(const QVariant &grams) {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("g", UnitWeight);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->rawTranslator(grams);
+        return pAppSettingsTranslation->translators.raw(grams);
     } else {
         return grams;
     }
@@ -1056,7 +1070,7 @@ QVariant FactMetaData::gramsToAppSettingsWeightUnits(const QVariant &grams) {
 QVariant FactMetaData::appSettingsWeightUnitsToGrams(const QVariant &weight) {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("g", UnitWeight);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->cookedTranslator(weight);
+        return pAppSettingsTranslation->translators.cooked(weight);
     } else {
         return weight;
     }
@@ -1066,7 +1080,7 @@ QVariant FactMetaData::metersSecondToAppSettingsSpeedUnits(const QVariant &meter
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m/s", UnitSpeed);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->rawTranslator(metersSecond);
+        return pAppSettingsTranslation->translators.raw(metersSecond);
     } else {
         return metersSecond;
     }
@@ -1076,7 +1090,7 @@ QVariant FactMetaData::appSettingsSpeedUnitsToMetersSecond(const QVariant &speed
 {
     const AppSettingsTranslation_s *const pAppSettingsTranslation = _findAppSettingsUnitsTranslation("m/s", UnitSpeed);
     if (pAppSettingsTranslation) {
-        return pAppSettingsTranslation->cookedTranslator(speed);
+        return pAppSettingsTranslation->translators.cooked(speed);
     } else {
         return speed;
     }
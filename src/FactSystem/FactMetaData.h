@@ -51,6 +51,8 @@ class FactMetaData : public QObject
     Q_ENUM(ValueType_t)
 
     typedef QVariant (*Translator)(const QVariant &from);
+    /// Numeric form of a translator, used by the typed Fact fast paths to avoid QVariant boxing
+    typedef double (*NumericTranslator)(double from);
 
     // Custom function to validate a cooked value.
     //  @return Error string for failed validation explanation to user. Empty string indicates no error.
@@ -161,6 +163,10 @@ class FactMetaData : public QObject
 
     Translator rawTranslator() const { return _rawTranslator; }
     Translator cookedTranslator() const { return _cookedTranslator; }
+    /// @return nullptr: no translation (rawTranslatorIsDefault) or a custom translator which only has a QVariant form
+    NumericTranslator rawNumericTranslator() const { return _rawNumericTranslator; }
+    NumericTranslator cookedNumericTranslator() const { return _cookedNumericTranslator; }
+    bool rawTranslatorIsDefault() const { return (_rawTranslator == _defaultTranslator); }
 
     /// Used to add new values to the bitmask lists after the meta data has been loaded
     void addBitmaskInfo(const QString &name, const QVariant &value);
@@ -264,46 +270,69 @@ class FactMetaData : public QObject
     static bool _parseValuesArray(const QJsonObject &jsonObject, QStringList &rgDescriptions, QList<double> &rgValues, QString &errorString);
     static bool _parseBitmaskArray(const QJsonObject &jsonObject, QStringList &rgDescriptions, QList<int> &rgValues, QString &errorString);
 
+    struct Translators_s {
+        Translator raw;
+        Translator cooked;
+        NumericTranslator rawNumeric;
+        NumericTranslator cookedNumeric;
+    };
+
+    /// Generates the QVariant translator for a numeric translator at compile time
+    template<NumericTranslator numericTranslator>
+    static QVariant _variantTranslator(const QVariant &from) { return QVariant(numericTranslator(from.toDouble())); }
+
+    /// Same as _variantTranslator but for conversions to integral raw units, the QVariant holds an int
+    template<NumericTranslator numericTranslator>
+    static QVariant _intVariantTranslator(const QVariant &from) { return QVariant(qRound(numericTranslator(from.toDouble()))); }
+
+    template<NumericTranslator rawTranslator, NumericTranslator cookedTranslator>
+    static constexpr Translators_s _numericTranslators() { return { _variantTranslator<rawTranslator>, _variantTranslator<cookedTranslator>, rawTranslator, cookedTranslator }; }
+    template<NumericTranslator rawTranslator, NumericTranslator cookedTranslator>
+    static constexpr Translators_s _numericToIntTranslators() { return { _variantTranslator<rawTranslator>, _intVariantTranslator<cookedTranslator>, rawTranslator, cookedTranslator }; }
+    static constexpr Translators_s _defaultTranslators() { return { _defaultTranslator, _defaultTranslator, nullptr, nullptr }; }
+
+    void _setTranslators(const Translators_s &translators);
+
     // Built in translators
     static QVariant _defaultTranslator(const QVariant &from) { return from; }
-    static QVariant _degreesToRadians(const QVariant &degrees);
-    static QVariant _radiansToDegrees(const QVariant &radians);
-    static QVariant _centiDegreesToDegrees(const QVariant &centiDegrees);
-    static QVariant _degreesToCentiDegrees(const QVariant &degrees);
-    static QVariant _centiCelsiusToCelsius(const QVariant &centiCelsius);
-    static QVariant _celsiusToCentiCelsius(const QVariant &celsius);
-    static QVariant _userGimbalDegreesToMavlinkGimbalDegrees(const QVariant &userGimbalDegrees);
-    static QVariant _mavlinkGimbalDegreesToUserGimbalDegrees(const QVariant &mavlinkGimbalDegrees);
-    static QVariant _metersToFeet(const QVariant &meters);
-    static QVariant _feetToMeters(const QVariant &feet);
-    static QVariant _squareMetersToSquareKilometers(const QVariant &squareMeters);
-    static QVariant _squareKilometersToSquareMeters(const QVariant &squareKilometers);
-    static QVariant _squareMetersToHectares(const QVariant &squareMeters);
-    static QVariant _hectaresToSquareMeters(const QVariant &hectares);
-    static QVariant _squareMetersToSquareFeet(const QVariant &squareMeters);
-    static QVariant _squareFeetToSquareMeters(const QVariant &squareFeet);
-    static QVariant _squareMetersToAcres(const QVariant &squareMeters);
-    static QVariant _acresToSquareMeters(const QVariant &acres);
-    static QVariant _squareMetersToSquareMiles(const QVariant &squareMeters);
-    static QVariant _squareMilesToSquareMeters(const QVariant &squareMiles);
-    static QVariant _metersPerSecondToMilesPerHour(const QVariant &metersPerSecond);
-    static QVariant _milesPerHourToMetersPerSecond(const QVariant &milesPerHour);
-    static QVariant _metersPerSecondToKilometersPerHour(const QVariant &metersPerSecond);
-    static QVariant _kilometersPerHourToMetersPerSecond(const QVariant &kilometersPerHour);
-    static QVariant _metersPerSecondToKnots(const QVariant &metersPerSecond);
-    static QVariant _knotsToMetersPerSecond(const QVariant &knots);
-    static QVariant _percentToNorm(const QVariant &percent);
-    static QVariant _normToPercent(const QVariant &normalized);
-    static QVariant _centimetersToInches(const QVariant &centimeters);
-    static QVariant _inchesToCentimeters(const QVariant &inches);
-    static QVariant _celsiusToFarenheit(const QVariant &celsius);
-    static QVariant _farenheitToCelsius(const QVariant &farenheit);
-    static QVariant _kilogramsToGrams(const QVariant &kg);
-    static QVariant _ouncesToGrams(const QVariant &oz);
-    static QVariant _poundsToGrams(const QVariant &lbs);
-    static QVariant _gramsToKilograms(const QVariant &g);
-    static QVariant _gramsToOunces(const QVariant &g);
-    static QVariant _gramsToPunds(const QVariant &g);
+    static double _degreesToRadians(double degrees);
+    static double _radiansToDegrees(double radians);
+    static double _centiDegreesToDegrees(double centiDegrees);
+    static double _degreesToCentiDegrees(double degrees);
+    static double _centiCelsiusToCelsius(double centiCelsius);
+    static double _celsiusToCentiCelsius(double celsius);
+    static double _userGimbalDegreesToMavlinkGimbalDegrees(double userGimbalDegrees);
+    static double _mavlinkGimbalDegreesToUserGimbalDegrees(double mavlinkGimbalDegrees);
+    static double _metersToFeet(double meters);
+    static double _feetToMeters(double feet);
+    static double _squareMetersToSquareKilometers(double squareMeters);
+    static double _squareKilometersToSquareMeters(double squareKilometers);
+    static double _squareMetersToHectares(double squareMeters);
+    static double _hectaresToSquareMeters(double hectares);
+    static double _squareMetersToSquareFeet(double squareMeters);
+    static double _squareFeetToSquareMeters(double squareFeet);
+    static double _squareMetersToAcres(double squareMeters);
+    static double _acresToSquareMeters(double acres);
+    static double _squareMetersToSquareMiles(double squareMeters);
+    static double _squareMilesToSquareMeters(double squareMiles);
+    static double _metersPerSecondToMilesPerHour(double metersPerSecond);
+    static double _milesPerHourToMetersPerSecond(double milesPerHour);
+    static double _metersPerSecondToKilometersPerHour(double metersPerSecond);
+    static double _kilometersPerHourToMetersPerSecond(double kilometersPerHour);
+    static double _metersPerSecondToKnots(double metersPerSecond);
+    static double _knotsToMetersPerSecond(double knots);
+    static double _percentToNorm(double percent);
+    static double _normToPercent(double normalized);
+    static double _centimetersToInches(double centimeters);
+    static double _inchesToCentimeters(double inches);
+    static double _celsiusToFarenheit(double celsius);
+    static double _farenheitToCelsius(double farenheit);
+    static double _kilogramsToGrams(double kg);
+    static double _ouncesToGrams(double oz);
+    static double _poundsToGrams(double lbs);
+    static double _gramsToKilograms(double g);
+    static double _gramsToOunces(double g);
+    static double _gramsToPunds(double g);
 
     enum UnitTypes {
         UnitHorizontalDistance = 0,
@@ -319,8 +348,7 @@ class FactMetaData : public QObject
         const char *cookedUnits = nullptr;
         UnitTypes unitType = UnitHorizontalDistance;
         uint32_t unitOption = 0;
-        Translator rawTranslator;
-        Translator cookedTranslator;
+        Translators_s translators;
     };
 
     static const AppSettingsTranslation_s *_findAppSettingsUnitsTranslation(const QString &rawUnits, UnitTypes type);
@@ -346,6 +374,8 @@ class FactMetaData : public QObject
     QString _cookedUnits;
     Translator _rawTranslator = _defaultTranslator;
     Translator _cookedTranslator = _defaultTranslator;
+    NumericTranslator _rawNumericTranslator = nullptr;
+    NumericTranslator _cookedNumericTranslator = nullptr;
     bool _vehicleRebootRequired = false;
     bool _qgcRebootRequired = false;
     double _rawIncrement = std::numeric_limits<double>::quiet_NaN();
@@ -375,8 +405,7 @@ class FactMetaData : public QObject
     struct BuiltInTranslation_s {
         QString rawUnits;
         const char *cookedUnits;
-        Translator rawTranslator;
-        Translator cookedTranslator;
+        Translators_s translators;
     };
 
     static const BuiltInTranslation_s _rgBuiltInTranslations[];
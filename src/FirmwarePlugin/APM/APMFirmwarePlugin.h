@@ -63,6 +63,7 @@ class APMFirmwarePlugin : public FirmwarePlugin
     virtual void initializeStreamRates(Vehicle *vehicle);
     void initializeVehicle(Vehicle *vehicle) override;
     bool sendHomePositionToVehicle() const override { return true; }
+    bool supportsMissionItemStreaming() const override { return true; }
     QString missionCommandOverrides(QGCMAVLink::VehicleClass_t vehicleClass) const override;
     QString _internalParameterMetaDataFile(const Vehicle* vehicle) const override;
     FactMetaData *_getMetaDataForFact(QObject *parameterMetaData, const QString &name, FactMetaData::ValueType_t type, MAV_TYPE vehicleType) const override;
@@ -286,6 +286,13 @@ class FirmwarePlugin : public QObject
     ///     false: Do not send first item to vehicle, sequence numbers must be adjusted
     virtual bool sendHomePositionToVehicle() const { return false; }
 
+    /// @return
+    ///     true: Vehicle stores mission items in order, tolerates items arriving ahead of its requests and answers
+    ///             item requests in any order, so several can be in flight during upload/download
+    ///     false: Strict protocol, one request/response round trip per item. Required by firmware such as PX4 which
+    ///             rejects a MISSION_REQUEST_INT for anything other than the next (or repeated) item.
+    virtual bool supportsMissionItemStreaming() const { return false; }
+
     /// Returns the parameter set version info pulled from inside the meta data file. -1 if not found.
     /// Note: The implementation for this must not vary by vehicle type.
     /// Important: Only CompInfoParam code should use this method
@@ -103,6 +103,9 @@ FlightMap {
     onAnimatedLatitudeChanged: _root.center = QtPositioning.coordinate(animatedLatitude, animatedLongitude)
     onAnimatedLongitudeChanged: _root.center = QtPositioning.coordinate(animatedLatitude, animatedLongitude)
 
+    // Only ADSB traffic within the map view is published to the ui, the pip map shows all traffic
+    onVisibleRegionChanged: QGroundControl.adsbVehicleManager.setVisibleRegion(pipMode ? QtPositioning.shape() : visibleRegion)
+
     NumberAnimation on animatedLatitude { id: animateLat; from: _animatedLatitudeStart; to: _animatedLatitudeStop; duration: 1000 }
     NumberAnimation on animatedLongitude { id: animateLong; from: _animatedLongitudeStart; to: _animatedLongitudeStop; duration: 1000 }
 
@@ -30,22 +30,29 @@ RTCMMavlink::~RTCMMavlink()
 
 void RTCMMavlink::RTCMDataUpdate(QByteArrayView data)
 {
-#ifdef QT_DEBUG
-    _calculateBandwith(data.size());
-#endif
+    _updateReports(data.size());
 
-    mavlink_gps_rtcm_data_t gpsRtcmData{};
+    _fragment(data);
+    _sendFragmentsToLinks();
+
+    ++_sequenceId;
+}
+
+void RTCMMavlink::_fragment(QByteArrayView data)
+{
+    _fragments.clear();
 
     static constexpr qsizetype maxMessageLength = MAVLINK_MSG_GPS_RTCM_DATA_FIELD_DATA_LEN;
     if (data.size() < maxMessageLength) {
+        mavlink_gps_rtcm_data_t &gpsRtcmData = _fragments.emplace_back();
         gpsRtcmData.len = data.size();
         gpsRtcmData.flags = (_sequenceId & 0x1FU) << 3;
         (void) memcpy(&gpsRtcmData.data, data.data(), data.size());
-        _sendMessageToVehicle(gpsRtcmData);
     } else {
         uint8_t fragmentId = 0;
         qsizetype start = 0;
         while (start < data.size()) {
+            mavlink_gps_rtcm_data_t &gpsRtcmData = _fragments.emplace_back();
             gpsRtcmData.flags = 0x01U; // LSB set indicates message is fragmented
             gpsRtcmData.flags |= fragmentId++ << 1; // Next 2 bits are fragment id
             gpsRtcmData.flags |= (_sequenceId & 0x1FU) << 3; // Next 5 bits are sequence id
@@ -54,36 +61,64 @@ void RTCMMavlink::RTCMDataUpdate(QByteArrayView data)
             gpsRtcmData.len = length;
 
             (void) memcpy(gpsRtcmData.data, data.constData() + start, length);
-            _sendMessageToVehicle(gpsRtcmData);
 
             start += length;
         }
     }
-
-    ++_sequenceId;
 }
 
-void RTCMMavlink::_sendMessageToVehicle(const mavlink_gps_rtcm_data_t &data)
+void RTCMMavlink::_sendFragmentsToLinks()
 {
+    // GPS_RTCM_DATA has no target, so a single copy per link reaches every vehicle on it. The message is still
+    // encoded per link since sequence numbers and signing are per mavlink channel.
+    QList<SharedLinkInterfacePtr> links;
+    QList<Vehicle*> linkVehicles;
+
     QmlObjectListModel* const vehicles = MultiVehicleManager::instance()->vehicles();
     for (qsizetype i = 0; i < vehicles->count(); i++) {
         Vehicle* const vehicle = qobject_cast<Vehicle*>(vehicles->get(i));
         const SharedLinkInterfacePtr sharedLink = vehicle->vehicleLinkManager()->primaryLink().lock();
-        if (sharedLink) {
+        if (!sharedLink) {
+            continue;
+        }
+
+        LinkCounters_s &counters = _linkCounters[sharedLink->mavlinkChannel()];
+        const auto it = std::find(links.cbegin(), links.cend(), sharedLink);
+        if (it != links.cend()) {
+            counters.vehicleCount++;
+            continue;
+        }
+
+        links.append(sharedLink);
+        linkVehicles.append(vehicle);
+        counters.linkName = sharedLink->linkConfiguration()->name();
+        counters.vehicleCount = 1;
+    }
+
+    for (qsizetype i = 0; i < links.count(); i++) {
+        LinkInterface* const link = links[i].get();
+        LinkCounters_s &counters = _linkCounters[link->mavlinkChannel()];
+
+        for (const mavlink_gps_rtcm_data_t &gpsRtcmData : std::as_const(_fragments)) {
             mavlink_message_t message;
             (void) mavlink_msg_gps_rtcm_data_encode_chan(
                 MAVLinkProtocol::instance()->getSystemId(),
                 MAVLinkProtocol::getComponentId(),
-                sharedLink->mavlinkChannel(),
+                link->mavlinkChannel(),
                 &message,
-                &data
+                &gpsRtcmData
             );
-            (void) vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), message);
+            if (linkVehicles[i]->sendMessageOnLinkThreadSafe(link, message, LinkInterface::HighPriority)) {
+                counters.messageCount++;
+                counters.byteCount += MAVLINK_NUM_NON_PAYLOAD_BYTES + message.len;
+            }
         }
+
+        counters.maxQueueWaitNsecs = qMax(counters.maxQueueWaitNsecs, link->takeHighPriorityMaxWaitNsecs());
     }
 }
 
-void RTCMMavlink::_calculateBandwith(qsizetype bytes)
+void RTCMMavlink::_updateReports(qsizetype bytes)
 {
     if (!_bandwidthTimer.isValid()) {
         return;
@@ -92,9 +127,30 @@ void RTCMMavlink::_calculateBandwith(qsizetype bytes)
     _bandwidthByteCounter += bytes;
 
     const qint64 elapsed = _bandwidthTimer.elapsed();
-    if (elapsed > 1000) {
+    if (elapsed > kReportIntervalMsecs) {
         qCDebug(RTCMMavlinkLog) << QStringLiteral("RTCM bandwidth: %1 kB/s").arg(((_bandwidthByteCounter / elapsed) * 1000.f) / 1024.f);
+
+        _linkReports.clear();
+        for (auto it = _linkCounters.cbegin(); it != _linkCounters.cend(); ++it) {
+            LinkReport report;
+            report.linkName = it->linkName;
+            report.vehicleCount = it->vehicleCount;
+            report.messageCount = it->messageCount;
+            report.bytesPerSecond = (it->byteCount * 1000.) / elapsed;
+            report.maxQueueWaitMsecs = it->maxQueueWaitNsecs / 1e6;
+            _linkReports.append(report);
+
+            qCDebug(RTCMMavlinkLog) << "RTCM link" << report.linkName
+                                    << "vehicles:" << report.vehicleCount
+                                    << "messages:" << report.messageCount
+                                    << QStringLiteral("%1 kB/s").arg(report.bytesPerSecond / 1024., 0, 'f', 2)
+                                    << QStringLiteral("max queue wait: %1 ms").arg(report.maxQueueWaitMsecs, 0, 'f', 2);
+        }
+        _linkCounters.clear();
+
         (void) _bandwidthTimer.restart();
         _bandwidthByteCounter = 0;
+
+        emit linkReportsUpdated();
     }
 }
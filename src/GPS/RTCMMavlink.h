@@ -11,13 +11,18 @@
 #pragma once
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
 
-typedef struct __mavlink_gps_rtcm_data_t mavlink_gps_rtcm_data_t;
+#include "MAVLinkLib.h"
 
 Q_DECLARE_LOGGING_CATEGORY(RTCMMavlinkLog)
 
+class LinkInterface;
+class Vehicle;
+
 class RTCMMavlink : public QObject
 {
     Q_OBJECT
@@ -26,14 +31,45 @@ class RTCMMavlink : public QObject
     RTCMMavlink(QObject *parent = nullptr);
     ~RTCMMavlink();
 
+    /// RTCM injection statistics for a single link over the last reporting interval
+    struct LinkReport {
+        QString linkName;
+        int vehicleCount = 0;               ///< Vehicles sharing the link, they all receive the same broadcast copy
+        quint64 messageCount = 0;           ///< GPS_RTCM_DATA messages written
+        double bytesPerSecond = 0;
+        double maxQueueWaitMsecs = 0;       ///< Longest time an RTCM message waited in the link outbound queue
+    };
+
+    /// @return Per link reports for the last completed reporting interval
+    QList<LinkReport> linkReports() const { return _linkReports; }
+
+    static constexpr int kReportIntervalMsecs = 1000;
+
+signals:
+    void linkReportsUpdated();
+
 public slots:
     void RTCMDataUpdate(QByteArrayView data);
 
 private:
-    void _calculateBandwith(qsizetype bytes);
-    static void _sendMessageToVehicle(const mavlink_gps_rtcm_data_t &data);
+    struct LinkCounters_s {
+        QString linkName;
+        int vehicleCount = 0;
+        quint64 messageCount = 0;
+        qsizetype byteCount = 0;
+        qint64 maxQueueWaitNsecs = 0;
+    };
+
+    /// Splits an RTCM frame into GPS_RTCM_DATA payloads, done once per frame regardless of vehicle count
+    void _fragment(QByteArrayView data);
+    /// Sends the fragments once per link, vehicles which share a link all receive the single copy
+    void _sendFragmentsToLinks();
+    void _updateReports(qsizetype bytes);
 
     uint8_t _sequenceId = 0;
+    QList<mavlink_gps_rtcm_data_t> _fragments;
+    QHash<uint8_t, LinkCounters_s> _linkCounters;   ///< Keyed by mavlink channel
+    QList<LinkReport> _linkReports;
     qsizetype _bandwidthByteCounter = 0;
     QElapsedTimer _bandwidthTimer;
 };
@@ -52,6 +52,11 @@ typedef enum : uint8_t {
 // #define MAVLINK_NO_SIGNATURE_CHECK
 #define MAVLINK_USE_MESSAGE_INFO
 
+#define HAVE_MAVLINK_SHA256
+#ifdef HAVE_MAVLINK_SHA256
+    #include "MAVLinkSha256.h"
+#endif
+
 #include <stddef.h>
 
 // Ignore warnings from mavlink headers for both GCC/Clang and MSVC
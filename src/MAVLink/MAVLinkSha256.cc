@@ -0,0 +1,368 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkSha256.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define QGC_SHA256_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define QGC_SHA256_X86_TARGET
+    #else
+        #include <cpuid.h>
+        #define QGC_SHA256_X86_TARGET __attribute__((target("sha,sse4.1")))
+    #endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+    // Only used when the target baseline includes the crypto extensions (e.g. all Apple arm64 devices)
+    #define QGC_SHA256_ARM
+    #include <arm_neon.h>
+#endif
+
+namespace
+{
+
+using Transform = void (*)(uint32_t state[8], const uint8_t *data, size_t blockCount);
+
+alignas(16) constexpr uint32_t kRoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+constexpr uint32_t kInitialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+std::atomic<bool> s_forcePortable = false;
+
+inline uint32_t rotr(uint32_t value, int bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+void transformPortable(uint32_t state[8], const uint8_t *data, size_t blockCount)
+{
+    for (; blockCount > 0; blockCount--, data += 64) {
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++) {
+            w[i] = (static_cast<uint32_t>(data[i * 4]) << 24) | (static_cast<uint32_t>(data[(i * 4) + 1]) << 16) |
+                   (static_cast<uint32_t>(data[(i * 4) + 2]) << 8) | static_cast<uint32_t>(data[(i * 4) + 3]);
+        }
+        for (int i = 16; i < 64; i++) {
+            const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int i = 0; i < 64; i++) {
+            const uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + kRoundConstants[i] + w[i];
+            const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+}
+
+#ifdef QGC_SHA256_X86
+
+bool cpuHasShaExtensions()
+{
+    // SHA-NI plus SSSE3/SSE4.1 for the byte shuffles and blends around it
+    constexpr uint32_t kSsse3 = 1u << 9;
+    constexpr uint32_t kSse41 = 1u << 19;
+    constexpr uint32_t kSha = 1u << 29;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const uint32_t features1 = static_cast<uint32_t>(info[2]);
+    __cpuidex(info, 7, 0);
+    const uint32_t features7 = static_cast<uint32_t>(info[1]);
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const uint32_t features1 = ecx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    const uint32_t features7 = ebx;
+#endif
+
+    return ((features1 & kSsse3) && (features1 & kSse41) && (features7 & kSha));
+}
+
+QGC_SHA256_X86_TARGET
+void transformX86(uint32_t state[8], const uint8_t *data, size_t blockCount)
+{
+    const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // The sha256rnds2 instruction works on ABEF/CDGH ordered state
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);   // CDAB
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);                                                      // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                                                           // CDGH
+
+    for (; blockCount > 0; blockCount--, data += 64) {
+        const __m128i abefSave = state0;
+        const __m128i cdghSave = state1;
+
+        // Message schedule ring, w[n & 3] holds words 4n..4n+3 once they are needed
+        __m128i w[4];
+        for (int i = 0; i < 4; i++) {
+            w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + (i * 16))), byteSwapMask);
+        }
+
+        for (int group = 0; group < 16; group++) {
+            __m128i msg = _mm_add_epi32(w[group & 3], _mm_load_si128(reinterpret_cast<const __m128i*>(&kRoundConstants[group * 4])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            if ((group >= 3) && (group <= 14)) {
+                const __m128i next = _mm_add_epi32(w[(group + 1) & 3], _mm_alignr_epi8(w[group & 3], w[(group - 1) & 3], 4));
+                w[(group + 1) & 3] = _mm_sha256msg2_epu32(next, w[group & 3]);
+            }
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+            if ((group >= 1) && (group <= 12)) {
+                w[(group - 1) & 3] = _mm_sha256msg1_epu32(w[(group - 1) & 3], w[group & 3]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);          // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);       // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);       // ABEF
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+#endif // QGC_SHA256_X86
+
+#ifdef QGC_SHA256_ARM
+
+void transformArm(uint32_t state[8], const uint8_t *data, size_t blockCount)
+{
+    uint32x4_t state0 = vld1q_u32(&state[0]);
+    uint32x4_t state1 = vld1q_u32(&state[4]);
+
+    for (; blockCount > 0; blockCount--, data += 64) {
+        const uint32x4_t abcdSave = state0;
+        const uint32x4_t efghSave = state1;
+
+        // Message schedule ring, w[n & 3] holds words 4n..4n+3 once they are needed
+        uint32x4_t w[4];
+        for (int i = 0; i < 4; i++) {
+            w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + (i * 16))));
+        }
+
+        for (int group = 0; group < 16; group++) {
+            const uint32x4_t msg = vaddq_u32(w[group & 3], vld1q_u32(&kRoundConstants[group * 4]));
+            if (group < 12) {
+                w[group & 3] = vsha256su0q_u32(w[group & 3], w[(group + 1) & 3]);
+            }
+            const uint32x4_t abcd = state0;
+            state0 = vsha256hq_u32(state0, state1, msg);
+            state1 = vsha256h2q_u32(state1, abcd, msg);
+            if (group < 12) {
+                w[group & 3] = vsha256su1q_u32(w[group & 3], w[(group + 2) & 3], w[(group + 3) & 3]);
+            }
+        }
+
+        state0 = vaddq_u32(state0, abcdSave);
+        state1 = vaddq_u32(state1, efghSave);
+    }
+
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+
+#endif // QGC_SHA256_ARM
+
+MAVLinkSha256::Backend detectBackend()
+{
+#if defined(QGC_SHA256_X86)
+    if (cpuHasShaExtensions()) {
+        return MAVLinkSha256::X86ShaExtensions;
+    }
+#elif defined(QGC_SHA256_ARM)
+    return MAVLinkSha256::ArmV8CryptoExtensions;
+#endif
+
+    return MAVLinkSha256::Portable;
+}
+
+Transform transformForBackend(MAVLinkSha256::Backend backend)
+{
+    switch (backend) {
+#ifdef QGC_SHA256_X86
+    case MAVLinkSha256::X86ShaExtensions:
+        return transformX86;
+#endif
+#ifdef QGC_SHA256_ARM
+    case MAVLinkSha256::ArmV8CryptoExtensions:
+        return transformArm;
+#endif
+    default:
+        return transformPortable;
+    }
+}
+
+inline void transform(uint32_t state[8], const uint8_t *data, size_t blockCount)
+{
+    static const Transform s_transform = transformForBackend(MAVLinkSha256::backend());
+
+    if (s_forcePortable.load(std::memory_order_relaxed)) {
+        transformPortable(state, data, blockCount);
+    } else {
+        s_transform(state, data, blockCount);
+    }
+}
+
+void finish(mavlink_sha256_ctx *ctx)
+{
+    const uint64_t bitLength = ctx->length * 8;
+
+    // 0x80 terminator, zero fill up to 56 mod 64, then the big endian bit length
+    uint8_t padding[72] = { 0x80 };
+    const uint32_t padLength = (ctx->bufferLength < 56) ? (56 - ctx->bufferLength) : (120 - ctx->bufferLength);
+    for (int i = 0; i < 8; i++) {
+        padding[padLength + i] = static_cast<uint8_t>(bitLength >> (56 - (i * 8)));
+    }
+
+    mavlink_sha256_update(ctx, padding, padLength + 8);
+}
+
+void digestBytes(const mavlink_sha256_ctx *ctx, uint8_t *result, int count)
+{
+    for (int i = 0; i < count; i++) {
+        result[i] = static_cast<uint8_t>(ctx->state[i / 4] >> (24 - ((i % 4) * 8)));
+    }
+}
+
+} // namespace
+
+void mavlink_sha256_init(mavlink_sha256_ctx *ctx)
+{
+    (void) memcpy(ctx->state, kInitialState, sizeof(ctx->state));
+    ctx->length = 0;
+    ctx->bufferLength = 0;
+}
+
+void mavlink_sha256_update(mavlink_sha256_ctx *ctx, const void *data, uint32_t length)
+{
+    const uint8_t *bytes = static_cast<const uint8_t*>(data);
+    ctx->length += length;
+
+    if (ctx->bufferLength > 0) {
+        const uint32_t count = std::min(static_cast<uint32_t>(sizeof(ctx->buffer)) - ctx->bufferLength, length);
+        (void) memcpy(ctx->buffer + ctx->bufferLength, bytes, count);
+        ctx->bufferLength += count;
+        bytes += count;
+        length -= count;
+
+        if (ctx->bufferLength < sizeof(ctx->buffer)) {
+            return;
+        }
+        transform(ctx->state, ctx->buffer, 1);
+        ctx->bufferLength = 0;
+    }
+
+    const uint32_t blockCount = length / 64;
+    if (blockCount > 0) {
+        transform(ctx->state, bytes, blockCount);
+        bytes += blockCount * 64;
+        length -= blockCount * 64;
+    }
+
+    if (length > 0) {
+        (void) memcpy(ctx->buffer, bytes, length);
+        ctx->bufferLength = length;
+    }
+}
+
+void mavlink_sha256_final_48(mavlink_sha256_ctx *ctx, uint8_t result[6])
+{
+    finish(ctx);
+    digestBytes(ctx, result, 6);
+}
+
+namespace MAVLinkSha256
+{
+
+Backend backend()
+{
+    static const Backend s_backend = detectBackend();
+    return s_backend;
+}
+
+const char *backendName(Backend backend)
+{
+    switch (backend) {
+    case X86ShaExtensions:
+        return "x86 SHA extensions";
+    case ArmV8CryptoExtensions:
+        return "ARMv8 crypto extensions";
+    case Portable:
+    default:
+        return "portable";
+    }
+}
+
+void setForcePortable(bool forcePortable)
+{
+    s_forcePortable.store(forcePortable, std::memory_order_relaxed);
+}
+
+void sha256(const void *data, size_t length, uint8_t digest[32])
+{
+    mavlink_sha256_ctx ctx;
+    mavlink_sha256_init(&ctx);
+
+    const uint8_t *bytes = static_cast<const uint8_t*>(data);
+    while (length > 0) {
+        const uint32_t count = static_cast<uint32_t>(std::min<size_t>(length, UINT32_MAX));
+        mavlink_sha256_update(&ctx, bytes, count);
+        bytes += count;
+        length -= count;
+    }
+
+    finish(&ctx);
+    digestBytes(&ctx, digest, 32);
+}
+
+} // namespace MAVLinkSha256
@@ -0,0 +1,48 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// SHA-256 used by the mavlink headers for MAVLink 2 signing and signature verification. Replaces the built in
+/// mavlink_sha256 implementation through HAVE_MAVLINK_SHA256 with the same API. The block transform uses the
+/// x86 SHA extensions or the ARMv8 crypto extensions when the CPU supports them, with a portable fallback.
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;            ///< Total bytes hashed so far
+    uint8_t buffer[64];         ///< Partial block
+    uint32_t bufferLength;
+} mavlink_sha256_ctx;
+
+void mavlink_sha256_init(mavlink_sha256_ctx *ctx);
+void mavlink_sha256_update(mavlink_sha256_ctx *ctx, const void *data, uint32_t length);
+/// MAVLink signatures only use the first 48 bits of the digest
+void mavlink_sha256_final_48(mavlink_sha256_ctx *ctx, uint8_t result[6]);
+
+namespace MAVLinkSha256
+{
+    enum Backend {
+        Portable,
+        X86ShaExtensions,
+        ArmV8CryptoExtensions
+    };
+
+    /// @return Backend selected for this CPU
+    Backend backend();
+    const char *backendName(Backend backend);
+
+    /// Forces the portable backend, used to compare backends in tests and benchmarks
+    void setForcePortable(bool forcePortable);
+
+    /// Full 32 byte digest of a single buffer
+    void sha256(const void *data, size_t length, uint8_t digest[32]);
+} // namespace MAVLinkSha256
@@ -13,9 +13,14 @@
 
 #include <QtCore/QDateTime>
 
+#include <utility>
+
 namespace
 {
 
+/// Unsigned messages rejected by insecureConnectionAccceptUnsignedCallback, only touched by the thread parsing the channel
+quint64 s_unsignedRejectedCount[MAVLINK_COMM_NUM_BUFFERS] = {};
+
 mavlink_signing_t* _getChannelSigning(uint8_t channel)
 {
     mavlink_status_t* const status = mavlink_get_channel_status(channel);
@@ -67,11 +72,27 @@ bool secureConnectionAccceptUnsignedCallback(const mavlink_status_t *status, uin
 
 bool insecureConnectionAccceptUnsignedCallback(const mavlink_status_t *status, uint32_t message_id)
 {
-    Q_UNUSED(status);
-
     static const QSet<uint32_t> unsigned_messages({MAVLINK_MSG_ID_RADIO_STATUS});
 
-    return unsigned_messages.contains(message_id);
+    if (unsigned_messages.contains(message_id)) {
+        return true;
+    }
+
+    // Signed messages which failed verification end up here as well, those are counted from the signing status.
+    // Frames with a bad crc are dropped for that reason already.
+    if (status->msg_received == MAVLINK_FRAMING_BAD_CRC) {
+        return false;
+    }
+    for (uint8_t channel = 0; channel < MAVLINK_COMM_NUM_BUFFERS; channel++) {
+        if (mavlink_get_channel_status(channel) == status) {
+            if (!(mavlink_get_channel_buffer(channel)->incompat_flags & MAVLINK_IFLAG_SIGNED)) {
+                s_unsignedRejectedCount[channel]++;
+            }
+            break;
+        }
+    }
+
+    return false;
 }
 
 /// Initialize the signing for a channel, both incoming and outgoing
@@ -132,4 +153,14 @@ void createSetupSigning(mavlink_channel_t channel, mavlink_system_t target_syste
     }
 }
 
+/// @return Unsigned messages rejected on a channel which requires signing since the last call
+quint64 takeUnsignedRejectedCount(mavlink_channel_t channel)
+{
+    if (channel >= MAVLINK_COMM_NUM_BUFFERS) {
+        return 0;
+    }
+
+    return std::exchange(s_unsignedRejectedCount[channel], 0);
+}
+
 } // namespace MAVLinkSigning
@@ -21,4 +21,5 @@ namespace MAVLinkSigning
     bool initSigning(mavlink_channel_t channel, QByteArrayView key, mavlink_accept_unsigned_t callback);
     bool checkSigningLinkId(mavlink_channel_t channel, const mavlink_message_t &message);
     void createSetupSigning(mavlink_channel_t channel, mavlink_system_t target_system, mavlink_setup_signing_t &setup_signing);
+    quint64 takeUnsignedRejectedCount(mavlink_channel_t channel);
 }; // namespace MAVLinkSigning
@@ -36,6 +36,8 @@
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 
+#include <limits>
+
 #define UPDATE_TIMEOUT 5000 ///< How often we check for bounding box changes
 
 QGC_LOGGING_CATEGORY(MissionControllerLog, "PlanManager.MissionController")
@@ -1195,11 +1197,14 @@ FlightPathSegment* MissionController::_createFlightPathSegmentWorker(VisualItemP
     connect(pair.second, &VisualMissionItem::coordinateChanged,     segment,    &FlightPathSegment::setCoordinate2);
     connect(pair.second, &VisualMissionItem::amslEntryAltChanged,   segment,    &FlightPathSegment::setCoord2AMSLAlt);
 
-    connect(pair.second, &VisualMissionItem::coordinateChanged,         this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    // Only the items from the segment onward are affected by changes to it
+    VisualMissionItem* firstItem    = pair.first;
+    VisualMissionItem* secondItem   = pair.second;
+    connect(pair.second, &VisualMissionItem::coordinateChanged,         segment,    [this, secondItem]() { _recalcMissionFlightStatusFrom(secondItem); });
 
     connect(segment,    &FlightPathSegment::totalDistanceChanged,       this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
-    connect(segment,    &FlightPathSegment::coord1AMSLAltChanged,       this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(segment,    &FlightPathSegment::coord2AMSLAltChanged,       this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    connect(segment,    &FlightPathSegment::coord1AMSLAltChanged,       this,       [this, firstItem]() { _recalcMissionFlightStatusFrom(firstItem); });
+    connect(segment,    &FlightPathSegment::coord2AMSLAltChanged,       this,       [this, secondItem]() { _recalcMissionFlightStatusFrom(secondItem); });
     connect(segment,    &FlightPathSegment::amslTerrainHeightsChanged,  this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
     connect(segment,    &FlightPathSegment::terrainCollisionChanged,    this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
 
@@ -1442,7 +1447,7 @@ void MissionController::_recalcFlightPathSegments(void)
     // Anything left in the old table is an obsolete line object that can go
     qDeleteAll(oldSegmentTable);
 
-    emit _recalcMissionFlightStatusSignal();
+    _recalcMissionFlightStatusFrom(nullptr);
 
     emit recalcTerrainProfile();
     if (signalSplitSegmentChanged) {
@@ -1510,43 +1515,103 @@ void MissionController::_addTimeDistance(bool vtolInHover, double hoverTime, dou
     }
 }
 
+/// Queues a mission flight status recalc. Items prior to the specified item are not affected by the change
+/// so their values are kept and the recalc resumes from the specified item.
+///     @param visualItem Changed item, nullptr to recalc all items
+void MissionController::_recalcMissionFlightStatusFrom(VisualMissionItem* visualItem)
+{
+    int index = (visualItem && _visualItems) ? _visualItems->indexOf(visualItem) : 0;
+    _flightStatusDirtyIndex = qMin(_flightStatusDirtyIndex, qMax(index, 0));
+    emit _recalcMissionFlightStatusSignal();
+}
+
+/// @return Visual item index to resume the mission flight status recalc from, 0 for a full recalc
+int MissionController::_missionFlightStatusResumeIndex(bool homePositionValid)
+{
+    int resumeIndex = qMin(_flightStatusDirtyIndex, static_cast<int>(_flightStatusCheckpoints.count()) - 1);
+    if (resumeIndex < 1 || homePositionValid != _flightStatusHomePositionValid) {
+        return 0;
+    }
+
+    // Checkpoints are only valid if all the items prior to them are unchanged
+    for (int i=0; i<=resumeIndex; i++) {
+        if (_flightStatusCheckpoints[i].visualItem != _visualItems->get(i)) {
+            return 0;
+        }
+    }
+
+    return resumeIndex;
+}
+
 void MissionController::_recalcMissionFlightStatus()
 {
     if (!_visualItems->count()) {
         return;
     }
 
-    bool                firstCoordinateItem =           true;
-    VisualMissionItem*  lastFlyThroughVI =   qobject_cast<VisualMissionItem*>(_visualItems->get(0));
-
     bool homePositionValid = _settingsItem->coordinate().isValid();
+    int  startIndex = _missionFlightStatusResumeIndex(homePositionValid);
 
-    qCDebug(MissionControllerLog) << "_recalcMissionFlightStatus";
+    _flightStatusDirtyIndex = std::numeric_limits<int>::max();
+    _flightStatusHomePositionValid = homePositionValid;
+
+    qCDebug(MissionControllerLog) << "_recalcMissionFlightStatus startIndex" << startIndex;
 
     // If home position is valid we can calculate distances between all waypoints.
     // If home position is not valid we can only calculate distances between waypoints which are
     // both relative altitude.
 
-    // No values for first item
-    lastFlyThroughVI->setAltDifference(0);
-    lastFlyThroughVI->setAzimuth(0);
-    lastFlyThroughVI->setDistance(0);
-    lastFlyThroughVI->setDistanceFromStart(0);
+    double prevMinAMSLAltitude = _minAMSLAltitude;
+    double prevMaxAMSLAltitude = _maxAMSLAltitude;
 
-    _minAMSLAltitude = _maxAMSLAltitude = qQNaN();
+    bool                firstCoordinateItem;
+    VisualMissionItem*  lastFlyThroughVI;
+    bool                linkStartToHome;
+    bool                foundRTL;
+    bool                pastLandCommand;
+    double              totalHorizontalDistance;
 
-    _resetMissionFlightStatus();
+    if (startIndex == 0) {
+        firstCoordinateItem =       true;
+        lastFlyThroughVI =          qobject_cast<VisualMissionItem*>(_visualItems->get(0));
+        linkStartToHome =           false;
+        foundRTL =                  false;
+        pastLandCommand =           false;
+        totalHorizontalDistance =   0;
 
-    bool   linkStartToHome =            false;
-    bool   foundRTL =                   false;
-    bool   pastLandCommand =            false;
-    double totalHorizontalDistance =    0;
+        // No values for first item
+        lastFlyThroughVI->setAltDifference(0);
+        lastFlyThroughVI->setAzimuth(0);
+        lastFlyThroughVI->setDistance(0);
+        lastFlyThroughVI->setDistanceFromStart(0);
 
-    for (int i=0; i<_visualItems->count(); i++) {
+        _minAMSLAltitude = _maxAMSLAltitude = qQNaN();
+
+        _resetMissionFlightStatus();
+    } else {
+        // Pick up from the state prior to the first changed item
+        const FlightStatusCheckpoint_t& checkpoint = _flightStatusCheckpoints[startIndex];
+
+        firstCoordinateItem =       checkpoint.firstCoordinateItem;
+        lastFlyThroughVI =          checkpoint.lastFlyThroughVI;
+        linkStartToHome =           checkpoint.linkStartToHome;
+        foundRTL =                  checkpoint.foundRTL;
+        pastLandCommand =           checkpoint.pastLandCommand;
+        totalHorizontalDistance =   checkpoint.totalHorizontalDistance;
+        _minAMSLAltitude =          checkpoint.minAMSLAltitude;
+        _maxAMSLAltitude =          checkpoint.maxAMSLAltitude;
+        _missionFlightStatus =      checkpoint.missionFlightStatus;
+    }
+    _flightStatusCheckpoints.resize(startIndex);
+
+    for (int i=startIndex; i<_visualItems->count(); i++) {
         VisualMissionItem*  item =          qobject_cast<VisualMissionItem*>(_visualItems->get(i));
         SimpleMissionItem*  simpleItem =    qobject_cast<SimpleMissionItem*>(item);
         ComplexMissionItem* complexItem =   qobject_cast<ComplexMissionItem*>(item);
 
+        _flightStatusCheckpoints.append({ item, _missionFlightStatus, lastFlyThroughVI, firstCoordinateItem, linkStartToHome, foundRTL, pastLandCommand,
+                                          totalHorizontalDistance, _minAMSLAltitude, _maxAMSLAltitude });
+
         if (simpleItem && simpleItem->mavCommand() == MAV_CMD_NAV_RETURN_TO_LAUNCH) {
             foundRTL = true;
         }
@@ -1775,9 +1840,13 @@ void MissionController::_recalcMissionFlightStatus()
     emit minAMSLAltitudeChanged         (_minAMSLAltitude);
     emit maxAMSLAltitudeChanged         (_maxAMSLAltitude);
 
-    // Walk the list again calculating altitude percentages
+    // Walk the list again calculating altitude percentages. Unchanged items only need updating if the altitude range changed.
+    auto sameAltitude = [](double alt1, double alt2) { return alt1 == alt2 || (qIsNaN(alt1) && qIsNaN(alt2)); };
+    if (!sameAltitude(_minAMSLAltitude, prevMinAMSLAltitude) || !sameAltitude(_maxAMSLAltitude, prevMaxAMSLAltitude)) {
+        startIndex = 0;
+    }
     double altRange = _maxAMSLAltitude - _minAMSLAltitude;
-    for (int i=0; i<_visualItems->count(); i++) {
+    for (int i=startIndex; i<_visualItems->count(); i++) {
         VisualMissionItem* item = qobject_cast<VisualMissionItem*>(_visualItems->get(i));
 
         if (item->specifiesCoordinate()) {
@@ -1927,6 +1996,8 @@ void MissionController::_initAllVisualItems(void)
         }
     }
 
+    // New set of items, nothing from the previous mission flight status recalc can be reused
+    _flightStatusCheckpoints.clear();
     _recalcAll();
 
     connect(_visualItems, &QmlObjectListModel::dirtyChanged, this, &MissionController::_visualItemsDirtyChanged);
@@ -1961,13 +2032,13 @@ void MissionController::_initVisualItem(VisualMissionItem* visualItem)
     setDirty(false);
 
     connect(visualItem, &VisualMissionItem::specifiesCoordinateChanged,                 this, &MissionController::_recalcFlightPathSegmentsSignal,  Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedFlightSpeedChanged,                this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedGimbalYawChanged,                  this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedGimbalPitchChanged,                this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedVehicleYawChanged,                 this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::terrainAltitudeChanged,                     this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::additionalTimeDelayChanged,                 this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::currentVTOLModeChanged,                     this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    connect(visualItem, &VisualMissionItem::specifiedFlightSpeedChanged,                this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::specifiedGimbalYawChanged,                  this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::specifiedGimbalPitchChanged,                this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::specifiedVehicleYawChanged,                 this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::terrainAltitudeChanged,                     this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::additionalTimeDelayChanged,                 this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+    connect(visualItem, &VisualMissionItem::currentVTOLModeChanged,                     this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
     connect(visualItem, &VisualMissionItem::lastSequenceNumberChanged,                  this, &MissionController::_recalcSequence);
 
     if (visualItem->isSimpleItem()) {
@@ -1981,10 +2052,10 @@ void MissionController::_initVisualItem(VisualMissionItem* visualItem)
     } else {
         ComplexMissionItem* complexItem = qobject_cast<ComplexMissionItem*>(visualItem);
         if (complexItem) {
-            connect(complexItem, &ComplexMissionItem::complexDistanceChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::greatestDistanceToChanged,    this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::minAMSLAltitudeChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::maxAMSLAltitudeChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+            connect(complexItem, &ComplexMissionItem::complexDistanceChanged,       this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+            connect(complexItem, &ComplexMissionItem::greatestDistanceToChanged,    this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+            connect(complexItem, &ComplexMissionItem::minAMSLAltitudeChanged,       this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
+            connect(complexItem, &ComplexMissionItem::maxAMSLAltitudeChanged,       this, [this, visualItem]() { _recalcMissionFlightStatusFrom(visualItem); });
             connect(complexItem, &ComplexMissionItem::isIncompleteChanged,          this, &MissionController::_recalcFlightPathSegmentsSignal,  Qt::QueuedConnection);
         } else {
             qWarning() << "ComplexMissionItem not found";
@@ -2029,8 +2100,8 @@ void MissionController::_managerVehicleChanged(Vehicle* managerVehicle)
     connect(_missionManager, &MissionManager::lastCurrentIndexChanged,  this, &MissionController::resumeMissionIndexChanged);
     connect(_missionManager, &MissionManager::resumeMissionReady,       this, &MissionController::resumeMissionReady);
     connect(_missionManager, &MissionManager::resumeMissionUploadFail,  this, &MissionController::resumeMissionUploadFail);
-    connect(_managerVehicle, &Vehicle::defaultCruiseSpeedChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(_managerVehicle, &Vehicle::defaultHoverSpeedChanged,        this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    connect(_managerVehicle, &Vehicle::defaultCruiseSpeedChanged,       this, [this]() { _recalcMissionFlightStatusFrom(nullptr); });
+    connect(_managerVehicle, &Vehicle::defaultHoverSpeedChanged,        this, [this]() { _recalcMissionFlightStatusFrom(nullptr); });
     connect(_managerVehicle, &Vehicle::vehicleTypeChanged,              this, &MissionController::complexMissionItemNamesChanged);
 
     emit complexMissionItemNamesChanged();
@@ -355,6 +355,8 @@ private slots:
     void                    _scanForAdditionalSettings          (QmlObjectListModel* visualItems, PlanMasterController* masterController);
     void                    _setPlannedHomePositionFromFirstCoordinate(const QGeoCoordinate& clickCoordinate);
     void                    _resetMissionFlightStatus           (void);
+    void                    _recalcMissionFlightStatusFrom      (VisualMissionItem* visualItem);
+    int                     _missionFlightStatusResumeIndex     (bool homePositionValid);
     void                    _addHoverTime                       (double hoverTime, double hoverDistance, int waypointIndex);
     void                    _addCruiseTime                      (double cruiseTime, double cruiseDistance, int wayPointIndex);
     void                    _updateBatteryInfo                  (int waypointIndex);
@@ -376,6 +378,21 @@ private slots:
     static bool             _convertToMissionItems              (QmlObjectListModel* visualMissionItems, QList<MissionItem*>& rgMissionItems, QObject* missionItemParent);
 
 private:
+    /// Mission flight status recalc state prior to processing a visual item. Allows a recalc to resume from the first
+    /// changed item instead of walking the entire mission.
+    typedef struct {
+        VisualMissionItem*      visualItem;
+        MissionFlightStatus_t   missionFlightStatus;
+        VisualMissionItem*      lastFlyThroughVI;
+        bool                    firstCoordinateItem;
+        bool                    linkStartToHome;
+        bool                    foundRTL;
+        bool                    pastLandCommand;
+        double                  totalHorizontalDistance;
+        double                  minAMSLAltitude;
+        double                  maxAMSLAltitude;
+    } FlightStatusCheckpoint_t;
+
     Vehicle*                    _controllerVehicle =            nullptr;
     Vehicle*                    _managerVehicle =               nullptr;
     MissionManager*             _missionManager =               nullptr;
@@ -413,6 +430,9 @@ private slots:
     double                      _minAMSLAltitude =              0;
     double                      _maxAMSLAltitude =              0;
     bool                        _missionContainsVTOLTakeoff =   false;
+    int                         _flightStatusDirtyIndex =       0;      ///< First visual item index which needs mission flight status recalc
+    bool                        _flightStatusHomePositionValid = false; ///< Home position validity used for the current checkpoints
+    QList<FlightStatusCheckpoint_t> _flightStatusCheckpoints;           ///< Indexed by visual item index
 
     QGroundControlQmlGlobal::AltMode _globalAltMode = QGroundControlQmlGlobal::AltitudeModeRelative;
 
@@ -15,6 +15,8 @@
 #include "MissionCommandTree.h"
 #include "QGCLoggingCategory.h"
 
+#include <algorithm>
+
 QGC_LOGGING_CATEGORY(PlanManagerLog, "PlanManager.PlanManager")
 
 PlanManager::PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType)
@@ -27,6 +29,7 @@ PlanManager::PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType)
     , _resumeMission            (false)
     , _lastMissionRequest       (-1)
     , _missionItemCountToRead   (-1)
+    , _highestMissionRequest    (-1)
     , _currentMissionIndex      (-1)
     , _lastCurrentIndex         (-1)
 {
@@ -34,6 +37,8 @@ PlanManager::PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType)
     _ackTimeoutTimer->setSingleShot(true);
 
     connect(_ackTimeoutTimer, &QTimer::timeout, this, &PlanManager::_ackTimeout);
+
+    _transferTimer.start();
 }
 
 PlanManager::~PlanManager()
@@ -44,6 +49,7 @@ PlanManager::~PlanManager()
 void PlanManager::_writeMissionItemsWorker(void)
 {
     _lastMissionRequest = -1;
+    _highestMissionRequest = -1;
 
     emit progressPctChanged(0);
 
@@ -54,8 +60,11 @@ void PlanManager::_writeMissionItemsWorker(void)
     for (int i=0; i<_writeMissionItems.count(); i++) {
         _itemIndicesToWrite << i;
     }
+    _itemSentMsecs.fill(-1, _writeMissionItems.count());
+    _itemSendCount.fill(0, _writeMissionItems.count());
 
     _retryCount = 0;
+    _startTransferWindow();
     _setTransactionInProgress(TransactionWrite);
     _connectToMavlink();
     _writeMissionCount();
@@ -142,6 +151,7 @@ void PlanManager::loadFromVehicle(void)
     }
 
     _retryCount = 0;
+    _startTransferWindow();
     _setTransactionInProgress(TransactionRead);
     _connectToMavlink();
     _requestList();
@@ -152,7 +162,6 @@ void PlanManager::_requestList(void)
 {
     qCDebug(PlanManagerLog) << QStringLiteral("_requestList %1 _planType:_retryCount").arg(_planTypeString()) << _planType << _retryCount;
 
-    _itemIndicesToRead.clear();
     _clearMissionItems();
 
     SharedLinkInterfacePtr  sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
@@ -200,8 +209,10 @@ void PlanManager::_ackTimeout(void)
             _finishTransaction(false);
         } else {
             _retryCount++;
-            qCDebug(PlanManagerLog) << tr("Retrying %1 MISSION_REQUEST retry Count").arg(_planTypeString()) << _retryCount;
-            _requestNextMissionItem();
+            // Back off until the vehicle responds again, the next round trip sample will pull the timeout back down
+            _retryTimeoutMsecs = qMin(_retryTimeoutMsecs * 2, _ackTimeoutMilliseconds);
+            qCDebug(PlanManagerLog) << tr("Retrying %1 MISSION_REQUEST retry Count").arg(_planTypeString()) << _retryCount << _retryTimeoutMsecs;
+            _resendMissionItemRequests();
         }
         break;
     case AckMissionRequest:
@@ -252,7 +263,7 @@ void PlanManager::_startAckTimeout(AckType_t ack)
     switch (ack) {
     case AckMissionItem:
         // We are actively trying to get the mission item, so we don't want to wait as long.
-        _ackTimeoutTimer->setInterval(_retryTimeoutMilliseconds);
+        _ackTimeoutTimer->setInterval(_retryTimeoutMsecs);
         break;
     case AckNone:
         // FALLTHROUGH
@@ -351,6 +362,30 @@ void PlanManager::_handleMissionCount(const mavlink_message_t& message)
     }
 }
 
+/// Decides how many mission items may be in flight for the transaction which is about to start
+void PlanManager::_startTransferWindow(void)
+{
+    _transferWindowSize = _vehicle->firmwarePlugin()->supportsMissionItemStreaming() ? _maxItemsInFlight : 1;
+    _outstandingItemRequests.clear();
+    _reRequestedItems.clear();
+
+    qCDebug(PlanManagerLog) << QStringLiteral("_startTransferWindow %1 windowSize:retryTimeout").arg(_planTypeString()) << _transferWindowSize << _retryTimeoutMsecs;
+}
+
+void PlanManager::_updateRtt(qint64 rttMsecs)
+{
+    if (_srttMsecs == 0) {
+        _srttMsecs      = rttMsecs;
+        _rttVarMsecs    = rttMsecs / 2.0;
+    } else {
+        _rttVarMsecs    = (0.75 * _rttVarMsecs) + (0.25 * qAbs(_srttMsecs - rttMsecs));
+        _srttMsecs      = (0.875 * _srttMsecs) + (0.125 * rttMsecs);
+    }
+
+    _retryTimeoutMsecs = qBound(_minRetryTimeoutMilliseconds, qRound(_srttMsecs + (4 * _rttVarMsecs)), _ackTimeoutMilliseconds);
+}
+
+/// Requests the lowest outstanding items until the transfer window is full
 void PlanManager::_requestNextMissionItem(void)
 {
     if (_itemIndicesToRead.count() == 0) {
@@ -358,8 +393,47 @@ void PlanManager::_requestNextMissionItem(void)
         return;
     }
 
-    qCDebug(PlanManagerLog) << QStringLiteral("_requestNextMissionItem %1 sequenceNumber:retry").arg(_planTypeString()) << _itemIndicesToRead[0] << _retryCount;
+    const qint64 nowMsecs = _transferTimer.elapsed();
+
+    // Items which are still missing a retry timeout after being requested were lost, ask again without waiting for the window to stall
+    for (auto it = _outstandingItemRequests.begin(); it != _outstandingItemRequests.end(); it++) {
+        if (nowMsecs - it.value() >= _retryTimeoutMsecs) {
+            qCDebug(PlanManagerLog) << QStringLiteral("_requestNextMissionItem %1 re-request sequenceNumber").arg(_planTypeString()) << it.key();
+            _sendMissionRequest(it.key());
+            _reRequestedItems.insert(it.key());
+            it.value() = nowMsecs;
+        }
+    }
+
+    for (const int seq: _itemIndicesToRead) {
+        if (_outstandingItemRequests.count() >= _transferWindowSize) {
+            break;
+        }
+        if (!_outstandingItemRequests.contains(seq)) {
+            qCDebug(PlanManagerLog) << QStringLiteral("_requestNextMissionItem %1 sequenceNumber:retry").arg(_planTypeString()) << seq << _retryCount;
+            _sendMissionRequest(seq);
+            _outstandingItemRequests[seq] = nowMsecs;
+        }
+    }
+    _startAckTimeout(AckMissionItem);
+}
+
+/// Re-requests every item in the window which has not arrived yet in a single burst
+void PlanManager::_resendMissionItemRequests(void)
+{
+    const qint64 nowMsecs = _transferTimer.elapsed();
+
+    for (auto it = _outstandingItemRequests.begin(); it != _outstandingItemRequests.end(); it++) {
+        qCDebug(PlanManagerLog) << QStringLiteral("_resendMissionItemRequests %1 sequenceNumber:retry").arg(_planTypeString()) << it.key() << _retryCount;
+        _sendMissionRequest(it.key());
+        _reRequestedItems.insert(it.key());
+        it.value() = nowMsecs;
+    }
+    _requestNextMissionItem();
+}
 
+void PlanManager::_sendMissionRequest(int seq)
+{
     SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
     if (sharedLink) {
         mavlink_message_t       message;
@@ -370,11 +444,10 @@ void PlanManager::_requestNextMissionItem(void)
                                                   &message,
                                                   _vehicle->id(),
                                                   MAV_COMP_ID_AUTOPILOT1,
-                                                  _itemIndicesToRead[0],
+                                                  seq,
                                                   _planType);
         _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), message);
     }
-    _startAckTimeout(AckMissionItem);
 }
 
 void PlanManager::_handleMissionItem(const mavlink_message_t& message)
@@ -445,6 +518,12 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
     if (_itemIndicesToRead.contains(seq)) {
         _itemIndicesToRead.removeOne(seq);
 
+        // A response to a re-requested item may belong to either request, so it can't be used as a round trip sample
+        if (_outstandingItemRequests.contains(seq) && !_reRequestedItems.contains(seq)) {
+            _updateRtt(_transferTimer.elapsed() - _outstandingItemRequests[seq]);
+        }
+        _outstandingItemRequests.remove(seq);
+
         MissionItem* item = new MissionItem(seq,
                                             command,
                                             frame,
@@ -472,10 +551,14 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
         return;
     }
 
-    emit progressPctChanged((double)seq / (double)_missionItemCountToRead);
+    emit progressPctChanged((double)(_missionItemCountToRead - _itemIndicesToRead.count()) / (double)_missionItemCountToRead);
 
     _retryCount = 0;
     if (_itemIndicesToRead.count() == 0) {
+        // Items may have arrived out of order when more than one was in flight
+        std::sort(_missionItems.begin(), _missionItems.end(), [](const MissionItem* a, const MissionItem* b) {
+            return a->sequenceNumber() < b->sequenceNumber();
+        });
         _readTransactionComplete();
     } else {
         _requestNextMissionItem();
@@ -485,6 +568,8 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
 void PlanManager::_clearMissionItems(void)
 {
     _itemIndicesToRead.clear();
+    _outstandingItemRequests.clear();
+    _reRequestedItems.clear();
     _clearAndDeleteMissionItems();
 }
 
@@ -526,8 +611,44 @@ void PlanManager::_handleMissionRequest(const mavlink_message_t& message)
         _itemIndicesToWrite.removeOne(missionRequestSeq);
     }
 
-    MissionItem* item = _writeMissionItems[missionRequestSeq];
-    qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionRequest %1 sequenceNumber:command").arg(_planTypeString()) << missionRequestSeq << item->command();
+    if (missionRequestSeq > _highestMissionRequest) {
+        // The vehicle requests the next item once it has stored the previous one
+        if ((missionRequestSeq > 0) && (_itemSendCount[missionRequestSeq - 1] == 1)) {
+            _updateRtt(_transferTimer.elapsed() - _itemSentMsecs[missionRequestSeq - 1]);
+        }
+        if (_transferWindowSize > 1) {
+            // Vehicles store items in order, so a request implies all previous items arrived even if their own
+            // requests were lost or crossed with the streamed items.
+            while (!_itemIndicesToWrite.isEmpty() && (_itemIndicesToWrite.first() < missionRequestSeq)) {
+                _itemIndicesToWrite.removeFirst();
+            }
+        }
+        _highestMissionRequest = missionRequestSeq;
+    }
+
+    if (_transferWindowSize == 1) {
+        _sendMissionItem(missionRequestSeq);
+    } else {
+        // Stream the window which starts at the requested item. Items still in flight are left alone, anything sent
+        // longer than a retry timeout ago is assumed lost and goes again (go-back-N).
+        const qint64 nowMsecs = _transferTimer.elapsed();
+        const int windowEnd = qMin(missionRequestSeq + _transferWindowSize, static_cast<int>(_writeMissionItems.count()));
+        for (int seq=missionRequestSeq; seq<windowEnd; seq++) {
+            if ((_itemSentMsecs[seq] < 0) || (nowMsecs - _itemSentMsecs[seq] >= _retryTimeoutMsecs)) {
+                _sendMissionItem(seq);
+            }
+        }
+    }
+    _startAckTimeout(AckMissionRequest);
+}
+
+void PlanManager::_sendMissionItem(int seq)
+{
+    MissionItem* item = _writeMissionItems[seq];
+    qCDebug(PlanManagerLog) << QStringLiteral("_sendMissionItem %1 sequenceNumber:command").arg(_planTypeString()) << seq << item->command();
+
+    _itemSentMsecs[seq] = _transferTimer.elapsed();
+    _itemSendCount[seq]++;
 
     SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
     if (sharedLink) {
@@ -539,10 +660,10 @@ void PlanManager::_handleMissionRequest(const mavlink_message_t& message)
                                                &messageOut,
                                                _vehicle->id(),
                                                MAV_COMP_ID_AUTOPILOT1,
-                                               missionRequestSeq,
+                                               seq,
                                                item->frame(),
                                                item->command(),
-                                               missionRequestSeq == 0,
+                                               seq == 0,
                                                item->autoContinue(),
                                                item->param1(),
                                                item->param2(),
@@ -554,7 +675,6 @@ void PlanManager::_handleMissionRequest(const mavlink_message_t& message)
                                                _planType);
         _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), messageOut);
     }
-    _startAckTimeout(AckMissionRequest);
 }
 
 void PlanManager::_handleMissionAck(const mavlink_message_t& message)
@@ -576,6 +696,12 @@ void PlanManager::_handleMissionAck(const mavlink_message_t& message)
         qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionAck ArduPilot sending possibly bogus MAV_MISSION_INVALID_SEQUENCE").arg(_planTypeString()) << _planType;
         return;
     }
+    if ((_transferWindowSize > 1) && (_transactionInProgress == TransactionWrite) && (missionAck.type == MAV_MISSION_INVALID_SEQUENCE)) {
+        // Streamed items which the vehicle is not ready for yet, or duplicates from a go-back-N resend, can be
+        // rejected this way. The vehicle will request them again.
+        qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionAck %1 ignoring MAV_MISSION_INVALID_SEQUENCE for streamed item").arg(_planTypeString());
+        return;
+    }
 
     // Save the retry ack before calling _checkForExpectedAck since we'll need it to determine what
     // type of a protocol sequence we are in.
@@ -610,6 +736,10 @@ void PlanManager::_handleMissionAck(const mavlink_message_t& message)
     case AckMissionRequest:
         // MISSION_REQUEST is expected, or MAV_MISSION_ACCEPTED to end sequence
         if (missionAck.type == MAV_MISSION_ACCEPTED) {
+            if ((_transferWindowSize > 1) && (_itemIndicesToWrite.count() == 1) && (_itemIndicesToWrite[0] == _writeMissionItems.count() - 1)) {
+                // The request for the last item may have been lost, the ack itself confirms the item arrived
+                _itemIndicesToWrite.clear();
+            }
             if (_itemIndicesToWrite.count() == 0) {
                 qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionAck write sequence complete %1").arg(_planTypeString());
                 _finishTransaction(true);
@@ -813,6 +943,7 @@ void PlanManager::_finishTransaction(bool success, bool apmGuidedItemWrite)
 
     _itemIndicesToRead.clear();
     _itemIndicesToWrite.clear();
+    _outstandingItemRequests.clear();
 
     // First thing we do is clear the transaction. This way inProgesss is off when we signal transaction complete.
     TransactionType_t currentTransactionType = _transactionInProgress;
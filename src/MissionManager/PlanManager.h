@@ -9,7 +9,10 @@
 
 #pragma once
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QTimer>
 #include <QtCore/QLoggingCategory>
 
@@ -26,6 +29,8 @@ class PlanManager : public QObject
 {
     Q_OBJECT
 
+    friend class MissionManagerTest;    // Unit test
+
 public:
     PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType);
     ~PlanManager();
@@ -68,10 +73,14 @@ class PlanManager : public QObject
 
     // These values are public so the unit test can set appropriate signal wait times
     // When passively waiting for a mission process, use a longer timeout.
-    static const int _ackTimeoutMilliseconds = 1500;
+    static constexpr int _ackTimeoutMilliseconds = 1500;
     // When actively retrying to request mission items, use a shorter timeout instead.
-    static const int _retryTimeoutMilliseconds = 250;
-    static const int _maxRetryCount = 5;
+    // This is the initial value, it adapts to the measured round trip time once items start flowing.
+    static constexpr int _retryTimeoutMilliseconds = 250;
+    static constexpr int _minRetryTimeoutMilliseconds = 50;
+    static constexpr int _maxRetryCount = 5;
+    /// Maximum number of mission items in flight for firmware which supports item streaming
+    static constexpr int _maxItemsInFlight = 16;
 
 signals:
     void newMissionItemsAvailable   (bool removeAllRequested);
@@ -114,6 +123,11 @@ private slots:
     void _handleMissionRequest(const mavlink_message_t& message);
     void _handleMissionAck(const mavlink_message_t& message);
     void _requestNextMissionItem(void);
+    void _resendMissionItemRequests(void);
+    void _sendMissionRequest(int seq);
+    void _sendMissionItem(int seq);
+    void _updateRtt(qint64 rttMsecs);
+    void _startTransferWindow(void);
     void _clearMissionItems(void);
     void _sendError(ErrorCode_t errorCode, const QString& errorMsg);
     QString _ackTypeToString(AckType_t ackType);
@@ -144,6 +158,17 @@ private slots:
     QList<int>          _itemIndicesToRead;     ///< List of mission items which still need to be requested from vehicle
     int                 _lastMissionRequest;    ///< Index of item last requested by MISSION_REQUEST
     int                 _missionItemCountToRead;///< Count of all mission items to read
+    int                 _highestMissionRequest; ///< Highest index requested by MISSION_REQUEST during this write
+
+    int                 _transferWindowSize =   1;      ///< Maximum items in flight, 1 is the strict one item per round trip protocol
+    QElapsedTimer       _transferTimer;
+    QMap<int, qint64>   _outstandingItemRequests;       ///< Read: requested seq -> msecs last requested
+    QSet<int>           _reRequestedItems;              ///< Read: items requested more than once, never used as round trip samples (Karn's algorithm)
+    QList<qint64>       _itemSentMsecs;                 ///< Write: msecs each item was last sent, -1 if never sent
+    QList<int>          _itemSendCount;                 ///< Write: number of times each item has been sent
+    int                 _retryTimeoutMsecs =    _retryTimeoutMilliseconds;  ///< Current MISSION_ITEM timeout adapted from the round trip time
+    double              _srttMsecs =            0;      ///< Smoothed round trip time, 0 until the first sample
+    double              _rttVarMsecs =          0;      ///< Round trip time variation
 
     QList<MissionItem*> _missionItems;          ///< Set of mission items on vehicle
     QList<MissionItem*> _writeMissionItems;     ///< Set of mission items currently being written to vehicle
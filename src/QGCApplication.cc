@@ -41,6 +41,7 @@
 #include "QGCFileDownload.h"
 #include "QGCImageProvider.h"
 #include "QGCLoggingCategory.h"
+#include "QGCTrace.h"
 #include "SettingsManager.h"
 #include "MavlinkSettings.h"
 #include "AppSettings.h"
@@ -65,6 +66,10 @@ QGCApplication::QGCApplication(int &argc, char *argv[], const QGCCommandLinePars
 {
     _msecsElapsedTime.start();
 
+    if (cli.traceFile.has_value()) {
+        (void) QGCTrace::start(cli.traceFile.value());
+    }
+
     // Setup for network proxy support
     QNetworkProxyFactory::setUseSystemConfiguration(true);
 
@@ -678,6 +683,8 @@ void QGCApplication::shutdown()
 
     // This is bad, but currently qobject inheritances are incorrect and cause crashes on exit without
     delete _qmlAppEngine;
+
+    QGCTrace::stop();
 }
 
 QString QGCApplication::numberToString(quint64 number)
@@ -74,7 +74,7 @@ Item {
 
                 Connections {
                     target:         debugMessageModel
-                    function onDataChanged(topLeft, bottomRight, roles) { listView.scrollToEnd() }
+                    function onRowsInserted(parent, first, last) { listView.scrollToEnd() }
                 }
             }
 
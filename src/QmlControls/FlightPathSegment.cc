@@ -27,6 +27,11 @@ FlightPathSegment::FlightPathSegment(SegmentType segmentType, const QGeoCoordina
     _delayedTerrainPathQueryTimer.callOnTimeout(this, &FlightPathSegment::_sendTerrainPathQuery);
     _updateTotalDistance();
 
+    if (_queryTerrainData) {
+        _terrainPathQuery = new TerrainPathQuery(false /* autoDelete */, this);
+        connect(_terrainPathQuery, &TerrainPathQuery::terrainDataReceived, this, &FlightPathSegment::_terrainDataReceived);
+    }
+
     qCDebug(FlightPathSegmentLog) << this << "new" << coord1 << coord2 << amslCoord1Alt << amslCoord2Alt << _totalDistance;
 
     _sendTerrainPathQuery();
@@ -82,24 +87,18 @@ void FlightPathSegment::_sendTerrainPathQuery(void)
 {
     if (_queryTerrainData && _coord1.isValid() && _coord2.isValid()) {
         qCDebug(FlightPathSegmentLog) << this << "_sendTerrainPathQuery";
-        // Clear any previous query
-        if (_currentTerrainPathQuery) {
-            // We are already waiting on another query. We don't care about those results any more.
-            disconnect(_currentTerrainPathQuery, &TerrainPathQuery::terrainDataReceived, this, &FlightPathSegment::_terrainDataReceived);
-            _currentTerrainPathQuery = nullptr;
-        }
 
         // Clear old terrain data
         _amslTerrainHeights.clear();
+        _rgTerrainHeights.clear();
         _distanceBetween = 0;
         _finalDistanceBetween = 0;
         emit distanceBetweenChanged(0);
         emit finalDistanceBetweenChanged(0);
         emit amslTerrainHeightsChanged();
 
-        _currentTerrainPathQuery = new TerrainPathQuery(true /* autoDelete */);
-        connect(_currentTerrainPathQuery, &TerrainPathQuery::terrainDataReceived, this, &FlightPathSegment::_terrainDataReceived);
-        _currentTerrainPathQuery->requestData(_coord1, _coord2);
+        // Replaces any previous request for this segment which is still outstanding
+        _terrainPathQuery->requestData(_coord1, _coord2);
     }
 }
 
@@ -116,16 +115,15 @@ void FlightPathSegment::_terrainDataReceived(bool success, const TerrainPathQuer
             emit finalDistanceBetweenChanged(_finalDistanceBetween);
         }
 
+        _rgTerrainHeights = pathHeightInfo.heights;
         _amslTerrainHeights.clear();
-        for (const double& amslTerrainHeight: pathHeightInfo.heights) {
+        _amslTerrainHeights.reserve(_rgTerrainHeights.count());
+        for (const double& amslTerrainHeight: _rgTerrainHeights) {
             _amslTerrainHeights.append(amslTerrainHeight);
         }
         emit amslTerrainHeightsChanged();
     }
 
-    _currentTerrainPathQuery->deleteLater();
-    _currentTerrainPathQuery = nullptr;
-
     _updateTerrainCollision();
 }
 
@@ -151,7 +149,7 @@ void FlightPathSegment::_updateTerrainCollision(void)
         double yIntercept = _coord1AMSLAlt;
 
         double x = 0;
-        for (int i=0; i<_amslTerrainHeights.count(); i++) {
+        for (int i=0; i<_rgTerrainHeights.count(); i++) {
             bool ignoreCollision = false;
             if (_segmentType == SegmentTypeTakeoff && x < _collisionIgnoreMeters) {
                 ignoreCollision = true;
@@ -160,14 +158,14 @@ void FlightPathSegment::_updateTerrainCollision(void)
             }
 
             if (!ignoreCollision) {
-                double y = _amslTerrainHeights[i].value<double>();
+                double y = _rgTerrainHeights[i];
                 if (y > (slope * x) + yIntercept) {
                     newTerrainCollision = true;
                     break;
                 }
             }
 
-            if (i == _amslTerrainHeights.count() - 2) {
+            if (i == _rgTerrainHeights.count() - 2) {
                 x += _finalDistanceBetween;
             } else {
                 x += _distanceBetween;
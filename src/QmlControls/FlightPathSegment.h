@@ -95,8 +95,9 @@ private slots:
     bool                _terrainCollision =             false;
     bool                _specialVisual =                false;
     QTimer              _delayedTerrainPathQueryTimer;
-    TerrainPathQuery*   _currentTerrainPathQuery =      nullptr;
+    TerrainPathQuery*   _terrainPathQuery =             nullptr;    ///< Re-used for each query, queries from all segments are batched together
     QVariantList        _amslTerrainHeights;
+    QList<double>       _rgTerrainHeights;                          ///< Same as _amslTerrainHeights, used for collision checks without QVariant conversions
     double              _distanceBetween =              0;
     double              _finalDistanceBetween =         0;
     double              _totalDistance =                0;
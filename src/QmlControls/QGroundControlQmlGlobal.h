@@ -29,6 +29,7 @@ class QGCMapEngineManager;
 class QGCPalette;
 class QGCPositionManager;
 class SettingsManager;
+class TelemetryLatency;
 class VideoManager;
 class UTMSPManager;
 class AirLinkManager;
@@ -44,6 +45,7 @@ Q_MOC_INCLUDE("QGCMapEngineManager.h")
 Q_MOC_INCLUDE("QGCPalette.h")
 Q_MOC_INCLUDE("PositionManager.h")
 Q_MOC_INCLUDE("SettingsManager.h")
+Q_MOC_INCLUDE("TelemetryLatency.h")
 Q_MOC_INCLUDE("VideoManager.h")
 #ifdef QGC_UTM_ADAPTER
 Q_MOC_INCLUDE("UTMSPManager.h")
@@ -80,6 +82,7 @@ class QGroundControlQmlGlobal : public QObject
     Q_PROPERTY(VideoManager*        videoManager            READ    videoManager            CONSTANT)
     Q_PROPERTY(SettingsManager*     settingsManager         READ    settingsManager         CONSTANT)
     Q_PROPERTY(ADSBVehicleManager*  adsbVehicleManager      READ    adsbVehicleManager      CONSTANT)
+    Q_PROPERTY(TelemetryLatency*    telemetryLatency        READ    telemetryLatency        CONSTANT)
     Q_PROPERTY(QGCCorePlugin*       corePlugin              READ    corePlugin              CONSTANT)
     Q_PROPERTY(MissionCommandTree*  missionCommandTree      READ    missionCommandTree      CONSTANT)
 #ifndef QGC_NO_SERIAL_LINK
@@ -179,6 +182,7 @@ class QGroundControlQmlGlobal : public QObject
     FactGroup*              gpsRtkFactGroup     ()  { return _gpsRtkFactGroup; }
 #endif
     ADSBVehicleManager*     adsbVehicleManager  ()  { return _adsbVehicleManager; }
+    TelemetryLatency*       telemetryLatency    ()  { return _telemetryLatency; }
     QmlUnitsConversion*     unitsConversion     ()  { return &_unitsConversion; }
     static QGeoCoordinate   flightMapPosition   ()  { return _coord; }
     static double           flightMapZoom       ()  { return _zoom; }
@@ -249,6 +253,7 @@ class QGroundControlQmlGlobal : public QObject
 private:
     QGCMapEngineManager*    _mapEngineManager       = nullptr;
     ADSBVehicleManager*     _adsbVehicleManager     = nullptr;
+    TelemetryLatency*       _telemetryLatency       = nullptr;
     QGCPositionManager*     _qgcPositionManager     = nullptr;
     MissionCommandTree*     _missionCommandTree     = nullptr;
     VideoManager*           _videoManager           = nullptr;
@@ -34,6 +34,7 @@ class MavlinkSettings : public SettingsGroup
     DEFINE_SETTINGFACT(sendGCSHeartbeat)
     DEFINE_SETTINGFACT(gcsMavlinkSystemID)
     DEFINE_SETTINGFACT(requireMatchingMavlinkVersions)
+    DEFINE_SETTINGFACT(telemetryLatencyEnabled)
 
     // Although this is a global setting it only affects ArduPilot vehicle since PX4 automatically starts the stream from the vehicle side
     DEFINE_SETTINGFACT(apmStartMavlinkStreams)
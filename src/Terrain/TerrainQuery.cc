@@ -18,6 +18,7 @@ QGC_LOGGING_CATEGORY(TerrainQueryLog, "Terrain.TerrainQuery")
 QGC_LOGGING_CATEGORY(TerrainQueryVerboseLog, "Terrain.TerrainQuery:verbose")
 
 Q_GLOBAL_STATIC(TerrainAtCoordinateBatchManager, _terrainAtCoordinateBatchManager)
+Q_GLOBAL_STATIC(TerrainPathBatchManager, _terrainPathBatchManager)
 
 TerrainAtCoordinateBatchManager::TerrainAtCoordinateBatchManager(QObject *parent)
     : QObject(parent)
@@ -193,14 +194,192 @@ void TerrainAtCoordinateQuery::signalTerrainData(bool success, const QList<doubl
 
 /*===========================================================================*/
 
+TerrainPathBatchManager::TerrainPathBatchManager(TerrainQueryInterface *terrainQuery, QObject *parent)
+    : QObject(parent)
+    , _batchTimer(new QTimer(this))
+    , _terrainQuery(terrainQuery ? terrainQuery : new TerrainOfflineQuery(this))
+{
+    // qCDebug(TerrainQueryLog) << Q_FUNC_INFO << this;
+
+    // Zero timeout collects everything queued during the current pass through the event loop. For example all the
+    // flight path segments created by a single mission recalc.
+    _batchTimer->setSingleShot(true);
+    _batchTimer->setInterval(0);
+
+    (void) connect(_batchTimer, &QTimer::timeout, this, &TerrainPathBatchManager::_sendNextBatch);
+    (void) connect(_terrainQuery, &TerrainQueryInterface::coordinateHeightsReceived, this, &TerrainPathBatchManager::_coordinateHeights);
+}
+
+TerrainPathBatchManager::~TerrainPathBatchManager()
+{
+    // qCDebug(TerrainQueryLog) << Q_FUNC_INFO << this;
+}
+
+TerrainPathBatchManager *TerrainPathBatchManager::instance()
+{
+    return _terrainPathBatchManager();
+}
+
+void TerrainPathBatchManager::addQuery(TerrainPathQuery *terrainPathQuery, const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord)
+{
+    const QueuedRequestInfo_t queuedRequestInfo = {
+        terrainPathQuery,
+        fromCoord,
+        toCoord
+    };
+
+    bool replaced = false;
+    for (QueuedRequestInfo_t &requestInfo: _requestQueue) {
+        if (requestInfo.terrainPathQuery == terrainPathQuery) {
+            requestInfo = queuedRequestInfo;
+            replaced = true;
+            break;
+        }
+    }
+    if (!replaced) {
+        (void) _requestQueue.append(queuedRequestInfo);
+    }
+
+    if (!_batchTimer->isActive()) {
+        _batchTimer->start();
+    }
+}
+
+bool TerrainPathBatchManager::_isQueued(const TerrainPathQuery *terrainPathQuery) const
+{
+    for (const QueuedRequestInfo_t &requestInfo: _requestQueue) {
+        if (requestInfo.terrainPathQuery == terrainPathQuery) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TerrainPathBatchManager::_sendNextBatch()
+{
+    qCDebug(TerrainQueryLog) << Q_FUNC_INFO << "_requestQueue.count:_splitQueue.count:_sentRequests.count" << _requestQueue.count() << _splitQueue.count() << _sentRequests.count();
+
+    if (_state != TerrainQuery::State::Idle) {
+        // Waiting for tiles needed by the last batch, the next batch goes out when it completes
+        return;
+    }
+
+    // Paths split out of a failed batch go first, one at a time. Skip any which were deleted or re-requested since.
+    while (!_splitQueue.isEmpty()) {
+        const QueuedRequestInfo_t requestInfo = _splitQueue.dequeue();
+        if (!requestInfo.terrainPathQuery.isNull() && !_isQueued(requestInfo.terrainPathQuery)) {
+            _sendRequests({ requestInfo });
+            return;
+        }
+    }
+
+    const QList<QueuedRequestInfo_t> requests = _requestQueue;
+    _requestQueue.clear();
+    _sendRequests(requests);
+}
+
+void TerrainPathBatchManager::_sendRequests(const QList<QueuedRequestInfo_t> &requests)
+{
+    _sentRequests.clear();
+
+    // Sample all the paths into a single coordinate list
+    QList<QGeoCoordinate> coords;
+    for (const QueuedRequestInfo_t &requestInfo: requests) {
+        if (requestInfo.terrainPathQuery.isNull()) {
+            continue;
+        }
+
+        SentRequestInfo_t sentRequestInfo;
+        sentRequestInfo.terrainPathQuery = requestInfo.terrainPathQuery;
+        sentRequestInfo.fromCoord = requestInfo.fromCoord;
+        sentRequestInfo.toCoord = requestInfo.toCoord;
+        const QList<QGeoCoordinate> pathCoords = TerrainTileManager::_pathQueryToCoords(requestInfo.fromCoord, requestInfo.toCoord, sentRequestInfo.distanceBetween, sentRequestInfo.finalDistanceBetween);
+        sentRequestInfo.cCoord = pathCoords.count();
+        (void) _sentRequests.append(sentRequestInfo);
+        coords += pathCoords;
+    }
+
+    if (coords.isEmpty()) {
+        return;
+    }
+
+    qCDebug(TerrainQueryLog) << Q_FUNC_INFO << "requesting paths:coords" << _sentRequests.count() << coords.count();
+
+    _state = TerrainQuery::State::Downloading;
+    _terrainQuery->requestCoordinateHeights(coords);
+}
+
+void TerrainPathBatchManager::_batchFailed()
+{
+    const QList<SentRequestInfo_t> sentRequests = _sentRequests;
+    _sentRequests.clear();
+
+    if (sentRequests.count() > 1) {
+        // Any one path may have caused the failure, retry each on its own so the others still get their heights
+        qCDebug(TerrainQueryLog) << Q_FUNC_INFO << "splitting failed batch, paths:" << sentRequests.count();
+        for (const SentRequestInfo_t &sentRequestInfo: sentRequests) {
+            const QueuedRequestInfo_t requestInfo = {
+                sentRequestInfo.terrainPathQuery,
+                sentRequestInfo.fromCoord,
+                sentRequestInfo.toCoord
+            };
+            _splitQueue.enqueue(requestInfo);
+        }
+        return;
+    }
+
+    const TerrainPathQuery::PathHeightInfo_t noPathHeightInfo = { 0, 0, {} };
+
+    for (const SentRequestInfo_t &sentRequestInfo: sentRequests) {
+        if (!sentRequestInfo.terrainPathQuery.isNull() && !_isQueued(sentRequestInfo.terrainPathQuery)) {
+            sentRequestInfo.terrainPathQuery->signalTerrainData(false, noPathHeightInfo);
+        }
+    }
+}
+
+void TerrainPathBatchManager::_coordinateHeights(bool success, const QList<double> &heights)
+{
+    _state = TerrainQuery::State::Idle;
+
+    qCDebug(TerrainQueryLog) << Q_FUNC_INFO << "signalled success:count" << success << heights.count();
+
+    if (!success) {
+        _batchFailed();
+    } else {
+        qsizetype currentIndex = 0;
+        const QList<SentRequestInfo_t> sentRequests = _sentRequests;
+        _sentRequests.clear();
+        for (const SentRequestInfo_t &sentRequestInfo: sentRequests) {
+            const qsizetype startIndex = currentIndex;
+            currentIndex += sentRequestInfo.cCoord;
+
+            // Skip deleted queries as well as queries which have been re-requested with a new path since this batch went out
+            if (sentRequestInfo.terrainPathQuery.isNull() || _isQueued(sentRequestInfo.terrainPathQuery)) {
+                continue;
+            }
+
+            qCDebug(TerrainQueryVerboseLog) << Q_FUNC_INFO << "returned TerrainPathQuery:count" << sentRequestInfo.terrainPathQuery << sentRequestInfo.cCoord;
+            TerrainPathQuery::PathHeightInfo_t pathHeightInfo;
+            pathHeightInfo.distanceBetween = sentRequestInfo.distanceBetween;
+            pathHeightInfo.finalDistanceBetween = sentRequestInfo.finalDistanceBetween;
+            pathHeightInfo.heights = heights.mid(startIndex, sentRequestInfo.cCoord);
+            sentRequestInfo.terrainPathQuery->signalTerrainData(true, pathHeightInfo);
+        }
+    }
+
+    if ((!_requestQueue.isEmpty() || !_splitQueue.isEmpty()) && !_batchTimer->isActive()) {
+        _batchTimer->start();
+    }
+}
+
+/*===========================================================================*/
+
 TerrainPathQuery::TerrainPathQuery(bool autoDelete, QObject *parent)
     : QObject(parent)
     , _autoDelete(autoDelete)
-    , _terrainQuery(new TerrainOfflineQuery(this))
 {
     // qCDebug(TerrainQueryLog) << Q_FUNC_INFO << this;
-
-    (void) connect(_terrainQuery, &TerrainQueryInterface::pathHeightsReceived, this, &TerrainPathQuery::_pathHeights);
 }
 
 TerrainPathQuery::~TerrainPathQuery()
@@ -210,15 +389,11 @@ TerrainPathQuery::~TerrainPathQuery()
 
 void TerrainPathQuery::requestData(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord)
 {
-    _terrainQuery->requestPathHeights(fromCoord, toCoord);
+    TerrainPathBatchManager::instance()->addQuery(this, fromCoord, toCoord);
 }
 
-void TerrainPathQuery::_pathHeights(bool success, double distanceBetween, double finalDistanceBetween, const QList<double> &heights)
+void TerrainPathQuery::signalTerrainData(bool success, const PathHeightInfo_t &pathHeightInfo)
 {
-    PathHeightInfo_t pathHeightInfo;
-    pathHeightInfo.distanceBetween = distanceBetween;
-    pathHeightInfo.finalDistanceBetween = finalDistanceBetween;
-    pathHeightInfo.heights = heights;
     emit terrainDataReceived(success, pathHeightInfo);
     if (_autoDelete) {
         deleteLater();
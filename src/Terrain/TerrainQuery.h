@@ -107,6 +107,61 @@ class TerrainAtCoordinateQuery : public QObject
 
 /*===========================================================================*/
 
+class TerrainPathQuery;
+
+/// Collects the path queries made during a single pass through the event loop and samples the terrain heights for all of them
+/// as a single coordinate query. Tiles shared by the paths are only looked up once, and a plan with many flight path segments
+/// no longer results in one tile manager request per segment. If a batch fails its paths are split up and re-sent one at a
+/// time, so only the paths which touch a failing tile report failure.
+class TerrainPathBatchManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// @param terrainQuery Query used to look up heights, nullptr to use the offline tile cache
+    explicit TerrainPathBatchManager(TerrainQueryInterface *terrainQuery = nullptr, QObject *parent = nullptr);
+    ~TerrainPathBatchManager();
+
+    static TerrainPathBatchManager *instance();
+
+    /// Queues a path query. A query which is already queued has its path replaced, results for a query which is
+    /// already in flight are dropped in favor of the new path.
+    void addQuery(TerrainPathQuery *terrainPathQuery, const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord);
+
+private slots:
+    void _sendNextBatch();
+    void _coordinateHeights(bool success, const QList<double> &heights);
+
+private:
+    struct QueuedRequestInfo_t {
+        QPointer<TerrainPathQuery> terrainPathQuery;
+        QGeoCoordinate fromCoord;
+        QGeoCoordinate toCoord;
+    };
+
+    struct SentRequestInfo_t {
+        QPointer<TerrainPathQuery> terrainPathQuery;
+        QGeoCoordinate fromCoord;
+        QGeoCoordinate toCoord;
+        qsizetype cCoord;
+        double distanceBetween;
+        double finalDistanceBetween;
+    };
+
+    void _batchFailed();
+    bool _isQueued(const TerrainPathQuery *terrainPathQuery) const;
+    void _sendRequests(const QList<QueuedRequestInfo_t> &requests);
+
+    QList<QueuedRequestInfo_t> _requestQueue;
+    QQueue<QueuedRequestInfo_t> _splitQueue;    ///< Paths from a failed batch, each is sent on its own
+    QList<SentRequestInfo_t> _sentRequests;
+    TerrainQuery::State _state = TerrainQuery::State::Idle;
+    QTimer *_batchTimer = nullptr;
+    TerrainQueryInterface *_terrainQuery = nullptr;
+};
+
+/*===========================================================================*/
+
 class TerrainPathQuery : public QObject
 {
     Q_OBJECT
@@ -117,7 +172,7 @@ class TerrainPathQuery : public QObject
     ~TerrainPathQuery();
 
     /// Async terrain query for terrain heights between two lat/lon coordinates. When the query is done, the terrainData() signal
-    /// is emitted.
+    /// is emitted. Calling this again before the results arrive replaces the previous request.
     ///     @param coordinates to query
     void requestData(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord);
 
@@ -127,16 +182,14 @@ class TerrainPathQuery : public QObject
         QList<double> heights;                ///< Terrain heights along path
     };
 
+    void signalTerrainData(bool success, const PathHeightInfo_t &pathHeightInfo);
+
 signals:
     /// Signalled when terrain data comes back from server
     void terrainDataReceived(bool success, const TerrainPathQuery::PathHeightInfo_t &pathHeightInfo);
 
-private slots:
-    void _pathHeights(bool success, double distanceBetween, double finalDistanceBetween, const QList<double> &heights);
-
 private:
     bool _autoDelete = false;
-    TerrainQueryInterface *_terrainQuery = nullptr;
 };
 Q_DECLARE_METATYPE(TerrainPathQuery::PathHeightInfo_t)
 
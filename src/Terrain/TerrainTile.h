@@ -20,6 +20,7 @@ Q_DECLARE_LOGGING_CATEGORY(TerrainTileLog)
 class TerrainTile
 {
     friend class TerrainTileTest;
+    friend class TerrainTileBenchmark;
 
 public:
     /// Constructor from serialized elevation data (either from file or web)
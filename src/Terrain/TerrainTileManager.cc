@@ -58,16 +58,26 @@ bool TerrainTileManager::getAltitudesForCoordinates(const QList<QGeoCoordinate>
 
     const QString elevationProviderName = SettingsManager::instance()->flightMapSettings()->elevationMapProvider()->rawValue().toString();
     const SharedMapProvider provider = UrlFactory::getMapProviderFromProviderType(elevationProviderName);
+
+    // Batched path queries sample long runs of coordinates from the same tile, so only look up the tile when it changes
+    int lastTileX = -1;
+    int lastTileY = -1;
+    TerrainTile *lastTile = nullptr;
+
+    altitudes.reserve(altitudes.count() + coordinates.count());
     for (const QGeoCoordinate &coordinate: coordinates) {
-        const QString tileHash = UrlFactory::getTileHash(
-            provider->getMapName(),
-            provider->long2tileX(coordinate.longitude(), 1),
-            provider->lat2tileY(coordinate.latitude(), 1),
-            1
-        );
-        qCDebug(TerrainTileManagerLog) << "hash:coordinate" << tileHash << coordinate;
-
-        TerrainTile* const tile = _getCachedTile(tileHash);
+        const int tileX = provider->long2tileX(coordinate.longitude(), 1);
+        const int tileY = provider->lat2tileY(coordinate.latitude(), 1);
+        if (!lastTile || (tileX != lastTileX) || (tileY != lastTileY)) {
+            const QString tileHash = UrlFactory::getTileHash(provider->getMapName(), tileX, tileY, 1);
+            qCDebug(TerrainTileManagerLog) << "hash:coordinate" << tileHash << coordinate;
+
+            lastTile = _getCachedTile(tileHash);
+            lastTileX = tileX;
+            lastTileY = tileY;
+        }
+
+        TerrainTile* const tile = lastTile;
         if (tile) {
             const double elevation = tile->elevation(coordinate);
             if (qIsNaN(elevation)) {
@@ -20,6 +20,7 @@
 class TerrainTile;
 class QNetworkAccessManager;
 class UnitTestTerrainQuery;
+class TerrainPathBatchManager;
 
 Q_DECLARE_LOGGING_CATEGORY(TerrainTileManagerLog)
 
@@ -28,6 +29,7 @@ class TerrainTileManager : public QObject
     Q_OBJECT
 
     friend class UnitTestTerrainQuery;
+    friend class TerrainPathBatchManager;
 public:
     explicit TerrainTileManager(QObject *parent = nullptr);
     ~TerrainTileManager();
@@ -144,6 +144,42 @@ SettingsPage {
         }
     }
 
+    SettingsGroupLayout {
+        Layout.fillWidth:   true
+        heading:            qsTr("Telemetry Latency")
+        headingDescription: qsTr("Time received telemetry takes from the link to the display, per link and message.")
+
+        FactCheckBoxSlider {
+            Layout.fillWidth:   true
+            text:               qsTr("Record telemetry latency")
+            fact:               _mavlinkSettings.telemetryLatencyEnabled
+            visible:            fact.visible
+        }
+
+        LabelledButton {
+            label:      qsTr("Latency statistics")
+            buttonText: qsTr("Export")
+            onClicked: {
+                latencyFileDialog.title = qsTr("Export Telemetry Latency")
+                latencyFileDialog.openForSave()
+            }
+        }
+    }
+
+    QGCFileDialog {
+        id:             latencyFileDialog
+        folder:         _appSettings.logSavePath
+        nameFilters:    [ qsTr("Text Files (*.%1)").arg(defaultSuffix) ]
+        defaultSuffix:  "txt"
+
+        onAcceptedForSave: (file) => {
+            close()
+            if (!QGroundControl.telemetryLatency.dumpToFile(file)) {
+                mainWindow.showMessageDialog(qsTr("Export Telemetry Latency"), qsTr("Unable to write '%1'.").arg(file))
+            }
+        }
+    }
+
     SettingsGroupLayout {
         Layout.fillWidth:   true
         heading:            qsTr("Stream Rates (ArduPilot Only)")
@@ -285,7 +285,15 @@ QGCFlickable {
                                 visible: false
                             }
                             onClicked:{
-                                var validToken = QGroundControl.utmspManager.utmspAuthorization.requestOAuth2Client(userName.text,password.text)
+                                loginButton.enabled = false
+                                QGroundControl.utmspManager.utmspAuthorization.requestOAuth2Client(userName.text,password.text)
+                            }
+                        }
+
+                        Connections {
+                            target: QGroundControl.utmspManager.utmspAuthorization
+                            onAuthorizationFinished: function(validToken) {
+                                loginButton.enabled = Qt.binding(function() { return loginSwitch.checked })
                                 if(validToken === true){
                                     loginButton.opacity = 0.5
                                     loading.visible = true
@@ -1286,9 +1294,7 @@ QGCFlickable {
                     enabled:        geoSwitch.checked && triggerSubmitButton
 
                     onClicked: {
-                        submissionTimer.interval = 2500
-                        submissionTimer.repeat = false
-                        submissionTimer.start()
+                        submitFlightPlan.enabled = false
                         loadEndDateTime()
                         var minAltitude   = minSlider.value.toFixed(0)
                         var maxAltitude   = maxSlider.value.toFixed(0)
@@ -1310,17 +1316,27 @@ QGCFlickable {
                         QGroundControl.utmspManager.utmspVehicle.updateEndDateTime(endDateTime.toString())
                         QGroundControl.utmspManager.utmspVehicle.updateMinAltitude(minAltitude)
                         QGroundControl.utmspManager.utmspVehicle.updateMaxAltitude(maxAltitude)
+                        UTMSPStateStorage.startTimeStamp = activateTD
                         QGroundControl.utmspManager.utmspVehicle.triggerFlightAuthorization()
-                        var responseFlightID = QGroundControl.utmspManager.utmspVehicle.responseFlightID
-                        var responseFlag = QGroundControl.utmspManager.utmspVehicle.activationFlag
+                    }
+                }
+
+                Connections {
+                    target: QGroundControl.utmspManager.utmspVehicle
+                    onFlightPlanAuthorizationComplete: function(activated) {
                         var serialNumber = QGroundControl.utmspManager.utmspVehicle.vehicleSerialNumber
                         vehicleIDSent(serialNumber)
-                        flightID = responseFlightID
-                        submissionFlag = responseFlag
-                        UTMSPStateStorage.startTimeStamp = activateTD
-                        UTMSPStateStorage.showActivationTab = responseFlag
+                        flightID = QGroundControl.utmspManager.utmspVehicle.responseFlightID
+                        submissionFlag = activated
+                        UTMSPStateStorage.showActivationTab = activated
                         UTMSPStateStorage.flightID = flightID
                         UTMSPStateStorage.serialNumber = serialNumber
+                        if (!activated) {
+                            submitFlightPlan.enabled = Qt.binding(function() { return geoSwitch.checked && triggerSubmitButton })
+                        }
+                        submissionTimer.interval = 2500
+                        submissionTimer.repeat = false
+                        submissionTimer.start()
                     }
                 }
 
@@ -1341,9 +1357,6 @@ QGCFlickable {
                             UTMSPStateStorage.currentStateIndex = 1
                             UTMSPStateStorage.currentNotificationIndex = 2
                         }
-                        else{
-                            submitFlightPlan.enabled = true
-                        }
                     }
                 }
 
@@ -27,7 +27,7 @@ UTMSPAuthorization::UTMSPAuthorization(QObject *parent):
 
 thread_local std::string clientToken = "";
 
-bool UTMSPAuthorization::requestOAuth2Client(const QString &clientID, const QString &clientSecret)
+void UTMSPAuthorization::requestOAuth2Client(const QString &clientID, const QString &clientSecret)
 {
     QString combinedCredential = clientID + ":" + clientSecret;
     QString encodedBasicToken = combinedCredential.toUtf8().toBase64();
@@ -35,29 +35,29 @@ bool UTMSPAuthorization::requestOAuth2Client(const QString &clientID, const QStr
     _utmspRestInterface.setHost(UTMSPRestInterface::HostTarget::AuthClient);
     const QString target = "/oauth/token/";
     QString body = "grant_type=client_credentials&scope=blender.write blender.read&audience=testflight.flightblender.com&client_id=" + clientID + "&client_secret=" + clientSecret + "\r\n\r\n";
-    _utmspRestInterface.modifyRequest(target, QNetworkAccessManager::PostOperation, body);
-    auto [status, response] = _utmspRestInterface.executeRequest();
-    UTMSP_LOG_INFO() << "UTMSPAuthorization: Authorization Response: " << response;
+    _utmspRestInterface.sendRequest(target, QNetworkAccessManager::PostOperation, body, [this](int status, const std::string &response) {
+        UTMSP_LOG_INFO() << "UTMSPAuthorization: Authorization Response: " << response;
 
-    if(status == 200)
-    {
-        try {
-            json responseJson = json::parse(response);
-            clientToken = responseJson["access_token"];
-            _isValidToken = true;
+        if(status == 200)
+        {
+            try {
+                json responseJson = json::parse(response);
+                clientToken = responseJson["access_token"];
+                _isValidToken = true;
+            }
+            catch (const json::parse_error& e) {
+                UTMSP_LOG_ERROR() << "UTMSPAuthorization: Invalid Token: " << e.what();
+                _isValidToken = false;
+            }
         }
-        catch (const json::parse_error& e) {
-            UTMSP_LOG_ERROR() << "UTMSPAuthorization: Invalid Token: " << e.what();
+        else
+        {
+            UTMSP_LOG_ERROR() << "UTMSPAuthorization: Invalid Status Code ";
             _isValidToken = false;
         }
-    }
-    else
-    {
-        UTMSP_LOG_ERROR() << "UTMSPAuthorization: Invalid Status Code ";
-        _isValidToken = false;
-    }
 
-    return _isValidToken;
+        emit authorizationFinished(_isValidToken);
+    });
 }
 
 const std::string &UTMSPAuthorization::getOAuth2Token()
@@ -26,10 +26,14 @@ class UTMSPAuthorization: public QObject
 
     const std::string& getOAuth2Token();
 
+signals:
+    /// Emitted when the token request started by requestOAuth2Client finishes
+    void authorizationFinished(bool validToken);
+
 protected slots:
-    bool requestOAuth2Client(const QString& clientID, const QString& clientSecret);
+    void requestOAuth2Client(const QString& clientID, const QString& clientSecret);
 
 private:
-    bool                 _isValidToken;
+    bool                 _isValidToken = false;
     UTMSPRestInterface   _utmspRestInterface;
 };
@@ -15,37 +15,29 @@ UTMSPBlenderRestInterface::UTMSPBlenderRestInterface(QObject *parent):
     setHost(HostTarget::BlenderClient);
 }
 
-QPair<int, std::string> UTMSPBlenderRestInterface::setFlightPlan(const std::string& body)
+void UTMSPBlenderRestInterface::setFlightPlan(const std::string& body, const ResponseHandler& handler)
 {
     // Post Flight plan
     QString setFlightPlanTarget = "/flight_declaration_ops/set_flight_declaration";
-    modifyRequest(setFlightPlanTarget, QNetworkAccessManager::PostOperation, QString::fromStdString(body));
-
-    return executeRequest();
+    sendRequest(setFlightPlanTarget, QNetworkAccessManager::PostOperation, QString::fromStdString(body), handler);
 }
 
-QPair<int, std::string> UTMSPBlenderRestInterface::requestTelemetry(const std::string& body)
+void UTMSPBlenderRestInterface::requestTelemetry(const std::string& body, const ResponseHandler& handler)
 {
     // Post RID data
     QString target = "/flight_stream/set_telemetry";
-    modifyRequest(target, QNetworkAccessManager::PutOperation, QString::fromStdString(body));
-
-    return executeRequest();
+    sendRequest(target, QNetworkAccessManager::PutOperation, QString::fromStdString(body), handler);
 }
 
-QPair<int, std::string> UTMSPBlenderRestInterface::updateFlightState(const std::string& body, const std::string &flightID)
+void UTMSPBlenderRestInterface::updateFlightState(const std::string& body, const std::string &flightID, const ResponseHandler& handler)
 {
     // Post RID data
     QString target = "/flight_declaration_ops/flight_declaration_state/" + QString::fromStdString(flightID);
-    modifyRequest(target, QNetworkAccessManager::PutOperation, QString::fromStdString(body));
-
-    return executeRequest();
+    sendRequest(target, QNetworkAccessManager::PutOperation, QString::fromStdString(body), handler);
 }
 
-QPair<int, std::string> UTMSPBlenderRestInterface::ping()
+void UTMSPBlenderRestInterface::ping(const ResponseHandler& handler)
 {
     QString target = "/ping";
-    modifyRequest(target, QNetworkAccessManager::GetOperation);
-
-    return executeRequest();
+    sendRequest(target, QNetworkAccessManager::GetOperation, QString(), handler);
 }
@@ -11,7 +11,6 @@
 
 #include "UTMSPRestInterface.h"
 
-#include <QPair>
 #include <QString>
 
 class UTMSPBlenderRestInterface: public UTMSPRestInterface
@@ -19,9 +18,9 @@ class UTMSPBlenderRestInterface: public UTMSPRestInterface
 public:
     UTMSPBlenderRestInterface(QObject *parent = nullptr);
 
-    QPair<int, std::string> setFlightPlan(const std::string& body);
-    QPair<int, std::string> requestTelemetry(const std::string& body);
-    QPair<int, std::string> updateFlightState(const std::string& body, const std::string& flightID);
-    QPair<int, std::string> ping();
+    void setFlightPlan(const std::string& body, const ResponseHandler& handler);
+    void requestTelemetry(const std::string& body, const ResponseHandler& handler);
+    void updateFlightState(const std::string& body, const std::string& flightID, const ResponseHandler& handler);
+    void ping(const ResponseHandler& handler);
 
 };
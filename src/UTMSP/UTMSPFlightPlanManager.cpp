@@ -9,7 +9,6 @@
 
 #include "UTMSPFlightPlanManager.h"
 #include "UTMSPLogger.h"
-#include <iostream>
 
 UTMSPFlightPlanManager::UTMSPFlightPlanManager():
     _currentState(FlightState::Idle),
@@ -45,7 +44,8 @@ void UTMSPFlightPlanManager::registerFlightPlan(const std::string &token,
                                                 const int &minAltitude,
                                                 const int &maxAltitude,
                                                 const std::string &startDateTime,
-                                                const std::string &endDateTime)
+                                                const std::string &endDateTime,
+                                                const CompletionHandler &completion)
 {
     // Generate Flight declaretion JSON
 
@@ -103,31 +103,36 @@ void UTMSPFlightPlanManager::registerFlightPlan(const std::string &token,
     json data = _flightDataJson;
     setHost(HostTarget::BlenderClient);
     setBearerToken(token);
-    auto [statusCode, response] =  setFlightPlan(data.dump(4));
-    UTMSP_LOG_INFO() << "UTMSPFlightPlanManager: Register Response -->" << response;
-
-    if(statusCode == 200)
-    {
-        try {
-            json jsonData = json::parse(response);
-            std::string flightID = jsonData["id"];
-
-            _flightResponseID = flightID;
-            _responseJSON = response;
-            _responseStatus = true;
+    setFlightPlan(data.dump(), [this, completion](int statusCode, const std::string &response) {
+        UTMSP_LOG_INFO() << "UTMSPFlightPlanManager: Register Response -->" << response;
+
+        if(statusCode == 200)
+        {
+            try {
+                json jsonData = json::parse(response);
+                std::string flightID = jsonData["id"];
+
+                _flightResponseID = flightID;
+                _responseJSON = response;
+                _responseStatus = true;
+            }
+            catch (const json::exception& e) {
+                UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Error parsing the response: " << e.what();
+                _responseJSON = "Response is Invalid";
+                _responseStatus = false;
+            }
         }
-        catch (const json::parse_error& e) {
-            UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Error parsing the response: " << e.what();
+        else
+        {
+            UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Invalid Status Code";
             _responseJSON = "Response is Invalid";
             _responseStatus = false;
         }
-    }
-    else
-    {
-        UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Invalid Status Code";
-        _responseJSON = "Response is Invalid";
-        _responseStatus = false;
-    }
+
+        if (completion) {
+            completion(_responseStatus);
+        }
+    });
 }
 
 std::tuple<std::string, std::string, bool> UTMSPFlightPlanManager::registerFlightPlanNotification()
@@ -135,33 +140,31 @@ std::tuple<std::string, std::string, bool> UTMSPFlightPlanManager::registerFligh
     return std::make_tuple(_responseJSON, _flightResponseID, _responseStatus);
 }
 
-bool UTMSPFlightPlanManager::activateFlightPlan(const std::string &token)
+void UTMSPFlightPlanManager::activateFlightPlan(const std::string &token, const CompletionHandler &completion)
 {
     //TODO : Plan for conformance Monitering phase 2
     _updateState["state"] = 2;
     _updateState["submitted_by"] = this->_flightData.user;
     json data = _updateState;
-    std::cout << data.dump(4) << std::endl;
+    UTMSP_LOG_DEBUG() << data.dump(4);
     setHost(HostTarget::BlenderClient);
     setBearerToken(token);
-    auto [statusCode, response] =  updateFlightState(data.dump(4), _flightResponseID);
-
-    if(statusCode == 200)
-    {
-        try {
+    updateFlightState(data.dump(), _flightResponseID, [completion](int statusCode, const std::string &response) {
+        bool activated = false;
+        if(statusCode == 200)
+        {
             UTMSP_LOG_DEBUG() << "Update flight plan response" << response;
-            return true;
+            activated = true;
         }
-        catch (const json::parse_error& e) {
-            UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Error parsing the response: " << e.what();
-            return false;
+        else
+        {
+            UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Invalid Status Code";
+        }
+
+        if (completion) {
+            completion(activated);
         }
-    }
-    else
-    {
-        UTMSP_LOG_ERROR() << "UTMSPFlightPlanManager: Invalid Status Code";
-        return false;
-    }
+    });
 }
 
 void UTMSPFlightPlanManager::activateFlightPlanNotification()
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 // #include <nlohmann/json_fwd.hpp>
 
@@ -35,14 +36,18 @@ class UTMSPFlightPlanManager: public UTMSPBlenderRestInterface
     void getCapability();
     void preRegisterFlightPlan();
     void preRegisterFlightPlanNotification();
+    /// Called when a flight plan request finishes
+    using CompletionHandler = std::function<void(bool success)>;
+
     void registerFlightPlan(const std::string& token,
                             const json& boundaryPolygons,
                             const int& minAltitude,
                             const int& maxAltitude,
                             const std::string& startDateTime,
-                            const std::string& endDateTime);
+                            const std::string& endDateTime,
+                            const CompletionHandler& completion);
     std::tuple<std::string, std::string, bool> registerFlightPlanNotification();
-    bool activateFlightPlan(const std::string &token);
+    void activateFlightPlan(const std::string &token, const CompletionHandler& completion);
     void activateFlightPlanNotification();
     void  updateFlightPlanState(FlightState state);
     FlightState getFlightPlanState();
@@ -138,37 +138,48 @@ void UTMSPNetworkRemoteIDManager::startTelemetry(const double &latitude,
     json mix;
     mix["current_states"] = current_states;
     mix["flight_details"] = _flightDetailsJson;
-    json final_array = json::array();
-    final_array.push_back(mix);
-    json final_format;
-    final_format["observations"] = final_array;
-    json data = final_format;
-
-    auto [statusCode, response] = requestTelemetry(data.dump(4));
-    _statusCode = statusCode;
-    _response = response;
-    UTMSP_LOG_DEBUG()<< "Response " << _response;
-    UTMSP_LOG_DEBUG()<< "Status Code: " << _statusCode;
-
-    if(_statusCode == 201)
-    {
-        try {
+
+    // Observations made while a request is in flight go out together with the next one
+    _pendingObservations.push_back(mix);
+    if (_pendingObservations.size() > _maxBatchObservations) {
+        _pendingObservations.erase(_pendingObservations.begin());
+    }
+    _sendTelemetry();
+}
+
+void UTMSPNetworkRemoteIDManager::_sendTelemetry()
+{
+    if (_telemetryInFlight || _pendingObservations.empty()) {
+        return;
+    }
+
+    json data;
+    data["observations"] = std::move(_pendingObservations);
+    _pendingObservations = json::array();
+    const size_t observationCount = data["observations"].size();
+
+    _telemetryInFlight = true;
+    requestTelemetry(data.dump(), [this, observationCount](int statusCode, const std::string &response) {
+        _telemetryInFlight = false;
+        UTMSP_LOG_DEBUG()<< "Response " << response;
+        UTMSP_LOG_DEBUG()<< "Status Code: " << statusCode;
+
+        if(statusCode == 201)
+        {
             auto now = std::chrono::system_clock::now();
             std::time_t now_c = std::chrono::system_clock::to_time_t(now);
             char buffer[20];
             std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", std::localtime(&now_c));
-            UTMSP_LOG_DEBUG() <<"The Telemetry RID data submitted at " << buffer;
+            UTMSP_LOG_DEBUG() <<"The Telemetry RID data submitted at " << buffer << " observations: " << observationCount;
             UTMSP_LOG_DEBUG() << "--------------Telemetry Submitted Successfully---------------";
         }
-        catch (const json::parse_error& e) {
-            UTMSP_LOG_ERROR() << "UTMSPNetworkRemoteManager: Error parsing the Telemetry response: " << e.what();
+        else
+        {
+            UTMSP_LOG_ERROR() << "UTMSPNetworkRemoteManager: Invalid Status Code";
         }
-    }
-    else
-    {
-        UTMSP_LOG_ERROR() << "UTMSPNetworkRemoteManager: Invalid Status Code";
-    }
 
+        _sendTelemetry();
+    });
 }
 
 bool UTMSPNetworkRemoteIDManager::stopTelemetry()
@@ -110,13 +110,21 @@ class UTMSPNetworkRemoteIDManager:public UTMSPBlenderRestInterface
         std::string group_time_end;
     };
 
+    /// Observations waiting to be sent with the next telemetry request
+    size_t pendingObservations() const { return _pendingObservations.size(); }
+
 private:
+    void _sendTelemetry();
+
+    /// Oldest observations are dropped past this, a stale Remote ID position is of no use to the service
+    static constexpr size_t _maxBatchObservations = 10;
+
     FlightDetails                _flightDetails;
     json                         _flightDetailsJson;
     RidData                      _ridData;
     json                         _ridDataJson;
-    int                          _statusCode;
-    std::string                  _response;
+    json                         _pendingObservations = json::array();
+    bool                         _telemetryInFlight = false;
     std::shared_ptr<Dispatcher>  _dispatcher;
     double                       _initLatitude;
     double                       _initLongitude;
@@ -10,43 +10,91 @@
 #include "UTMSPRestInterface.h"
 #include "UTMSPLogger.h"
 
-#include <QList>
-#include <QNetworkInterface>
-#include "qeventloop.h"
+#include <QCoreApplication>
+#include <QMap>
+#include <QtNetwork/QSslConfiguration>
 
-UTMSPRestInterface::UTMSPRestInterface(QObject *parent):
-    QObject(parent)
+namespace {
+
+QMap<UTMSPRestInterface::HostTarget, QString> &hostUrls()
+{
+    static QMap<UTMSPRestInterface::HostTarget, QString> urls = {
+        { UTMSPRestInterface::HostTarget::AuthClient,       QStringLiteral("https://id.openskies.sh") },
+        { UTMSPRestInterface::HostTarget::BlenderClient,    QStringLiteral("https://testflight.flightblender.com") },
+    };
+    return urls;
+}
+
+} // namespace
+
+UTMSPRestInterface::UTMSPRestInterface(QObject *parent)
+    : QObject(parent)
 {
-    _networkManager = new QNetworkAccessManager(this);
 }
 
 UTMSPRestInterface::~UTMSPRestInterface()
 {
-    delete _networkManager;
-    _networkManager = nullptr;
+    // The replies belong to the shared manager, make sure they do not call back into this object
+    for (QNetworkReply *reply : std::as_const(_pendingReplies)) {
+        (void) disconnect(reply, nullptr, this, nullptr);
+        reply->abort();
+        reply->deleteLater();
+    }
+    _pendingReplies.clear();
 }
 
+QNetworkAccessManager *UTMSPRestInterface::_sharedNetworkManager()
+{
+    static QNetworkAccessManager *networkManager = nullptr;
+    if (!networkManager) {
+        networkManager = new QNetworkAccessManager(QCoreApplication::instance());
+    }
+    return networkManager;
+}
+
+/// Opens the connection ahead of the first request so it does not pay for the TCP and TLS handshakes. The
+/// connection is kept alive by the manager and picked up by the requests which follow.
+void UTMSPRestInterface::_connectToHost(const QUrl &url, const QSslConfiguration &sslConfig)
+{
+    // Pre-connecting to a host which already has an open connection in the shared manager reuses it, so no need to track hosts
+    if (url.scheme() == QStringLiteral("https")) {
+        _sharedNetworkManager()->connectToHostEncrypted(url.host(), url.port(443), sslConfig);
+    } else {
+        _sharedNetworkManager()->connectToHost(url.host(), url.port(80));
+    }
+}
+
+void UTMSPRestInterface::setHostUrl(HostTarget hostTarget, const QString &url)
+{
+    hostUrls()[hostTarget] = url;
+}
+
+QString UTMSPRestInterface::hostUrl(HostTarget hostTarget)
+{
+    return hostUrls().value(hostTarget);
+}
 
 void UTMSPRestInterface::setHost(const HostTarget &hostTarget)
 {
+    _currentURL = hostUrl(hostTarget);
     switch (hostTarget) {
     case HostTarget::AuthClient:
-        _currentURL = "https://id.openskies.sh";
         _currentRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/x-www-form-urlencoded");
         break;
     case HostTarget::BlenderClient:
-        _currentURL = "https://testflight.flightblender.com";
         _currentRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
         break;
     }
+    // Accept-Encoding is left to the network manager, setting it here disables transparent decompression
     _currentRequest.setRawHeader("User-Agent", QString("Qt/%1").arg(QT_VERSION_STR).toUtf8());
     _currentRequest.setRawHeader("Accept", "*/*");
-    _currentRequest.setRawHeader("Accept-Encoding", "gzip, deflate, br");
     _currentRequest.setRawHeader("Connection", "keep-alive");
 
     QSslConfiguration sslConfig = QSslConfiguration::defaultConfiguration();
     sslConfig.setProtocol(QSsl::TlsV1_3);
     _currentRequest.setSslConfiguration(sslConfig);
+
+    _connectToHost(QUrl(_currentURL), sslConfig);
 }
 
 void UTMSPRestInterface::setBasicToken(const QString &basicToken){
@@ -54,55 +102,54 @@ void UTMSPRestInterface::setBasicToken(const QString &basicToken){
     _currentRequest.setRawHeader("Authorization", ("Basic " + _basicToken).toUtf8());
 }
 
-void UTMSPRestInterface::modifyRequest(const QString &target, QNetworkAccessManager::Operation method, const QString &body)
-{
-    QUrl url(_currentURL+target);
-    _currentRequest.setUrl(url);
-    _currentMethod = method;
-    _currentBody = body;
-}
-
-QPair<int, std::string> UTMSPRestInterface::executeRequest()
+void UTMSPRestInterface::sendRequest(const QString &target, QNetworkAccessManager::Operation method, const QString &body, const ResponseHandler &handler)
 {
-    if (!_networkManager) {
-        qDebug() << "Network manager is not initialized!";
-        return qMakePair(0, "Network manager is not initialized");
-    }
+    QNetworkRequest request(_currentRequest);
+    request.setUrl(QUrl(_currentURL + target));
 
+    QNetworkAccessManager *networkManager = _sharedNetworkManager();
     QNetworkReply *reply = nullptr;
-    switch(_currentMethod) {
+    switch (method) {
     case QNetworkAccessManager::GetOperation:
-        reply = _networkManager->get(_currentRequest);
+        reply = networkManager->get(request);
         break;
     case QNetworkAccessManager::PostOperation:
-        reply = _networkManager->post(_currentRequest, _currentBody.toUtf8());
+        reply = networkManager->post(request, body.toUtf8());
         break;
     case QNetworkAccessManager::PutOperation:
-        reply = _networkManager->put(_currentRequest, _currentBody.toUtf8());
+        reply = networkManager->put(request, body.toUtf8());
         break;
     case QNetworkAccessManager::DeleteOperation:
-        reply = _networkManager->deleteResource(_currentRequest);
+        reply = networkManager->deleteResource(request);
         break;
     case QNetworkAccessManager::HeadOperation:
-        reply = _networkManager->head(_currentRequest);
+        reply = networkManager->head(request);
         break;
     default:
-        qDebug() << "Unsupported HTTP method: " << _currentMethod;
-        return qMakePair(0, "Unsupported HTTP method");
+        UTMSP_LOG_ERROR() << "UTMSPRestInterface: Unsupported HTTP method: " << static_cast<int>(method);
+        break;
     }
 
-    if (!reply) return qMakePair(0, "Failed to create network reply");
-
-    QEventLoop loop;
-    connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
-    loop.exec();
-
-    auto response = reply->readAll();
-    int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
-
-    reply->deleteLater();
+    if (!reply) {
+        if (handler) {
+            handler(0, "Failed to create network reply");
+        }
+        return;
+    }
 
-    return qMakePair(statusCode, (QString::fromUtf8(response)).toStdString());
+    _pendingReplies.insert(reply);
+    (void) connect(reply, &QNetworkReply::finished, this, [this, reply, handler]() {
+        _pendingReplies.remove(reply);
+        reply->deleteLater();
+
+        const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if ((statusCode == 0) && (reply->error() != QNetworkReply::NoError)) {
+            UTMSP_LOG_ERROR() << "UTMSPRestInterface: Request failed: " << reply->errorString().toStdString();
+        }
+        if (handler) {
+            handler(statusCode, reply->readAll().toStdString());
+        }
+    });
 }
 
 void UTMSPRestInterface::setBearerToken(const std::string& token)
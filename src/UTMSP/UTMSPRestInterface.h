@@ -13,10 +13,15 @@
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
 #include <QtNetwork/QNetworkRequest>
+#include <QSet>
 #include <QString>
 #include <QUrl>
-#include <QPair>
 
+#include <functional>
+#include <string>
+
+/// Asynchronous REST client for the UTM service provider. All instances share one network access manager so
+/// keep-alive connections to the auth and Blender hosts are reused across requests and clients.
 class UTMSPRestInterface : public QObject {
     Q_OBJECT
 
@@ -29,17 +34,31 @@ class UTMSPRestInterface : public QObject {
         BlenderClient
     };
 
+    /// Called from the event loop when a request finishes
+    ///     @param statusCode HTTP status code, 0 if the request failed before a response was received
+    using ResponseHandler = std::function<void(int statusCode, const std::string &response)>;
+
     void setBearerToken(const std::string &token);
-    QPair<int, std::string> executeRequest();
-    void modifyRequest(const QString &target, QNetworkAccessManager::Operation method, const QString &body = "");
     void setHost(const HostTarget &hostTarget);
     void setBasicToken(const QString &basicToken);
 
+    /// Sends a request to the current host without blocking. The handler is not called if this object is
+    /// destroyed before the request finishes.
+    void sendRequest(const QString &target, QNetworkAccessManager::Operation method, const QString &body, const ResponseHandler &handler);
+
+    /// Requests sent which have not finished yet
+    int pendingRequests() const { return _pendingReplies.count(); }
+
+    /// Overrides the base url of a host, used to point the clients at a local mock server
+    static void setHostUrl(HostTarget hostTarget, const QString &url);
+    static QString hostUrl(HostTarget hostTarget);
+
 private:
-    QNetworkAccessManager *             _networkManager = nullptr;
+    static QNetworkAccessManager *_sharedNetworkManager();
+    static void _connectToHost(const QUrl &url, const QSslConfiguration &sslConfig);
+
     QNetworkRequest                     _currentRequest;
-    QString                             _currentBody;
-    QNetworkAccessManager::Operation    _currentMethod;
     QString                             _currentURL;
     QString                             _basicToken;
+    QSet<QNetworkReply*>                _pendingReplies;
 };
@@ -30,7 +30,7 @@ UTMSPServiceController::~UTMSPServiceController()
 
 }
 
-std::string UTMSPServiceController::flightPlanAuthorization()
+void UTMSPServiceController::flightPlanAuthorization()
 {
     _currentState = UTMSPFlightPlanManager::FlightState::Idle;
 
@@ -48,30 +48,34 @@ std::string UTMSPServiceController::flightPlanAuthorization()
         json coordinateJson ={coordinates.latitude(),coordinates.longitude()};
         _coordinateList.push_back(coordinateJson);
     }
-    _utmspFlightPlanManager.registerFlightPlan(_blenderToken, _coordinateList,_minAltitude,_maxAltitude,_startDateTime, _endDateTime);
     //TODO-> Find a correct way to assign min and max altitude for UTM mission
-    auto [responseJson, flightID, flag] = _utmspFlightPlanManager.registerFlightPlanNotification();
-    QString _Json = QString::fromStdString(responseJson);
-    QString _flightID = QString::fromStdString(flightID);
-    _responseFlightID = _flightID;
-    emit responseFlightIDChanged();
-    _utmspFlightPlanManager.updateFlightPlanState(_currentState);
-
-    // State 2 --> Activate Flight Plan
-    _utmspFlightPlanManager.getFlightPlanState();
-    bool activated_flag = _utmspFlightPlanManager.activateFlightPlan(_blenderToken);
-    if(activated_flag == true){
-        _currentState = UTMSPFlightPlanManager::FlightState::Activated;
-        _activationFlag = true;
-        emit activationFlagChanged();
-        _utmspNetworkRemoteIDManager.getCapabilty(_blenderToken);
+    _utmspFlightPlanManager.registerFlightPlan(_blenderToken, _coordinateList,_minAltitude,_maxAltitude,_startDateTime, _endDateTime, [this](bool registered) {
+        auto [responseJson, flightID, flag] = _utmspFlightPlanManager.registerFlightPlanNotification();
+        _responseFlightID = QString::fromStdString(flightID);
+        emit responseFlightIDChanged();
         _utmspFlightPlanManager.updateFlightPlanState(_currentState);
-        _utmspFlightPlanManager.getFlightPlanState();
-    }
 
+        if (!registered) {
+            emit flightPlanAuthorizationComplete(false);
+            return;
+        }
 
-    return _responseFlightID.toStdString();
+        // State 2 --> Activate Flight Plan
+        _utmspFlightPlanManager.getFlightPlanState();
+        _utmspFlightPlanManager.activateFlightPlan(_blenderToken, [this](bool activated) {
+            if(activated == true){
+                _currentState = UTMSPFlightPlanManager::FlightState::Activated;
+                _activationFlag = true;
+                emit activationFlagChanged();
+                _utmspNetworkRemoteIDManager.getCapabilty(_blenderToken);
+                _utmspFlightPlanManager.updateFlightPlanState(_currentState);
+                _utmspFlightPlanManager.getFlightPlanState();
+            }
+            emit flightPlanAuthorizationComplete(activated);
+        });
+    });
 }
+
 bool UTMSPServiceController::networkRemoteID(const mavlink_message_t &message,
                                              const std::string &serialNumber,
                                              const std::string &operatorID,
@@ -29,7 +29,8 @@ class UTMSPServiceController : public QObject
     Q_PROPERTY(QString              responseFlightID        READ responseFlightID   NOTIFY responseFlightIDChanged)
     Q_PROPERTY(bool                 activationFlag          READ activationFlag     NOTIFY activationFlagChanged)
 
-    std::string flightPlanAuthorization();
+    /// Registers and then activates the flight plan. Finishes asynchronously with flightPlanAuthorizationComplete.
+    void flightPlanAuthorization();
     bool networkRemoteID(const mavlink_message_t& message,
                          const std::string& serialNumber,
                          const std::string& operatorID,
@@ -42,6 +43,7 @@ class UTMSPServiceController : public QObject
     void responseFlightIDChanged                 (void);
     void activationFlagChanged                   (void);
     void stopTelemetryFlagChanged                (bool value);
+    void flightPlanAuthorizationComplete         (bool activated);
 
 public slots:
     void updatePolygonBoundary (const QList<QGeoCoordinate> &boundary)                   {_boundaryPolygon.clear();_boundaryPolygon.append(boundary);};
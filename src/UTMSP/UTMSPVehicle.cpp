@@ -19,6 +19,9 @@ UTMSPVehicle::UTMSPVehicle(std::shared_ptr<Dispatcher> dispatcher, Vehicle *vehi
     UTMSP_LOG_INFO() << "UTMSPManagerLog: UTMSPVehicle Contructor";
     Q_CHECK_PTR(vehicle);
     connect(vehicle, &Vehicle::mavlinkMessageReceived, this, &UTMSPVehicle::triggerNetworkRemoteID);
+    connect(this, &UTMSPServiceController::responseFlightIDChanged, this, [this]() {
+        _flightID = responseFlightID().toStdString();
+    });
     UTMSP_LOG_INFO() << "UTMSPManagerLog: UTMSPVehicle MAvlink msg slot connected";
     _aircraftModel = _utmspAircraft.aircraftModel();
     _aircraftClass = _utmspAircraft.aircraftClass();
@@ -38,7 +41,7 @@ void UTMSPVehicle::loadTelemetryFlag(bool value){
 void UTMSPVehicle::triggerFlightAuthorization()
 {
     UTMSP_LOG_INFO() << "Registration process Initiated Successfully";
-    _flightID = flightPlanAuthorization();
+    flightPlanAuthorization();
 }
 
 void UTMSPVehicle::triggerNetworkRemoteID(const mavlink_message_t &message)
@@ -20,20 +20,17 @@ QGC_LOGGING_CATEGORY(QGCLZMALog, "Utilities.Compression.QGCLZMA")
 
 namespace QGCLZMA {
 
-bool inflateLZMAFile(const QString &lzmaFilename, const QString &decompressedFilename)
-{
-    QFile inputFile(lzmaFilename);
-    if (!inputFile.open(QIODevice::ReadOnly)) {
-        qCWarning(QGCLZMALog) << "open input file failed" << lzmaFilename << inputFile.errorString();
-        return false;
-    }
+namespace {
 
-    QFile outputFile(decompressedFilename);
-    if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        qCWarning(QGCLZMALog) << "open input file failed" << outputFile.fileName() << outputFile.errorString();
-        return false;
-    }
+constexpr size_t kInputBufferSize = 16 * 1024;
+constexpr size_t kOutputBufferSize = 64 * 1024;
+
+/// Supplies the next block of compressed input
+///     @return false on read error, an empty block signals end of input
+using InputSource = std::function<bool(const uint8_t *&data, size_t &size)>;
 
+bool _inflate(const InputSource &source, const DataSink &sink)
+{
     static std::once_flag crc_init_flag;
     std::call_once(crc_init_flag, []() {
         xz_crc32_init();
@@ -46,33 +43,40 @@ bool inflateLZMAFile(const QString &lzmaFilename, const QString &decompressedFil
         return false;
     }
 
-    constexpr int buf_size = 4 * 1024;
-    uint8_t in[buf_size];
-    uint8_t out[buf_size];
+    QByteArray out(kOutputBufferSize, Qt::Uninitialized);
 
     xz_buf b;
-    b.in = in;
+    b.in = nullptr;
     b.in_pos = 0;
     b.in_size = 0;
-    b.out = out;
+    b.out = reinterpret_cast<uint8_t*>(out.data());
     b.out_pos = 0;
-    b.out_size = buf_size;
+    b.out_size = kOutputBufferSize;
+
+    bool inputDone = false;
+    bool success = false;
 
     while (true) {
-        if (b.in_pos == b.in_size) {
-            b.in_size = static_cast<size_t>(inputFile.read((char*)in, sizeof(in)));
+        if ((b.in_pos == b.in_size) && !inputDone) {
+            const uint8_t *data = nullptr;
+            size_t size = 0;
+            if (!source(data, size)) {
+                break;
+            }
+            b.in = data;
             b.in_pos = 0;
+            b.in_size = size;
+            // xz_dec_run reports XZ_BUF_ERROR if the input ends early, no need to track truncation ourselves
+            inputDone = (size == 0);
         }
 
-        xz_ret ret = xz_dec_run(s, &b);
+        const xz_ret ret = xz_dec_run(s, &b);
 
-        if (b.out_pos == sizeof(out)) {
-            const size_t cBytesWritten = static_cast<size_t>(outputFile.write((char*)out, static_cast<int>(b.out_pos)));
-            if (cBytesWritten != b.out_pos) {
-                qCWarning(QGCLZMALog) << "output file write failed:" << outputFile.fileName() << outputFile.errorString();
-                goto error;
+        if ((b.out_pos == b.out_size) || ((ret != XZ_OK) && (ret != XZ_UNSUPPORTED_CHECK) && (b.out_pos > 0))) {
+            if (!sink(out.constData(), static_cast<qsizetype>(b.out_pos))) {
+                qCDebug(QGCLZMALog) << "Decompression aborted by sink";
+                break;
             }
-
             b.out_pos = 0;
         }
 
@@ -85,45 +89,103 @@ bool inflateLZMAFile(const QString &lzmaFilename, const QString &decompressedFil
             continue;
         }
 
-        const size_t cBytesWritten = static_cast<size_t>(outputFile.write((char*)out, static_cast<int>(b.out_pos)));
-        if (cBytesWritten != b.out_pos) {
-            qCWarning(QGCLZMALog) << "output file write failed:" << outputFile.fileName() << outputFile.errorString();
-            goto error;
-        }
-
         switch (ret) {
         case XZ_STREAM_END:
-            xz_dec_end(s);
-            return true;
+            success = true;
+            break;
         case XZ_MEM_ERROR:
             qCWarning(QGCLZMALog) << "Memory allocation failed";
-            goto error;
+            break;
         case XZ_MEMLIMIT_ERROR:
             qCWarning(QGCLZMALog) << "Memory usage limit reached";
-            goto error;
+            break;
         case XZ_FORMAT_ERROR:
             qCWarning(QGCLZMALog) << "Not a .xz file";
-            goto error;
+            break;
         case XZ_OPTIONS_ERROR:
             qCWarning(QGCLZMALog) << "Unsupported options in the .xz headers";
-            goto error;
+            break;
         case XZ_DATA_ERROR:
         case XZ_BUF_ERROR:
             qCWarning(QGCLZMALog) << "File is corrupt";
-            goto error;
+            break;
         default:
             qCWarning(QGCLZMALog) << "Bug!";
-            goto error;
+            break;
         }
+        break;
     }
 
     xz_dec_end(s);
-    return true;
+    return success;
+}
 
-error:
-    xz_dec_end(s);
-    return false;
+} // namespace
 
+bool inflateLZMAFile(const QString &lzmaFilename, const QString &decompressedFilename)
+{
+    QFile inputFile(lzmaFilename);
+    if (!inputFile.open(QIODevice::ReadOnly)) {
+        qCWarning(QGCLZMALog) << "open input file failed" << lzmaFilename << inputFile.errorString();
+        return false;
+    }
+
+    QFile outputFile(decompressedFilename);
+    if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(QGCLZMALog) << "open input file failed" << outputFile.fileName() << outputFile.errorString();
+        return false;
+    }
+
+    return inflateLZMA(&inputFile, [&outputFile](const char *data, qsizetype size) {
+        if (outputFile.write(data, size) != size) {
+            qCWarning(QGCLZMALog) << "output file write failed:" << outputFile.fileName() << outputFile.errorString();
+            return false;
+        }
+        return true;
+    });
+}
+
+bool inflateLZMA(QIODevice *input, const DataSink &sink)
+{
+    QByteArray in(kInputBufferSize, Qt::Uninitialized);
+
+    return _inflate([input, &in](const uint8_t *&data, size_t &size) {
+        const qint64 cBytesRead = input->read(in.data(), in.size());
+        if (cBytesRead < 0) {
+            qCWarning(QGCLZMALog) << "input read failed:" << input->errorString();
+            return false;
+        }
+        data = reinterpret_cast<const uint8_t*>(in.constData());
+        size = static_cast<size_t>(cBytesRead);
+        return true;
+    }, sink);
+}
+
+QByteArray inflateLZMA(QByteArrayView input, bool *ok)
+{
+    QByteArray output;
+    // Compressed json is typically around a tenth of its inflated size
+    output.reserve(input.size() * 8);
+
+    // The whole input is handed to the decoder at once, no copy required
+    bool inputSupplied = false;
+    const bool success = _inflate([input, &inputSupplied](const uint8_t *&data, size_t &size) {
+        data = reinterpret_cast<const uint8_t*>(input.data());
+        size = inputSupplied ? 0 : static_cast<size_t>(input.size());
+        inputSupplied = true;
+        return true;
+    }, [&output](const char *data, qsizetype size) {
+        output.append(data, size);
+        return true;
+    });
+
+    if (ok) {
+        *ok = success;
+    }
+    if (!success) {
+        output.clear();
+    }
+    return output;
 }
 
 } // namespace QGCLZMA
@@ -9,14 +9,36 @@
 
 #pragma once
 
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
 #include <QtCore/QString>
 #include <QtCore/QLoggingCategory>
 
+#include <functional>
+
 Q_DECLARE_LOGGING_CATEGORY(QGCLZMALog)
 
+class QIODevice;
+
 namespace QGCLZMA {
+    /// Receives decompressed data as it is produced
+    ///     @return false to abort decompression
+    using DataSink = std::function<bool(const char *data, qsizetype size)>;
+
     /// Decompresses the specified file to the specified directory
     ///     @param lzmaFilename         Fully qualified path to lzma file
     ///     @param decompressedFilename Fully qualified path to for file to decompress to
     bool inflateLZMAFile(const QString &lzmaFilename, const QString &decompressedFilename);
+
+    /// Decompresses an xz stream read from the device, handing output to the sink as it is produced
+    ///     @param input    Device open for reading, positioned at the start of the xz stream
+    ///     @param sink     Receives the decompressed data in chunks
+    /// @return true: stream decompressed completely, false: error or sink aborted
+    bool inflateLZMA(QIODevice *input, const DataSink &sink);
+
+    /// Decompresses an in-memory xz stream without going through the file system
+    ///     @param input    Compressed data
+    ///     @param ok       Set to true on success (optional)
+    /// @return Decompressed data, empty on error
+    QByteArray inflateLZMA(QByteArrayView input, bool *ok = nullptr);
 } // namespace QGCLZMA
@@ -12,6 +12,8 @@
 
 #include <QtCore/QFile>
 
+#include <limits>
+
 #include <zlib.h>
 
 QGC_LOGGING_CATEGORY(QGCZlibLog, "Utilities.Compression.QGCZlib")
@@ -19,21 +21,17 @@ QGC_LOGGING_CATEGORY(QGCZlibLog, "Utilities.Compression.QGCZlib")
 namespace QGCZlib
 {
 
-bool inflateGzipFile(const QString &gzippedFileName, const QString &decompressedFilename)
-{
-    QFile inputFile(gzippedFileName);
-    if (!inputFile.open(QIODevice::ReadOnly)) {
-        qCWarning(QGCZlibLog) << "open input file failed" << gzippedFileName << inputFile.errorString();
-        return false;
-    }
+namespace {
 
-    QFile outputFile(decompressedFilename);
-    if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        qCWarning(QGCZlibLog) << "open output file failed" << outputFile.fileName() << outputFile.errorString();
-        inputFile.close();
-        return false;
-    }
+constexpr qsizetype kInputBufferSize = 16 * 1024;
+constexpr qsizetype kOutputBufferSize = 64 * 1024;
+
+/// Supplies the next block of compressed input
+///     @return false on read error, an empty block signals end of input
+using InputSource = std::function<bool(const char *&data, qsizetype &size)>;
 
+bool _inflate(const InputSource &source, const DataSink &sink)
+{
     z_stream strm;
     strm.zalloc = nullptr;
     strm.zfree = nullptr;
@@ -44,49 +42,45 @@ bool inflateGzipFile(const QString &gzippedFileName, const QString &decompressed
     int ret = inflateInit2(&strm, 16 + MAX_WBITS);
     if (ret != Z_OK) {
         qCWarning(QGCZlibLog) << "inflateInit2 failed:" << ret;
-        inputFile.close();
-        outputFile.close();
         return false;
     }
 
-    constexpr int cBuffer = 1024 * 5;
-    unsigned char inputBuffer[cBuffer];
-    unsigned char outputBuffer[cBuffer];
+    QByteArray outputBuffer(kOutputBufferSize, Qt::Uninitialized);
     do {
-        strm.avail_in = static_cast<unsigned>(inputFile.read(reinterpret_cast<char*>(inputBuffer), cBuffer));
-        if (strm.avail_in == 0) {
+        const char *data = nullptr;
+        qsizetype size = 0;
+        if (!source(data, size)) {
+            inflateEnd(&strm);
+            return false;
+        }
+        if (size == 0) {
             break;
         }
-        strm.next_in = inputBuffer;
+        strm.avail_in = static_cast<unsigned>(size);
+        strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
 
         do {
-            strm.avail_out = cBuffer;
-            strm.next_out = outputBuffer;
+            strm.avail_out = static_cast<unsigned>(kOutputBufferSize);
+            strm.next_out = reinterpret_cast<Bytef*>(outputBuffer.data());
 
             ret = inflate(&strm, Z_NO_FLUSH);
-            if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
+            if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR || ret == Z_NEED_DICT) {
                 qCWarning(QGCZlibLog) << "inflate failed:" << ret;
                 inflateEnd(&strm);
-                inputFile.close();
-                outputFile.close();
                 return false;
             }
 
-            const unsigned cBytesInflated = cBuffer - strm.avail_out;
-            if (outputFile.write(reinterpret_cast<char*>(outputBuffer), cBytesInflated) != cBytesInflated) {
-                qCWarning(QGCZlibLog) << "output file write failed:" << outputFile.fileName() << outputFile.errorString();
+            const qsizetype cBytesInflated = kOutputBufferSize - strm.avail_out;
+            if ((cBytesInflated > 0) && !sink(outputBuffer.constData(), cBytesInflated)) {
+                qCDebug(QGCZlibLog) << "Decompression aborted by sink";
                 inflateEnd(&strm);
-                inputFile.close();
-                outputFile.close();
                 return false;
             }
-        } while (strm.avail_out == 0);
+        } while ((strm.avail_out == 0) && (ret != Z_STREAM_END));
 
     } while (ret != Z_STREAM_END);
 
     inflateEnd(&strm);
-    inputFile.close();
-    outputFile.close();
 
     if (ret != Z_STREAM_END) {
         qCWarning(QGCZlibLog) << "inflate did not reach stream end:" << ret;
@@ -96,4 +90,71 @@ bool inflateGzipFile(const QString &gzippedFileName, const QString &decompressed
     return true;
 }
 
+} // namespace
+
+bool inflateGzipFile(const QString &gzippedFileName, const QString &decompressedFilename)
+{
+    QFile inputFile(gzippedFileName);
+    if (!inputFile.open(QIODevice::ReadOnly)) {
+        qCWarning(QGCZlibLog) << "open input file failed" << gzippedFileName << inputFile.errorString();
+        return false;
+    }
+
+    QFile outputFile(decompressedFilename);
+    if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(QGCZlibLog) << "open output file failed" << outputFile.fileName() << outputFile.errorString();
+        return false;
+    }
+
+    return inflateGzip(&inputFile, [&outputFile](const char *data, qsizetype size) {
+        if (outputFile.write(data, size) != size) {
+            qCWarning(QGCZlibLog) << "output file write failed:" << outputFile.fileName() << outputFile.errorString();
+            return false;
+        }
+        return true;
+    });
+}
+
+bool inflateGzip(QIODevice *input, const DataSink &sink)
+{
+    QByteArray inputBuffer(kInputBufferSize, Qt::Uninitialized);
+
+    return _inflate([input, &inputBuffer](const char *&data, qsizetype &size) {
+        const qint64 cBytesRead = input->read(inputBuffer.data(), inputBuffer.size());
+        if (cBytesRead < 0) {
+            qCWarning(QGCZlibLog) << "input read failed:" << input->errorString();
+            return false;
+        }
+        data = inputBuffer.constData();
+        size = static_cast<qsizetype>(cBytesRead);
+        return true;
+    }, sink);
+}
+
+QByteArray inflateGzip(QByteArrayView input, bool *ok)
+{
+    QByteArray output;
+    output.reserve(input.size() * 4);
+
+    // Handed to zlib in pieces since avail_in is limited to unsigned
+    qsizetype inputPos = 0;
+    const bool success = _inflate([input, &inputPos](const char *&data, qsizetype &size) {
+        data = input.data() + inputPos;
+        size = qMin(input.size() - inputPos, static_cast<qsizetype>(std::numeric_limits<unsigned>::max()));
+        inputPos += size;
+        return true;
+    }, [&output](const char *data, qsizetype size) {
+        output.append(data, size);
+        return true;
+    });
+
+    if (ok) {
+        *ok = success;
+    }
+    if (!success) {
+        output.clear();
+    }
+    return output;
+}
+
 } // namespace QGCZlib
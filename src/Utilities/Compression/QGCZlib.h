@@ -9,16 +9,38 @@
 
 #pragma once
 
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
 #include <QtCore/QString>
 #include <QtCore/QLoggingCategory>
 
+#include <functional>
+
 Q_DECLARE_LOGGING_CATEGORY(QGCZlibLog)
 
+class QIODevice;
+
 namespace QGCZlib
 {
+    /// Receives decompressed data as it is produced
+    ///     @return false to abort decompression
+    using DataSink = std::function<bool(const char *data, qsizetype size)>;
+
     /// Decompresses the specified file to the specified directory
     ///     @param gzippedFileName      Fully qualified path to gzip file
     ///     @param decompressedFilename Fully qualified path to for file to decompress to
     /// @return bool Success
     bool inflateGzipFile(const QString &gzippedFileName, const QString &decompressedFilename);
+
+    /// Decompresses a gzip stream read from the device, handing output to the sink as it is produced
+    ///     @param input    Device open for reading, positioned at the start of the gzip stream
+    ///     @param sink     Receives the decompressed data in chunks
+    /// @return true: stream decompressed completely, false: error or sink aborted
+    bool inflateGzip(QIODevice *input, const DataSink &sink);
+
+    /// Decompresses an in-memory gzip stream without going through the file system
+    ///     @param input    Compressed data
+    ///     @param ok       Set to true on success (optional)
+    /// @return Decompressed data, empty on error
+    QByteArray inflateGzip(QByteArrayView input, bool *ok = nullptr);
 }
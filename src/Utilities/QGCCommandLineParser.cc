@@ -19,6 +19,7 @@ static const QString kOptClearSettings   = QStringLiteral("clear-settings");
 static const QString kOptClearCache      = QStringLiteral("clear-cache");
 static const QString kOptLogging         = QStringLiteral("logging");
 static const QString kOptLogOutput       = QStringLiteral("log-output");
+static const QString kOptTrace           = QStringLiteral("trace");
 static const QString kOptSimpleBoot      = QStringLiteral("simple-boot-test");
 static const QString kOptFakeMobile      = QStringLiteral("fake-mobile");
 static const QString kOptAllowMultiple   = QStringLiteral("allow-multiple");
@@ -95,6 +96,12 @@ CommandLineParseResult parseCommandLine()
         QCoreApplication::translate("main", "Log to console."));
     (void) parser.addOption(logOutputOpt);
 
+    const QCommandLineOption traceOpt(
+        kOptTrace,
+        QCoreApplication::translate("main", "Record high rate trace events to a binary file."),
+        QCoreApplication::translate("main", "file"));
+    (void) parser.addOption(traceOpt);
+
     const QCommandLineOption simpleBootOpt(
         kOptSimpleBoot,
         QCoreApplication::translate("main", "Initialize subsystems and exit."));
@@ -213,6 +220,9 @@ CommandLineParseResult parseCommandLine()
         out.loggingOptions = parser.value(loggingOpt);
     }
     out.logOutput = parser.isSet(logOutputOpt);
+    if (parser.isSet(traceOpt)) {
+        out.traceFile = parser.value(traceOpt);
+    }
     out.simpleBootTest = parser.isSet(simpleBootOpt);
 
 #if defined(QGC_UNITTEST_BUILD)
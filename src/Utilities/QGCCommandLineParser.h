@@ -39,6 +39,7 @@ struct CommandLineParseResult
     bool clearCache = false;
     std::optional<QString> loggingOptions;
     bool logOutput = false;
+    std::optional<QString> traceFile;
     bool simpleBootTest = false;
 
     bool runningUnitTests = false;
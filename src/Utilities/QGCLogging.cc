@@ -14,8 +14,11 @@
 #include "SettingsManager.h"
 
 #include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QGlobalStatic>
-#include <QtCore/QStringListModel>
+#include <QtCore/QSaveFile>
 #include <QtCore/QTextStream>
 
 QGC_LOGGING_CATEGORY(QGCLoggingLog, "Utilities.QGCLogging")
@@ -24,6 +27,125 @@ Q_GLOBAL_STATIC(QGCLogging, _qgcLogging)
 
 static QtMessageHandler defaultHandler = nullptr;
 
+/// Owns the console log file. Lives on QGCLogging's writer thread so file I/O and rotation never block the GUI thread.
+class QGCLogFileWriter : public QObject
+{
+public:
+    explicit QGCLogFileWriter(QGCLogging *logging)
+        : _logging(logging)
+    {}
+
+    ~QGCLogFileWriter()
+    {
+        _flush();
+    }
+
+    void open(const QString &filePath)
+    {
+        if (!_flushTimer) {
+            _flushTimer = new QTimer(this);
+            _flushTimer->setInterval(kFlushIntervalMSecs);
+            (void) connect(_flushTimer, &QTimer::timeout, this, [this]() { _flush(); });
+            _flushTimer->start();
+        }
+
+        _logFile.setFileName(filePath);
+        if (!_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+            _reportError(QGCLogging::tr("Open console log output file failed %1 : %2").arg(_logFile.fileName(), _logFile.errorString()));
+        }
+    }
+
+    void write(const QStringList &lines)
+    {
+        if (!_ioError) {
+            _pendingLines.append(lines);
+        }
+    }
+
+private:
+    void _flush()
+    {
+        if (_pendingLines.isEmpty() || _ioError || !_logFile.isOpen()) {
+            return;
+        }
+
+        // Check size before writing
+        if (_logFile.size() >= QGCLogging::kMaxLogFileSize) {
+            _rotateLogs();
+            if (_ioError) {
+                return;
+            }
+        }
+
+        // Write all pending lines
+        QTextStream out(&_logFile);
+        for (const QString &line : std::as_const(_pendingLines)) {
+            out << line << '\n';
+            if (out.status() != QTextStream::Ok) {
+                _ioError = true;
+                qCWarning(QGCLoggingLog) << "Error writing to log file:" << _logFile.errorString();
+                break;
+            }
+        }
+        (void) _logFile.flush();
+        _pendingLines.clear();
+    }
+
+    void _rotateLogs()
+    {
+        // Close the current log
+        _logFile.close();
+
+        // Full path without extension
+        const QString basePath = _logFile.fileName();    // e.g. "/path/QGCConsole.log"
+        const QFileInfo fileInfo(basePath);
+        const QString dir = fileInfo.absolutePath();
+        const QString name = fileInfo.baseName();        // "QGCConsole"
+        const QString ext = fileInfo.completeSuffix();   // "log"
+
+        // Rotate existing backups: QGCConsole.4.log → QGCConsole.5.log, …
+        for (int i = kMaxBackupFiles - 1; i >= 1; --i) {
+            const QString from = QStringLiteral("%1/%2.%3.%4").arg(dir, name).arg(i).arg(ext);
+            const QString to = QStringLiteral("%1/%2.%3.%4").arg(dir, name).arg(i+1).arg(ext);
+            if (QFile::exists(to)) {
+                (void) QFile::remove(to);
+            }
+            if (QFile::exists(from)) {
+                (void) QFile::rename(from, to);
+            }
+        }
+
+        // Move the just‐closed log to “.1”
+        const QString firstBackup = QStringLiteral("%1/%2.1.%3").arg(dir, name, ext);
+        if (QFile::exists(firstBackup)) {
+            (void) QFile::remove(firstBackup);
+        }
+        (void) QFile::rename(basePath, firstBackup);
+
+        // Re‑open a fresh log file
+        _logFile.setFileName(basePath);
+        if (!_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+            _reportError(QGCLogging::tr("Unable to reopen log file %1: %2").arg(_logFile.fileName(), _logFile.errorString()));
+        }
+    }
+
+    void _reportError(const QString &errorMessage)
+    {
+        _ioError = true;
+        _pendingLines.clear();
+        (void) QMetaObject::invokeMethod(_logging, "_writerError", Qt::QueuedConnection, Q_ARG(QString, errorMessage));
+    }
+
+    QGCLogging *_logging = nullptr;
+    QFile _logFile;
+    QTimer *_flushTimer = nullptr;
+    QStringList _pendingLines;
+    bool _ioError = false;
+
+    static constexpr int kMaxBackupFiles = 5;
+    static constexpr int kFlushIntervalMSecs = 1000;
+};
+
 static void msgHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
     // Format the message using Qt's pattern
@@ -46,14 +168,19 @@ QGCLogging *QGCLogging::instance()
 }
 
 QGCLogging::QGCLogging(QObject *parent)
-    : QStringListModel(parent)
+    : QAbstractListModel(parent)
+    , _writer(new QGCLogFileWriter(this))
 {
     qCDebug(QGCLoggingLog) << this;
 
-    _flushTimer.setInterval(kFlushIntervalMSecs);
-    _flushTimer.setSingleShot(false);
-    (void) connect(&_flushTimer, &QTimer::timeout, this, &QGCLogging::_flushToDisk);
-    _flushTimer.start();
+    _rowFlushTimer.setInterval(kRowFlushIntervalMSecs);
+    _rowFlushTimer.setSingleShot(true);
+    (void) connect(&_rowFlushTimer, &QTimer::timeout, this, &QGCLogging::_flushPendingRows);
+
+    _writerThread.setObjectName(QStringLiteral("QGCLogWriter"));
+    _writer->moveToThread(&_writerThread);
+    (void) connect(&_writerThread, &QThread::finished, _writer, &QObject::deleteLater);
+    _writerThread.start(QThread::LowPriority);
 
     // Connect the emitLog signal to threadsafeLog slot
 #if defined(Q_OS_ANDROID) || defined(Q_OS_IOS)
@@ -67,6 +194,10 @@ QGCLogging::QGCLogging(QObject *parent)
 QGCLogging::~QGCLogging()
 {
     qCDebug(QGCLoggingLog) << this;
+
+    // The writer flushes whatever it still holds as it is deleted on its own thread
+    _writerThread.quit();
+    (void) _writerThread.wait();
 }
 
 void QGCLogging::installHandler()
@@ -88,73 +219,58 @@ void QGCLogging::log(const QString &message)
 
 void QGCLogging::_threadsafeLog(const QString &message)
 {
-    // Notify view of new row
-    const int line = rowCount();
-    (void) QStringListModel::insertRows(line, 1);
-    (void) setData(index(line, 0), message, Qt::DisplayRole);
-
-    // Trim old entries to cap memory usage
-    static constexpr const int kMaxLogRows = kMaxLogFileSize / 100;
-    if (rowCount() > kMaxLogRows) {
-        const int removeCount = rowCount() - kMaxLogRows;
-        beginRemoveRows(QModelIndex(), 0, removeCount - 1);
-        (void) removeRows(0, removeCount);
-        endRemoveRows();
+    // Views are notified in batches, bursts of debug output would otherwise relayout the log view per line
+    _pendingRows.append(message);
+    if (!_rowFlushTimer.isActive()) {
+        _rowFlushTimer.start();
     }
-
-    // Queue for disk flush
-    _pendingDiskWrites.append(message);
 }
 
-void QGCLogging::_rotateLogs()
+void QGCLogging::_flushPendingRows()
 {
-    // Close the current log
-    _logFile.close();
-
-    // Full path without extension
-    const QString basePath = _logFile.fileName();    // e.g. "/path/QGCConsole.log"
-    const QFileInfo fileInfo(basePath);
-    const QString dir = fileInfo.absolutePath();
-    const QString name = fileInfo.baseName();        // "QGCConsole"
-    const QString ext = fileInfo.completeSuffix();   // "log"
-
-    // Rotate existing backups: QGCConsole.4.log → QGCConsole.5.log, …
-    for (int i = kMaxBackupFiles - 1; i >= 1; --i) {
-        const QString from = QStringLiteral("%1/%2.%3.%4").arg(dir, name).arg(i).arg(ext);
-        const QString to = QStringLiteral("%1/%2.%3.%4").arg(dir, name).arg(i+1).arg(ext);
-        if (QFile::exists(to)) {
-            (void) QFile::remove(to);
-        }
-        if (QFile::exists(from)) {
-            (void) QFile::rename(from, to);
-        }
+    if (_pendingRows.isEmpty()) {
+        return;
     }
 
-    // Move the just‐closed log to “.1”
-    const QString firstBackup = QStringLiteral("%1/%2.1.%3").arg(dir, name, ext);
-    if (QFile::exists(firstBackup)) {
-        (void) QFile::remove(firstBackup);
+    QStringList lines = std::exchange(_pendingRows, QStringList());
+    _queueDiskWrites(lines);
+
+    // A burst larger than the whole buffer only keeps its tail
+    if (lines.count() > kMaxLogRows) {
+        lines = lines.mid(lines.count() - kMaxLogRows);
     }
-    (void) QFile::rename(basePath, firstBackup);
 
-    // Re‑open a fresh log file
-    _logFile.setFileName(basePath);
-    if (!_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
-        _ioError = true;
-        qgcApp()->showAppMessage(tr("Unable to reopen log file %1: %2").arg(_logFile.fileName(), _logFile.errorString()));
+    // Drop the oldest rows to make room, this only moves the start of the ring
+    const int removeCount = _rowCount + static_cast<int>(lines.count()) - kMaxLogRows;
+    if (removeCount > 0) {
+        beginRemoveRows(QModelIndex(), 0, removeCount - 1);
+        _firstRow = (_firstRow + removeCount) % kMaxLogRows;
+        _rowCount -= removeCount;
+        endRemoveRows();
     }
+
+    beginInsertRows(QModelIndex(), _rowCount, _rowCount + static_cast<int>(lines.count()) - 1);
+    for (QString &line : lines) {
+        const int storageIndex = (_firstRow + _rowCount) % kMaxLogRows;
+        if (storageIndex == _rows.count()) {
+            _rows.append(std::move(line));
+        } else {
+            _rows[storageIndex] = std::move(line);
+        }
+        _rowCount++;
+    }
+    endInsertRows();
 }
 
-void QGCLogging::_flushToDisk()
+void QGCLogging::_queueDiskWrites(const QStringList &lines)
 {
-    if (_pendingDiskWrites.isEmpty() || _ioError) {
+    if (_ioError) {
         return;
     }
 
     // Ensure log output enabled and file open
-    if (!_logFile.isOpen()) {
-        if (!qgcApp()->logOutput()) {
-            _pendingDiskWrites.clear();
+    if (!_diskOutputStarted) {
+        if (!qgcApp() || !qgcApp()->logOutput()) {
             return;
         }
 
@@ -162,37 +278,54 @@ void QGCLogging::_flushToDisk()
         const QDir saveDir(saveDirPath);
         const QString saveFilePath = saveDir.absoluteFilePath("QGCConsole.log");
 
-        _logFile.setFileName(saveFilePath);
-        if (!_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
-            _ioError = true;
-            qgcApp()->showAppMessage(tr("Open console log output file failed %1 : %2").arg(_logFile.fileName(), _logFile.errorString()));
-            return;
-        }
+        QGCLogFileWriter *const writer = _writer;
+        (void) QMetaObject::invokeMethod(writer, [writer, saveFilePath]() { writer->open(saveFilePath); }, Qt::QueuedConnection);
+        _diskOutputStarted = true;
     }
 
-    // Check size before writing
-    if (_logFile.size() >= kMaxLogFileSize) {
-        _rotateLogs();
+    QGCLogFileWriter *const writer = _writer;
+    (void) QMetaObject::invokeMethod(writer, [writer, lines]() { writer->write(lines); }, Qt::QueuedConnection);
+}
+
+void QGCLogging::_writerError(const QString &errorMessage)
+{
+    _ioError = true;
+    qgcApp()->showAppMessage(errorMessage);
+}
+
+int QGCLogging::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
     }
 
-    // Write all pending lines
-    QTextStream out(&_logFile);
-    for (const QString &line : std::as_const(_pendingDiskWrites)) {
-        out << line << '\n';
-        if (out.status() != QTextStream::Ok) {
-            _ioError = true;
-            qCWarning(QGCLoggingLog) << "Error writing to log file:" << _logFile.errorString();
-            break;
-        }
+    return _rowCount;
+}
+
+QVariant QGCLogging::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || (index.row() >= _rowCount) || ((role != Qt::DisplayRole) && (role != Qt::EditRole))) {
+        return QVariant();
     }
-    (void) _logFile.flush();
-    _pendingDiskWrites.clear();
+
+    return _rows.at((_firstRow + index.row()) % kMaxLogRows);
+}
+
+QStringList QGCLogging::messages() const
+{
+    QStringList result;
+    result.reserve(_rowCount);
+    for (int row = 0; row < _rowCount; row++) {
+        result.append(_rows.at((_firstRow + row) % kMaxLogRows));
+    }
+
+    return result;
 }
 
 void QGCLogging::writeMessages(const QString &destFile)
 {
     // Snapshot current logs on GUI thread
-    const QStringList logs = stringList();
+    const QStringList logs = messages();
 
     // Run the file write in a separate thread
     (void) QtConcurrent::run([this, destFile, logs]() {
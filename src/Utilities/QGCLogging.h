@@ -9,14 +9,21 @@
 
 #pragma once
 
-#include <QtCore/QFile>
+#include <atomic>
+
+#include <QtCore/QAbstractListModel>
 #include <QtCore/QLoggingCategory>
-#include <QtCore/QStringListModel>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
 #include <QtCore/QTimer>
 
 Q_DECLARE_LOGGING_CATEGORY(QGCLoggingLog)
 
-class QGCLogging : public QStringListModel
+class QGCLogFileWriter;
+
+/// Application log model. Lines are kept in a fixed capacity ring buffer so appending never shifts the stored rows,
+/// and new rows are announced to views in batches. Console log file output is written from a background thread.
+class QGCLogging : public QAbstractListModel
 {
     Q_OBJECT
 
@@ -36,6 +43,15 @@ class QGCLogging : public QStringListModel
     /// Enqueue a log message (thread-safe)
     void log(const QString &message);
 
+    /// @return All log lines currently held by the model, oldest first
+    QStringList messages() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    static constexpr int kMaxLogFileSize = 10LL * 1024 * 1024;
+    static constexpr int kMaxLogRows = kMaxLogFileSize / 100;
+
 signals:
     /// Emitted when a log message is enqueued
     void emitLog(const QString &message);
@@ -47,21 +63,29 @@ class QGCLogging : public QStringListModel
     void writeFinished(bool success);
 
 private slots:
-    /// Internal slot to append message on the GUI/main thread
+    /// Internal slot to queue a message on the GUI/main thread
     void _threadsafeLog(const QString &message);
 
-    /// Periodic flush of pending log lines to disk
-    void _flushToDisk();
+    /// Appends all queued messages to the model, at most once per frame
+    void _flushPendingRows();
+
+    /// Reported by the background file writer
+    void _writerError(const QString &errorMessage);
 
 private:
-    void _rotateLogs();
+    void _queueDiskWrites(const QStringList &lines);
 
-    QFile _logFile;
-    QTimer _flushTimer;
-    QStringList _pendingDiskWrites;
-    bool _ioError = false;
+    QList<QString> _rows;           ///< Ring buffer storage, grows up to kMaxLogRows
+    int _firstRow = 0;              ///< Storage index of model row 0
+    int _rowCount = 0;
 
-    static constexpr int kMaxLogFileSize = 10LL * 1024 * 1024;
-    static constexpr int kMaxBackupFiles = 5;
-    static constexpr int kFlushIntervalMSecs = 1000;
+    QStringList _pendingRows;
+    QTimer _rowFlushTimer;
+
+    bool _diskOutputStarted = false;
+    QThread _writerThread;
+    QGCLogFileWriter *_writer = nullptr;
+    std::atomic<bool> _ioError = false;
+
+    static constexpr int kRowFlushIntervalMSecs = 16;
 };
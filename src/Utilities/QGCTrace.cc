@@ -0,0 +1,342 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "QGCTrace.h"
+#include "QGCLoggingCategory.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+
+QGC_LOGGING_CATEGORY(QGCTraceLog, "Utilities.QGCTrace")
+
+namespace {
+
+constexpr char kFileMagic[] = "QGCTRACE";
+constexpr quint32 kBufferCapacity = 16384;      ///< Records per thread, must be a power of two
+constexpr int kDrainIntervalMSecs = 50;
+
+static_assert((kBufferCapacity & (kBufferCapacity - 1)) == 0, "Buffer capacity must be a power of two");
+
+/// Single producer (the owning thread) / single consumer (the writer thread) ring
+struct ThreadBuffer
+{
+    QGCTrace::Record_t records[kBufferCapacity];
+    std::atomic<quint32> head = 0;
+    std::atomic<quint32> tail = 0;
+    std::atomic<quint32> dropped = 0;
+    quint16 threadIndex = 0;
+    bool inUse = true;                                  ///< Guarded by TraceState::mutex
+};
+
+struct TraceState
+{
+    QMutex mutex;                                       ///< Guards buffers, only taken when a thread records its first event or exits
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers; ///< At most QGCTrace::kMaxThreads, buffers of exited threads are reused
+    std::atomic<quint32> unregisteredDropped = 0;       ///< Events lost because every buffer was in use
+    QElapsedTimer clock;
+    QFile file;
+    QThread *writerThread = nullptr;
+    std::atomic_bool stopRequested = false;
+};
+
+TraceState &traceState()
+{
+    static TraceState state;
+    return state;
+}
+
+/// @return nullptr: all kMaxThreads buffers are in use
+ThreadBuffer *registerThread()
+{
+    TraceState &state = traceState();
+    const QMutexLocker locker(&state.mutex);
+
+    // Whatever the previous owner left in a reused buffer is still drained in order ahead of the new records
+    for (const std::unique_ptr<ThreadBuffer> &buffer : state.buffers) {
+        if (!buffer->inUse) {
+            buffer->inUse = true;
+            return buffer.get();
+        }
+    }
+
+    if (state.buffers.size() >= static_cast<size_t>(QGCTrace::kMaxThreads)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<ThreadBuffer> buffer = std::make_unique<ThreadBuffer>();
+    buffer->threadIndex = static_cast<quint16>(state.buffers.size());
+    state.buffers.push_back(std::move(buffer));
+
+    return state.buffers.back().get();
+}
+
+/// Hands the thread's buffer back for reuse when the thread exits
+struct ThreadBufferOwner
+{
+    ~ThreadBufferOwner()
+    {
+        if (buffer) {
+            TraceState &state = traceState();
+            const QMutexLocker locker(&state.mutex);
+            buffer->inUse = false;
+        }
+    }
+
+    ThreadBuffer *buffer = nullptr;
+};
+
+thread_local ThreadBufferOwner t_bufferOwner;
+
+void writeDropped(quint16 threadIndex, quint32 dropped)
+{
+    TraceState &state = traceState();
+
+    const QGCTrace::Record_t record{
+        static_cast<quint64>(state.clock.nsecsElapsed()),
+        static_cast<quint16>(QGCTrace::Event::TraceDropped),
+        threadIndex,
+        threadIndex,
+        dropped
+    };
+    (void) state.file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void drainBuffers()
+{
+    TraceState &state = traceState();
+
+    std::vector<ThreadBuffer*> buffers;
+    {
+        const QMutexLocker locker(&state.mutex);
+        buffers.reserve(state.buffers.size());
+        for (const std::unique_ptr<ThreadBuffer> &buffer : state.buffers) {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    const quint32 unregisteredDropped = state.unregisteredDropped.exchange(0, std::memory_order_relaxed);
+    if (unregisteredDropped > 0) {
+        writeDropped(QGCTrace::kNoThreadIndex, unregisteredDropped);
+    }
+
+    for (ThreadBuffer *const buffer : buffers) {
+        const quint32 dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            writeDropped(buffer->threadIndex, dropped);
+        }
+
+        quint32 tail = buffer->tail.load(std::memory_order_relaxed);
+        const quint32 head = buffer->head.load(std::memory_order_acquire);
+        while (tail != head) {
+            // Write contiguous runs straight out of the ring
+            const quint32 index = tail & (kBufferCapacity - 1);
+            const quint32 count = qMin(head - tail, kBufferCapacity - index);
+            (void) state.file.write(reinterpret_cast<const char*>(&buffer->records[index]), count * sizeof(QGCTrace::Record_t));
+            tail += count;
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+}
+
+bool writeHeader(QFile &file)
+{
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    (void) stream.writeRawData(kFileMagic, sizeof(kFileMagic) - 1);
+    stream << QGCTrace::kFileVersion;
+    stream << static_cast<quint32>(sizeof(QGCTrace::Record_t));
+    stream << static_cast<qint64>(QDateTime::currentMSecsSinceEpoch());
+
+    stream << static_cast<quint32>(QGCTrace::Event::EventCount);
+    for (quint16 id = 0; id < static_cast<quint16>(QGCTrace::Event::EventCount); id++) {
+        const QByteArray name(QGCTrace::eventName(static_cast<QGCTrace::Event>(id)));
+        stream << id << static_cast<quint16>(name.size());
+        (void) stream.writeRawData(name.constData(), name.size());
+    }
+
+    return (stream.status() == QDataStream::Ok);
+}
+
+} // namespace
+
+bool QGCTrace::start(const QString &filePath)
+{
+    if (isRunning()) {
+        qCWarning(QGCTraceLog) << "Trace already running";
+        return false;
+    }
+
+    TraceState &state = traceState();
+
+    state.file.setFileName(filePath);
+    if (!state.file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(QGCTraceLog) << "Unable to open trace file" << filePath << state.file.errorString();
+        return false;
+    }
+
+    if (!writeHeader(state.file)) {
+        qCWarning(QGCTraceLog) << "Unable to write trace header" << state.file.errorString();
+        state.file.close();
+        return false;
+    }
+
+    {
+        // Discard anything recorded by threads which raced the previous stop
+        const QMutexLocker locker(&state.mutex);
+        for (const std::unique_ptr<ThreadBuffer> &buffer : state.buffers) {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+        state.unregisteredDropped.store(0, std::memory_order_relaxed);
+    }
+
+    state.clock.start();
+    state.stopRequested = false;
+    state.writerThread = QThread::create([]() {
+        TraceState &state = traceState();
+        while (!state.stopRequested.load()) {
+            drainBuffers();
+            QThread::msleep(kDrainIntervalMSecs);
+        }
+        drainBuffers();
+    });
+    state.writerThread->setObjectName(QStringLiteral("QGCTraceWriter"));
+    state.writerThread->start(QThread::LowPriority);
+
+    _running.store(true);
+    qCDebug(QGCTraceLog) << "Tracing to" << filePath;
+
+    return true;
+}
+
+void QGCTrace::stop()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+    _running.store(false);
+
+    TraceState &state = traceState();
+    state.stopRequested.store(true);
+    (void) state.writerThread->wait();
+    delete state.writerThread;
+    state.writerThread = nullptr;
+
+    qCDebug(QGCTraceLog) << "Trace stopped" << state.file.fileName() << state.file.size() << "bytes";
+    state.file.close();
+}
+
+void QGCTrace::record(Event event, quint32 arg0, quint64 arg1)
+{
+    ThreadBuffer *buffer = t_bufferOwner.buffer;
+    if (!buffer) {
+        buffer = registerThread();
+        if (!buffer) {
+            (void) traceState().unregisteredDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        t_bufferOwner.buffer = buffer;
+    }
+
+    const quint32 head = buffer->head.load(std::memory_order_relaxed);
+    const quint32 tail = buffer->tail.load(std::memory_order_acquire);
+    if ((head - tail) >= kBufferCapacity) {
+        // Never block the caller, the writer reports the loss
+        (void) buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Record_t &record = buffer->records[head & (kBufferCapacity - 1)];
+    record.timestampNsecs = static_cast<quint64>(traceState().clock.nsecsElapsed());
+    record.eventId = static_cast<quint16>(event);
+    record.threadIndex = buffer->threadIndex;
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+const char *QGCTrace::eventName(Event event)
+{
+    switch (event) {
+    case Event::TraceDropped:
+        return "TraceDropped";
+    case Event::MAVLinkBytesReceived:
+        return "MAVLinkBytesReceived";
+    case Event::MAVLinkMessageReceived:
+        return "MAVLinkMessageReceived";
+    case Event::LinkBytesSent:
+        return "LinkBytesSent";
+    case Event::FTPRequestSent:
+        return "FTPRequestSent";
+    case Event::FTPResponseReceived:
+        return "FTPResponseReceived";
+    case Event::EventCount:
+        break;
+    }
+
+    return "Unknown";
+}
+
+bool QGCTrace::decodeFile(const QString &filePath, QList<Record_t> &records, qint64 &startMsecsSinceEpoch)
+{
+    records.clear();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(QGCTraceLog) << "Unable to open trace file" << filePath << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    char magic[sizeof(kFileMagic) - 1];
+    if ((stream.readRawData(magic, sizeof(magic)) != sizeof(magic)) || (memcmp(magic, kFileMagic, sizeof(magic)) != 0)) {
+        qCWarning(QGCTraceLog) << "Not a trace file" << filePath;
+        return false;
+    }
+
+    quint32 version = 0;
+    quint32 recordSize = 0;
+    quint32 eventCount = 0;
+    stream >> version >> recordSize >> startMsecsSinceEpoch >> eventCount;
+    if ((version != kFileVersion) || (recordSize != sizeof(Record_t))) {
+        qCWarning(QGCTraceLog) << "Unsupported trace file version:recordSize" << version << recordSize;
+        return false;
+    }
+
+    for (quint32 i = 0; i < eventCount; i++) {
+        quint16 id = 0;
+        quint16 nameLength = 0;
+        stream >> id >> nameLength;
+        if (stream.skipRawData(nameLength) != nameLength) {
+            return false;
+        }
+    }
+    if (stream.status() != QDataStream::Ok) {
+        return false;
+    }
+
+    const qint64 recordBytes = file.size() - file.pos();
+    records.resize(recordBytes / sizeof(Record_t));
+    const qint64 bytesRead = file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(Record_t));
+
+    return (bytesRead == static_cast<qint64>(records.size() * sizeof(Record_t)));
+}
@@ -0,0 +1,91 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+
+Q_DECLARE_LOGGING_CATEGORY(QGCTraceLog)
+
+/// Records a trace event if tracing is running. When tracing is off this costs a single relaxed atomic load.
+///     @param event QGCTrace::Event enumerator name
+///     @param arg0 Event specific 32 bit argument
+///     @param arg1 Event specific 64 bit argument
+#define QGC_TRACE(event, arg0, arg1) \
+    do { \
+        if (QGCTrace::isRunning()) { \
+            QGCTrace::record(QGCTrace::Event::event, static_cast<quint32>(arg0), static_cast<quint64>(arg1)); \
+        } \
+    } while (false)
+
+/// Low overhead binary tracing for high rate events which are too frequent for logging categories.
+///
+/// Each thread records fixed size events into its own lock-free buffer, a background thread drains the buffers
+/// into a compact binary file. Use tools/qgctrace_decode.py or QGCTrace::decodeFile to turn a trace into text.
+///
+/// File layout (little endian):
+///     "QGCTRACE" magic, quint32 version, quint32 record size, qint64 start time (msecs since epoch),
+///     quint32 event count, per event: quint16 id, quint16 name length, name (utf8),
+///     followed by Record_t entries until the end of the file.
+class QGCTrace
+{
+public:
+    /// Event ids are stored in trace files, only ever append new events
+    enum class Event : quint16 {
+        TraceDropped = 0,           ///< arg0: thread index (kNoThreadIndex for threads beyond kMaxThreads), arg1: number of events lost
+        MAVLinkBytesReceived,       ///< arg0: mavlink channel, arg1: byte count
+        MAVLinkMessageReceived,     ///< arg0: mavlink channel, arg1: msgid | seq << 24 | compid << 32 | sysid << 40
+        LinkBytesSent,              ///< arg0: mavlink channel, arg1: byte count
+        FTPRequestSent,             ///< arg0: opcode, arg1: seqNumber | size << 16 | offset << 32
+        FTPResponseReceived,        ///< arg0: opcode | req_opcode << 8, arg1: seqNumber | size << 16 | offset << 32
+        EventCount
+    };
+
+    struct Record_t {
+        quint64 timestampNsecs;     ///< Since the trace was started
+        quint16 eventId;
+        quint16 threadIndex;
+        quint32 arg0;
+        quint64 arg1;
+    };
+    static_assert(sizeof(Record_t) == 24, "Trace record layout is part of the file format");
+
+    /// Starts writing trace events to the specified file
+    /// @return false: file could not be created
+    static bool start(const QString &filePath);
+
+    /// Stops tracing and writes out all buffered events
+    static void stop();
+
+    static bool isRunning() { return _running.load(std::memory_order_relaxed); }
+
+    /// Use the QGC_TRACE macro instead of calling this directly
+    static void record(Event event, quint32 arg0, quint64 arg1);
+
+    static const char *eventName(Event event);
+
+    /// Reads back a trace file
+    ///     @param[out] startMsecsSinceEpoch Wall clock time the trace was started
+    /// @return false: not a valid trace file
+    static bool decodeFile(const QString &filePath, QList<Record_t> &records, qint64 &startMsecsSinceEpoch);
+
+    static constexpr quint32 kFileVersion = 1;
+
+    /// Maximum number of threads recording at the same time. A thread's buffer is reused once it exits, so thread
+    /// indices in a trace identify a buffer rather than a specific thread.
+    static constexpr int kMaxThreads = 64;
+    static constexpr quint16 kNoThreadIndex = 0xFFFF;
+
+private:
+    static inline std::atomic_bool _running = false;
+};
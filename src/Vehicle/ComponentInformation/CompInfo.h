@@ -11,6 +11,7 @@
 
 #include "MAVLinkLib.h"
 
+#include <QtCore/QJsonDocument>
 #include <QtCore/QObject>
 
 class FactMetaData;
@@ -39,6 +40,12 @@ class CompInfo : public QObject
 
     virtual void setJson(const QString& metaDataJsonFileName) = 0;
 
+    /// Same as setJson, but with the json already parsed off the main thread. Only called if usesJsonDocument() is true.
+    virtual void setJsonDocument(const QString& metaDataJsonFileName, const QJsonDocument& jsonDoc) { Q_UNUSED(jsonDoc); setJson(metaDataJsonFileName); }
+
+    /// @return true: setJsonDocument makes use of a pre-parsed document, false: the json file is read by other means
+    virtual bool usesJsonDocument() const { return false; }
+
     bool available() const { return !_uris.uriMetaData.isEmpty(); }
 
     const COMP_METADATA_TYPE  type;
@@ -45,6 +45,17 @@ void CompInfoGeneral::setJson(const QString& metadataJsonFileName)
         qCWarning(CompInfoGeneralLog) << "Metadata json file open failed: compid:" << compId << errorString;
         return;
     }
+
+    setJsonDocument(metadataJsonFileName, jsonDoc);
+}
+
+void CompInfoGeneral::setJsonDocument(const QString& metadataJsonFileName, const QJsonDocument& jsonDoc)
+{
+    if (metadataJsonFileName.isEmpty()) {
+        return;
+    }
+
+    QString     errorString;
     QJsonObject jsonObj = jsonDoc.object();
 
     QList<JsonHelper::KeyValidateInfo> keyInfoList = {
@@ -34,6 +34,8 @@ class CompInfoGeneral : public CompInfo
 
     // Overrides from CompInfo
     void setJson(const QString& metadataJsonFileName) override;
+    void setJsonDocument(const QString& metadataJsonFileName, const QJsonDocument& jsonDoc) override;
+    bool usesJsonDocument() const override { return true; }
 
 private:
     QMap<COMP_METADATA_TYPE, Uris>   _supportedTypes;
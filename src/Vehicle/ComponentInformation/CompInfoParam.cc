@@ -49,6 +49,21 @@ void CompInfoParam::setJson(const QString& metadataJsonFileName)
         qCWarning(CompInfoParamLog) << "Metadata json file open failed: compid:" << compId << errorString;
         return;
     }
+
+    setJsonDocument(metadataJsonFileName, jsonDoc);
+}
+
+void CompInfoParam::setJsonDocument(const QString& metadataJsonFileName, const QJsonDocument& jsonDoc)
+{
+    qCDebug(CompInfoParamLog) << "setJsonDocument: metadataJsonFileName" << metadataJsonFileName;
+
+    if (metadataJsonFileName.isEmpty()) {
+        return;
+    }
+
+    _noJsonMetadata = false;
+
+    QString     errorString;
     QJsonObject jsonObj = jsonDoc.object();
 
     QList<JsonHelper::KeyValidateInfo> keyInfoList = {
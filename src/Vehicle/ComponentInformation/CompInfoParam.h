@@ -32,6 +32,8 @@ class CompInfoParam : public CompInfo
 
     // Overrides from CompInfo
     void setJson(const QString& metadataJsonFileName) override;
+    void setJsonDocument(const QString& metadataJsonFileName, const QJsonDocument& jsonDoc) override;
+    bool usesJsonDocument() const override { return true; }
 
     static void _cachePX4MetaDataFile(const QString& metaDataFile);
 
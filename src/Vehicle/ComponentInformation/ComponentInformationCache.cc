@@ -113,6 +113,28 @@ QString ComponentInformationCache::insert(const QString &fileTag, const QString
     return data.fileName();
 }
 
+bool ComponentInformationCache::remove(const QString &fileTag)
+{
+    QFile meta(metaFileName(fileTag));
+    QFile data(dataFileName(fileTag));
+    if (!meta.exists() && !data.exists()) {
+        return false;
+    }
+
+    qCDebug(ComponentInformationCacheLog) << "Removing cache entry" << fileTag;
+    meta.remove();
+    data.remove();
+
+    for (auto iter = _cachedFiles.begin(); iter != _cachedFiles.end(); ++iter) {
+        if (iter.value() == fileTag) {
+            _cachedFiles.erase(iter);
+            --_numFiles;
+            break;
+        }
+    }
+    return true;
+}
+
 void ComponentInformationCache::initializeDirectory()
 {
     if (!_path.exists()) {
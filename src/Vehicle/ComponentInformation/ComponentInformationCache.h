@@ -46,6 +46,13 @@ class ComponentInformationCache : public QObject
      */
     QString insert(const QString &fileTag, const QString& fileName);
 
+    /**
+     * Remove a file from the cache, e.g. after the user found its contents to be invalid
+     * @param fileTag
+     * @return true if an entry was removed
+     */
+    bool remove(const QString &fileTag);
+
 private:
 
     static constexpr const char* _metaExtension = ".meta";
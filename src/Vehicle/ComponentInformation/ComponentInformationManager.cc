@@ -20,25 +20,38 @@
 #include "QGCApplication.h"
 #include "QGCCachedFileDownload.h"
 #include "QGCLoggingCategory.h"
+#include "JsonHelper.h"
 
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QStandardPaths>
 
 QGC_LOGGING_CATEGORY(ComponentInformationManagerLog, "Vehicle.ComponentInformationManager")
 
+static QString _downloadCacheDir()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/QGCCompInfoFileDownloadCache");
+}
+
 ComponentInformationManager::ComponentInformationManager(Vehicle *vehicle, QObject *parent)
     : StateMachine(parent)
     , _vehicle(vehicle)
-    , _requestTypeStateMachine(this, this)
-    , _cachedFileDownload(new QGCCachedFileDownload(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/QGCCompInfoFileDownloadCache"), this))
     , _fileCache(ComponentInformationCache::defaultInstance())
-    , _translation(new ComponentInformationTranslation(this, _cachedFileDownload))
 {
     // qCDebug(ComponentInformationManagerLog) << Q_FUNC_INFO << this;
 
+    _removeLegacyDownloadCache();
+
     _compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_GENERAL]    = new CompInfoGeneral   (MAV_COMP_ID_AUTOPILOT1, vehicle, this);
     _compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_PARAMETER]  = new CompInfoParam     (MAV_COMP_ID_AUTOPILOT1, vehicle, this);
     _compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_EVENTS]     = new CompInfoEvents    (MAV_COMP_ID_AUTOPILOT1, vehicle, this);
     _compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_ACTUATORS]  = new CompInfoActuators (MAV_COMP_ID_AUTOPILOT1, vehicle, this);
+
+    for (auto it = _compInfoMap[MAV_COMP_ID_AUTOPILOT1].cbegin(); it != _compInfoMap[MAV_COMP_ID_AUTOPILOT1].cend(); ++it) {
+        _requestTypeStateMachines[it.key()] = new RequestMetaDataTypeStateMachine(this, it.key(), this);
+    }
 }
 
 ComponentInformationManager::~ComponentInformationManager()
@@ -61,7 +74,11 @@ float ComponentInformationManager::progress() const
     if (!_active)
         return 1.f;
     // here we could compute a more fine-grained progress, based on ftp download progress
-    return _stateIndex / (float)_cStates;
+    float stateProgress = _stateIndex;
+    if ((rgStates()[_stateIndex] == _stateRequestCompInfoTypes) && (_cTypeRequests > 0)) {
+        stateProgress += (_cTypeRequests - _cPendingTypeRequests) / (float)_cTypeRequests;
+    }
+    return stateProgress / (float)_cStates;
 }
 
 void ComponentInformationManager::advance()
@@ -74,6 +91,7 @@ void ComponentInformationManager::requestAllComponentInformation(RequestAllCompl
 {
     _requestAllCompleteFn       = requestAllCompletFn;
     _requestAllCompleteFnData   = requestAllCompleteFnData;
+    _requestAllTimer.start();
     start();
     emit progressUpdate(progress());
 }
@@ -81,7 +99,7 @@ void ComponentInformationManager::requestAllComponentInformation(RequestAllCompl
 void ComponentInformationManager::_stateRequestCompInfoGeneral(StateMachine* stateMachine)
 {
     ComponentInformationManager* compMgr = static_cast<ComponentInformationManager*>(stateMachine);
-    compMgr->_requestTypeStateMachine.request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_GENERAL]);
+    compMgr->_requestTypeStateMachines[COMP_METADATA_TYPE_GENERAL]->request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_GENERAL]);
 }
 
 void ComponentInformationManager::_stateRequestCompInfoGeneralComplete(StateMachine* stateMachine)
@@ -99,53 +117,117 @@ void ComponentInformationManager::_updateAllUri()
     }
 }
 
-void ComponentInformationManager::_stateRequestCompInfoComplete(void)
+void ComponentInformationManager::_stateRequestCompInfoComplete(COMP_METADATA_TYPE type)
 {
-    advance();
+    if (type == COMP_METADATA_TYPE_GENERAL) {
+        // The other types can't be requested until the general metadata provides their uris
+        advance();
+        return;
+    }
+
+    if (--_cPendingTypeRequests == 0) {
+        advance();
+    } else {
+        emit progressUpdate(progress());
+    }
 }
 
-void ComponentInformationManager::_stateRequestCompInfoParam(StateMachine* stateMachine)
+void ComponentInformationManager::_stateRequestCompInfoTypes(StateMachine* stateMachine)
 {
     ComponentInformationManager* compMgr = static_cast<ComponentInformationManager*>(stateMachine);
 
-    if (compMgr->_isCompTypeSupported(COMP_METADATA_TYPE_PARAMETER)) {
-        compMgr->_requestTypeStateMachine.request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_PARAMETER]);
-    } else {
-        qCDebug(ComponentInformationManagerLog) << "_stateRequestCompInfoParam skipping, not supported";
+    QList<COMP_METADATA_TYPE> rgTypes;
+    for (COMP_METADATA_TYPE type: _rgConcurrentTypes) {
+        if (compMgr->_isCompTypeSupported(type)) {
+            rgTypes.append(type);
+        } else {
+            qCDebug(ComponentInformationManagerLog) << "_stateRequestCompInfoTypes skipping, not supported" << type;
+        }
+    }
+
+    // Counts must be set up front since requests may complete synchronously
+    compMgr->_cTypeRequests         = rgTypes.count();
+    compMgr->_cPendingTypeRequests  = rgTypes.count();
+    if (rgTypes.isEmpty()) {
         compMgr->advance();
+        return;
+    }
+
+    for (COMP_METADATA_TYPE type: rgTypes) {
+        compMgr->_requestTypeStateMachines[type]->request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][type]);
     }
 }
 
-void ComponentInformationManager::_stateRequestCompInfoEvents(StateMachine* stateMachine)
+void ComponentInformationManager::_stateRequestAllCompInfoComplete(StateMachine* stateMachine)
 {
     ComponentInformationManager* compMgr = static_cast<ComponentInformationManager*>(stateMachine);
 
-    if (compMgr->_isCompTypeSupported(COMP_METADATA_TYPE_EVENTS)) {
-        compMgr->_requestTypeStateMachine.request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_EVENTS]);
-    } else {
-        qCDebug(ComponentInformationManagerLog) << "_stateRequestCompInfoEvents skipping, not supported";
-        compMgr->advance();
+    qCDebug(ComponentInformationManagerLog) << "Component information complete: total msecs" << compMgr->_requestAllTimer.elapsed();
+    for (RequestMetaDataTypeStateMachine* requestMachine: compMgr->_requestTypeStateMachines) {
+        if (requestMachine->compInfo()) {
+            qCDebug(ComponentInformationManagerLog) << "    " << requestMachine->typeToString() << requestMachine->timingString();
+        }
     }
+
+    (*compMgr->_requestAllCompleteFn)(compMgr->_requestAllCompleteFnData);
+    compMgr->_requestAllCompleteFn      = nullptr;
+    compMgr->_requestAllCompleteFnData  = nullptr;
 }
 
-void ComponentInformationManager::_stateRequestCompInfoActuators(StateMachine* stateMachine)
+void ComponentInformationManager::_queueFtpDownload(RequestMetaDataTypeStateMachine* requestMachine, const QString& uri)
 {
-    ComponentInformationManager* compMgr = static_cast<ComponentInformationManager*>(stateMachine);
+    _ftpDownloadQueue.enqueue(qMakePair(requestMachine, uri));
+    _startNextFtpDownload();
+}
+
+void ComponentInformationManager::_startNextFtpDownload()
+{
+    if (_activeFtpRequest || _ftpDownloadQueue.isEmpty()) {
+        return;
+    }
+
+    FTPManager* ftpManager = _vehicle->ftpManager();
 
-    if (compMgr->_isCompTypeSupported(COMP_METADATA_TYPE_ACTUATORS)) {
-        compMgr->_requestTypeStateMachine.request(compMgr->_compInfoMap[MAV_COMP_ID_AUTOPILOT1][COMP_METADATA_TYPE_ACTUATORS]);
+    const QPair<RequestMetaDataTypeStateMachine*, QString> ftpRequest = _ftpDownloadQueue.dequeue();
+    _activeFtpRequest = ftpRequest.first;
+    _activeFtpRequest->_queuedMsecs += _activeFtpRequest->_phaseTimer.restart();
+
+    (void) connect(ftpManager, &FTPManager::downloadComplete, this, &ComponentInformationManager::_ftpDownloadComplete);
+    if (ftpManager->download(MAV_COMP_ID_AUTOPILOT1, ftpRequest.second, QStandardPaths::writableLocation(QStandardPaths::TempLocation))) {
+        _activeFtpRequest->_downloadStartTime.start();
+        (void) connect(ftpManager, &FTPManager::commandProgress, this, &ComponentInformationManager::_ftpDownloadProgress);
     } else {
-        qCDebug(ComponentInformationManagerLog) << "_stateRequestCompInfoActuators skipping, not supported";
-        compMgr->advance();
+        qCWarning(ComponentInformationManagerLog) << "_startNextFtpDownload FTPManager::download returned failure";
+        disconnect(ftpManager, &FTPManager::downloadComplete, this, &ComponentInformationManager::_ftpDownloadComplete);
+        RequestMetaDataTypeStateMachine* requestMachine = _activeFtpRequest;
+        _activeFtpRequest = nullptr;
+        requestMachine->advance();
+        _startNextFtpDownload();
     }
 }
 
-void ComponentInformationManager::_stateRequestAllCompInfoComplete(StateMachine* stateMachine)
+void ComponentInformationManager::_ftpDownloadComplete(const QString& file, const QString& errorMsg)
 {
-    ComponentInformationManager* compMgr = static_cast<ComponentInformationManager*>(stateMachine);
-    (*compMgr->_requestAllCompleteFn)(compMgr->_requestAllCompleteFnData);
-    compMgr->_requestAllCompleteFn      = nullptr;
-    compMgr->_requestAllCompleteFnData  = nullptr;
+    FTPManager* ftpManager = _vehicle->ftpManager();
+    disconnect(ftpManager, &FTPManager::downloadComplete, this, &ComponentInformationManager::_ftpDownloadComplete);
+    disconnect(ftpManager, &FTPManager::commandProgress, this, &ComponentInformationManager::_ftpDownloadProgress);
+
+    RequestMetaDataTypeStateMachine* requestMachine = _activeFtpRequest;
+    _activeFtpRequest = nullptr;
+
+    // Start the next transfer first so it overlaps with the processing of this one
+    _startNextFtpDownload();
+
+    if (requestMachine) {
+        requestMachine->_ftpDownloadComplete(file, errorMsg);
+    }
+}
+
+void ComponentInformationManager::_ftpDownloadProgress(float progress)
+{
+    if (_activeFtpRequest) {
+        _activeFtpRequest->_ftpDownloadProgress(progress);
+    }
 }
 
 bool ComponentInformationManager::_isCompTypeSupported(COMP_METADATA_TYPE type)
@@ -172,10 +254,38 @@ QString ComponentInformationManager::_getFileCacheTag(int compInfoType, uint32_t
     return QString::asprintf("%08x_%02i_%i", crc, compInfoType, (int)isTranslation);
 }
 
+void ComponentInformationManager::_removeLegacyDownloadCache()
+{
+    static bool removed = false;
+    if (removed) {
+        return;
+    }
+    removed = true;
+
+    // All types used to share the download cache directory, each now has a sub directory named after its type
+    const QDir cacheDir(_downloadCacheDir());
+    const QFileInfoList entries = cacheDir.entryInfoList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot);
+    for (const QFileInfo &entry : entries) {
+        bool isTypeDir = false;
+        (void) entry.fileName().toInt(&isTypeDir);
+        if (isTypeDir && entry.isDir()) {
+            continue;
+        }
 
-RequestMetaDataTypeStateMachine::RequestMetaDataTypeStateMachine(ComponentInformationManager *compMgr, QObject *parent)
+        qCDebug(ComponentInformationManagerLog) << "Removing legacy download cache" << entry.filePath();
+        const bool success = entry.isDir() ? QDir(entry.filePath()).removeRecursively() : QFile::remove(entry.filePath());
+        if (!success) {
+            qCWarning(ComponentInformationManagerLog) << "Could not remove legacy download cache" << entry.filePath();
+        }
+    }
+}
+
+
+RequestMetaDataTypeStateMachine::RequestMetaDataTypeStateMachine(ComponentInformationManager *compMgr, COMP_METADATA_TYPE type, QObject *parent)
     : StateMachine(parent)
     , _compMgr(compMgr)
+    , _cachedFileDownload(new QGCCachedFileDownload(_downloadCacheDir() + QStringLiteral("/%1").arg(static_cast<int>(type)), this))
+    , _translation(new ComponentInformationTranslation(this, _cachedFileDownload))
 {
     // qCDebug(RequestMetaDataTypeStateMachineLog) << Q_FUNC_INFO << this;
 }
@@ -192,9 +302,24 @@ void RequestMetaDataTypeStateMachine::request(CompInfo* compInfo)
     _jsonMetadataFileName.clear();
     _jsonTranslationFileName.clear();
 
+    _queuedMsecs    = 0;
+    _downloadMsecs  = 0;
+    _inflateMsecs   = 0;
+    _translateMsecs = 0;
+    _parseMsecs     = 0;
+    _applyMsecs     = 0;
+    _totalMsecs     = 0;
+    _requestTimer.start();
+
     start();
 }
 
+QString RequestMetaDataTypeStateMachine::timingString(void) const
+{
+    return QStringLiteral("total:%1ms queued:%2ms download:%3ms inflate:%4ms translate:%5ms parse:%6ms apply:%7ms")
+            .arg(_totalMsecs).arg(_queuedMsecs).arg(_downloadMsecs).arg(_inflateMsecs).arg(_translateMsecs).arg(_parseMsecs).arg(_applyMsecs);
+}
+
 int RequestMetaDataTypeStateMachine::stateCount(void) const
 {
     return _cStates;
@@ -207,7 +332,7 @@ const RequestMetaDataTypeStateMachine::StateFn* RequestMetaDataTypeStateMachine:
 
 void RequestMetaDataTypeStateMachine::statesCompleted(void) const
 {
-    _compMgr->_stateRequestCompInfoComplete();
+    _compMgr->_stateRequestCompInfoComplete(_compInfo->type);
 }
 
 QString RequestMetaDataTypeStateMachine::typeToString(void)
@@ -327,44 +452,64 @@ void RequestMetaDataTypeStateMachine::_stateRequestCompInfoDeprecated(StateMachi
     }
 }
 
-QString RequestMetaDataTypeStateMachine::_downloadCompleteJsonWorker(const QString& fileName)
+QString RequestMetaDataTypeStateMachine::_inflateJsonWorker(const QString& fileName, const QString& outputFileName)
 {
-    QString outputFileName = fileName;
+    if (!QGCLZMA::inflateLZMAFile(fileName, outputFileName)) {
+        return QString();
+    }
 
-    if (fileName.endsWith(".lzma", Qt::CaseInsensitive) || fileName.endsWith(".xz", Qt::CaseInsensitive)) {
-        outputFileName = (QDir(QStandardPaths::writableLocation(QStandardPaths::TempLocation)).absoluteFilePath(_currentCacheFileTag));
-        if (QGCLZMA::inflateLZMAFile(fileName, outputFileName)) {
-            QFile(fileName).remove();
-        } else {
-            qCWarning(ComponentInformationManagerLog) << "Inflate of compressed json failed" << _currentCacheFileTag;
-            outputFileName.clear();
+    QFile(fileName).remove();
+    return outputFileName;
+}
+
+void RequestMetaDataTypeStateMachine::_downloadCompleteJson(const QString& fileName)
+{
+    _downloadMsecs += _phaseTimer.restart();
+
+    if (!(fileName.endsWith(".lzma", Qt::CaseInsensitive) || fileName.endsWith(".xz", Qt::CaseInsensitive))) {
+        if (_currentFileName) {
+            // cache the file (this will move/remove the temp file as well)
+            *_currentFileName = _currentFileValidCrc ? _compMgr->fileCache().insert(_currentCacheFileTag, fileName) : fileName;
         }
-    } else {
-        outputFileName = fileName;
+        advance();
+        return;
     }
 
-    if (_currentFileValidCrc) {
-        // cache the file (this will move/remove the temp file as well)
-        outputFileName = _compMgr->fileCache().insert(_currentCacheFileTag, outputFileName);
-    }
-    return outputFileName;
+    // Inflate on the worker pool so concurrent type requests and the ui keep running
+    const QString outputFileName = QDir(QStandardPaths::writableLocation(QStandardPaths::TempLocation)).absoluteFilePath(_currentCacheFileTag);
+    QFutureWatcher<QString>* watcher = new QFutureWatcher<QString>(this);
+    (void) connect(watcher, &QFutureWatcher<QString>::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        _inflateMsecs += _phaseTimer.restart();
+
+        QString inflatedFileName = watcher->result();
+        if (inflatedFileName.isEmpty()) {
+            qCWarning(ComponentInformationManagerLog) << "Inflate of compressed json failed" << _currentCacheFileTag;
+        } else if (_currentFileValidCrc) {
+            // cache the file (this will move/remove the temp file as well)
+            inflatedFileName = _compMgr->fileCache().insert(_currentCacheFileTag, inflatedFileName);
+        }
+        if (_currentFileName) {
+            *_currentFileName = inflatedFileName;
+        }
+        advance();
+    });
+    watcher->setFuture(QtConcurrent::run(&RequestMetaDataTypeStateMachine::_inflateJsonWorker, fileName, outputFileName));
 }
 
 void RequestMetaDataTypeStateMachine::_ftpDownloadComplete(const QString& fileName, const QString& errorMsg)
 {
     qCDebug(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_ftpDownloadComplete fileName:errorMsg" << fileName << errorMsg;
 
-    disconnect(_compInfo->vehicle->ftpManager(), &FTPManager::downloadComplete, this, &RequestMetaDataTypeStateMachine::_ftpDownloadComplete);
-    disconnect(_compInfo->vehicle->ftpManager(), &FTPManager::commandProgress, this, &RequestMetaDataTypeStateMachine::_ftpDownloadProgress);
     if (errorMsg.isEmpty()) {
-        if (_currentFileName) {
-            *_currentFileName = _downloadCompleteJsonWorker(fileName);
-        }
+        _downloadCompleteJson(fileName);
+        return;
     } else if (qgcApp()->runningUnitTests()) {
         // Unit test should always succeed
         qCWarning(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_ftpDownloadComplete failed filename:errorMsg" << fileName << errorMsg;
     }
 
+    _downloadMsecs += _phaseTimer.restart();
     advance();
 }
 
@@ -385,22 +530,21 @@ void RequestMetaDataTypeStateMachine::_httpDownloadComplete(QString remoteFile,
 {
     qCDebug(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_httpDownloadComplete remoteFile:localFile:errorMsg" << remoteFile << localFile << errorMsg;
 
-    disconnect(qobject_cast<QGCCachedFileDownload*>(sender()), &QGCCachedFileDownload::downloadComplete, this, &RequestMetaDataTypeStateMachine::_httpDownloadComplete);
+    disconnect(_cachedFileDownload, &QGCCachedFileDownload::downloadComplete, this, &RequestMetaDataTypeStateMachine::_httpDownloadComplete);
     if (errorMsg.isEmpty()) {
-        if (_currentFileName) {
-            *_currentFileName = _downloadCompleteJsonWorker(localFile);
-        }
+        _downloadCompleteJson(localFile);
+        return;
     } else if (qgcApp()->runningUnitTests()) {
         // Unit test should always succeed
         qCWarning(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_httpDownloadCompleteMetaDataJson failed remoteFile:localFile:errorMsg" << remoteFile << localFile << errorMsg;
     }
 
+    _downloadMsecs += _phaseTimer.restart();
     advance();
 }
 
 void RequestMetaDataTypeStateMachine::_requestFile(const QString& cacheFileTag, bool crcValid, const QString& uri, QString& outputFileName)
 {
-    FTPManager*                         ftpManager      = _compInfo->vehicle->ftpManager();
     _currentCacheFileTag = cacheFileTag;
     _currentFileName = &outputFileName;
     _currentFileValidCrc = crcValid;
@@ -411,24 +555,18 @@ void RequestMetaDataTypeStateMachine::_requestFile(const QString& cacheFileTag,
 
         if (cachedFile.isEmpty()) {
             qCDebug(ComponentInformationManagerLog) << "Downloading json" << uri;
+            _phaseTimer.start();
             if (_uriIsMAVLinkFTP(uri)) {
-                connect(ftpManager, &FTPManager::downloadComplete, this, &RequestMetaDataTypeStateMachine::_ftpDownloadComplete);
-                if (ftpManager->download(MAV_COMP_ID_AUTOPILOT1, uri, QStandardPaths::writableLocation(QStandardPaths::TempLocation))) {
-                    _downloadStartTime.start();
-                    connect(ftpManager, &FTPManager::commandProgress, this, &RequestMetaDataTypeStateMachine::_ftpDownloadProgress);
-                } else {
-                    qCWarning(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_requestFile FTPManager::download returned failure";
-                    disconnect(ftpManager, &FTPManager::downloadComplete, this, &RequestMetaDataTypeStateMachine::_ftpDownloadComplete);
-                    advance();
-                }
+                // Completion comes back through _ftpDownloadComplete once FTPManager is free
+                _compMgr->_queueFtpDownload(this, uri);
             } else {
-                connect(_compMgr->_cachedFileDownload, &QGCCachedFileDownload::downloadComplete, this,
+                connect(_cachedFileDownload, &QGCCachedFileDownload::downloadComplete, this,
                         &RequestMetaDataTypeStateMachine::_httpDownloadComplete);
-                if (_compMgr->_cachedFileDownload->download(uri, crcValid ? 0 : ComponentInformationManager::cachedFileMaxAgeSec)) {
+                if (_cachedFileDownload->download(uri, crcValid ? 0 : ComponentInformationManager::cachedFileMaxAgeSec)) {
                     _downloadStartTime.start();
                 } else {
                     qCWarning(ComponentInformationManagerLog) << "RequestMetaDataTypeStateMachine::_requestFile QGCCachedFileDownload::download returned failure";
-                    disconnect(_compMgr->_cachedFileDownload, &QGCCachedFileDownload::downloadComplete, this,
+                    disconnect(_cachedFileDownload, &QGCCachedFileDownload::downloadComplete, this,
                                &RequestMetaDataTypeStateMachine::_httpDownloadComplete);
                     advance();
                 }
@@ -488,12 +626,13 @@ void RequestMetaDataTypeStateMachine::_stateRequestTranslate(StateMachine* state
     if (requestMachine->_jsonTranslationFileName.isEmpty()) {
         requestMachine->advance();
     } else {
-        connect(requestMachine->_compMgr->translation(), &ComponentInformationTranslation::downloadComplete,
+        requestMachine->_phaseTimer.start();
+        connect(requestMachine->_translation, &ComponentInformationTranslation::downloadComplete,
                 requestMachine, &RequestMetaDataTypeStateMachine::_downloadAndTranslationComplete);
-        if (!requestMachine->_compMgr->translation()->downloadAndTranslate(requestMachine->_jsonTranslationFileName,
+        if (!requestMachine->_translation->downloadAndTranslate(requestMachine->_jsonTranslationFileName,
                                                                            requestMachine->_jsonMetadataFileName,
                                                                            ComponentInformationManager::cachedFileMaxAgeSec)) {
-            disconnect(requestMachine->_compMgr->translation(), &ComponentInformationTranslation::downloadComplete,
+            disconnect(requestMachine->_translation, &ComponentInformationTranslation::downloadComplete,
                        requestMachine, &RequestMetaDataTypeStateMachine::_downloadAndTranslationComplete);
             qCDebug(ComponentInformationManagerLog) << "downloadAndTranslate() failed";
             requestMachine->advance();
@@ -503,8 +642,9 @@ void RequestMetaDataTypeStateMachine::_stateRequestTranslate(StateMachine* state
 
 void RequestMetaDataTypeStateMachine::_downloadAndTranslationComplete(QString translatedJsonTempFile, QString errorMsg)
 {
-    disconnect(_compMgr->translation(), &ComponentInformationTranslation::downloadComplete,
+    disconnect(_translation, &ComponentInformationTranslation::downloadComplete,
                this, &RequestMetaDataTypeStateMachine::_downloadAndTranslationComplete);
+    _translateMsecs += _phaseTimer.elapsed();
     _jsonMetadataTranslatedFileName = translatedJsonTempFile;
     if (!errorMsg.isEmpty()) {
         qCWarning(ComponentInformationManagerLog) << "Metadata translation failed:" << errorMsg;
@@ -512,27 +652,66 @@ void RequestMetaDataTypeStateMachine::_downloadAndTranslationComplete(QString tr
     advance();
 }
 
-void RequestMetaDataTypeStateMachine::_stateRequestComplete(StateMachine* stateMachine)
+QJsonDocument RequestMetaDataTypeStateMachine::_parseJsonWorker(const QString& jsonFileName)
 {
-    RequestMetaDataTypeStateMachine*    requestMachine  = static_cast<RequestMetaDataTypeStateMachine*>(stateMachine);
-    CompInfo*                           compInfo        = requestMachine->compInfo();
+    QString         errorString;
+    QJsonDocument   jsonDoc;
+
+    if (!JsonHelper::isJsonFile(jsonFileName, jsonDoc, errorString)) {
+        // Leave it to CompInfo to report the error since it knows the context
+        return QJsonDocument();
+    }
+    return jsonDoc;
+}
+
+void RequestMetaDataTypeStateMachine::_setJson(const QString& jsonFileName, const QJsonDocument& jsonDoc)
+{
+    QElapsedTimer applyTimer;
+    applyTimer.start();
 
-    if (requestMachine->_jsonMetadataTranslatedFileName.isEmpty()) {
-        compInfo->setJson(requestMachine->_jsonMetadataFileName);
+    if (jsonDoc.isNull()) {
+        _compInfo->setJson(jsonFileName);
     } else {
-        compInfo->setJson(requestMachine->_jsonMetadataTranslatedFileName);
-        QFile(requestMachine->_jsonMetadataTranslatedFileName).remove();
+        _compInfo->setJsonDocument(jsonFileName, jsonDoc);
+    }
+    _applyMsecs = applyTimer.elapsed();
+
+    if (!_jsonMetadataTranslatedFileName.isEmpty()) {
+        QFile(_jsonMetadataTranslatedFileName).remove();
     }
 
     // if we don't have a CRC we didn't cache the file and we need to delete it
-    if (!requestMachine->_jsonMetadataCrcValid && !requestMachine->_jsonMetadataFileName.isEmpty()) {
-        QFile(requestMachine->_jsonMetadataFileName).remove();
+    if (!_jsonMetadataCrcValid && !_jsonMetadataFileName.isEmpty()) {
+        QFile(_jsonMetadataFileName).remove();
     }
-    if (!requestMachine->_jsonMetadataCrcValid && !requestMachine->_jsonTranslationFileName.isEmpty()) {
-        QFile(requestMachine->_jsonTranslationFileName).remove();
+    if (!_jsonMetadataCrcValid && !_jsonTranslationFileName.isEmpty()) {
+        QFile(_jsonTranslationFileName).remove();
     }
 
-    requestMachine->advance();
+    _totalMsecs = _requestTimer.elapsed();
+    advance();
+}
+
+void RequestMetaDataTypeStateMachine::_stateRequestComplete(StateMachine* stateMachine)
+{
+    RequestMetaDataTypeStateMachine*    requestMachine  = static_cast<RequestMetaDataTypeStateMachine*>(stateMachine);
+    CompInfo*                           compInfo        = requestMachine->compInfo();
+
+    const QString jsonFileName = requestMachine->_jsonMetadataTranslatedFileName.isEmpty() ? requestMachine->_jsonMetadataFileName : requestMachine->_jsonMetadataTranslatedFileName;
+    if (jsonFileName.isEmpty() || !compInfo->usesJsonDocument()) {
+        requestMachine->_setJson(jsonFileName, QJsonDocument());
+        return;
+    }
+
+    // Parse on the worker pool, only applying the result to CompInfo happens on the main thread
+    requestMachine->_phaseTimer.start();
+    QFutureWatcher<QJsonDocument>* watcher = new QFutureWatcher<QJsonDocument>(requestMachine);
+    (void) connect(watcher, &QFutureWatcher<QJsonDocument>::finished, requestMachine, [requestMachine, watcher, jsonFileName]() {
+        watcher->deleteLater();
+        requestMachine->_parseMsecs = requestMachine->_phaseTimer.elapsed();
+        requestMachine->_setJson(jsonFileName, watcher->result());
+    });
+    watcher->setFuture(QtConcurrent::run(&RequestMetaDataTypeStateMachine::_parseJsonWorker, jsonFileName));
 }
 
 bool RequestMetaDataTypeStateMachine::_uriIsMAVLinkFTP(const QString& uri)
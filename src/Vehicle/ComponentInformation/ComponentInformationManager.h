@@ -13,7 +13,10 @@
 #include "StateMachine.h"
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QPair>
+#include <QtCore/QQueue>
 
 Q_DECLARE_LOGGING_CATEGORY(RequestMetaDataTypeStateMachineLog)
 Q_DECLARE_LOGGING_CATEGORY(ComponentInformationManagerLog)
@@ -32,13 +35,16 @@ class RequestMetaDataTypeStateMachine : public StateMachine
     Q_OBJECT
 
 public:
-    RequestMetaDataTypeStateMachine(ComponentInformationManager *compMgr, QObject *parent = nullptr);
+    RequestMetaDataTypeStateMachine(ComponentInformationManager *compMgr, COMP_METADATA_TYPE type, QObject *parent = nullptr);
     ~RequestMetaDataTypeStateMachine();
 
     void        request     (CompInfo* compInfo);
     QString     typeToString(void);
     CompInfo*   compInfo    (void) { return _compInfo; }
 
+    /// @return Timing breakdown of the last request for logging
+    QString     timingString(void) const;
+
     // Overrides from StateMachine
     int             stateCount      (void) const final;
     const StateFn*  rgStates        (void) const final;
@@ -48,8 +54,8 @@ private slots:
     void    _ftpDownloadComplete                (const QString& file, const QString& errorMsg);
     void    _ftpDownloadProgress                (float progress);
     void    _httpDownloadComplete               (QString remoteFile, QString localFile, QString errorMsg);
-    QString _downloadCompleteJsonWorker         (const QString& jsonFileName);
-    void _downloadAndTranslationComplete(QString translatedJsonTempFile, QString errorMsg);
+    void    _downloadCompleteJson               (const QString& jsonFileName);
+    void    _downloadAndTranslationComplete     (QString translatedJsonTempFile, QString errorMsg);
 
 private:
     static void _stateRequestCompInfo           (StateMachine* stateMachine);
@@ -61,6 +67,14 @@ private slots:
     static void _stateRequestComplete           (StateMachine* stateMachine);
     static bool _uriIsMAVLinkFTP                (const QString& uri);
 
+    /// Decompresses the file if needed. Runs on the worker pool.
+    ///     @return Uncompressed file name, empty on error
+    static QString _inflateJsonWorker           (const QString& jsonFileName, const QString& outputFileName);
+    /// Parses the json file. Runs on the worker pool.
+    static QJsonDocument _parseJsonWorker       (const QString& jsonFileName);
+
+    void _setJson(const QString& jsonFileName, const QJsonDocument& jsonDoc);
+
     void _requestFile(const QString& cacheFileTag, bool crcValid, const QString& uri, QString& outputFileName);
 
     ComponentInformationManager*    _compMgr                    = nullptr;
@@ -76,6 +90,18 @@ private slots:
     bool                            _currentFileValidCrc        = false;
 
     QElapsedTimer                   _downloadStartTime;
+    QGCCachedFileDownload*          _cachedFileDownload         = nullptr;  ///< Per type so http downloads run concurrently, each with its own cache directory since QNetworkDiskCache instances can't share one
+    ComponentInformationTranslation* _translation               = nullptr;
+
+    QElapsedTimer                   _requestTimer;
+    QElapsedTimer                   _phaseTimer;
+    qint64                          _queuedMsecs                = 0;    ///< Waiting for FTPManager to be free
+    qint64                          _downloadMsecs              = 0;
+    qint64                          _inflateMsecs               = 0;
+    qint64                          _translateMsecs             = 0;
+    qint64                          _parseMsecs                 = 0;
+    qint64                          _applyMsecs                 = 0;
+    qint64                          _totalMsecs                 = 0;
 
     static constexpr const StateFn _rgStates[]= {
         _stateRequestCompInfo,
@@ -88,6 +114,8 @@ private slots:
     };
 
     static constexpr int _cStates = sizeof(_rgStates) / sizeof(_rgStates[0]);
+
+    friend class ComponentInformationManager;
 };
 
 class ComponentInformationManager : public StateMachine
@@ -110,7 +138,6 @@ class ComponentInformationManager : public StateMachine
     const StateFn *rgStates() const final;
 
     ComponentInformationCache &fileCache() { return _fileCache; }
-    ComponentInformationTranslation *translation() { return _translation; }
 
     float progress() const;
 
@@ -121,36 +148,52 @@ class ComponentInformationManager : public StateMachine
 signals:
     void progressUpdate(float progress);
 
+private slots:
+    void _ftpDownloadComplete           (const QString& file, const QString& errorMsg);
+    void _ftpDownloadProgress           (float progress);
+
 private:
-    void _stateRequestCompInfoComplete  (void);
+    void _stateRequestCompInfoComplete  (COMP_METADATA_TYPE type);
     bool _isCompTypeSupported           (COMP_METADATA_TYPE type);
     void _updateAllUri                  ();
 
+    /// FTPManager handles a single download at a time, so ftp requests from the concurrent type requests are queued here
+    void _queueFtpDownload              (RequestMetaDataTypeStateMachine* requestMachine, const QString& uri);
+    void _startNextFtpDownload          ();
+
     static QString _getFileCacheTag(int compInfoType, uint32_t crc, bool isTranslation);
+    static void _removeLegacyDownloadCache();
 
     static void _stateRequestCompInfoGeneral        (StateMachine* stateMachine);
     static void _stateRequestCompInfoGeneralComplete(StateMachine* stateMachine);
-    static void _stateRequestCompInfoParam          (StateMachine* stateMachine);
-    static void _stateRequestCompInfoEvents         (StateMachine* stateMachine);
-    static void _stateRequestCompInfoActuators      (StateMachine* stateMachine);
+    static void _stateRequestCompInfoTypes          (StateMachine* stateMachine);
     static void _stateRequestAllCompInfoComplete    (StateMachine* stateMachine);
 
     Vehicle*                        _vehicle                    = nullptr;
-    RequestMetaDataTypeStateMachine _requestTypeStateMachine;
     RequestAllCompleteFn            _requestAllCompleteFn       = nullptr;
     void*                           _requestAllCompleteFnData   = nullptr;
-    QGCCachedFileDownload*          _cachedFileDownload         = nullptr;
     ComponentInformationCache&      _fileCache;
-    ComponentInformationTranslation* _translation               = nullptr;
+    int                             _cPendingTypeRequests       = 0;
+    int                             _cTypeRequests              = 0;
+    QElapsedTimer                   _requestAllTimer;
+
+    QQueue<QPair<RequestMetaDataTypeStateMachine*, QString /* uri */>> _ftpDownloadQueue;
+    RequestMetaDataTypeStateMachine*    _activeFtpRequest       = nullptr;
 
     QMap<uint8_t /* compId */, QMap<COMP_METADATA_TYPE, CompInfo*>> _compInfoMap;
+    QMap<COMP_METADATA_TYPE, RequestMetaDataTypeStateMachine*>      _requestTypeStateMachines;
+
+    /// Types which are requested concurrently once general metadata is available
+    static constexpr const COMP_METADATA_TYPE _rgConcurrentTypes[] = {
+        COMP_METADATA_TYPE_PARAMETER,
+        COMP_METADATA_TYPE_EVENTS,
+        COMP_METADATA_TYPE_ACTUATORS,
+    };
 
     static constexpr const StateFn _rgStates[]= {
         _stateRequestCompInfoGeneral,
         _stateRequestCompInfoGeneralComplete,
-        _stateRequestCompInfoParam,
-        _stateRequestCompInfoEvents,
-        _stateRequestCompInfoActuators,
+        _stateRequestCompInfoTypes,
         _stateRequestAllCompInfoComplete
     };
 
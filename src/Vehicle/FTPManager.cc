@@ -12,6 +12,7 @@
 #include "Vehicle.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
+#include "QGCTrace.h"
 
 #include <QtCore/QFile>
 #include <QtCore/QDir>
@@ -19,11 +20,13 @@
 QGC_LOGGING_CATEGORY(FTPManagerLog, "Vehicle.FTPManager")
 
 FTPManager::FTPManager(Vehicle* vehicle)
-    : QObject   (vehicle)
-    , _vehicle  (vehicle)
+    : QObject                   (vehicle)
+    , _vehicle                  (vehicle)
+    , _minAckOrNakTimeoutMsecs  (qgcApp()->runningUnitTests() ? 10 : 100)
 {
     _ackOrNakTimeoutTimer.setSingleShot(true);
-    // Mock link responds immediately if at all, speed up unit tests with faster timoue
+    // Mock link responds immediately if at all, speed up unit tests with faster timoue.
+    // The timeout adapts to the measured round trip time from here on.
     _ackOrNakTimeoutTimer.setInterval(qgcApp()->runningUnitTests() ? 10 : _ackOrNakTimeoutMsecs);
     connect(&_ackOrNakTimeoutTimer, &QTimer::timeout, this, &FTPManager::_ackOrNakTimeout);
 
@@ -114,6 +117,43 @@ bool FTPManager::listDirectory(uint8_t fromCompId, const QString& fromURI)
     return true;
 }
 
+bool FTPManager::upload(uint8_t toCompId, const QString& toURI, const QString& fromFile)
+{
+    qCDebug(FTPManagerLog) << "upload fromFile:" << fromFile << "to:" << toURI << "toCompId:" << toCompId;
+
+    if (!_rgStateMachine.isEmpty()) {
+        qCDebug(FTPManagerLog) << "Cannot upload. Already in another operation";
+        return false;
+    }
+
+    _uploadState.reset();
+
+    if (!_parseURI(toCompId, toURI, _uploadState.fullPathOnVehicle, _ftpCompId)) {
+        qCWarning(FTPManagerLog) << "_parseURI failed";
+        return false;
+    }
+
+    _uploadState.file.setFileName(fromFile);
+    if (!_uploadState.file.open(QFile::ReadOnly)) {
+        qCWarning(FTPManagerLog) << "upload: open failed" << fromFile << _uploadState.file.errorString();
+        return false;
+    }
+
+    static const StateFunctions_t rgUploadStateMachine[] = {
+        { &FTPManager::_createFileBegin,            &FTPManager::_createFileAckOrNak,           &FTPManager::_createFileTimeout },
+        { &FTPManager::_writeFileBegin,             &FTPManager::_writeFileAckOrNak,            &FTPManager::_writeFileTimeout },
+        { &FTPManager::_uploadTerminateBegin,       &FTPManager::_uploadTerminateAckOrNak,      &FTPManager::_uploadTerminateTimeout },
+        { &FTPManager::_uploadCompleteNoError,      nullptr,                                    nullptr },
+    };
+    for (size_t i=0; i<sizeof(rgUploadStateMachine)/sizeof(rgUploadStateMachine[0]); i++) {
+        _rgStateMachine.append(rgUploadStateMachine[i]);
+    }
+
+    _startStateMachine();
+
+    return true;
+}
+
 void FTPManager::cancelDownload()
 {
     if (!_downloadState.inProgress()) {
@@ -197,6 +237,20 @@ void FTPManager::_downloadComplete(const QString& errorMsg)
     emit downloadComplete(downloadFilePath, errorMsg);
 }
 
+/// Closes out an upload session
+///     @param errorMsg Error message, empty if no error
+void FTPManager::_uploadComplete(const QString& errorMsg)
+{
+    qCDebug(FTPManagerLog) << QString("_uploadComplete: errorMsg(%1)").arg(errorMsg);
+
+    _ackOrNakTimeoutTimer.stop();
+    _rgStateMachine.clear();
+    _currentStateMachineIndex = -1;
+    _uploadState.file.close();
+
+    emit uploadComplete(_uploadState.fullPathOnVehicle, errorMsg);
+}
+
 /// Closes out a list directory sequence
 ///     @param errorMsg Error message, empty if no error
 void FTPManager::_listDirectoryComplete(const QString& errorMsg)
@@ -237,19 +291,30 @@ void FTPManager::_mavlinkMessageReceived(const mavlink_message_t& message)
 
     MavlinkFTP::Request* request = (MavlinkFTP::Request*)&data.payload[0];
 
+    // While filling missing blocks several reads are in flight and responses are matched by sequence number in the state itself
+    const bool windowedState = (_rgStateMachine[_currentStateMachineIndex].ackNakFn == &FTPManager::_fillMissingBlocksAckOrNak);
+
     // Ignore old/reordered packets (handle wrap-around properly)
     uint16_t actualIncomingSeqNumber = request->hdr.seqNumber;
-    if ((uint16_t)((_expectedIncomingSeqNumber - 1) - actualIncomingSeqNumber) < (std::numeric_limits<uint16_t>::max()/2)) {
+    if (!windowedState && ((uint16_t)((_expectedIncomingSeqNumber - 1) - actualIncomingSeqNumber) < (std::numeric_limits<uint16_t>::max()/2))) {
         qCDebug(FTPManagerLog) << "_mavlinkMessageReceived: Received old packet seqNum expected:actual" << _expectedIncomingSeqNumber << actualIncomingSeqNumber
                                << "hdr.opcode:hdr.req_opcode" << MavlinkFTP::opCodeToString(static_cast<MavlinkFTP::OpCode_t>(request->hdr.opcode)) <<  MavlinkFTP::opCodeToString(static_cast<MavlinkFTP::OpCode_t>(request->hdr.req_opcode));
 
         return;
     }
 
+    QGC_TRACE(FTPResponseReceived, request->hdr.opcode | (request->hdr.req_opcode << 8),
+              request->hdr.seqNumber | (static_cast<quint64>(request->hdr.size) << 16) | (static_cast<quint64>(request->hdr.offset) << 32));
+
     qCDebug(FTPManagerLog) << "_mavlinkMessageReceived: hdr.opcode:hdr.req_opcode:seqNumber"
                            << MavlinkFTP::opCodeToString(static_cast<MavlinkFTP::OpCode_t>(request->hdr.opcode)) <<  MavlinkFTP::opCodeToString(static_cast<MavlinkFTP::OpCode_t>(request->hdr.req_opcode))
                            << request->hdr.seqNumber;
 
+    if (!windowedState && _rttSamplePending && (actualIncomingSeqNumber == _expectedIncomingSeqNumber)) {
+        _rttSamplePending = false;
+        _updateRtt(_requestTimer.elapsed());
+    }
+
     (this->*_rgStateMachine[_currentStateMachineIndex].ackNakFn)(request);
 }
 
@@ -561,31 +626,49 @@ void FTPManager::_listDirectoryTimeout(void)
     }
 }
 
-void FTPManager::_fillMissingBlocksWorker(bool firstRequest)
+void FTPManager::_sendMissingBlockRead(uint32_t offset, uint32_t cBytes, int retryCount)
 {
-    if (_downloadState.rgMissingData.count()) {
-        MavlinkFTP::Request request{};
-        MissingData_t&      missingData = _downloadState.rgMissingData.first();
+    qCDebug(FTPManagerLog) << "_sendMissingBlockRead: offset:cBytes:retryCount" << offset << cBytes << retryCount;
 
-        uint32_t cBytesToRead = qMin((uint32_t)sizeof(request.data), missingData.cBytesMissing);
+    MavlinkFTP::Request request{};
+    request.hdr.session = _downloadState.sessionId;
+    request.hdr.opcode  = MavlinkFTP::kCmdReadFile;
+    request.hdr.offset  = offset;
+    request.hdr.size    = static_cast<uint8_t>(cBytes);
+    _sendRequestExpectAck(&request);
 
-        qCDebug(FTPManagerLog) << "_fillMissingBlocksBegin: offset:cBytesToRead" << missingData.offset << cBytesToRead;
+    OutstandingRead_t outstandingRead;
+    outstandingRead.offset      = offset;
+    outstandingRead.cBytes      = cBytes;
+    outstandingRead.retryCount  = retryCount;
+    outstandingRead.sentTimer.start();
+    _downloadState.rgOutstandingReads.insert(_expectedIncomingSeqNumber, outstandingRead);
+}
 
-        request.hdr.session                 = _downloadState.sessionId;
-        request.hdr.opcode                  = MavlinkFTP::kCmdReadFile;
-        request.hdr.offset                  = missingData.offset;
-        request.hdr.size                    = cBytesToRead;
+void FTPManager::_fillMissingBlocksWorker(void)
+{
+    // Keep a window of reads in flight, gaps are split into packet sized reads
+    MavlinkFTP::Request request{};
+    while ((_downloadState.rgOutstandingReads.count() < _maxOutstandingReads) && !_downloadState.rgMissingData.isEmpty()) {
+        MissingData_t& missingData = _downloadState.rgMissingData.first();
 
-        if (firstRequest) {
-            _downloadState.retryCount = 0;
-        } else {
-            // Must used same sequence number as previous request
-            _expectedIncomingSeqNumber -= 2;
+        const uint32_t offset       = missingData.offset;
+        const uint32_t cBytesToRead = qMin((uint32_t)sizeof(request.data), missingData.cBytesMissing);
+        missingData.offset          += cBytesToRead;
+        missingData.cBytesMissing   -= cBytesToRead;
+        if (missingData.cBytesMissing == 0) {
+            _downloadState.rgMissingData.removeFirst();
         }
-        _downloadState.expectedOffset = request.hdr.offset;
 
-        _sendRequestExpectAck(&request);
-    } else {
+        _sendMissingBlockRead(offset, cBytesToRead, 0 /* retryCount */);
+    }
+
+    if (!_downloadState.rgOutstandingReads.isEmpty()) {
+        // Reads are still in flight even if nothing new was sent, keep watching for their loss
+        if (!_ackOrNakTimeoutTimer.isActive()) {
+            _ackOrNakTimeoutTimer.start();
+        }
+    } else if (_downloadState.rgMissingData.isEmpty()) {
         // We should have the full file now
         if (_downloadState.checksize == false || _downloadState.bytesWritten == _downloadState.fileSize) {
             _advanceStateMachine();
@@ -596,9 +679,30 @@ void FTPManager::_fillMissingBlocksWorker(bool firstRequest)
     }
 }
 
+void FTPManager::_dropMissingDataFrom(uint32_t offset)
+{
+    for (int i=_downloadState.rgMissingData.count()-1; i>=0; i--) {
+        MissingData_t& missingData = _downloadState.rgMissingData[i];
+        if (missingData.offset >= offset) {
+            _downloadState.rgMissingData.removeAt(i);
+        } else if (missingData.offset + missingData.cBytesMissing > offset) {
+            missingData.cBytesMissing = offset - missingData.offset;
+        }
+    }
+
+    for (auto it = _downloadState.rgOutstandingReads.begin(); it != _downloadState.rgOutstandingReads.end();) {
+        if (it.value().offset >= offset) {
+            it = _downloadState.rgOutstandingReads.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void FTPManager::_fillMissingBlocksBegin(void)
 {
-    _fillMissingBlocksWorker(true /* firstRequest */);
+    _downloadState.rgOutstandingReads.clear();
+    _fillMissingBlocksWorker();
 }
 
 void FTPManager::_fillMissingBlocksAckOrNak(const MavlinkFTP::Request* ackOrNak)
@@ -609,30 +713,37 @@ void FTPManager::_fillMissingBlocksAckOrNak(const MavlinkFTP::Request* ackOrNak)
         qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak: Disregarding due to incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
         return;
     }
-    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
-        qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak: Disregarding due to incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
-        return;
-    }
     if (ackOrNak->hdr.session != _downloadState.sessionId) {
         qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak: Disregarding due to incorrect session id actual:expected" << ackOrNak->hdr.session << _downloadState.sessionId;
         return;
     }
+    auto it = _downloadState.rgOutstandingReads.find(ackOrNak->hdr.seqNumber);
+    if (it == _downloadState.rgOutstandingReads.end()) {
+        qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak: Disregarding due to unknown sequence" << ackOrNak->hdr.seqNumber;
+        return;
+    }
+
+    const OutstandingRead_t outstandingRead = it.value();
+    _downloadState.rgOutstandingReads.erase(it);
+    if (outstandingRead.retryCount == 0) {
+        _updateRtt(outstandingRead.sentTimer.elapsed());
+    }
 
     _ackOrNakTimeoutTimer.stop();
 
     if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
         qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak: Ack offset:size" << ackOrNak->hdr.offset << ackOrNak->hdr.size;
 
-        if (ackOrNak->hdr.offset != _downloadState.expectedOffset) {
-            if (++_downloadState.retryCount > _maxRetry) {
+        if ((ackOrNak->hdr.offset != outstandingRead.offset) || (ackOrNak->hdr.size == 0) || (ackOrNak->hdr.size > outstandingRead.cBytes)) {
+            if (outstandingRead.retryCount + 1 > _maxRetry) {
                 qCDebug(FTPManagerLog) << QString("_fillMissingBlocksAckOrNak: offset mismatch, retries exceeded");
                 _downloadComplete(tr("Download failed"));
                 return;
             }
 
-            // Ask for current offset again
-            qCDebug(FTPManagerLog) << QString("_fillMissingBlocksAckOrNak: Ack offset mismatch retry, retryCount(%1) offset(%2)").arg(_downloadState.retryCount).arg(_downloadState.expectedOffset);
-            _fillMissingBlocksWorker(false /* firstReqeust */);
+            // Ask for the same block again
+            qCDebug(FTPManagerLog) << QString("_fillMissingBlocksAckOrNak: Ack offset mismatch retry, retryCount(%1) offset(%2)").arg(outstandingRead.retryCount + 1).arg(outstandingRead.offset);
+            _sendMissingBlockRead(outstandingRead.offset, outstandingRead.cBytes, outstandingRead.retryCount + 1);
             return;
         }
 
@@ -644,16 +755,16 @@ void FTPManager::_fillMissingBlocksAckOrNak(const MavlinkFTP::Request* ackOrNak)
         }
         _downloadState.bytesWritten += ackOrNak->hdr.size;
 
-        MissingData_t& missingData = _downloadState.rgMissingData.first();
-        missingData.offset += ackOrNak->hdr.size;
-        missingData.cBytesMissing -= ackOrNak->hdr.size;
-        if (missingData.cBytesMissing == 0) {
-            // This block is finished, remove it
-            _downloadState.rgMissingData.takeFirst();
+        if (ackOrNak->hdr.size < outstandingRead.cBytes) {
+            // Short read, the remainder goes back in the gap list
+            MissingData_t missingData;
+            missingData.offset          = outstandingRead.offset + ackOrNak->hdr.size;
+            missingData.cBytesMissing   = outstandingRead.cBytes - ackOrNak->hdr.size;
+            _downloadState.rgMissingData.prepend(missingData);
         }
 
-        // Move on to fill in possible next hole
-        _fillMissingBlocksWorker(true /* firstReqeust */);
+        // Keep the window full or finish up
+        _fillMissingBlocksWorker();
 
         // Emit progress last, as cancel could be called in there
         if (_downloadState.fileSize != 0) {
@@ -664,7 +775,12 @@ void FTPManager::_fillMissingBlocksAckOrNak(const MavlinkFTP::Request* ackOrNak)
 
         if (errorCode == MavlinkFTP::kErrEOF) {
             qCDebug(FTPManagerLog) << "_fillMissingBlocksAckOrNak EOF";
-            if (_downloadState.checksize == false || _downloadState.bytesWritten == _downloadState.fileSize) {
+            if (_downloadState.checksize == false) {
+                // Real file is shorter than the size reported by open, nothing past here exists
+                _dropMissingDataFrom(outstandingRead.offset);
+                _fillMissingBlocksWorker();
+                return;
+            } else if (_downloadState.bytesWritten == _downloadState.fileSize) {
                 // We've successfully complete filling in all missing blocks
                 _advanceStateMachine();
                 return;
@@ -678,13 +794,19 @@ void FTPManager::_fillMissingBlocksAckOrNak(const MavlinkFTP::Request* ackOrNak)
 
 void FTPManager::_fillMissingBlocksTimeout(void)
 {
-    if (++_downloadState.retryCount > _maxRetry) {
-        qCDebug(FTPManagerLog) << QString("_fillMissingBlocksTimeout retries exceeded");
-        _downloadComplete(tr("Download failed"));
-    } else {
-        // Ask for current offset again
-        qCDebug(FTPManagerLog) << QString("_fillMissingBlocksTimeout: retrying - retryCount(%1) offset(%2)").arg(_downloadState.retryCount).arg(_downloadState.expectedOffset);
-        _fillMissingBlocksWorker(false /* firstReqeust */);
+    // Nothing arrived within the timeout, everything still in flight is considered lost
+    const QList<OutstandingRead_t> rgLostReads = _downloadState.rgOutstandingReads.values();
+    _downloadState.rgOutstandingReads.clear();
+
+    for (const OutstandingRead_t& lostRead: rgLostReads) {
+        if (lostRead.retryCount + 1 > _maxRetry) {
+            qCDebug(FTPManagerLog) << QString("_fillMissingBlocksTimeout retries exceeded");
+            _downloadComplete(tr("Download failed"));
+            return;
+        }
+
+        qCDebug(FTPManagerLog) << QString("_fillMissingBlocksTimeout: retrying - retryCount(%1) offset(%2)").arg(lostRead.retryCount + 1).arg(lostRead.offset);
+        _sendMissingBlockRead(lostRead.offset, lostRead.cBytes, lostRead.retryCount + 1);
     }
 }
 
@@ -735,6 +857,14 @@ void FTPManager::_sendRequestExpectAck(MavlinkFTP::Request* request)
         request->hdr.seqNumber = _expectedIncomingSeqNumber + 1;    // Outgoing is 1 past last incoming
         _expectedIncomingSeqNumber += 2;
 
+        // Retries reuse the previous sequence number and their acks can't be used for round trip timing
+        _rttSamplePending = (request->hdr.seqNumber != _lastOutgoingSeqNumber);
+        _lastOutgoingSeqNumber = request->hdr.seqNumber;
+        _requestTimer.start();
+
+        QGC_TRACE(FTPRequestSent, request->hdr.opcode,
+                  request->hdr.seqNumber | (static_cast<quint64>(request->hdr.size) << 16) | (static_cast<quint64>(request->hdr.offset) << 32));
+
         qCDebug(FTPManagerLog) << "_sendRequestExpectAck opcode:" << MavlinkFTP::opCodeToString(static_cast<MavlinkFTP::OpCode_t>(request->hdr.opcode)) << "seqNumber:" << request->hdr.seqNumber;
 
         mavlink_message_t message;
@@ -752,6 +882,199 @@ void FTPManager::_sendRequestExpectAck(MavlinkFTP::Request* request)
     }
 }
 
+void FTPManager::_updateRtt(qint64 rttMsecs)
+{
+    if (_srttMsecs == 0) {
+        _srttMsecs      = rttMsecs;
+        _rttVarMsecs    = rttMsecs / 2.0;
+    } else {
+        _rttVarMsecs    = (0.75 * _rttVarMsecs) + (0.25 * qAbs(_srttMsecs - rttMsecs));
+        _srttMsecs      = (0.875 * _srttMsecs) + (0.125 * rttMsecs);
+    }
+
+    const int timeoutMsecs = qBound(_minAckOrNakTimeoutMsecs, qRound(_srttMsecs + (4 * _rttVarMsecs)), _maxAckOrNakTimeoutMsecs);
+    if (timeoutMsecs != _ackOrNakTimeoutTimer.interval()) {
+        qCDebug(FTPManagerLog) << "_updateRtt: srtt:rttvar:timeout" << _srttMsecs << _rttVarMsecs << timeoutMsecs;
+        _ackOrNakTimeoutTimer.setInterval(timeoutMsecs);
+    }
+}
+
+void FTPManager::_createFileBegin(void)
+{
+    MavlinkFTP::Request request{};
+    request.hdr.session = 0;
+    request.hdr.opcode  = MavlinkFTP::kCmdCreateFile;
+    request.hdr.offset  = 0;
+    request.hdr.size    = 0;
+    _fillRequestDataWithString(&request, _uploadState.fullPathOnVehicle);
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_createFileTimeout(void)
+{
+    // Create is not retried since a lost ack would leave the session open on the vehicle
+    qCDebug(FTPManagerLog) << "_createFileTimeout";
+    _uploadComplete(tr("Upload failed"));
+}
+
+void FTPManager::_createFileAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if (requestOpCode != MavlinkFTP::kCmdCreateFile) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack disregarding ack for incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack disregarding ack for incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack - sessionId" << ackOrNak->hdr.session;
+        _uploadState.sessionId = ackOrNak->hdr.session;
+        _advanceStateMachine();
+    } else if (ackOrNak->hdr.opcode == MavlinkFTP::kRspNak) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _uploadComplete(tr("Upload failed") + ": " + _errorMsgFromNak(ackOrNak));
+    }
+}
+
+void FTPManager::_writeFileWorker(bool firstRequest)
+{
+    if (_uploadState.offset >= _uploadState.file.size()) {
+        _advanceStateMachine();
+        return;
+    }
+
+    MavlinkFTP::Request request{};
+    request.hdr.session = _uploadState.sessionId;
+    request.hdr.opcode  = MavlinkFTP::kCmdWriteFile;
+    request.hdr.offset  = _uploadState.offset;
+
+    if (!_uploadState.file.seek(_uploadState.offset)) {
+        _uploadComplete(tr("Upload failed: Error reading file"));
+        return;
+    }
+    const qint64 cBytesRead = _uploadState.file.read((char*)request.data, sizeof(request.data));
+    if (cBytesRead <= 0) {
+        _uploadComplete(tr("Upload failed: Error reading file"));
+        return;
+    }
+    request.hdr.size = static_cast<uint8_t>(cBytesRead);
+    _uploadState.cBytesLastWrite = static_cast<uint32_t>(cBytesRead);
+
+    qCDebug(FTPManagerLog) << "_writeFileWorker: offset:size:firstRequest:retryCount" << _uploadState.offset << cBytesRead << firstRequest << _uploadState.retryCount;
+
+    if (firstRequest) {
+        _uploadState.retryCount = 0;
+    } else {
+        // Must used same sequence number as previous request
+        _expectedIncomingSeqNumber -= 2;
+    }
+
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_writeFileBegin(void)
+{
+    _writeFileWorker(true /* firstRequest */);
+}
+
+void FTPManager::_writeFileAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if (requestOpCode != MavlinkFTP::kCmdWriteFile) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+    if (ackOrNak->hdr.session != _uploadState.sessionId) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect session id actual:expected" << ackOrNak->hdr.session << _uploadState.sessionId;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        _uploadState.offset += _uploadState.cBytesLastWrite;
+        _writeFileWorker(true /* firstRequest */);
+
+        // Emit progress last, as cancel could be called in there
+        if (_uploadState.file.size() != 0) {
+            emit commandProgress((float)(_uploadState.offset) / (float)_uploadState.file.size());
+        }
+    } else if (ackOrNak->hdr.opcode == MavlinkFTP::kRspNak) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _uploadComplete(tr("Upload failed") + ": " + _errorMsgFromNak(ackOrNak));
+    }
+}
+
+void FTPManager::_writeFileTimeout(void)
+{
+    if (++_uploadState.retryCount > _maxRetry) {
+        qCDebug(FTPManagerLog) << QString("_writeFileTimeout retries exceeded");
+        _uploadComplete(tr("Upload failed"));
+    } else {
+        // Try again
+        qCDebug(FTPManagerLog) << QString("_writeFileTimeout: retrying - retryCount(%1) offset(%2)").arg(_uploadState.retryCount).arg(_uploadState.offset);
+        _writeFileWorker(false /* firstReqeust */);
+    }
+}
+
+void FTPManager::_uploadTerminateBegin(void)
+{
+    _uploadState.retryCount = 0;
+
+    MavlinkFTP::Request request{};
+    request.hdr.session = _uploadState.sessionId;
+    request.hdr.opcode  = MavlinkFTP::kCmdTerminateSession;
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_uploadTerminateAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if (requestOpCode != MavlinkFTP::kCmdTerminateSession) {
+        qCDebug(FTPManagerLog) << "_uploadTerminateAckOrNak: Disregarding due to incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_uploadTerminateAckOrNak: Disregarding due to incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        _advanceStateMachine();
+    } else {
+        // The data has been written at this point, a failed close is only logged
+        qCDebug(FTPManagerLog) << "_uploadTerminateAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _advanceStateMachine();
+    }
+}
+
+void FTPManager::_uploadTerminateTimeout(void)
+{
+    if (++_uploadState.retryCount > _maxRetry) {
+        qCDebug(FTPManagerLog) << QString("_uploadTerminateTimeout retries exceeded");
+        _uploadComplete(tr("Upload failed"));
+    } else {
+        qCDebug(FTPManagerLog) << QString("_uploadTerminateTimeout: retrying - retryCount(%1)").arg(_uploadState.retryCount);
+        _expectedIncomingSeqNumber -= 2;
+
+        MavlinkFTP::Request request{};
+        request.hdr.session = _uploadState.sessionId;
+        request.hdr.opcode  = MavlinkFTP::kCmdTerminateSession;
+        _sendRequestExpectAck(&request);
+    }
+}
+
 bool FTPManager::_parseURI(uint8_t fromCompId, const QString& uri, QString& parsedURI, uint8_t& compId)
 {
     parsedURI   = uri;
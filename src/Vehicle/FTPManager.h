@@ -13,6 +13,8 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
 #include <QtCore/QTimer>
 #include <QtCore/QLoggingCategory>
 
@@ -52,6 +54,15 @@ class FTPManager : public QObject
     /// Signals listDirectoryComplete
     bool listDirectory(uint8_t fromCompId, const QString& fromURI);
 
+    /// Uploads the specified file.
+    ///     @param toCompId   Component id of the component to upload to. If toCompId is MAV_COMP_ID_ALL, then MAV_COMP_ID_AUTOPILOT1 is used.
+    ///     @param toURI      Fully qualified path for the file on the component. May be in the format "mftp://[;comp=<id>]..." where the component id
+    ///                       is specified. If component id is not specified, then the id set via toCompId is used.
+    ///     @param fromFile   Local file to upload
+    /// @return true: upload has started, false: error, no upload
+    /// Signals uploadComplete, commandProgress
+    bool upload(uint8_t toCompId, const QString& toURI, const QString& fromFile);
+
     /// Cancel the download operation
     /// This will emit downloadComplete() when done, and if there's currently a download in progress
     void cancelDownload();
@@ -61,6 +72,7 @@ class FTPManager : public QObject
 signals:
     void downloadComplete       (const QString& file, const QString& errorMsg);
     void listDirectoryComplete  (const QStringList& dirList, const QString& errorMsg);
+    void uploadComplete         (const QString& file, const QString& errorMsg);
 
     /// Signalled during a lengthy command to show progress
     ///     @param value Amount of progress: 0.0 = none, 1.0 = complete
@@ -85,11 +97,19 @@ private slots:
         uint32_t cBytesMissing;
     };
 
+    struct OutstandingRead_t {
+        uint32_t        offset;
+        uint32_t        cBytes;
+        int             retryCount;
+        QElapsedTimer   sentTimer;                      ///< Used for RTT sampling, only valid for first attempts
+    };
+
     struct DownloadState_t {
         uint8_t                 sessionId;
         uint32_t                expectedOffset;         ///< offset which should be coming next
         uint32_t                bytesWritten;
         QList<MissingData_t>    rgMissingData;
+        QHash<uint16_t, OutstandingRead_t> rgOutstandingReads; ///< Reads in flight while filling missing blocks, keyed by expected response sequence number
         QString                 fullPathOnVehicle;      ///< Fully qualified path to file on vehicle
         QDir                    toDir;                  ///< Directory to download file to
         QString                 fileName;               ///< Filename (no path) for download file
@@ -109,6 +129,25 @@ private slots:
             fullPathOnVehicle.clear();
             fileName.clear();
             rgMissingData.clear();
+            rgOutstandingReads.clear();
+            file.close();
+        }
+    };
+
+    struct UploadState_t {
+        uint8_t     sessionId;
+        uint32_t    offset;                 ///< offset of the next write
+        uint32_t    cBytesLastWrite;        ///< size of the write which is waiting for an ack
+        QString     fullPathOnVehicle;      ///< Fully qualified path to file on vehicle
+        QFile       file;
+        int         retryCount;
+
+        void reset() {
+            sessionId       = 0;
+            offset          = 0;
+            cBytesLastWrite = 0;
+            retryCount      = 0;
+            fullPathOnVehicle.clear();
             file.close();
         }
     };
@@ -154,7 +193,9 @@ private slots:
     void    _downloadCompleteNoError    (void) { _downloadComplete(QString()); }
     void    _downloadComplete           (const QString& errorMsg);
     void    _fillRequestDataWithString(MavlinkFTP::Request* request, const QString& str);
-    void    _fillMissingBlocksWorker    (bool firstRequest);
+    void    _fillMissingBlocksWorker    (void);
+    void    _sendMissingBlockRead       (uint32_t offset, uint32_t cBytes, int retryCount);
+    void    _dropMissingDataFrom        (uint32_t offset);
     void    _burstReadFileWorker        (bool firstRequest);
     void    _listDirectoryWorker        (bool firstRequest);
     bool    _parseURI                   (uint8_t fromCompId, const QString& uri, QString& parsedURI, uint8_t& compId);
@@ -167,15 +208,40 @@ private slots:
     void    _terminateSessionTimeout    (void);
     void    _terminateComplete          (void);
 
+    void    _createFileBegin            (void);
+    void    _createFileAckOrNak         (const MavlinkFTP::Request* ackOrNak);
+    void    _createFileTimeout          (void);
+    void    _writeFileBegin             (void);
+    void    _writeFileAckOrNak          (const MavlinkFTP::Request* ackOrNak);
+    void    _writeFileTimeout           (void);
+    void    _writeFileWorker            (bool firstRequest);
+    void    _uploadTerminateBegin       (void);
+    void    _uploadTerminateAckOrNak    (const MavlinkFTP::Request* ackOrNak);
+    void    _uploadTerminateTimeout     (void);
+    void    _uploadCompleteNoError      (void) { _uploadComplete(QString()); }
+    void    _uploadComplete             (const QString& errorMsg);
+
+    /// Updates the smoothed round trip time estimate and the ack/nak timeout derived from it (RFC 6298 style)
+    void    _updateRtt                  (qint64 rttMsecs);
+
     Vehicle*                _vehicle;
     uint8_t                 _ftpCompId = MAV_COMP_ID_AUTOPILOT1;
     QList<StateFunctions_t> _rgStateMachine;
     DownloadState_t         _downloadState;
     ListDirectoryState_t    _listDirectoryState;
+    UploadState_t           _uploadState;
     QTimer                  _ackOrNakTimeoutTimer;
     int                     _currentStateMachineIndex   = -1;
     uint16_t                _expectedIncomingSeqNumber  = 0;
-
-    static const int _ackOrNakTimeoutMsecs  = 1000;
-    static const int _maxRetry              = 3;
+    uint16_t                _lastOutgoingSeqNumber      = 0;
+    QElapsedTimer           _requestTimer;                      ///< Time since the last request was sent
+    bool                    _rttSamplePending           = false;///< false if the last request was a retry (Karn's algorithm)
+    double                  _srttMsecs                  = 0;    ///< Smoothed round trip time, 0 until the first sample
+    double                  _rttVarMsecs                = 0;    ///< Round trip time variation
+    int                     _minAckOrNakTimeoutMsecs;
+
+    static constexpr int _ackOrNakTimeoutMsecs      = 1000;     ///< Initial timeout until a round trip time has been measured
+    static constexpr int _maxAckOrNakTimeoutMsecs   = 5000;
+    static constexpr int _maxRetry                  = 3;
+    static constexpr int _maxOutstandingReads       = 8;        ///< Read requests in flight while filling missing blocks
 };
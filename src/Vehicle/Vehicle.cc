@@ -44,6 +44,7 @@
 #include "AppSettings.h"
 #include "FlyViewSettings.h"
 #include "StandardModes.h"
+#include "TelemetryLatency.h"
 #include "TerrainProtocolHandler.h"
 #include "TerrainQuery.h"
 #include "TrajectoryPoints.h"
@@ -459,6 +460,8 @@ void Vehicle::_mavlinkMessageReceived(LinkInterface* link, mavlink_message_t mes
         }
     }
 
+    TelemetryLatency::instance()->messageDispatched();
+
     // We give the link manager first whack since it it reponsible for adding new links
     _vehicleLinkManager->mavlinkMessageReceived(link, message);
 
@@ -1471,7 +1474,7 @@ void Vehicle::_handleRCChannels(mavlink_message_t& message)
     emit rcChannelsChanged(channels.chancount, pwmValues);
 }
 
-bool Vehicle::sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t message)
+bool Vehicle::sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t message, LinkInterface::WritePriority priority)
 {
     if (!link->isConnected()) {
         qCDebug(VehicleLog) << "sendMessageOnLinkThreadSafe" << link << "not connected!";
@@ -1485,7 +1488,7 @@ bool Vehicle::sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t
     uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
     int len = mavlink_msg_to_send_buffer(buffer, &message);
 
-    link->writeBytesThreadSafe((const char*)buffer, len);
+    link->writeBytesThreadSafe((const char*)buffer, len, priority);
     _messagesSent++;
     emit messagesSentChanged();
 
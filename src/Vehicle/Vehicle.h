@@ -108,6 +108,7 @@ class Vehicle : public VehicleFactGroup
     friend class SendMavCommandWithSignallingTest;  // Unit test
     friend class SendMavCommandWithHandlerTest;     // Unit test
     friend class RequestMessageTest;                // Unit test
+    friend class VehicleBenchmark;                  // Benchmark
     friend class GimbalController;                  // Allow GimbalController to call _addFactGroup
 
 public:
@@ -457,7 +458,7 @@ class Vehicle : public VehicleFactGroup
 
     /// Sends a message to the specified link
     /// @return true: message sent, false: Link no longer connected
-    bool sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t message);
+    bool sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t message, LinkInterface::WritePriority priority = LinkInterface::NormalPriority);
 
     /// Sends the specified messages multiple times to the vehicle in order to attempt to
     /// guarantee that it makes it to the vehicle.
@@ -12,9 +12,12 @@
 #include "FirmwareImage.h"
 #include "QGC.h"
 
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 #include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 
 QGC_LOGGING_CATEGORY(FirmwareUpgradeLog, "VehicleSetup.FirmwareUpgrade")
 QGC_LOGGING_CATEGORY(FirmwareUpgradeVerboseLog, "VehicleSetup.FirmwareUpgrade:verbose")
@@ -31,15 +34,16 @@ bool Bootloader::open(const QString portName)
 {
     qCDebug(FirmwareUpgradeLog) << "open:" << portName;
 
-    _port.setPortName   (portName);
-    _port.setBaudRate   (QSerialPort::Baud115200);
-    _port.setDataBits   (QSerialPort::Data8);
-    _port.setParity     (QSerialPort::NoParity);
-    _port.setStopBits   (QSerialPort::OneStop);
-    _port.setFlowControl(QSerialPort::NoFlowControl);
+    QSerialPort* serialPort = new QSerialPort(this);
+    serialPort->setPortName   (portName);
+    serialPort->setBaudRate   (QSerialPort::Baud115200);
+    serialPort->setDataBits   (QSerialPort::Data8);
+    serialPort->setParity     (QSerialPort::NoParity);
+    serialPort->setStopBits   (QSerialPort::OneStop);
+    serialPort->setFlowControl(QSerialPort::NoFlowControl);
 
-    if (!_port.open(QIODevice::ReadWrite)) {
-        _errorString = tr("Open failed on port %1: %2").arg(portName, _port.errorString());
+    if (!open(serialPort)) {
+        _errorString = tr("Open failed on port %1: %2").arg(portName, _errorString);
         return false;
     }
 
@@ -50,6 +54,49 @@ bool Bootloader::open(const QString portName)
     return true;
 }
 
+bool Bootloader::open(QIODevice* device)
+{
+    if (!device) {
+        _errorString = tr("No device");
+        return false;
+    }
+
+    if (_port) {
+        _port->close();
+        _port->deleteLater();
+    }
+    _port = device;
+    _port->setParent(this);
+
+    if (!_port->isOpen() && !_port->open(QIODevice::ReadWrite)) {
+        _errorString = _port->errorString();
+        return false;
+    }
+
+    return true;
+}
+
+void Bootloader::close(void)
+{
+    if (_port) {
+        _port->close();
+    }
+}
+
+void Bootloader::_flush(void)
+{
+    if (QSerialPort* serialPort = qobject_cast<QSerialPort*>(_port)) {
+        serialPort->flush();
+    }
+}
+
+void Bootloader::_setBaudRate(qint32 baudRate)
+{
+    if (QSerialPort* serialPort = qobject_cast<QSerialPort*>(_port)) {
+        serialPort->setBaudRate(baudRate);
+    }
+}
+
 QString Bootloader::_getNextLine(int timeoutMsecs)
 {
     QString         line;
@@ -59,8 +106,8 @@ QString Bootloader::_getNextLine(int timeoutMsecs)
     timeout.start();
     while (timeout.elapsed() < timeoutMsecs) {
         char oneChar;
-        _port.waitForReadyRead(100);
-        if (_port.read(&oneChar, 1) > 0) {
+        _port->waitForReadyRead(100);
+        if (_port->read(&oneChar, 1) > 0) {
             if (oneChar == '\r') {
                 foundCR = true;
                 continue;
@@ -86,15 +133,15 @@ bool Bootloader::getBoardInfo(uint32_t& bootloaderVersion, uint32_t& boardID, ui
             }
         } else {
             qCDebug(FirmwareUpgradeLog) << "Radio in normal mode";
-            _port.readAll();
-            _port.setBaudRate(QSerialPort::Baud57600);
+            _port->readAll();
+            _setBaudRate(QSerialPort::Baud57600);
             // Put radio into command mode
             _write("+++");
-            if (!_port.waitForReadyRead(2000)) {
+            if (!_port->waitForReadyRead(2000)) {
                 _errorString = tr("Unable to put radio into command mode +++");
                 goto Error;
             }
-            QByteArray bytes = _port.readAll();
+            QByteArray bytes = _port->readAll();
             if (!bytes.contains("OK")) {
                 _errorString = tr("Radio did not respond to command mode");
                 goto Error;
@@ -163,11 +210,11 @@ bool Bootloader::initFlashSequence(void)
 {
     if (_sikRadio && !_inBootloaderMode) {
         _write("AT&UPDATE\r\n");
-        if (!_port.waitForReadyRead(1500)) {
+        if (!_port->waitForReadyRead(1500)) {
             _errorString = tr("Unable to reboot radio (ready read)");
             return false;
         }
-        _port.setBaudRate(QSerialPort::Baud115200);
+        _setBaudRate(QSerialPort::Baud115200);
 
         if (!_sync()) {
             return false;
@@ -209,13 +256,13 @@ bool Bootloader::reboot(void)
     bool success;
     if (_sikRadio && !_inBootloaderMode) {
         qCDebug(FirmwareUpgradeLog) << "reboot ATZ";
-        _port.readAll();
+        _port->readAll();
         success = _write("ATZ\r\n");
     } else {
         qCDebug(FirmwareUpgradeLog) << "reboot";
         success = _write(PROTO_BOOT) && _write(PROTO_EOC);
     }
-    _port.flush();
+    _flush();
     if (success) {
         QThread::msleep(1000);
     }
@@ -229,9 +276,9 @@ bool Bootloader::_write(const char* data)
 
 bool Bootloader::_write(const uint8_t* data, qint64 maxSize)
 {
-    qint64 bytesWritten = _port.write((const char*)data, maxSize);
+    qint64 bytesWritten = _port->write((const char*)data, maxSize);
     if (bytesWritten == -1) {
-        _errorString = tr("Write failed: %1").arg(_port.errorString());
+        _errorString = tr("Write failed: %1").arg(_port->errorString());
         qWarning() << _errorString;
         return false;
     }
@@ -255,19 +302,19 @@ bool Bootloader::_read(uint8_t* data, qint64 cBytesExpected, int readTimeout)
     QElapsedTimer timeout;
 
     timeout.start();
-    while (_port.bytesAvailable() < cBytesExpected) {
+    while (_port->bytesAvailable() < cBytesExpected) {
         if (timeout.elapsed() > readTimeout) {
             _errorString = tr("Timeout waiting for bytes to be available");
             return false;
         }
-        _port.waitForReadyRead(100);
+        _port->waitForReadyRead(100);
     }
 
     qint64 bytesRead;
-    bytesRead = _port.read((char *)data, cBytesExpected);
+    bytesRead = _port->read((char *)data, cBytesExpected);
 
     if (bytesRead != cBytesExpected) {
-        _errorString = tr("Read failed: error: %1").arg(_port.errorString());
+        _errorString = tr("Read failed: error: %1").arg(_port->errorString());
         return false;
     }
 
@@ -340,7 +387,7 @@ bool Bootloader::_sendCommand(const uint8_t cmd, int responseTimeout)
     if (!_write(buf, 2)) {
         goto Error;
     }
-    _port.flush();
+    _flush();
 
     if (!_getCommandResponse(responseTimeout)) {
         goto Error;
@@ -353,6 +400,67 @@ bool Bootloader::_sendCommand(const uint8_t cmd, int responseTimeout)
     return false;
 }
 
+/// Sends a command without waiting for its response, so that several commands are in flight on the port at once.
+/// Waits for the oldest responses once the pipeline window is full.
+///     @param address Address the command applies to, for error reporting
+///     @param progBytes Image bytes programmed by the command, for progress reporting
+bool Bootloader::_pipelineCommand(const QByteArray& command, uint32_t address, int progBytes)
+{
+    if (!_write(command)) {
+        _pendingCommands.clear();
+        _errorString = tr("Flash failed: %1 at address 0x%2").arg(_errorString).arg(address, 8, 16, QLatin1Char('0'));
+        return false;
+    }
+    _pendingCommands.enqueue({ static_cast<uint8_t>(command.at(0)), address, progBytes });
+
+    return _pipelineDrain(_pipelineWindow - 1);
+}
+
+/// Reads command responses until no more than maxPending commands are in flight
+bool Bootloader::_pipelineDrain(int maxPending)
+{
+    if (_pendingCommands.count() > maxPending) {
+        _flush();
+    }
+
+    while (_pendingCommands.count() > maxPending) {
+        const PendingCommand pending = _pendingCommands.dequeue();
+
+        if (!_getCommandResponse()) {
+            // Whatever is still in flight was sent after the failed command, the flash sequence is over anyway
+            _pendingCommands.clear();
+            if (pending.command == PROTO_LOAD_ADDRESS) {
+                _errorString = tr("Unable to set flash start address: 0x%1").arg(pending.address, 8, 16, QLatin1Char('0'));
+            } else {
+                _errorString = tr("Flash failed: %1 at address 0x%2").arg(_errorString).arg(pending.address, 8, 16, QLatin1Char('0'));
+            }
+            return false;
+        }
+
+        if (pending.progBytes > 0) {
+            _pipelineBytesDone += pending.progBytes;
+            emit updateProgress(_pipelineBytesDone, _pipelineBytesTotal);
+        }
+    }
+
+    return true;
+}
+
+/// CRC of the image as the bootloader calculates it: over the entire flash size with the remainder filled with 0xFF
+uint32_t Bootloader::_calcImageCRC(const QByteArray& image, uint32_t flashSize)
+{
+    uint32_t crc = QGC::crc32(reinterpret_cast<const uint8_t*>(image.constData()), image.size(), 0);
+
+    const QByteArray fill(256, static_cast<char>(0xFF));
+    for (uint32_t bytes = image.size(); bytes < flashSize; ) {
+        const uint32_t fillBytes = qMin(static_cast<uint32_t>(fill.size()), flashSize - bytes);
+        crc = QGC::crc32(reinterpret_cast<const uint8_t*>(fill.constData()), fillBytes, crc);
+        bytes += fillBytes;
+    }
+
+    return crc;
+}
+
 bool Bootloader::_binProgram(const FirmwareImage* image)
 {
     QFile firmwareFile(image->binFilename());
@@ -360,70 +468,57 @@ bool Bootloader::_binProgram(const FirmwareImage* image)
         _errorString = tr("Unable to open firmware file %1: %2").arg(image->binFilename(), firmwareFile.errorString());
         return false;
     }
-    uint32_t imageSize = (uint32_t)firmwareFile.size();
+    const QByteArray imageBytes = firmwareFile.readAll();
+    if (imageBytes.size() != firmwareFile.size()) {
+        _errorString = tr("Firmware file read failed: %1").arg(firmwareFile.errorString());
+        return false;
+    }
+    firmwareFile.close();
+    const uint32_t imageSize = static_cast<uint32_t>(imageBytes.size());
 
-    uint8_t imageBuf[PROG_MULTI_MAX];
-    uint32_t bytesSent = 0;
+    // Calculate the CRC in the background so we can test it after the board is flashed
     _imageCRC = 0;
+    _imageCRCFuture = QtConcurrent::run(&Bootloader::_calcImageCRC, imageBytes, _boardFlashSize);
 
     Q_ASSERT(PROG_MULTI_MAX <= 0x8F);
 
-    while (bytesSent < imageSize) {
-        int bytesToSend = imageSize - bytesSent;
-        if (bytesToSend > (int)sizeof(imageBuf)) {
-            bytesToSend = (int)sizeof(imageBuf);
-        }
+    _pipelineWindow = _sikRadio ? 1 : _progMultiWindow;
+    _pipelineBytesDone = 0;
+    _pipelineBytesTotal = imageSize;
+    _pendingCommands.clear();
 
-        Q_ASSERT((bytesToSend % 4) == 0);
+    QByteArray command;
+    for (uint32_t bytesSent = 0; bytesSent < imageSize; ) {
+        const int bytesToSend = qMin(static_cast<int>(imageSize - bytesSent), static_cast<int>(PROG_MULTI_MAX));
 
-        int bytesRead = firmwareFile.read((char *)imageBuf, bytesToSend);
-        if (bytesRead == -1 || bytesRead != bytesToSend) {
-            _errorString = tr("Firmware file read failed: %1").arg(firmwareFile.errorString());
-            return false;
-        }
+        Q_ASSERT((bytesToSend % 4) == 0);
 
-        Q_ASSERT(bytesToSend <= 0x8F);
+        command.clear();
+        command.append(static_cast<char>(PROTO_PROG_MULTI));
+        command.append(static_cast<char>(bytesToSend));
+        command.append(imageBytes.constData() + bytesSent, bytesToSend);
+        command.append(static_cast<char>(PROTO_EOC));
 
-        bool failed = true;
-        if (_write(PROTO_PROG_MULTI) &&
-                _write((uint8_t)bytesToSend) &&
-                _write(imageBuf, bytesToSend) &&
-                _write(PROTO_EOC)) {
-            if (_getCommandResponse()) {
-                failed = false;
-            }
-        }
-        if (failed) {
-            _errorString = tr("Flash failed: %1 at address 0x%2").arg(_errorString).arg(bytesSent, 8, 16, QLatin1Char('0'));
+        if (!_pipelineCommand(command, bytesSent, bytesToSend)) {
             return false;
         }
 
         bytesSent += bytesToSend;
-
-        // Calculate the CRC now so we can test it after the board is flashed.
-        _imageCRC = QGC::crc32((uint8_t *)imageBuf, bytesToSend, _imageCRC);
-
-        emit updateProgress(bytesSent, imageSize);
-    }
-    firmwareFile.close();
-
-    // We calculate the CRC using the entire flash size, filling the remainder with 0xFF.
-    while (bytesSent < _boardFlashSize) {
-        const uint8_t fill = 0xFF;
-        _imageCRC = QGC::crc32(&fill, 1, _imageCRC);
-        bytesSent++;
     }
 
-    return true;
+    return _pipelineDrain(0);
 }
 
 bool Bootloader::_ihxProgram(const FirmwareImage* image)
 {
-    uint32_t imageSize = image->imageSize();
-    uint32_t bytesSent = 0;
+    // SiK radio bootloaders run on a uart without flow control, so they only get one command at a time
+    _pipelineWindow = _sikRadio ? 1 : _progMultiWindow;
+    _pipelineBytesDone = 0;
+    _pipelineBytesTotal = image->imageSize();
+    _pendingCommands.clear();
 
+    QByteArray command;
     for (uint16_t index=0; index<image->ihxBlockCount(); index++) {
-        bool        failed;
         uint16_t    flashAddress;
         QByteArray  bytes;
 
@@ -436,60 +531,36 @@ bool Bootloader::_ihxProgram(const FirmwareImage* image)
 
         // Set flash address
 
-        failed = true;
-        if (_write(PROTO_LOAD_ADDRESS) &&
-                _write(flashAddress & 0xFF) &&
-                _write((flashAddress >> 8) & 0xFF) &&
-                _write(PROTO_EOC)) {
-            _port.flush();
-            if (_getCommandResponse()) {
-                failed = false;
-            }
-        }
+        command.clear();
+        command.append(static_cast<char>(PROTO_LOAD_ADDRESS));
+        command.append(static_cast<char>(flashAddress & 0xFF));
+        command.append(static_cast<char>((flashAddress >> 8) & 0xFF));
+        command.append(static_cast<char>(PROTO_EOC));
 
-        if (failed) {
-            _errorString = tr("Unable to set flash start address: 0x%2").arg(flashAddress, 8, 16, QLatin1Char('0'));
+        if (!_pipelineCommand(command, flashAddress, 0)) {
             return false;
         }
 
         // Flash
 
-        int bytesIndex = 0;
-        uint16_t bytesLeftToWrite = bytes.length();
+        for (int bytesIndex = 0; bytesIndex < bytes.length(); ) {
+            const int bytesToWrite = qMin(static_cast<int>(bytes.length() - bytesIndex), static_cast<int>(PROG_MULTI_MAX));
 
-        while (bytesLeftToWrite > 0) {
-            uint8_t bytesToWrite;
+            command.clear();
+            command.append(static_cast<char>(PROTO_PROG_MULTI));
+            command.append(static_cast<char>(bytesToWrite));
+            command.append(bytes.constData() + bytesIndex, bytesToWrite);
+            command.append(static_cast<char>(PROTO_EOC));
 
-            if (bytesLeftToWrite > PROG_MULTI_MAX) {
-                bytesToWrite = PROG_MULTI_MAX;
-            } else {
-                bytesToWrite = bytesLeftToWrite;
-            }
-
-            failed = true;
-            if (_write(PROTO_PROG_MULTI) &&
-                    _write(bytesToWrite) &&
-                    _write(&((uint8_t *)bytes.data())[bytesIndex], bytesToWrite) &&
-                    _write(PROTO_EOC)) {
-                _port.flush();
-                if (_getCommandResponse()) {
-                    failed = false;
-                }
-            }
-            if (failed) {
-                _errorString = tr("Flash failed: %1 at address 0x%2").arg(_errorString).arg(flashAddress, 8, 16, QLatin1Char('0'));
+            if (!_pipelineCommand(command, flashAddress, bytesToWrite)) {
                 return false;
             }
 
             bytesIndex += bytesToWrite;
-            bytesLeftToWrite -= bytesToWrite;
-            bytesSent += bytesToWrite;
-
-            emit updateProgress(bytesSent, imageSize);
         }
     }
 
-    return true;
+    return _pipelineDrain(0);
 }
 
 bool Bootloader::verify(const FirmwareImage* image)
@@ -558,7 +629,7 @@ bool Bootloader::_binVerifyBytes(const FirmwareImage* image)
         if (_write(PROTO_READ_MULTI) &&
                 _write((uint8_t)bytesToRead) &&
                 _write(PROTO_EOC)) {
-            _port.flush();
+            _flush();
             if (_read(readBuf, bytesToRead)) {
                 if (_getCommandResponse()) {
                     failed = false;
@@ -613,7 +684,7 @@ bool Bootloader::_ihxVerifyBytes(const FirmwareImage* image)
                 _write(readAddress & 0xFF) &&
                 _write((readAddress >> 8) & 0xFF) &&
                 _write(PROTO_EOC)) {
-            _port.flush();
+            _flush();
             if (_getCommandResponse()) {
                 failed = false;
             }
@@ -643,7 +714,7 @@ bool Bootloader::_ihxVerifyBytes(const FirmwareImage* image)
             if (_write(PROTO_READ_MULTI) &&
                     _write(bytesToRead) &&
                     _write(PROTO_EOC)) {
-                _port.flush();
+                _flush();
                 if (_read(readBuf, bytesToRead)) {
                     if (_getCommandResponse()) {
                         failed = false;
@@ -687,7 +758,7 @@ bool Bootloader::_verifyCRC(void)
 
     bool failed = true;
     if (_write(buf, 2)) {
-        _port.flush();
+        _flush();
         if (_read((uint8_t*)&flashCRC, sizeof(flashCRC), _verifyTimeout)) {
             if (_getCommandResponse()) {
                 failed = false;
@@ -698,6 +769,9 @@ bool Bootloader::_verifyCRC(void)
         return false;
     }
 
+    if (!_imageCRCFuture.isCanceled()) {
+        _imageCRC = _imageCRCFuture.result();
+    }
     if (_imageCRC != flashCRC) {
         _errorString = tr("CRC mismatch: board(0x%1) file(0x%2)").arg(flashCRC, 4, 16, QLatin1Char('0')).arg(_imageCRC, 4, 16, QLatin1Char('0'));
         return false;
@@ -721,7 +795,7 @@ bool Bootloader::_syncWorker(void)
 bool Bootloader::_sync(void)
 {
     // Sometimes getting sync is flaky, try 3 times
-    _port.readAll();
+    _port->readAll();
     bool success = false;
     for (int i=0; i<3; i++) {
         success = _syncWorker();
@@ -740,7 +814,7 @@ bool Bootloader::_get3DRRadioBoardId(uint32_t& boardID)
     if (!_write(buf, sizeof(buf))) {
         goto Error;
     }
-    _port.flush();
+    _flush();
 
     if (!_read((uint8_t*)buf, 2)) {
         goto Error;
@@ -760,3 +834,51 @@ bool Bootloader::_get3DRRadioBoardId(uint32_t& boardID)
     _errorString.prepend(tr("Get Board Id: "));
     return false;
 }
+
+QList<Bootloader::FlashResult> Bootloader::flashBoards(const QStringList& portNames, const FirmwareImage* image, const DeviceFactory& deviceFactory)
+{
+    // Flashing is almost entirely spent waiting on the ports, so use a thread per board instead of the cpu bound global pool
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(qMax(1, static_cast<int>(portNames.count())));
+
+    const std::function<FlashResult(const QString&)> flashBoard = [image, deviceFactory](const QString& portName) {
+        FlashResult result;
+        result.portName = portName;
+
+        Bootloader bootloader(false /* sikRadio */);
+        const bool opened = deviceFactory ? bootloader.open(deviceFactory(portName)) : bootloader.open(portName);
+        if (opened) {
+            uint32_t bootloaderVersion;
+            uint32_t boardID;
+            uint32_t flashSize;
+            if (!bootloader.getBoardInfo(bootloaderVersion, boardID, flashSize)) {
+                result.errorString = bootloader.errorString();
+            } else if (boardID != image->boardId()) {
+                // Boards found on other ports may not be the type the image was loaded for, check before erasing
+                result.errorString = tr("Board id %1 does not match the board id %2 the image was loaded for").arg(boardID).arg(image->boardId());
+            } else if ((flashSize != 0) && (image->imageSize() > flashSize)) {
+                result.errorString = tr("Image size of %1 is too large for board flash size %2").arg(image->imageSize()).arg(flashSize);
+            } else {
+                result.success = bootloader.initFlashSequence() &&
+                        bootloader.erase() &&
+                        bootloader.program(image) &&
+                        bootloader.verify(image);   // verify reboots the board
+                if (!result.success) {
+                    result.errorString = bootloader.errorString();
+                }
+            }
+            if (!result.success) {
+                (void) bootloader.reboot();
+            }
+            bootloader.close();
+        } else {
+            result.errorString = bootloader.errorString();
+        }
+
+        qCDebug(FirmwareUpgradeLog) << "flashBoards:" << portName << (result.success ? "complete" : result.errorString);
+
+        return result;
+    };
+
+    return QtConcurrent::mapped(&threadPool, portNames, flashBoard).results();
+}
@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <QtCore/QFuture>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
+
+#include <functional>
 
 #ifdef Q_OS_ANDROID
 #include "qserialport.h"
@@ -22,6 +26,7 @@ Q_DECLARE_LOGGING_CATEGORY(FirmwareUpgradeLog)
 Q_DECLARE_LOGGING_CATEGORY(FirmwareUpgradeVerboseLog)
 
 class FirmwareImage;
+class QIODevice;
 
 /// Bootloader Utility routines. Works with PX4 and 3DR Radio bootloaders.
 class Bootloader : public QObject
@@ -34,7 +39,10 @@ class Bootloader : public QObject
     QString errorString(void) { return _errorString; }
 
     bool open               (const QString portName);
-    void close              (void) { _port.close(); }
+    /// Uses an already created device in place of a serial port, used with serial port stand-ins in unit tests.
+    /// Takes ownership of the device.
+    bool open               (QIODevice* device);
+    void close              (void);
     bool getBoardInfo       (uint32_t& bootloaderVersion, uint32_t& boardID, uint32_t& flashSize);
     bool initFlashSequence  (void);
     bool erase              (void);
@@ -50,6 +58,24 @@ class Bootloader : public QObject
     static const int boardIDPX4FMUV2 = 9;        ///< PX4 V2 board, as from USB PID
     static const int boardIDPX4FMUV3 = 255;
 
+    struct FlashResult {
+        QString portName;
+        bool    success = false;
+        QString errorString;
+    };
+
+    /// Creates the device for a port name in place of a serial port. Called on the thread which flashes the board.
+    using DeviceFactory = std::function<QIODevice*(const QString& portName)>;
+
+    /// Erases, programs and verifies the same image on several PX4 boards of the same type at once. Each board is
+    /// flashed from its own thread so the total time is that of the slowest board instead of the sum of all of them.
+    /// Boards whose id does not match the one the image was loaded for, or whose flash is too small for the image, are
+    /// rejected before they are erased. Blocks until all boards are done.
+    /// API only for now: the firmware upgrade page flashes a single board through FirmwareUpgradeController, this is
+    /// meant for tools which program several boards, e.g. on a bench.
+    ///     @param deviceFactory Optional factory for the port devices, serial ports are used if not set
+    static QList<FlashResult> flashBoards(const QStringList& portNames, const FirmwareImage* image, const DeviceFactory& deviceFactory = DeviceFactory());
+
 signals:
     /// @brief Signals progress indicator for long running bootloader utility routines
     void updateProgress(int curr, int total);
@@ -59,6 +85,7 @@ class Bootloader : public QObject
     bool    _syncWorker         (void);
     bool    _binProgram         (const FirmwareImage* image);
     bool    _ihxProgram         (const FirmwareImage* image);
+    bool    _write              (const QByteArray& data) { return _write(reinterpret_cast<const uint8_t*>(data.constData()), data.size()); }
     bool    _write              (const uint8_t* data, qint64 maxSize);
     bool    _write              (const uint8_t byte);
     bool    _write              (const char* data);
@@ -72,6 +99,12 @@ class Bootloader : public QObject
     bool    _verifyCRC          (void);
     QString _getNextLine        (int timeoutMsecs);
     bool    _get3DRRadioBoardId (uint32_t& boardID);
+    void    _flush              (void);
+    void    _setBaudRate        (qint32 baudRate);
+    bool    _pipelineCommand    (const QByteArray& command, uint32_t address, int progBytes);
+    bool    _pipelineDrain      (int maxPending);
+
+    static uint32_t _calcImageCRC(const QByteArray& image, uint32_t flashSize);
 
     enum {
         // protocol bytes
@@ -108,13 +141,25 @@ class Bootloader : public QObject
         READ_MULTI_MAX		=   0x28    ///< read size for PROTO_READ_MULTI, must be multiple of 4. Sik Radio max size is 0x28
     };
 
-    QSerialPort _port;
+    /// Command sent without waiting for its response yet
+    struct PendingCommand {
+        uint8_t     command;
+        uint32_t    address;
+        int         progBytes;  ///< Image bytes programmed by the command
+    };
+
+    QIODevice*  _port               = nullptr;
     bool        _sikRadio           = false;
     bool        _inBootloaderMode   = false;    ///< true: board is in bootloader mode, false: special case for SiK Radio, board is in command mode
     uint32_t    _boardID            = 0;        ///< board id for currently connected board
     uint32_t    _boardFlashSize     = 0;        ///< flash size for currently connected board
     uint32_t    _bootloaderVersion  = 0;        ///< Bootloader version
     uint32_t    _imageCRC           = 0;        ///< CRC for image in currently selected firmware file
+    QFuture<uint32_t> _imageCRCFuture;          ///< _imageCRC being calculated in the background while programming
+    QQueue<PendingCommand> _pendingCommands;    ///< Commands in flight, oldest first
+    int         _pipelineWindow     = 1;        ///< Max commands in flight
+    uint32_t    _pipelineBytesDone  = 0;        ///< Image bytes acknowledged by the bootloader
+    uint32_t    _pipelineBytesTotal = 0;
     QString     _firmwareFilename;              ///< Currently selected firmware file to flash
     QString     _errorString;                   ///< Last error
 
@@ -125,4 +170,5 @@ class Bootloader : public QObject
     static const int _responseTimeout                   = 2000;     ///< Msecs to wait for command response bytes
     static const int _flashSizeSmall                    = 1032192;  ///< Flash size for boards with silicon error
     static const int _bootloaderVersionV2CorrectFlash   = 5;        ///< Anything below this bootloader version on V2 boards cannot trust flash size
+    static const int _progMultiWindow                   = 4;        ///< PROTO_PROG_MULTI commands in flight for PX4 bootloaders, keeps the bytes in flight below the bootloader receive buffer size
 };
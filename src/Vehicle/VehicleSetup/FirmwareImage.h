@@ -37,6 +37,9 @@ class FirmwareImage : public QObject
     /// Returns the number of bytes in the image.
     uint32_t imageSize(void) const { return _imageSize; }
 
+    /// @return Board id the image was loaded for
+    uint32_t boardId(void) const { return _boardId; }
+
     /// @return true: image format is .bin
     bool imageIsBinFormat(void) const { return _binFormat; }
 
@@ -25,6 +25,7 @@
 #include "QGCLoggingCategory.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QStandardPaths>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -661,15 +662,22 @@ void FirmwareUpgradeController::_ardupilotManifestDownloadComplete(QString remot
 
         qCDebug(FirmwareUpgradeLog) << "_ardupilotManifestDownloadFinished" << remoteFile << localFile;
 
-        QString jsonFileName(QDir(QStandardPaths::writableLocation(QStandardPaths::TempLocation)).absoluteFilePath("ArduPilot.Manifest.json"));
-        if (!QGCZlib::inflateGzipFile(localFile, jsonFileName)) {
+        // Inflate straight into memory, the manifest is only needed for parsing
+        QFile manifestFile(localFile);
+        if (!manifestFile.open(QIODevice::ReadOnly)) {
+            qCWarning(FirmwareUpgradeLog) << "Open of compressed manifest failed" << localFile << manifestFile.errorString();
+            return;
+        }
+        bool ok = false;
+        const QByteArray jsonBytes = QGCZlib::inflateGzip(manifestFile.readAll(), &ok);
+        if (!ok) {
             qCWarning(FirmwareUpgradeLog) << "Inflate of compressed manifest failed" << localFile;
             return;
         }
 
         QString         errorString;
         QJsonDocument   doc;
-        if (!JsonHelper::isJsonFile(jsonFileName, doc, errorString)) {
+        if (!JsonHelper::isJsonFile(jsonBytes, doc, errorString)) {
             qCWarning(FirmwareUpgradeLog) << "Json file read failed" << errorString;
             return;
         }
@@ -11,8 +11,19 @@
 #include "SettingsManager.h"
 #include "Viewer3DSettings.h"
 #include "OsmParserThread.h"
+#include "ComponentInformationCache.h"
 #include "earcut.hpp"
 
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QStandardPaths>
+
+#include <utility>
+
 typedef union {
     uint array[3];
 
@@ -63,11 +74,14 @@ void OsmParser::resetGpsRef()
 void OsmParser::setBuildingLevelHeight(QVariant value)
 {
     _buildingLevelHeight = value.toFloat();
+    _cachedVertexData.clear();
     emit buildingLevelHeightChanged();
 }
 
 void OsmParser::osmParserFinished(bool isValid)
 {
+    _parsePending = false;
+    _buildingsParsed = isValid;
     if(isValid){
         if(!_gpsRefSet) {
             setGpsRef(_osmParserWorker->gpsRefPoint);
@@ -83,95 +97,264 @@ void OsmParser::osmParserFinished(bool isValid)
 
 void OsmParser::parseOsmFile(QString filePath)
 {
-    _osmParserWorker->mapNodes.clear();
     _osmParserWorker->mapBuildings.clear();
     _gpsRefSet = false;
     _mapLoadedFlag = false;
+    _buildingsParsed = false;
+    _filePath = filePath;
+    _fileCacheKey = fileCacheKey(filePath);
     resetGpsRef();
 
+    // The cached mesh carries the map reference and bounds, so the OSM file is only parsed on a miss
+    MeshCacheHeader_t header{};
+    const QString cacheTag = meshCacheTag();
+    _cachedVertexData = cacheTag.isEmpty() ? QByteArray() : loadCachedMesh(cacheTag, &header);
+    if(!_cachedVertexData.isEmpty()){
+        _coordinateMin = QGeoCoordinate(header.coordinateMin[0], header.coordinateMin[1], header.coordinateMin[2]);
+        _coordinateMax = QGeoCoordinate(header.coordinateMax[0], header.coordinateMax[1], header.coordinateMax[2]);
+        setGpsRef(QGeoCoordinate(header.gpsRef[0], header.gpsRef[1], header.gpsRef[2]));
+        _mapLoadedFlag = true;
+        qDebug() << "OSM map loaded from the building mesh cache" << filePath;
+        emit mapChanged();
+        return;
+    }
+
+    _parsePending = true;
     _osmParserWorker->start(filePath);
 }
 
 QByteArray OsmParser::buildingToMesh()
 {
-    QByteArray vertexData;
+    QElapsedTimer meshTimer;
+    meshTimer.start();
 
-    for (auto ii = _osmParserWorker->mapBuildings.begin(), end = _osmParserWorker->mapBuildings.end(); ii != end; ++ii) {
-        float bld_height = 0;
-        // std::vector<std::array<float, 2> > bld_points;
-        // std::vector<std::vector<std::array<float, 2> > > polygon;
+    if(!_cachedVertexData.isEmpty()){
+        return std::exchange(_cachedVertexData, QByteArray());
+    }
 
-        std::vector<std::array<float, 2> > all_bld_points;
-        std::vector<std::array<float, 2> > bld_points;
-        std::vector<std::vector<std::array<float, 2> > > polygon;
+    const QString cacheTag = meshCacheTag();
+    if(!cacheTag.isEmpty()){
+        const QByteArray cachedVertexData = loadCachedMesh(cacheTag);
+        if(!cachedVertexData.isEmpty()){
+            qDebug() << "Building mesh loaded from cache in" << meshTimer.elapsed() << "ms";
+            return cachedVertexData;
+        }
+    }
+
+    if(!_buildingsParsed){
+        // The map came from the mesh cache, another building level height needs the buildings themselves
+        if(!_parsePending && !_filePath.isEmpty()){
+            _parsePending = true;
+            _osmParserWorker->start(_filePath);
+        }
+        return QByteArray();
+    }
+
+    // Each building is triangulated independently across the thread pool
+    struct BuildingMesh_t {
+        const OsmParserThread::BuildingType_t* building;
         std::vector<QVector3D> triangulated_mesh;
+    };
+    std::vector<BuildingMesh_t> buildingMeshes;
+    buildingMeshes.reserve(_osmParserWorker->mapBuildings.size());
+    for (auto ii = _osmParserWorker->mapBuildings.cbegin(), end = _osmParserWorker->mapBuildings.cend(); ii != end; ++ii) {
+        buildingMeshes.push_back({&ii.value(), {}});
+    }
 
-        //        bld_height = (ii.value().height >= ii.value().levels * _buildingLevelHeight)?(ii.value().height):(ii.value().levels * _buildingLevelHeight);
+    const float buildingLevelHeight = _buildingLevelHeight;
+    QtConcurrent::blockingMap(buildingMeshes, [this, buildingLevelHeight](BuildingMesh_t& buildingMesh) {
+        buildingMesh.triangulated_mesh = triangulateBuilding(*buildingMesh.building, buildingLevelHeight);
+    });
 
-        if(ii.value().height > 0){
-            bld_height = ii.value().height;
-        }else if(ii.value().levels > 0){
-            bld_height = (float)(ii.value().levels) * _buildingLevelHeight;
-        }else{
-            continue;
-        }
+    // Pack all meshes into a single vertex buffer
+    size_t vertexCount = 0;
+    for(const BuildingMesh_t& buildingMesh : buildingMeshes){
+        vertexCount += buildingMesh.triangulated_mesh.size();
+    }
 
-        for(unsigned int jj=0; jj<ii.value().points_local.size(); jj++) {
-            bld_points.push_back({ii.value().points_local[jj].x(), ii.value().points_local[jj].y()});
-            all_bld_points.push_back({ii.value().points_local[jj].x(), ii.value().points_local[jj].y()});
+    QByteArray vertexData(vertexCount * 3 * sizeof(float), Qt::Initialization::Uninitialized);
+    float *p = reinterpret_cast<float *>(vertexData.data());
+    for(const BuildingMesh_t& buildingMesh : buildingMeshes){
+        for(const QVector3D& vertex : buildingMesh.triangulated_mesh){
+            *p++ = vertex.x(); *p++ = vertex.y(); *p++ = vertex.z();
         }
+    }
+
+    qDebug() << buildingMeshes.size() << "buildings triangulated in" << meshTimer.elapsed() << "ms";
+
+    if(!cacheTag.isEmpty() && !vertexData.isEmpty()){
+        saveCachedMesh(cacheTag, vertexData);
+    }
+
+    return vertexData;
+}
+
+std::vector<QVector3D> OsmParser::triangulateBuilding(const OsmParserThread::BuildingType_t& building, float buildingLevelHeight)
+{
+    float bld_height = 0;
+    std::vector<std::array<float, 2> > all_bld_points;
+    std::vector<std::array<float, 2> > bld_points;
+    std::vector<std::vector<std::array<float, 2> > > polygon;
+    std::vector<QVector3D> triangulated_mesh;
+
+    if(building.height > 0){
+        bld_height = building.height;
+    }else if(building.levels > 0){
+        bld_height = (float)(building.levels) * buildingLevelHeight;
+    }else{
+        return triangulated_mesh;
+    }
+
+    for(unsigned int jj=0; jj<building.points_local.size(); jj++) {
+        bld_points.push_back({building.points_local[jj].x(), building.points_local[jj].y()});
+        all_bld_points.push_back({building.points_local[jj].x(), building.points_local[jj].y()});
+    }
+    polygon.push_back(bld_points);
+
+    bld_points.clear();
+    for(unsigned int jj=0; jj<building.points_local_inner.size(); jj++) {
+        bld_points.push_back({building.points_local_inner[jj].x(), building.points_local_inner[jj].y()});
+        all_bld_points.push_back({building.points_local_inner[jj].x(), building.points_local_inner[jj].y()});
+    }
+    if(bld_points.size() > 0){
         polygon.push_back(bld_points);
+    }
 
-        bld_points.clear();
-        for(unsigned int jj=0; jj<ii.value().points_local_inner.size(); jj++) {
-            bld_points.push_back({ii.value().points_local_inner[jj].x(), ii.value().points_local_inner[jj].y()});
-            all_bld_points.push_back({ii.value().points_local_inner[jj].x(), ii.value().points_local_inner[jj].y()});
-        }
-        if(bld_points.size() > 0){
-            polygon.push_back(bld_points);
-        }
+    std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(polygon);
+
+    for(uint i_i=0; i_i<indices.size(); i_i+=3) {
+        // mesh for roof
+        uint n_idx = indices[i_i];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
+        n_idx = indices[i_i+1];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
+        n_idx = indices[i_i+2];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
+
+        // mesh for floor
+        n_idx = indices[i_i+2];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
+        n_idx = indices[i_i+1];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
+        n_idx = indices[i_i];
+        triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
+    }
 
-        std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(polygon);
-
-        for(uint i_i=0; i_i<indices.size(); i_i+=3) {
-            // mesh for roof
-            uint n_idx = indices[i_i];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
-            n_idx = indices[i_i+1];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
-            n_idx = indices[i_i+2];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], bld_height));
-
-            // mesh for floor
-            n_idx = indices[i_i+2];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
-            n_idx = indices[i_i+1];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
-            n_idx = indices[i_i];
-            triangulated_mesh.push_back(QVector3D(all_bld_points[n_idx][0], all_bld_points[n_idx][1], 0));
-        }
+    if(bld_height > 0) {
+        trianglateWallsExtrudedPolygon(triangulated_mesh, building.points_local, bld_height, 0, 0); // mesh for wall outside
+        trianglateWallsExtrudedPolygon(triangulated_mesh, building.points_local, bld_height, 1, 0);// mesh for wall inside
 
-        if(bld_height > 0) {
-            trianglateWallsExtrudedPolygon(triangulated_mesh, ii.value().points_local, bld_height, 0, 0); // mesh for wall outside
-            trianglateWallsExtrudedPolygon(triangulated_mesh, ii.value().points_local, bld_height, 1, 0);// mesh for wall inside
+        trianglateWallsExtrudedPolygon(triangulated_mesh, building.points_local_inner, bld_height, 0, 0); // mesh for wall outside
+        trianglateWallsExtrudedPolygon(triangulated_mesh, building.points_local_inner, bld_height, 1, 0);// mesh for wall inside
+    }
 
-            trianglateWallsExtrudedPolygon(triangulated_mesh, ii.value().points_local_inner, bld_height, 0, 0); // mesh for wall outside
-            trianglateWallsExtrudedPolygon(triangulated_mesh, ii.value().points_local_inner, bld_height, 1, 0);// mesh for wall inside
-        }
+    return triangulated_mesh;
+}
 
-        QByteArray vertexData_tmp(triangulated_mesh.size() * 3 * sizeof(float), Qt::Initialization::Uninitialized);
-        float *p = reinterpret_cast<float *>(vertexData_tmp.data());
+QString OsmParser::meshCacheTag() const
+{
+    // The mesh only depends on the OSM file and the building level height
+    if(_fileCacheKey.isEmpty()){
+        return QString();
+    }
+    return QStringLiteral("%1_%2_v%3").arg(_fileCacheKey).arg(_buildingLevelHeight).arg(kMeshCacheVersion);
+}
 
-        for(uint i_m=0; i_m<triangulated_mesh.size(); i_m++) {
-            *p++ =  (float)triangulated_mesh[i_m].x(); *p++ =  (float)triangulated_mesh[i_m].y(); *p++ =  (float)triangulated_mesh[i_m].z();
-        }
+QString OsmParser::fileCacheKey(const QString& filePath)
+{
+    const QFileInfo fileInfo(OsmParserThread::localFilePath(filePath));
+    if(!fileInfo.isFile()){
+        return QString();
+    }
+
+    // Path, size and modification time identify the file without reading it
+    const QByteArray fileId = fileInfo.absoluteFilePath().toUtf8() + '|' + QByteArray::number(fileInfo.size()) + '|' +
+                              QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch());
+    return QString::fromLatin1(QCryptographicHash::hash(fileId, QCryptographicHash::Sha1).toHex());
+}
+
+QByteArray OsmParser::loadCachedMesh(const QString& cacheTag, MeshCacheHeader_t* header)
+{
+    const QString cachedFileName = meshCache().access(cacheTag);
+    if(cachedFileName.isEmpty()){
+        return QByteArray();
+    }
+
+    QFile cachedFile(cachedFileName);
+    MeshCacheHeader_t cachedHeader{};
+    QByteArray vertexData;
+    if(cachedFile.open(QIODevice::ReadOnly) &&
+        cachedFile.read(reinterpret_cast<char*>(&cachedHeader), sizeof(cachedHeader)) == sizeof(cachedHeader) &&
+        cachedHeader.magic == kMeshCacheMagic && cachedHeader.version == kMeshCacheVersion &&
+        cachedHeader.byteCount == static_cast<quint64>(cachedFile.size() - sizeof(cachedHeader))){
+        vertexData = cachedFile.readAll();
+    }
+    cachedFile.close();
 
-        ii.value().triangulated_mesh.insert(ii.value().triangulated_mesh.begin(), triangulated_mesh.begin(), triangulated_mesh.end());
-        vertexData.append(vertexData_tmp);
+    if(vertexData.isEmpty() || static_cast<quint64>(vertexData.size()) != cachedHeader.byteCount){
+        // Drop the entry, the cache never replaces an existing one so the next save would be discarded otherwise
+        qDebug() << "Invalid building mesh cache file" << cachedFileName;
+        (void) meshCache().remove(cacheTag);
+        return QByteArray();
+    }
+
+    if(header){
+        *header = cachedHeader;
     }
     return vertexData;
 }
 
+void OsmParser::saveCachedMesh(const QString& cacheTag, const QByteArray& vertexData)
+{
+    ComponentInformationCache& cache = meshCache();
+
+    // Written next to the cache entries so inserting is a rename within the same directory
+    const QString tempFileName = meshCacheDir() + QStringLiteral("/") + cacheTag + QStringLiteral(".tmp");
+    QFile tempFile(tempFileName);
+    if(!tempFile.open(QIODevice::WriteOnly | QIODevice::Truncate)){
+        qDebug() << "Unable to write building mesh cache file" << tempFileName << tempFile.errorString();
+        return;
+    }
+
+    MeshCacheHeader_t header{};
+    header.magic = kMeshCacheMagic;
+    header.version = kMeshCacheVersion;
+    header.byteCount = static_cast<quint64>(vertexData.size());
+    header.gpsRef[0] = _gpsRefPoint.latitude();
+    header.gpsRef[1] = _gpsRefPoint.longitude();
+    header.gpsRef[2] = _gpsRefPoint.altitude();
+    header.coordinateMin[0] = _coordinateMin.latitude();
+    header.coordinateMin[1] = _coordinateMin.longitude();
+    header.coordinateMin[2] = _coordinateMin.altitude();
+    header.coordinateMax[0] = _coordinateMax.latitude();
+    header.coordinateMax[1] = _coordinateMax.longitude();
+    header.coordinateMax[2] = _coordinateMax.altitude();
+    const bool written = (tempFile.write(reinterpret_cast<const char*>(&header), sizeof(header)) == sizeof(header)) &&
+                         (tempFile.write(vertexData) == vertexData.size());
+    tempFile.close();
+
+    if(!written){
+        qDebug() << "Unable to write building mesh cache file" << tempFileName << tempFile.errorString();
+        (void) tempFile.remove();
+        return;
+    }
+
+    // Overwrite whatever is stored under this tag, insert() keeps an existing entry
+    (void) cache.remove(cacheTag);
+    (void) cache.insert(cacheTag, tempFileName);
+}
+
+QString OsmParser::meshCacheDir()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/QGCViewer3DMeshCache");
+}
+
+ComponentInformationCache& OsmParser::meshCache()
+{
+    static ComponentInformationCache instance(meshCacheDir(), kMeshCacheMaxFiles);
+    return instance;
+}
+
 void OsmParser::trianglateWallsExtrudedPolygon(std::vector<QVector3D>& triangulatedMesh, std::vector<QVector2D> verticesCcw, float h, bool inverseOrder, bool duplicateStartEndPoint)
 {
     std::vector<QVector3D> tmp_rec_ccw(4);
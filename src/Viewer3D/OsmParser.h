@@ -16,10 +16,12 @@
 #include <QtCore/QVariant>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include "OsmParserThread.h"
+
 ///     @author Omid Esrafilian <esrafilian.omid@gmail.com>
 
 class Viewer3DSettings;
-class OsmParserThread;
+class ComponentInformationCache;
 
 class OsmParser : public QObject
 {
@@ -27,6 +29,8 @@ class OsmParser : public QObject
     QML_ELEMENT
     QML_UNCREATABLE("")
 
+    friend class OsmParserTest;
+
     // Q_PROPERTY(float buildingLevelHeight READ buildingLevelHeight WRITE setBuildingLevelHeight NOTIFY buildingLevelHeightChanged)
 
 public:
@@ -47,6 +51,30 @@ class OsmParser : public QObject
     std::pair<QGeoCoordinate, QGeoCoordinate> getMapBoundingBoxCoordinate(){ return std::pair(_coordinateMin, _coordinateMax);}
 
 private:
+    /// Header of a cached building mesh, followed by the vertex data. Carries the map reference
+    /// and bounds so a cached map can be shown without parsing the OSM file.
+    typedef struct MeshCacheHeader_s
+    {
+        quint32 magic;
+        quint32 version;
+        quint64 byteCount;
+        double gpsRef[3];           ///< latitude, longitude, altitude
+        double coordinateMin[3];
+        double coordinateMax[3];
+    }MeshCacheHeader_t;
+
+    static constexpr quint32 kMeshCacheMagic = 0x4d443351; // "Q3DM"
+    static constexpr quint32 kMeshCacheVersion = 2;
+    static constexpr int kMeshCacheMaxFiles = 10;
+
+    std::vector<QVector3D> triangulateBuilding(const OsmParserThread::BuildingType_t& building, float buildingLevelHeight);
+    QString meshCacheTag() const;
+    QByteArray loadCachedMesh(const QString& cacheTag, MeshCacheHeader_t* header = nullptr);
+    void saveCachedMesh(const QString& cacheTag, const QByteArray& vertexData);
+    static QString fileCacheKey(const QString& filePath);
+    static QString meshCacheDir();
+    static ComponentInformationCache& meshCache();
+
     OsmParserThread* _osmParserWorker;
     QGeoCoordinate _gpsRefPoint;
     QGeoCoordinate _coordinateMin, _coordinateMax; //Osm map bounding boxes in global coordinate
@@ -55,6 +83,11 @@ class OsmParser : public QObject
     bool _gpsRefSet;
     float _buildingLevelHeight;
     bool _mapLoadedFlag;
+    bool _buildingsParsed = false;      ///< mapBuildings holds the buildings of _filePath
+    bool _parsePending = false;
+    QString _filePath;
+    QString _fileCacheKey;              ///< Identifies _filePath in the mesh cache, empty if it can't be cached
+    QByteArray _cachedVertexData;       ///< Mesh loaded from the cache along with the map, handed out once by buildingToMesh()
     Viewer3DSettings* _viewer3DSettings = nullptr;
     QList<QString> _singleStoreyBuildings;
     QList<QString> _doubleStoreyLeisure;
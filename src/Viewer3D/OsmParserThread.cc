@@ -10,12 +10,17 @@
 #include "OsmParserThread.h"
 #include "QGCGeo.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
+#include <QtCore/QXmlStreamReader>
+
+#include <algorithm>
 
 OsmParserThread::OsmParserThread(QObject *parent)
     : QThread{parent}
 {
     _mainThread = new QThread();
+    _nodesSorted = true;
     _singleStoreyBuildings.append("bungalow");
     _singleStoreyBuildings.append("shed");
     _singleStoreyBuildings.append("kiosk");
@@ -36,10 +41,20 @@ void OsmParserThread::start(QString filePath)
     emit startThread(filePath);
 }
 
+QString OsmParserThread::localFilePath(const QString& filePath)
+{
+#ifdef __unix__
+    return QString("/") + filePath;
+#else
+    return filePath;
+#endif
+}
+
 void OsmParserThread::parseOsmFile(QString filePath)
 {
-    mapNodes.clear();
     mapBuildings.clear();
+    _nodes.clear();
+    _nodesSorted = true;
     _mapLoadedFlag = false;
 
 
@@ -52,12 +67,8 @@ void OsmParserThread::parseOsmFile(QString filePath)
         return;
     }
 
-    //The QDomDocument class represents an XML document.
-    QDomDocument xml_content;
 // Load xml file as raw data
-#ifdef __unix__
-    filePath = QString("/") + filePath;
-#endif
+    filePath = localFilePath(filePath);
     QFile f(filePath);
     if (!f.open(QIODevice::ReadOnly )) {
         // Error while loading file
@@ -65,11 +76,27 @@ void OsmParserThread::parseOsmFile(QString filePath)
         return;
     }
     qDebug("Loading the OSM file!!!");
-    // Set data into the QDomDocument before processing
-    xml_content.setContent(&f);
+
+    // The file is streamed in a single pass, only the nodes and the buildings decoded so far are kept in memory
+    QElapsedTimer parseTimer;
+    parseTimer.start();
+    QXmlStreamReader xml(&f);
+    const bool gpsRefIsSet = decodeFile(xml, mapBuildings, _nodes, coordinateMin, coordinateMax, gpsRefPoint);
+    if(xml.hasError()){
+        qDebug() << "Error while parsing OSM file" << xml.errorString() << "line" << xml.lineNumber();
+    }
+
+    const qint64 elapsedMs = qMax<qint64>(parseTimer.elapsed(), 1);
+    const double megaBytes = f.pos() / (1024.0 * 1024.0);
+    qDebug().nospace() << "OSM file parsed: " << megaBytes << " MB in " << elapsedMs << " ms (" << (megaBytes * 1000.0 / elapsedMs) << " MB/s), "
+                       << _nodes.size() << " nodes, " << mapBuildings.size() << " buildings";
     f.close();
 
-    if(decodeFile(xml_content, mapBuildings, mapNodes, coordinateMin, coordinateMax, gpsRefPoint)){
+    // Nodes are only needed while resolving the ways
+    _nodes.clear();
+    _nodes.shrink_to_fit();
+
+    if(gpsRefIsSet && !xml.hasError()){
         _mapLoadedFlag = true;
         emit fileParsed(true);
         return;
@@ -78,73 +105,92 @@ void OsmParserThread::parseOsmFile(QString filePath)
     emit fileParsed(false);
 }
 
-bool OsmParserThread::decodeFile(QDomDocument &xml_content, QMap<uint64_t, OsmParserThread::BuildingType_t> &buildingMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate &coordinateMin, QGeoCoordinate &coordinateMax, QGeoCoordinate &gpsRef)
+bool OsmParserThread::decodeFile(QXmlStreamReader &xml, QMap<uint64_t, OsmParserThread::BuildingType_t> &buildingMap, std::vector<OsmNode_t> &nodes, QGeoCoordinate &coordinateMin, QGeoCoordinate &coordinateMax, QGeoCoordinate &gpsRef)
 {
-    QDomElement root = xml_content.documentElement();
-    QDomElement xmlComponent = root.firstChild().toElement();
     QGeoCoordinate tmpGpsRef;
     bool gpsRefIsSet = false;
-    while(!xmlComponent.isNull()) {
-        if(decodeNodeTags(xmlComponent, nodeMap, coordinateMin, coordinateMax, tmpGpsRef)){
-            gpsRefIsSet = true;
-            gpsRef = tmpGpsRef;
+    while(!xml.atEnd()) {
+        if(xml.readNext() != QXmlStreamReader::StartElement){
+            continue;
+        }
+
+        const QStringView tagName = xml.name();
+        if(tagName == u"node" || tagName == u"bounds"){
+            if(decodeNodeTags(xml, nodes, coordinateMin, coordinateMax, tmpGpsRef)){
+                gpsRefIsSet = true;
+                gpsRef = tmpGpsRef;
+            }
+        }else if(tagName == u"way"){
+            decodeBuildings(xml, buildingMap, nodes, coordinateMin, coordinateMax, gpsRef);
+        }else if(tagName == u"relation"){
+            decodeRelations(xml, buildingMap, gpsRef);
         }
-        decodeBuildings(xmlComponent, buildingMap, nodeMap, coordinateMin, coordinateMax, gpsRef);
-        decodeRelations(xmlComponent, buildingMap, nodeMap, gpsRef);
+    }
 
-        xmlComponent = xmlComponent.nextSibling().toElement();
+    // Ways without any height information were only kept as possible members of building relations
+    for(auto it = buildingMap.begin(); it != buildingMap.end();){
+        if(it.value().levels == 0 && it.value().height == 0){
+            it = buildingMap.erase(it);
+        }else{
+            ++it;
+        }
     }
+
     return gpsRefIsSet;
 }
 
-bool OsmParserThread::decodeNodeTags(QDomElement &xmlComponent, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate &coordMin, QGeoCoordinate &coordMax, QGeoCoordinate &gpsRef)
+bool OsmParserThread::decodeNodeTags(QXmlStreamReader &xml, std::vector<OsmNode_t> &nodes, QGeoCoordinate &coordMin, QGeoCoordinate &coordMax, QGeoCoordinate &gpsRef)
 {
-    int64_t id_tmp=0;
-    QGeoCoordinate gps_tmp;
-    QString attribute;
+    const QXmlStreamAttributes attributes = xml.attributes();
     bool gpsRefIsSet = false;
 
-    if (xmlComponent.tagName()=="node") {
-
-        attribute = xmlComponent.attribute("id","-1");
-        id_tmp = attribute.toLongLong();
-
-        attribute = xmlComponent.attribute("lat","0");
-        gps_tmp.setLatitude(attribute.toDouble());
-
-        attribute = xmlComponent.attribute("lon","0");
-        gps_tmp.setLongitude(attribute.toDouble());
-
-        gps_tmp.setAltitude(0);
-
+    if (xml.name() == u"node") {
+        const int64_t id_tmp = attributes.value(u"id").toLongLong();
         if(id_tmp > 0) {
-            nodeMap.insert((uint64_t)id_tmp, gps_tmp);
+            const OsmNode_t node = {(uint64_t)id_tmp, attributes.value(u"lat").toDouble(), attributes.value(u"lon").toDouble()};
+            if(!nodes.empty() && nodes.back().id >= node.id){
+                _nodesSorted = false;
+            }
+            nodes.push_back(node);
         }
-    }else if(xmlComponent.tagName() == "bounds") {
-        coordMin.setLatitude(xmlComponent.attribute("minlat","0").toFloat());
-        coordMin.setLongitude(xmlComponent.attribute("minlon","0").toFloat());
+    }else if(xml.name() == u"bounds") {
+        coordMin.setLatitude(attributes.value(u"minlat").toFloat());
+        coordMin.setLongitude(attributes.value(u"minlon").toFloat());
         coordMin.setAltitude(0);
-        coordMax.setLatitude(xmlComponent.attribute("maxlat","0").toFloat());
-        coordMax.setLongitude(xmlComponent.attribute("maxlon","0").toFloat());
+        coordMax.setLatitude(attributes.value(u"maxlat").toFloat());
+        coordMax.setLongitude(attributes.value(u"maxlon").toFloat());
         coordMax.setAltitude(0);
 
         gpsRefIsSet = true;
-        gps_tmp.setLatitude(0.5 * (coordMin.latitude() + coordMax.latitude()));
-        gps_tmp.setLongitude(0.5 * (coordMin.longitude() + coordMax.longitude()));
-        gps_tmp.setAltitude(0);
-        gpsRef = gps_tmp;
+        gpsRef.setLatitude(0.5 * (coordMin.latitude() + coordMax.latitude()));
+        gpsRef.setLongitude(0.5 * (coordMin.longitude() + coordMax.longitude()));
+        gpsRef.setAltitude(0);
     }
+
+    // Node tags are not used
+    xml.skipCurrentElement();
     return gpsRefIsSet;
 }
 
-void OsmParserThread::decodeBuildings(QDomElement &xmlComponent, QMap<uint64_t, OsmParserThread::BuildingType_t> &bldMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate &coordMin, QGeoCoordinate &coordMax, QGeoCoordinate gpsRef)
+const OsmParserThread::OsmNode_t* OsmParserThread::findNode(std::vector<OsmNode_t> &nodes, uint64_t id)
 {
-    if (xmlComponent.tagName()!="way"){
-        return;
+    if(!_nodesSorted){
+        std::stable_sort(nodes.begin(), nodes.end(), [](const OsmNode_t& a, const OsmNode_t& b) { return a.id < b.id; });
+        _nodesSorted = true;
+    }
+
+    const auto it = std::lower_bound(nodes.cbegin(), nodes.cend(), id, [](const OsmNode_t& node, uint64_t value) { return node.id < value; });
+    if(it == nodes.cend() || it->id != id){
+        return nullptr;
     }
+    return &(*it);
+}
 
-    int64_t id_tmp = xmlComponent.attribute("id","0").toLongLong();
+void OsmParserThread::decodeBuildings(QXmlStreamReader &xml, QMap<uint64_t, OsmParserThread::BuildingType_t> &bldMap, std::vector<OsmNode_t> &nodes, QGeoCoordinate &coordMin, QGeoCoordinate &coordMax, QGeoCoordinate gpsRef)
+{
+    int64_t id_tmp = xml.attributes().value(u"id").toLongLong();
     if(id_tmp == 0) {
+        xml.skipCurrentElement();
         return;
     }
     OsmParserThread::BuildingType_t bld_tmp;
@@ -160,18 +206,19 @@ void OsmParserThread::decodeBuildings(QDomElement &xmlComponent, QMap<uint64_t,
     bld_lon_min = bld_lat_min = 1e10;
 
     int64_t ref_id;
-    QDomElement Child = xmlComponent.firstChild().toElement();
-    QString attribute;
+    QStringView attribute;
 
     bld_tmp.height = 0;
     bld_tmp.levels = 0;
 
-    while (!Child.isNull()) {
-        if (Child.tagName()=="nd") {
-            ref_id = Child.attribute("ref","0").toLongLong();
+    while (xml.readNextStartElement()) {
+        const QXmlStreamAttributes attributes = xml.attributes();
+        if (xml.name() == u"nd") {
+            ref_id = attributes.value(u"ref").toLongLong();
 
-            if(ref_id > 0) {
-                gps_pt_tmp = nodeMap[ref_id];
+            const OsmNode_t* node = (ref_id > 0) ? findNode(nodes, ref_id) : nullptr;
+            if(node) {
+                gps_pt_tmp = QGeoCoordinate(node->latitude, node->longitude, 0);
                 bld_points.push_back(gps_pt_tmp);
                 local_pt_tmp = QGCGeo::convertGpsToEnu(gps_pt_tmp, gpsRef);
                 bld_points_local.push_back(QVector2D(local_pt_tmp.x(), local_pt_tmp.y()));
@@ -186,28 +233,26 @@ void OsmParserThread::decodeBuildings(QDomElement &xmlComponent, QMap<uint64_t,
                 bld_lon_min = fmin(bld_lon_min, gps_pt_tmp.longitude());
                 bld_lat_min = fmin(bld_lat_min, gps_pt_tmp.latitude());
             }
-        }else if (Child.tagName()=="tag") {
-            attribute = Child.attribute("k","0");
-            if(attribute == "building:levels") {
-                bld_tmp.levels = Child.attribute("v","0").toFloat();
-            }else if(attribute == "height") {
-                bld_tmp.height = Child.attribute("v","0").toFloat();
-            }else if(attribute == "building" && bld_tmp.levels == 0 && bld_tmp.height == 0){
-                QString attribute_2 = Child.attribute("v","0");
-                if(_singleStoreyBuildings.contains(attribute_2)){
+        }else if (xml.name() == u"tag") {
+            attribute = attributes.value(u"k");
+            if(attribute == u"building:levels") {
+                bld_tmp.levels = attributes.value(u"v").toFloat();
+            }else if(attribute == u"height") {
+                bld_tmp.height = attributes.value(u"v").toFloat();
+            }else if(attribute == u"building" && bld_tmp.levels == 0 && bld_tmp.height == 0){
+                if(_singleStoreyBuildings.contains(attributes.value(u"v"))){
                     bld_tmp.levels = 1;
                 }else{
                     bld_tmp.levels = 2;
                 }
-            }else if(attribute == "leisure" && bld_tmp.levels == 0 && bld_tmp.height == 0){
-                QString attribute_2 = Child.attribute("v","0");
-                if(_doubleStoreyLeisure.contains(attribute_2)){
+            }else if(attribute == u"leisure" && bld_tmp.levels == 0 && bld_tmp.height == 0){
+                if(_doubleStoreyLeisure.contains(attributes.value(u"v"))){
                     bld_tmp.levels = 2;
                 }
             }
         }
 
-        Child = Child.nextSibling().toElement();
+        xml.skipCurrentElement();
     }
 
     if(bld_points.size() > 2) {
@@ -219,30 +264,27 @@ void OsmParserThread::decodeBuildings(QDomElement &xmlComponent, QMap<uint64_t,
             coordMax.setLatitude(fmax(coordMax.latitude(), bld_lat_max));
             coordMax.setLongitude(fmax(coordMax.longitude(), bld_lon_max));
         }
-        bld_tmp.points_gps = bld_points;
-        bld_tmp.points_local = bld_points_local;
+        bld_tmp.points_gps = std::move(bld_points);
+        bld_tmp.points_local = std::move(bld_points_local);
         bld_tmp.bb_max = QVector2D(bld_x_max, bld_y_max);
         bld_tmp.bb_min = QVector2D(bld_x_min, bld_y_min);
         bldMap.insert(id_tmp, bld_tmp);
     }
 }
 
-void OsmParserThread::decodeRelations(QDomElement &xmlComponent, QMap<uint64_t, OsmParserThread::BuildingType_t> &bldMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate gpsRef)
+void OsmParserThread::decodeRelations(QXmlStreamReader &xml, QMap<uint64_t, OsmParserThread::BuildingType_t> &bldMap, QGeoCoordinate gpsRef)
 {
-    if (xmlComponent.tagName()!="relation"){
-        return;
-    }
+    Q_UNUSED(gpsRef);
 
-    int64_t id_tmp = xmlComponent.attribute("id","0").toLongLong();
+    int64_t id_tmp = xml.attributes().value(u"id").toLongLong();
     if(id_tmp == 0) {
+        xml.skipCurrentElement();
         return;
     }
 
     OsmParserThread::BuildingType_t bld_tmp;
     int64_t ref_id;
-    QDomElement Child = xmlComponent.firstChild().toElement();
-    QString attribute;
-    QString role;
+    QStringView attribute;
 
     bld_tmp.height = 0;
     bld_tmp.levels = 0;
@@ -250,14 +292,15 @@ void OsmParserThread::decodeRelations(QDomElement &xmlComponent, QMap<uint64_t,
     bool isBuilding = false;
     bool isMultipolygon = false;
 
-    while (!Child.isNull()) {
-        if (Child.tagName()=="member") {
-            ref_id = Child.attribute("ref","0").toLongLong();
-            role = Child.attribute("role","0");
+    while (xml.readNextStartElement()) {
+        const QXmlStreamAttributes attributes = xml.attributes();
+        if (xml.name() == u"member") {
+            ref_id = attributes.value(u"ref").toLongLong();
+            const bool isInner = (attributes.value(u"role") == u"inner");
             auto bldItem = bldMap.find(ref_id);
             if(bldItem != bldMap.end()) {
-                bld_tmp.append(bldItem.value().points_local, role == "inner");
-                bld_tmp.append(bldItem.value().points_gps, role == "inner");
+                bld_tmp.append(bldItem.value().points_local, isInner);
+                bld_tmp.append(bldItem.value().points_gps, isInner);
                 bld_tmp.levels = fmax(bld_tmp.levels, bldItem.value().levels);
                 bld_tmp.height = fmax(bld_tmp.height, bldItem.value().height);
 
@@ -267,17 +310,18 @@ void OsmParserThread::decodeRelations(QDomElement &xmlComponent, QMap<uint64_t,
                 bld_tmp.bb_min[1] = fmin(bld_tmp.bb_min[1], bldItem.value().bb_min[1]);
                 bldToBeRemoved.push_back(ref_id);
             }
-        }else if (Child.tagName()=="tag") {
-            attribute = Child.attribute("k","0");
-            if(attribute == "type") {
-                if(Child.attribute("v","0") == "multipolygon"){
+        }else if (xml.name() == u"tag") {
+            attribute = attributes.value(u"k");
+            if(attribute == u"type") {
+                if(attributes.value(u"v") == u"multipolygon"){
                     isMultipolygon = true;
                 }
-            }else if(attribute == "building"){
+            }else if(attribute == u"building"){
                 isBuilding = true;
             }
         }
-        Child = Child.nextSibling().toElement();
+
+        xml.skipCurrentElement();
     }
 
     if(isBuilding){
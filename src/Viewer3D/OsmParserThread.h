@@ -11,12 +11,15 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QThread>
-#include <QtXml/QDomDocument>
 #include <QtCore/QMap>
 #include <QtGui/QVector3D>
 #include <QtGui/QVector2D>
 #include <QtPositioning/QGeoCoordinate>
 
+#include <vector>
+
+class QXmlStreamReader;
+
 ///     @author Omid Esrafilian <esrafilian.omid@gmail.com>
 
 
@@ -30,7 +33,6 @@ class OsmParserThread : public QThread
         std::vector<QGeoCoordinate> points_gps_inner;
         std::vector<QVector2D> points_local;
         std::vector<QVector2D> points_local_inner;
-        std::vector<QVector3D> triangulated_mesh;
         QVector2D bb_max = QVector2D(-1e6, -1e6); //bounding boxes
         QVector2D bb_min = QVector2D(1e6, 1e6); //bounding boxes
         float height;
@@ -57,28 +59,41 @@ class OsmParserThread : public QThread
         }
     }BuildingType_t;
 
+    /// Nodes are only needed to resolve way references, so they are kept as plain values instead of QGeoCoordinate
+    typedef struct OsmNode_s
+    {
+        uint64_t id;
+        double latitude;
+        double longitude;
+    }OsmNode_t;
+
     Q_OBJECT
 public:
     explicit OsmParserThread(QObject *parent = nullptr);
 
     QGeoCoordinate gpsRefPoint;
-    QMap<uint64_t, QGeoCoordinate> mapNodes;
     QMap<uint64_t, BuildingType_t> mapBuildings;
     QGeoCoordinate coordinateMin, coordinateMax;
 
     void start(QString filePath);
 
+    /// Path of the OSM file on disk, file paths are handed over without the leading slash on unix
+    static QString localFilePath(const QString& filePath);
+
 private:
     QThread* _mainThread;
     bool _mapLoadedFlag;
     QList<QString> _singleStoreyBuildings;
     QList<QString> _doubleStoreyLeisure;
+    std::vector<OsmNode_t> _nodes; ///< Sorted by id, OSM files list nodes in ascending id order
+    bool _nodesSorted;
 
     void parseOsmFile(QString filePath);
-    bool decodeFile(QDomDocument& xml_content, QMap<uint64_t, BuildingType_t > &buildingMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate& coordinateMin, QGeoCoordinate& coordinateMax, QGeoCoordinate& gpsRef);
-    bool decodeNodeTags(QDomElement& xmlComponent, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate& coordMin, QGeoCoordinate& coordMax, QGeoCoordinate& gpsRef);
-    void decodeBuildings(QDomElement& xmlComponent, QMap<uint64_t, BuildingType_t > &bldMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate& coordMin, QGeoCoordinate& coordMax, QGeoCoordinate gpsRef);
-    void decodeRelations(QDomElement& xmlComponent, QMap<uint64_t, BuildingType_t > &bldMap, QMap<uint64_t, QGeoCoordinate> &nodeMap, QGeoCoordinate gpsRef);
+    bool decodeFile(QXmlStreamReader& xml, QMap<uint64_t, BuildingType_t > &buildingMap, std::vector<OsmNode_t> &nodes, QGeoCoordinate& coordinateMin, QGeoCoordinate& coordinateMax, QGeoCoordinate& gpsRef);
+    bool decodeNodeTags(QXmlStreamReader& xml, std::vector<OsmNode_t> &nodes, QGeoCoordinate& coordMin, QGeoCoordinate& coordMax, QGeoCoordinate& gpsRef);
+    void decodeBuildings(QXmlStreamReader& xml, QMap<uint64_t, BuildingType_t > &bldMap, std::vector<OsmNode_t> &nodes, QGeoCoordinate& coordMin, QGeoCoordinate& coordMax, QGeoCoordinate gpsRef);
+    void decodeRelations(QXmlStreamReader& xml, QMap<uint64_t, BuildingType_t > &bldMap, QGeoCoordinate gpsRef);
+    const OsmNode_t* findNode(std::vector<OsmNode_t> &nodes, uint64_t id);
 
 
 signals:
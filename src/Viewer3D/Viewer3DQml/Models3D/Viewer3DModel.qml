@@ -153,6 +153,7 @@ View3D {
                 geometry: Viewer3DTerrainGeometry {
                     id: terrainGeometryManager
                     refCoordinate: _gpsRef
+                    cameraPosition: pointModel.mapPositionFromScene(standAloneScene.cameraOne.scenePosition)
                 }
 
                 materials: CustomMaterial {
@@ -12,12 +12,27 @@
 #include "Viewer3DSettings.h"
 #include "QGCGeo.h"
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include "math.h"
 
 #define MaxLatitude 85.05112878
 #define EarthRadius 6378137
 
+namespace {
+    // Vertical texture coordinate of the web mercator map tiles
+    float textureT(float stackAngle, float stackRef)
+    {
+        if(fabs(stackAngle) < MaxLatitude){
+            double sinLatitude = sin(qDegreesToRadians(stackAngle));
+            return 0.5 - log((1 + sinLatitude) / (1 - sinLatitude)) / (4 * M_PI);
+        }
+        return (stackRef - stackAngle) / 180;
+    }
+}
+
 Viewer3DTerrainGeometry::Viewer3DTerrainGeometry()
+    : _chunkBuildWatcher(new QFutureWatcher<QList<TerrainChunkBuild_t>>(this))
 {
     _viewer3DSettings = SettingsManager::instance()->viewer3DSettings();
     setSectorCount(0);
@@ -25,38 +40,191 @@ Viewer3DTerrainGeometry::Viewer3DTerrainGeometry()
     setRadius(EarthRadius);
     connect(_viewer3DSettings->osmFilePath(), &Fact::rawValueChanged, this, &Viewer3DTerrainGeometry::clearScene);
     connect(this, &Viewer3DTerrainGeometry::refCoordinateChanged, this, &Viewer3DTerrainGeometry::updateEarthData);
+    connect(_chunkBuildWatcher, &QFutureWatcherBase::finished, this, &Viewer3DTerrainGeometry::chunkBuildFinished);
 }
 
 void Viewer3DTerrainGeometry::updateEarthData()
 {
+    _gridGeneration++;
+    _chunks.clear();
     clear();
-    int stride = 3 * sizeof(float);
-    stride += 3 * sizeof(float); // for normals
-    stride += 2 * sizeof(float); // for UV
+    update();
+
+    if(!buildTerrainGrid(roiMin(), roiMax(), refCoordinate(), 1)){
+        return;
+    }
+
+    // Split the grid into chunks, each chunk picks its own level of detail
+    for(int i = 0; i < _stackCount; i += kChunkCells){
+        for(int j = 0; j < _sectorCount; j += kChunkCells){
+            TerrainChunk_t chunk{};
+            chunk.firstStack = i;
+            chunk.firstSector = j;
+            chunk.stacks = qMin(kChunkCells, _stackCount - i);
+            chunk.sectors = qMin(kChunkCells, _sectorCount - j);
+            chunk.lodStep = 0;
+
+            const QVector3D cornerMin = gridPoint(chunk.firstStack, chunk.firstSector);
+            const QVector3D cornerMax = gridPoint(chunk.firstStack + chunk.stacks, chunk.firstSector + chunk.sectors);
+            chunk.center = 0.5f * (cornerMin + cornerMax);
+            chunk.extent = (cornerMax - cornerMin).length();
+            _chunks.push_back(chunk);
+        }
+    }
+
+    updateChunks();
+}
+
+bool Viewer3DTerrainGeometry::buildTerrainGrid(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale)
+{
+    if(_sectorCount == 0 || _stackCount == 0){
+        return false;
+    }
 
-    if(buildTerrain_2(roiMin(), roiMax(), refCoordinate(), 1) == 0){
+    float sectorLength = fabs(roiMaxCoordinate.longitude() - roiMinCoordinate.longitude());
+    float stackLength = fabs(roiMaxCoordinate.latitude() - roiMinCoordinate.latitude());
+
+    _grid.refCoordinate = refCoordinate;
+    _grid.stackRef = roiMaxCoordinate.latitude();
+    _grid.sectorRef = roiMinCoordinate.longitude();
+    _grid.sectorStep = sectorLength / _sectorCount;
+    _grid.stackStep = stackLength / _stackCount;
+
+    // Texture coordinates are normalized over the whole grid, s is linear in the longitude and t is monotonic in the latitude
+    if(scale){
+        const float s1 = (_grid.sectorRef + 180.0f) / 360.0f;
+        const float s2 = (_grid.sectorRef + sectorLength + 180.0f) / 360.0f;
+        const float t1 = textureT(_grid.stackRef, _grid.stackRef);
+        const float t2 = textureT(_grid.stackRef - stackLength, _grid.stackRef);
+        _grid.minS = fmin(s1, s2);
+        _grid.scaleS = fabs(s2 - s1);
+        _grid.minT = fmin(t1, t2);
+        _grid.scaleT = fabs(t2 - t1);
+    }else{
+        _grid.minS = _grid.minT = 0;
+        _grid.scaleS = _grid.scaleT = 1;
+    }
+
+    return true;
+}
+
+QVector3D Viewer3DTerrainGeometry::gridPoint(int stack, int sector) const
+{
+    const QVector3D localPoint = QGCGeo::convertGpsToEnu(QGeoCoordinate(_grid.stackRef - stack * _grid.stackStep, _grid.sectorRef + sector * _grid.sectorStep, 0), _grid.refCoordinate);
+    return QVector3D(localPoint.x(), localPoint.y(), 0);
+}
+
+int Viewer3DTerrainGeometry::chunkLodStep(const TerrainChunk_t &chunk) const
+{
+    const float distance = (chunk.center - _cameraPosition).length();
+    float lodDistance = kLodDistanceFactor * chunk.extent;
+    int lodStep = 1;
+    while(lodStep < kChunkCells && distance > lodDistance){
+        lodStep *= 2;
+        lodDistance *= 2;
+    }
+    return lodStep;
+}
+
+void Viewer3DTerrainGeometry::updateChunks()
+{
+    if(_chunks.empty()){
+        return;
+    }
+
+    // Only one build runs at a time, changes in the meantime are picked up once it finishes
+    if(_chunkBuildWatcher->isRunning()){
+        _chunkUpdatePending = true;
+        return;
+    }
+
+    QList<TerrainChunkBuild_t> chunkBuilds;
+    for(int i = 0; i < static_cast<int>(_chunks.size()); ++i){
+        const int lodStep = chunkLodStep(_chunks[i]);
+        if(lodStep != _chunks[i].lodStep){
+            TerrainChunkBuild_t chunkBuild{i, _chunks[i]};
+            chunkBuild.chunk.lodStep = lodStep;
+            chunkBuild.chunk.vertexData.clear();
+            chunkBuild.chunk.indexData.clear();
+            chunkBuilds.append(chunkBuild);
+        }
+    }
+    if(chunkBuilds.isEmpty()){
         return;
     }
 
+    const TerrainGrid_t grid = _grid;
+    _chunkBuildGeneration = _gridGeneration;
+    _chunkBuildWatcher->setFuture(QtConcurrent::run([grid, chunkBuilds]() mutable {
+        for(TerrainChunkBuild_t& chunkBuild : chunkBuilds){
+            chunkBuild.chunk = buildChunk(grid, chunkBuild.chunk);
+        }
+        return chunkBuilds;
+    }));
+}
+
+void Viewer3DTerrainGeometry::chunkBuildFinished()
+{
+    if(_chunkBuildGeneration == _gridGeneration){
+        const QList<TerrainChunkBuild_t> chunkBuilds = _chunkBuildWatcher->result();
+        for(const TerrainChunkBuild_t& chunkBuild : chunkBuilds){
+            _chunks[chunkBuild.chunkIndex] = chunkBuild.chunk;
+        }
+        uploadChunks();
+    }
+
+    if(_chunkUpdatePending){
+        _chunkUpdatePending = false;
+        updateChunks();
+    }
+}
+
+void Viewer3DTerrainGeometry::uploadChunks()
+{
+    qsizetype vertexBytes = 0;
+    qsizetype indexBytes = 0;
+    for(const TerrainChunk_t& chunk : _chunks){
+        vertexBytes += chunk.vertexData.size();
+        indexBytes += chunk.indexData.size();
+    }
+
     QByteArray vertexData;
-    vertexData.resize(_vertices.size() * stride);
-    float *p = reinterpret_cast<float *>(vertexData.data());
+    QByteArray indexData;
+    vertexData.reserve(vertexBytes);
+    indexData.reserve(indexBytes);
+    QVector3D boundsMin(1e10, 1e10, 1e10);
+    QVector3D boundsMax(-1e10, -1e10, -1e10);
+
+    // Chunk indices are local to the chunk, offset them into the shared vertex buffer
+    quint32 baseVertex = 0;
+    for(const TerrainChunk_t& chunk : _chunks){
+        if(chunk.vertexData.isEmpty()){
+            continue;
+        }
 
-    for (uint i = 0; i < _vertices.size(); ++i) {
-        *p++ = _vertices[i].x();
-        *p++ = _vertices[i].y();
-        *p++ = _vertices[i].z();
+        vertexData.append(chunk.vertexData);
+        const qsizetype indexOffset = indexData.size();
+        indexData.append(chunk.indexData);
+        quint32 *p = reinterpret_cast<quint32 *>(indexData.data() + indexOffset);
+        for(qsizetype i = 0; i < chunk.indexData.size() / static_cast<qsizetype>(sizeof(quint32)); ++i){
+            p[i] += baseVertex;
+        }
+        baseVertex += chunk.vertexData.size() / kVertexStride;
 
-        *p++ = _normals[i].x();
-        *p++ = _normals[i].y();
-        *p++ = _normals[i].z();
+        boundsMin = QVector3D(fmin(boundsMin.x(), chunk.boundsMin.x()), fmin(boundsMin.y(), chunk.boundsMin.y()), fmin(boundsMin.z(), chunk.boundsMin.z()));
+        boundsMax = QVector3D(fmax(boundsMax.x(), chunk.boundsMax.x()), fmax(boundsMax.y(), chunk.boundsMax.y()), fmax(boundsMax.z(), chunk.boundsMax.z()));
+    }
 
-        *p++ = _texCoords[i].x();
-        *p++ = _texCoords[i].y();
+    clear();
+    if(vertexData.isEmpty()){
+        update();
+        return;
     }
 
     setVertexData(vertexData);
-    setStride(stride);
+    setIndexData(indexData);
+    setStride(kVertexStride);
+    setBounds(boundsMin, boundsMax);
 
     setPrimitiveType(QQuick3DGeometry::PrimitiveType::Triangles);
     addAttribute(QQuick3DGeometry::Attribute::PositionSemantic,
@@ -68,10 +236,101 @@ void Viewer3DTerrainGeometry::updateEarthData()
     addAttribute(QQuick3DGeometry::Attribute::TexCoordSemantic,
                  6 * sizeof(float),
                  QQuick3DGeometry::Attribute::F32Type);
+    addAttribute(QQuick3DGeometry::Attribute::IndexSemantic,
+                 0,
+                 QQuick3DGeometry::Attribute::U32Type);
 
     update();
 }
 
+Viewer3DTerrainGeometry::TerrainChunk_t Viewer3DTerrainGeometry::buildChunk(const TerrainGrid_t &grid, TerrainChunk_t chunk)
+{
+    // Grid rows and columns sampled at this level of detail, the chunk edges are always included
+    std::vector<int> rows;
+    std::vector<int> cols;
+    for(int i = 0; i < chunk.stacks; i += chunk.lodStep){
+        rows.push_back(chunk.firstStack + i);
+    }
+    rows.push_back(chunk.firstStack + chunk.stacks);
+    for(int j = 0; j < chunk.sectors; j += chunk.lodStep){
+        cols.push_back(chunk.firstSector + j);
+    }
+    cols.push_back(chunk.firstSector + chunk.sectors);
+
+    const int rowCount = rows.size();
+    const int colCount = cols.size();
+    const int vertexCount = rowCount * colCount;
+
+    std::vector<QVector3D> positions(vertexCount);
+    std::vector<QVector2D> texCoords(vertexCount);
+    std::vector<QVector3D> normals(vertexCount, QVector3D(0, 0, 0));
+    chunk.boundsMin = QVector3D(1e10, 1e10, 0);
+    chunk.boundsMax = QVector3D(-1e10, -1e10, 0);
+
+    for(int r = 0; r < rowCount; ++r){
+        const float stackAngle = grid.stackRef - rows[r] * grid.stackStep;
+        const float t = (textureT(stackAngle, grid.stackRef) - grid.minT) / grid.scaleT;
+        for(int c = 0; c < colCount; ++c){
+            const float sectorAngle = grid.sectorRef + cols[c] * grid.sectorStep;
+            const QVector3D localPoint = QGCGeo::convertGpsToEnu(QGeoCoordinate(stackAngle, sectorAngle, 0), grid.refCoordinate);
+            const int idx = r * colCount + c;
+            positions[idx] = QVector3D(localPoint.x(), localPoint.y(), 0);
+            texCoords[idx] = QVector2D(((sectorAngle + 180.0f) / 360.0f - grid.minS) / grid.scaleS, t);
+
+            chunk.boundsMin.setX(fmin(chunk.boundsMin.x(), localPoint.x()));
+            chunk.boundsMin.setY(fmin(chunk.boundsMin.y(), localPoint.y()));
+            chunk.boundsMax.setX(fmax(chunk.boundsMax.x(), localPoint.x()));
+            chunk.boundsMax.setY(fmax(chunk.boundsMax.y(), localPoint.y()));
+        }
+    }
+
+    // Two triangles per cell, vertex normals are the average of the adjacent face normals
+    std::vector<quint32> indices;
+    indices.reserve((rowCount - 1) * (colCount - 1) * 6);
+    for(int r = 0; r < rowCount - 1; ++r){
+        const float stackAngle = grid.stackRef - rows[r] * grid.stackStep;
+        for(int c = 0; c < colCount - 1; ++c){
+            //  v1--v3
+            //  |    |
+            //  v2--v4
+            const quint32 v1 = r * colCount + c;
+            const quint32 v2 = (r + 1) * colCount + c;
+            const quint32 v3 = v1 + 1;
+            const quint32 v4 = v2 + 1;
+
+            if(stackAngle < 90){
+                indices.insert(indices.end(), {v1, v2, v3});
+                const QVector3D n = computeFaceNormal(positions[v1], positions[v2], positions[v3]);
+                normals[v1] += n; normals[v2] += n; normals[v3] += n;
+            }
+            if(stackAngle > -90){
+                indices.insert(indices.end(), {v3, v2, v4});
+                const QVector3D n = computeFaceNormal(positions[v3], positions[v2], positions[v4]);
+                normals[v3] += n; normals[v2] += n; normals[v4] += n;
+            }
+        }
+    }
+
+    chunk.vertexData.resize(vertexCount * kVertexStride);
+    float *p = reinterpret_cast<float *>(chunk.vertexData.data());
+    for(int i = 0; i < vertexCount; ++i){
+        const QVector3D normal = normals[i].normalized();
+        *p++ = positions[i].x();
+        *p++ = positions[i].y();
+        *p++ = positions[i].z();
+
+        *p++ = normal.x();
+        *p++ = normal.y();
+        *p++ = normal.z();
+
+        *p++ = texCoords[i].x();
+        *p++ = texCoords[i].y();
+    }
+
+    chunk.indexData = QByteArray(reinterpret_cast<const char *>(indices.data()), indices.size() * sizeof(quint32));
+    return chunk;
+}
+
 QVector3D Viewer3DTerrainGeometry::computeFaceNormal(QVector3D x1, QVector3D x2, QVector3D x3)
 {
     const float EPSILON = 0.000001f;
@@ -106,82 +365,13 @@ QVector3D Viewer3DTerrainGeometry::computeFaceNormal(QVector3D x1, QVector3D x2,
     return normal;
 }
 
-void Viewer3DTerrainGeometry::changeUpAxis(int from, int to)
-{
-    // initial transform matrix cols
-    float tx[] = {1.0f, 0.0f, 0.0f};    // x-axis (left)
-    float ty[] = {0.0f, 1.0f, 0.0f};    // y-axis (up)
-    float tz[] = {0.0f, 0.0f, 1.0f};    // z-axis (forward)
-
-    float sign_to = (to >= 0)?(1):(-1);
-
-    // X -> Y
-    if(from == 1 && to == 2)
-    {
-        tx[0] =  0.0f * sign_to; tx[1] =  1.0f * sign_to;
-        ty[0] = -1.0f * sign_to; ty[1] =  0.0f * sign_to;
-    }
-    // X -> Z
-    else if(from == 1 && to == 3)
-    {
-        tx[0] =  0.0f * sign_to; tx[2] =  1.0f * sign_to;
-        tz[0] = -1.0f * sign_to; tz[2] =  0.0f * sign_to;
-    }
-    // Y -> X
-    else if(from == 2 && to == 1)
-    {
-        tx[0] =  0.0f * sign_to; tx[1] = -1.0f * sign_to;
-        ty[0] =  1.0f * sign_to; ty[1] =  0.0f * sign_to;
-    }
-    // Y -> Z
-    else if(from == 2 && to == 3)
-    {
-        ty[1] =  0.0f * sign_to; ty[2] =  1.0f * sign_to;
-        tz[1] = -1.0f * sign_to; tz[2] =  0.0f * sign_to;
-    }
-    //  Z -> X
-    else if(from == 3 && to == 1)
-    {
-        tx[0] =  0.0f * sign_to; tx[2] = -1.0f * sign_to;
-        tz[0] =  1.0f * sign_to; tz[2] =  0.0f * sign_to;
-    }
-    // Z -> Y
-    else
-    {
-        ty[1] =  0.0f * sign_to; ty[2] = -1.0f * sign_to;
-        tz[1] =  1.0f * sign_to; tz[2] =  0.0f * sign_to;
-    }
-
-    float vx, vy, vz;
-    float nx, ny, nz;
-    for(std::size_t i = 0; i < _vertices.size(); i++)
-    {
-        // transform vertices
-        vx = _vertices[i].x();
-        vy = _vertices[i].y();
-        vz = _vertices[i].z();
-        _vertices[i] = QVector3D(tx[0] * vx + ty[0] * vy + tz[0] * vz,
-                                 tx[1] * vx + ty[1] * vy + tz[1] * vz,
-                                 tx[2] * vx + ty[2] * vy + tz[2] * vz);
-
-        // transform normals
-        nx = _normals[i].x();
-        ny = _normals[i].y();
-        nz = _normals[i].z();
-        _normals[i]   = QVector3D(tx[0] * nx + ty[0] * ny + tz[0] * nz,
-                                tx[1] * nx + ty[1] * ny + tz[1] * nz,
-                                tx[2] * nx + ty[2] * ny + tz[2] * nz);
-    }
-}
-
 void Viewer3DTerrainGeometry::clearScene()
 {
     clear();
     setSectorCount(0);
     setStackCount(0);
-    _vertices.clear();
-    _normals.clear();
-    _texCoords.clear();
+    _gridGeneration++;
+    _chunks.clear();
     update();
 }
 
@@ -211,292 +401,6 @@ void Viewer3DTerrainGeometry::setStackCount(int newStackCount)
     emit stackCountChanged();
 }
 
-void Viewer3DTerrainGeometry::buildTerrain(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale)
-{
-    float sectorLength = abs(roiMaxCoordinate.longitude() - roiMinCoordinate.longitude());
-    float stackLength = abs(roiMaxCoordinate.latitude() - roiMinCoordinate.latitude());
-    float stackRef = roiMaxCoordinate.latitude();
-    float sectorRef = roiMinCoordinate.longitude();
-
-
-    // tmp vertex definition (x,y,z,s,t)
-    struct Vertex{
-        float x, y, z, s, t;
-    };
-    std::vector<Vertex> tmpVertices;
-
-    float minT = 10;
-    float maxT = -10;
-    float minS = 10;
-    float maxS = -10;
-
-    // There si a bug now that the resolution of each polygon changes
-    // by thge portion. It hsould be fixed I think
-    float sectorStep =   sectorLength / _sectorCount;
-    float stackStep = stackLength / _stackCount;
-    float sectorAngle, stackAngle;
-
-    QVector3D refLocalPosition;
-    float refXY = _radius * cosf(qDegreesToRadians(refCoordinate.latitude()));
-    refLocalPosition.setX(refXY * cosf(qDegreesToRadians(refCoordinate.longitude())));
-    refLocalPosition.setY(refXY * sinf(qDegreesToRadians(refCoordinate.longitude())));
-    refLocalPosition.setZ(_radius * sinf(qDegreesToRadians(refCoordinate.latitude())));
-
-    // compute all vertices first, each vertex contains (x,y,z,s,t) except normal
-    for(int i = 0; i <= _stackCount; ++i){
-        stackAngle = stackRef - i * stackStep;        // starting from 90 to -90
-        float xy = _radius * cosf(qDegreesToRadians(stackAngle));       // r * cos(u)
-        // float z = _radius * sinf(qDegreesToRadians(stackAngle));        // r * sin(u)
-
-        // add (sectorCount+1) vertices per stack
-        // the first and last vertices have same position and normal, but different tex coords
-        for(int j = 0; j <= _sectorCount; ++j){
-            sectorAngle = sectorRef + j * sectorStep;           // starting from -180 to 180
-
-            Vertex vertex;
-            vertex.x = xy * cosf(qDegreesToRadians(sectorAngle)) - refLocalPosition.x();      // x = r * cos(u) * cos(v)
-            vertex.y = xy * sinf(qDegreesToRadians(sectorAngle)) - refLocalPosition.y();      // y = r * cos(u) * sin(v)
-            // vertex.z = z - refLocalPosition.z();                           // z = r * sin(u)
-            vertex.z = 0;                           // z = r * sin(u)
-
-            qDebug() << vertex.x << vertex.y << vertex.z;
-            vertex.s = (sectorAngle + 180.0f) / 360.0f;
-            minS = fmin(minS, vertex.s);
-            maxS = fmax(maxS, vertex.s);
-            if(abs(stackAngle) < MaxLatitude){
-                double sinLatitude = sin(qDegreesToRadians(stackAngle));
-                vertex.t = 0.5 - log((1 + sinLatitude) / (1 - sinLatitude)) / (4 * M_PI);
-
-            }else{
-                vertex.t = (stackRef - stackAngle) / 180;
-            }
-            minT = fmin(minT, vertex.t);
-            maxT = fmax(maxT, vertex.t);
-
-            tmpVertices.push_back(vertex);
-        }
-    }
-
-    float scaleT = maxT - minT;
-    float scaleS = maxS - minS;
-    _vertices.clear();
-    _texCoords.clear();
-    _normals.clear();
-    Vertex v1, v2, v3, v4;                          // 4 vertex positions and tex coords
-    int i, j, vi1, vi2;
-    QVector3D _n;
-    for(i = 0; i < _stackCount; ++i){
-        vi1 = i * (_sectorCount + 1);                // index of tmpVertices
-        vi2 = (i + 1) * (_sectorCount + 1);
-        stackAngle = stackRef - i * stackStep;
-        for(j = 0; j < _sectorCount; ++j, ++vi1, ++vi2){
-            // get 4 vertices per sector
-            //  v1--v3
-            //  |    |
-            //  v2--v4
-
-            v1 = tmpVertices[vi1];
-            v2 = tmpVertices[vi2];
-            v3 = tmpVertices[vi1 + 1];
-            v4 = tmpVertices[vi2 + 1];
-
-            if(scale){
-                v1.s = (v1.s - minS) / scaleS;
-                v1.t = (v1.t - minT) / scaleT;
-                v2.s = (v2.s - minS) / scaleS;
-                v2.t = (v2.t - minT) / scaleT;
-                v3.s = (v3.s - minS) / scaleS;
-                v3.t = (v3.t - minT) / scaleT;
-                v4.s = (v4.s - minS) / scaleS;
-                v4.t = (v4.t - minT) / scaleT;
-            }
-
-            // 2 triangles per sector excluding 1st and last stacks
-            if(stackAngle < 90){
-                _vertices.push_back(QVector3D(v1.x, v1.y, v1.z));
-                _vertices.push_back(QVector3D(v2.x, v2.y, v2.z));
-                _vertices.push_back(QVector3D(v3.x, v3.y, v3.z));
-
-                _texCoords.push_back(QVector2D(v1.s, v1.t));
-                _texCoords.push_back(QVector2D(v2.s, v2.t));
-                _texCoords.push_back(QVector2D(v3.s, v3.t));
-
-                _n = computeFaceNormal(QVector3D(v1.x,v1.y,v1.z),
-                                       QVector3D(v2.x,v2.y,v2.z),
-                                       QVector3D(v3.x,v3.y,v3.z));
-
-                for(int k = 0; k < 3; ++k)  // same normals for 3 vertices
-                {
-                    _normals.push_back(_n);
-                }
-            }
-
-            if(stackAngle > -90){
-                _vertices.push_back(QVector3D(v3.x, v3.y, v3.z));
-                _vertices.push_back(QVector3D(v2.x, v2.y, v2.z));
-                _vertices.push_back(QVector3D(v4.x, v4.y, v4.z));
-
-                _texCoords.push_back(QVector2D(v3.s, v3.t));
-                _texCoords.push_back(QVector2D(v2.s, v2.t));
-                _texCoords.push_back(QVector2D(v4.s, v4.t));
-
-                _n = computeFaceNormal(QVector3D(v3.x,v3.y,v3.z),
-                                       QVector3D(v2.x,v2.y,v2.z),
-                                       QVector3D(v4.x,v4.y,v4.z));
-
-                for(int k = 0; k < 3; ++k)  // same normals for 3 vertices
-                {
-                    _normals.push_back(_n);
-                }
-            }
-        }
-    }
-
-    changeUpAxis(3, 2);
-}
-
-bool Viewer3DTerrainGeometry::buildTerrain_2(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale)
-{
-    if(_sectorCount == 0 || _stackCount == 0){
-        return false;
-    }
-
-    float sectorLength = abs(roiMaxCoordinate.longitude() - roiMinCoordinate.longitude());
-    float stackLength = abs(roiMaxCoordinate.latitude() - roiMinCoordinate.latitude());
-    float stackRef = roiMaxCoordinate.latitude();
-    float sectorRef = roiMinCoordinate.longitude();
-
-
-    // tmp vertex definition (x,y,z,s,t)
-    struct Vertex{
-        float x, y, z, s, t;
-    };
-    std::vector<Vertex> tmpVertices;
-
-    float minT = 10;
-    float maxT = -10;
-    float minS = 10;
-    float maxS = -10;
-
-    // There si a bug now that the resolution of each polygon changes
-    // by thge portion. It hsould be fixed I think
-    float sectorStep =   sectorLength / _sectorCount;
-    float stackStep = stackLength / _stackCount;
-    float sectorAngle, stackAngle;
-
-    QVector3D refLocalPosition;
-    QVector3D localPoint;
-    float refXY = _radius * cosf(qDegreesToRadians(refCoordinate.latitude()));
-    refLocalPosition.setX(refXY * cosf(qDegreesToRadians(refCoordinate.longitude())));
-    refLocalPosition.setY(refXY * sinf(qDegreesToRadians(refCoordinate.longitude())));
-    refLocalPosition.setZ(_radius * sinf(qDegreesToRadians(refCoordinate.latitude())));
-
-    for(int i = 0; i <= _stackCount; ++i){
-        stackAngle = stackRef - i * stackStep;        // starting from 90 to -90
-
-        for(int j = 0; j <= _sectorCount; ++j){
-            sectorAngle = sectorRef + j * sectorStep;           // starting from -180 to 180
-
-            Vertex vertex;
-            localPoint = QGCGeo::convertGpsToEnu(QGeoCoordinate(stackAngle, sectorAngle, 0), refCoordinate);
-            vertex.x = localPoint.x();
-            vertex.y = localPoint.y();
-            vertex.z = 0;
-
-            vertex.s = (sectorAngle + 180.0f) / 360.0f;
-            minS = fmin(minS, vertex.s);
-            maxS = fmax(maxS, vertex.s);
-            if(abs(stackAngle) < MaxLatitude){
-                double sinLatitude = sin(qDegreesToRadians(stackAngle));
-                vertex.t = 0.5 - log((1 + sinLatitude) / (1 - sinLatitude)) / (4 * M_PI);
-
-            }else{
-                vertex.t = (stackRef - stackAngle) / 180;
-            }
-            minT = fmin(minT, vertex.t);
-            maxT = fmax(maxT, vertex.t);
-
-            tmpVertices.push_back(vertex);
-        }
-    }
-
-    float scaleT = maxT - minT;
-    float scaleS = maxS - minS;
-    _vertices.clear();
-    _texCoords.clear();
-    _normals.clear();
-    Vertex v1, v2, v3, v4;                          // 4 vertex positions and texture coords
-    int i, j, vi1, vi2;
-    QVector3D _n;
-    for(i = 0; i < _stackCount; ++i){
-        vi1 = i * (_sectorCount + 1);                // index of tmpVertices
-        vi2 = (i + 1) * (_sectorCount + 1);
-        stackAngle = stackRef - i * stackStep;
-        for(j = 0; j < _sectorCount; ++j, ++vi1, ++vi2){
-            // get 4 vertices per sector
-            //  v1--v3
-            //  |    |
-            //  v2--v4
-
-            v1 = tmpVertices[vi1];
-            v2 = tmpVertices[vi2];
-            v3 = tmpVertices[vi1 + 1];
-            v4 = tmpVertices[vi2 + 1];
-
-            if(scale){
-                v1.s = (v1.s - minS) / scaleS;
-                v1.t = (v1.t - minT) / scaleT;
-                v2.s = (v2.s - minS) / scaleS;
-                v2.t = (v2.t - minT) / scaleT;
-                v3.s = (v3.s - minS) / scaleS;
-                v3.t = (v3.t - minT) / scaleT;
-                v4.s = (v4.s - minS) / scaleS;
-                v4.t = (v4.t - minT) / scaleT;
-            }
-
-            // 2 triangles per sector excluding 1st and last stacks
-            if(stackAngle < 90){
-                _vertices.push_back(QVector3D(v1.x, v1.y, v1.z));
-                _vertices.push_back(QVector3D(v2.x, v2.y, v2.z));
-                _vertices.push_back(QVector3D(v3.x, v3.y, v3.z));
-
-                _texCoords.push_back(QVector2D(v1.s, v1.t));
-                _texCoords.push_back(QVector2D(v2.s, v2.t));
-                _texCoords.push_back(QVector2D(v3.s, v3.t));
-
-                _n = computeFaceNormal(QVector3D(v1.x,v1.y,v1.z),
-                                       QVector3D(v2.x,v2.y,v2.z),
-                                       QVector3D(v3.x,v3.y,v3.z));
-
-                for(int k = 0; k < 3; ++k)  // same normals for 3 vertices
-                {
-                    _normals.push_back(_n);
-                }
-            }
-
-            if(stackAngle > -90){
-                _vertices.push_back(QVector3D(v3.x, v3.y, v3.z));
-                _vertices.push_back(QVector3D(v2.x, v2.y, v2.z));
-                _vertices.push_back(QVector3D(v4.x, v4.y, v4.z));
-
-                _texCoords.push_back(QVector2D(v3.s, v3.t));
-                _texCoords.push_back(QVector2D(v2.s, v2.t));
-                _texCoords.push_back(QVector2D(v4.s, v4.t));
-
-                _n = computeFaceNormal(QVector3D(v3.x,v3.y,v3.z),
-                                       QVector3D(v2.x,v2.y,v2.z),
-                                       QVector3D(v4.x,v4.y,v4.z));
-
-                for(int k = 0; k < 3; ++k)  // same normals for 3 vertices
-                {
-                    _normals.push_back(_n);
-                }
-            }
-        }
-    }
-    return true;
-}
-
 int Viewer3DTerrainGeometry::radius() const
 {
     return _radius;
@@ -552,3 +456,18 @@ void Viewer3DTerrainGeometry::setRefCoordinate(const QGeoCoordinate &newRefCoord
     _refCoordinate = newRefCoordinate;
     emit refCoordinateChanged();
 }
+
+QVector3D Viewer3DTerrainGeometry::cameraPosition() const
+{
+    return _cameraPosition;
+}
+
+void Viewer3DTerrainGeometry::setCameraPosition(const QVector3D &newCameraPosition)
+{
+    if (_cameraPosition == newCameraPosition){
+        return;
+    }
+    _cameraPosition = newCameraPosition;
+    emit cameraPositionChanged();
+    updateChunks();
+}
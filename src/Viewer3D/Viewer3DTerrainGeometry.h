@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <QtCore/QByteArray>
+#include <QtCore/QFutureWatcher>
 #include <QtQuick3D/QQuick3DGeometry>
 #include <QtPositioning/QGeoCoordinate>
 #include <QtGui/QVector3D>
@@ -30,6 +32,7 @@ class Viewer3DTerrainGeometry : public QQuick3DGeometry
     Q_PROPERTY(QGeoCoordinate roiMin READ roiMin WRITE setRoiMin NOTIFY roiMinChanged)
     Q_PROPERTY(QGeoCoordinate roiMax READ roiMax WRITE setRoiMax NOTIFY roiMaxChanged)
     Q_PROPERTY(QGeoCoordinate refCoordinate READ refCoordinate WRITE setRefCoordinate NOTIFY refCoordinateChanged)
+    Q_PROPERTY(QVector3D cameraPosition READ cameraPosition WRITE setCameraPosition NOTIFY cameraPositionChanged)
 
 public:
     explicit Viewer3DTerrainGeometry();
@@ -55,21 +58,70 @@ class Viewer3DTerrainGeometry : public QQuick3DGeometry
     QGeoCoordinate refCoordinate() const;
     void setRefCoordinate(const QGeoCoordinate &newRefCoordinate);
 
+    /// Camera position in the local coordinates of the terrain, used to pick the level of detail of each chunk
+    QVector3D cameraPosition() const;
+    void setCameraPosition(const QVector3D &newCameraPosition);
+
 private:
+    /// Snapshot of the grid parameters, so chunks can be built off the gui thread
+    typedef struct TerrainGrid_s
+    {
+        QGeoCoordinate refCoordinate;
+        float stackRef;
+        float sectorRef;
+        float stackStep;
+        float sectorStep;
+        float minS, scaleS;
+        float minT, scaleT;
+    }TerrainGrid_t;
+
+    /// Rectangular block of grid cells which is meshed with a single level of detail
+    typedef struct TerrainChunk_s
+    {
+        int firstStack;
+        int firstSector;
+        int stacks;
+        int sectors;
+        int lodStep;            ///< Grid cells per mesh cell, 0 when not built yet
+        QVector3D center;
+        float extent;
+        QByteArray vertexData;  ///< Interleaved position, normal and uv
+        QByteArray indexData;   ///< Triangle indices local to the chunk
+        QVector3D boundsMin;
+        QVector3D boundsMax;
+    }TerrainChunk_t;
+
+    typedef struct TerrainChunkBuild_s
+    {
+        int chunkIndex;
+        TerrainChunk_t chunk;
+    }TerrainChunkBuild_t;
 
     int _sectorCount;
     int _stackCount;
-    std::vector<QVector3D> _vertices;
-    std::vector<QVector2D> _texCoords;
-    std::vector<QVector3D> _normals;
-
-    void buildTerrain(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale);
-    bool buildTerrain_2(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale);
-
-    QVector3D computeFaceNormal(QVector3D x1, QVector3D x2, QVector3D x3);
-    void changeUpAxis(int from, int to);
+    std::vector<TerrainChunk_t> _chunks;
+    TerrainGrid_t _grid;
+    int _gridGeneration = 0;          ///< Incremented whenever the grid changes, so stale chunk builds are dropped
+    int _chunkBuildGeneration = 0;    ///< Grid generation of the running chunk build
+    bool _chunkUpdatePending = false;
+    QFutureWatcher<QList<TerrainChunkBuild_t>>* _chunkBuildWatcher = nullptr;
+    QVector3D _cameraPosition;
+
+    bool buildTerrainGrid(QGeoCoordinate roiMinCoordinate, QGeoCoordinate roiMaxCoordinate, QGeoCoordinate refCoordinate, bool scale);
+    QVector3D gridPoint(int stack, int sector) const;
+    int chunkLodStep(const TerrainChunk_t& chunk) const;
+    void updateChunks();
+    void chunkBuildFinished();
+    void uploadChunks();
+    static TerrainChunk_t buildChunk(const TerrainGrid_t& grid, TerrainChunk_t chunk);
+
+    static QVector3D computeFaceNormal(QVector3D x1, QVector3D x2, QVector3D x3);
     void clearScene();
 
+    static constexpr int kChunkCells = 8;             ///< Grid cells along each side of a chunk, power of two so all lod levels line up
+    static constexpr float kLodDistanceFactor = 2.0f; ///< Chunks further away than this many chunk sizes drop a level of detail
+    static constexpr int kVertexStride = 8 * sizeof(float);
+
     int _radius;
     QGeoCoordinate _roiMin;
     QGeoCoordinate _roiMax;
@@ -85,4 +137,5 @@ class Viewer3DTerrainGeometry : public QQuick3DGeometry
     void roiMinChanged();
     void roiMaxChanged();
     void refCoordinateChanged();
+    void cameraPositionChanged();
 };
@@ -45,6 +45,7 @@ void Viewer3DTerrainTexture::loadTexture()
         if(!_terrainTileLoader){
             _terrainTileLoader = new MapTileQuery(this);
             connect(_terrainTileLoader, &MapTileQuery::loadingMapCompleted, this, &Viewer3DTerrainTexture::updateTexture);
+            connect(_terrainTileLoader, &MapTileQuery::mapTextureUpdated, this, &Viewer3DTerrainTexture::uploadTexture);
             connect(_terrainTileLoader, &MapTileQuery::textureGeometryReady, this, &Viewer3DTerrainTexture::setTextureGeometry);
         }
         _terrainTileLoader->adaptiveMapTilesLoader(_mapType, _mapId,
@@ -58,18 +59,25 @@ void Viewer3DTerrainTexture::updateTexture()
 {
     MapTileQuery* _extureQuery = qobject_cast<MapTileQuery*>(QObject::sender());
 
+    uploadTexture();
+    disconnect(_terrainTileLoader, &MapTileQuery::mapTileDownloaded, this, &Viewer3DTerrainTexture::setTextureDownloadProgress);
+    disconnect(_terrainTileLoader, &MapTileQuery::loadingMapCompleted, this, &Viewer3DTerrainTexture::updateTexture);
+    disconnect(_terrainTileLoader, &MapTileQuery::mapTextureUpdated, this, &Viewer3DTerrainTexture::uploadTexture);
+    _terrainTileLoader = nullptr;
+    setTextureDownloadProgress(100.0);
+    _extureQuery->deleteLater();
+}
+
+void Viewer3DTerrainTexture::uploadTexture()
+{
+    // Called for every refinement of the atlas while the tiles are streaming in and once more when all of them arrived
     setSize(_terrainTileLoader->getMapSize());
-    setFormat(QQuick3DTextureData::RGBA32F);
+    setFormat(QQuick3DTextureData::RGBA8);
     setHasTransparency(false);
 
     setTextureData(_terrainTileLoader->getMapData());
     setTextureLoaded(true);
     setTextureGeometryDone(true);
-    disconnect(_terrainTileLoader, &MapTileQuery::mapTileDownloaded, this, &Viewer3DTerrainTexture::setTextureDownloadProgress);
-    disconnect(_terrainTileLoader, &MapTileQuery::loadingMapCompleted, this, &Viewer3DTerrainTexture::updateTexture);
-    _terrainTileLoader = nullptr;
-    setTextureDownloadProgress(100.0);
-    _extureQuery->deleteLater();
 }
 
 void Viewer3DTerrainTexture::mapTypeChangedEvent(void)
@@ -184,6 +192,8 @@ void Viewer3DTerrainTexture::setTextureDownloadProgress(float newTextureDownload
 
 void Viewer3DTerrainTexture::setTextureGeometry(MapTileQuery::TileStatistics_t tileInfo)
 {
+    // The terrain mesh is rebuilt on the next texture upload
+    setTextureGeometryDone(false);
     setRoiMinCoordinate(tileInfo.coordinateMin);
     setRoiMaxCoordinate(tileInfo.coordinateMax);
     setTileCount(tileInfo.tileCounts);
@@ -72,6 +72,7 @@ class Viewer3DTerrainTexture : public QQuick3DTextureData
     int _mapId;
 
     void updateTexture();
+    void uploadTexture();
     void setTextureLoaded(bool laoded){_textureLoaded = laoded; emit textureLoadedChanged();}
     void mapTypeChangedEvent(void);
 
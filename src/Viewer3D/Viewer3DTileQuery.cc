@@ -9,7 +9,12 @@
 
 #include "Viewer3DTileQuery.h"
 
+#include <QtCore/QTimer>
+
 #define MAX_TILE_COUNTS     200
+#define COARSE_TILE_COUNTS  4
+#define MAX_ACTIVE_TILE_REQUESTS    8
+#define TEXTURE_UPDATE_INTERVAL     250 // ms
 #define MAX_ZOOM_LEVEL      23
 #define MAX_LATITUDE       85.05112878
 
@@ -23,10 +28,17 @@ enum RequestStat{
 MapTileQuery::MapTileQuery(QObject *parent)
     : QObject{parent}
 {
+    _coarseTilesRemaining = 0;
+    _textureUpdateTimer = new QTimer(this);
+    _textureUpdateTimer->setSingleShot(true);
+    _textureUpdateTimer->setInterval(TEXTURE_UPDATE_INTERVAL);
+    connect(_textureUpdateTimer, &QTimer::timeout, this, &MapTileQuery::mapTextureUpdated);
 }
 
 void MapTileQuery::loadMapTiles(int zoomLevel, QPoint tileMinIndex, QPoint tileMaxIndex)
 {
+    cancelPendingTiles();
+
     _mapTilesLoadStat = RequestStat::STARTED;
     _mapToBeLoaded.clear();
     _mapToBeLoaded.zoomLevel = zoomLevel;
@@ -34,19 +46,110 @@ void MapTileQuery::loadMapTiles(int zoomLevel, QPoint tileMinIndex, QPoint tileM
     _mapToBeLoaded.tileMaxIndex = tileMaxIndex;
     _mapToBeLoaded.init();
 
-    for (int x = tileMinIndex.x(); x <= tileMaxIndex.x(); x++) {
-        for (int y = tileMinIndex.y(); y <= tileMaxIndex.y(); y++) {
-            QString tileKey = getTileKey(_mapId, x, y, zoomLevel);
-            _mapToBeLoaded.tileList.append(tileKey);
-            Viewer3DTileReply* _reply = new Viewer3DTileReply(zoomLevel, x, y, _mapId, this);
-            connect(_reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
-            connect(_reply, &Viewer3DTileReply::tileGiveUp, this, &MapTileQuery::tileGiveUp);
-            connect(_reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
+    // Find the deepest zoom level where only a handful of tiles cover the whole region
+    int levelDiff = 0;
+    for(; levelDiff < zoomLevel; levelDiff++){
+        const int tilesX = (tileMaxIndex.x() >> levelDiff) - (tileMinIndex.x() >> levelDiff) + 1;
+        const int tilesY = (tileMaxIndex.y() >> levelDiff) - (tileMinIndex.y() >> levelDiff) + 1;
+        if(tilesX * tilesY <= COARSE_TILE_COUNTS){
+            break;
         }
     }
+
+    if(levelDiff > 0){
+        const QPoint coarseMinIndex(tileMinIndex.x() >> levelDiff, tileMinIndex.y() >> levelDiff);
+        const QPoint coarseMaxIndex(tileMaxIndex.x() >> levelDiff, tileMaxIndex.y() >> levelDiff);
+        queueTiles(zoomLevel - levelDiff, coarseMinIndex, coarseMaxIndex);
+        _coarseTilesRemaining = _pendingTiles.size();
+    }
+    queueTiles(zoomLevel, tileMinIndex, tileMaxIndex);
+
     totalTilesCount = _mapToBeLoaded.tileList.size();
     downloadedTilesCount = 0;
-    qDebug() << totalTilesCount << "Tiles to be downloaded!!";
+    qDebug() << totalTilesCount << "Tiles to be downloaded!!" << _coarseTilesRemaining << "coarse tiles at zoom" << zoomLevel - levelDiff;
+
+    requestNextTiles();
+}
+
+void MapTileQuery::queueTiles(int zoomLevel, QPoint tileMinIndex, QPoint tileMaxIndex)
+{
+    for (int x = tileMinIndex.x(); x <= tileMaxIndex.x(); x++) {
+        for (int y = tileMinIndex.y(); y <= tileMaxIndex.y(); y++) {
+            _mapToBeLoaded.tileList.append(getTileKey(_mapId, x, y, zoomLevel));
+
+            Viewer3DTileReply::tileInfo_t tile;
+            tile.x = x;
+            tile.y = y;
+            tile.zoomLevel = zoomLevel;
+            tile.mapId = _mapId;
+            _pendingTiles.enqueue(tile);
+        }
+    }
+}
+
+void MapTileQuery::requestNextTiles()
+{
+    while(_activeReplies.size() < MAX_ACTIVE_TILE_REQUESTS && !_pendingTiles.isEmpty()){
+        // Detail tiles wait for the coarse ones, otherwise a late coarse tile would paint over them
+        if(_coarseTilesRemaining > 0 && _pendingTiles.head().zoomLevel == _mapToBeLoaded.zoomLevel){
+            break;
+        }
+
+        const Viewer3DTileReply::tileInfo_t tile = _pendingTiles.dequeue();
+        Viewer3DTileReply* _reply = new Viewer3DTileReply(tile.zoomLevel, tile.x, tile.y, tile.mapId, this);
+        connect(_reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
+        connect(_reply, &Viewer3DTileReply::tileGiveUp, this, &MapTileQuery::tileGiveUp);
+        connect(_reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
+        _activeReplies.append(_reply);
+    }
+}
+
+void MapTileQuery::releaseReply(Viewer3DTileReply* reply)
+{
+    if(!reply){
+        return;
+    }
+    disconnect(reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
+    disconnect(reply, &Viewer3DTileReply::tileGiveUp, this, &MapTileQuery::tileGiveUp);
+    disconnect(reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
+    _activeReplies.removeAll(reply);
+    reply->deleteLater();
+}
+
+void MapTileQuery::cancelPendingTiles()
+{
+    const QList<Viewer3DTileReply*> replies = _activeReplies;
+    for(Viewer3DTileReply* reply : replies){
+        releaseReply(reply);
+    }
+    _pendingTiles.clear();
+    _coarseTilesRemaining = 0;
+    _textureUpdateTimer->stop();
+}
+
+void MapTileQuery::tileFinished(const Viewer3DTileReply::tileInfo_t &tileData, bool painted)
+{
+    QString tileKey = getTileKey(tileData.mapId, tileData.x, tileData.y, tileData.zoomLevel);
+    if(_mapToBeLoaded.tileList.removeAll(tileKey) == 0){
+        return;
+    }
+
+    if(tileData.zoomLevel < _mapToBeLoaded.zoomLevel && _coarseTilesRemaining > 0){
+        _coarseTilesRemaining--;
+    }
+
+    downloadedTilesCount++;
+    emit mapTileDownloaded(100.0 * ((float) downloadedTilesCount/ (float)totalTilesCount));
+
+    if(_mapToBeLoaded.tileList.size() == 0){
+        _mapTilesLoadStat = RequestStat::FINISHED;
+        qDebug() << "All tiles downloaded ";
+        downloadedTilesCount = totalTilesCount;
+        _textureUpdateTimer->stop();
+        emit loadingMapCompleted();
+    }else if(painted && !_textureUpdateTimer->isActive()){
+        _textureUpdateTimer->start();
+    }
 }
 
 MapTileQuery::TileStatistics_t MapTileQuery::findAndLoadMapTiles(int zoomLevel, QGeoCoordinate coordinate_1, QGeoCoordinate coordinate_2)
@@ -173,54 +276,37 @@ QGeoCoordinate MapTileQuery::pixelXYToLatLong(QPoint pixel, int zoomLevel)
 
 void MapTileQuery::tileDone(Viewer3DTileReply::tileInfo_t _tileData)
 {
-    Viewer3DTileReply* reply = qobject_cast<Viewer3DTileReply*>(QObject::sender());
+    releaseReply(qobject_cast<Viewer3DTileReply*>(QObject::sender()));
 
     QString tileKey = getTileKey(_tileData.mapId, _tileData.x, _tileData.y, _tileData.zoomLevel);
-    qsizetype itemRemoved = _mapToBeLoaded.tileList.removeAll(tileKey);
-
-    if(itemRemoved > 0){
-        _mapToBeLoaded.currentTileIndex = QPoint(_tileData.x, _tileData.y);
-        _mapToBeLoaded.currentTileData = _tileData.data;
-        _mapToBeLoaded.currentTileStat = RequestStat::FINISHED;
-        _mapToBeLoaded.setMapTile();
-        downloadedTilesCount++;
-        emit mapTileDownloaded(100.0 * ((float) downloadedTilesCount/ (float)totalTilesCount));
-
-        // qDebug() << _tileData.x << _tileData.y << _tileData.zoomLevel << "tile downloaded!!!" << _mapToBeLoaded.tileList.size();
-
-        if(_mapToBeLoaded.tileList.size() == 0){
-            _mapTilesLoadStat = RequestStat::FINISHED;
-            qDebug() << "All tiles downloaded ";
-            downloadedTilesCount = totalTilesCount;
-            emit loadingMapCompleted();
-        }
-
+    if(_mapToBeLoaded.tileList.contains(tileKey)){
+        const bool painted = _mapToBeLoaded.setMapTile(_tileData.zoomLevel, QPoint(_tileData.x, _tileData.y), _tileData.data);
+        tileFinished(_tileData, painted);
     }
-    disconnect(reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
-    disconnect(reply, &Viewer3DTileReply::tileGiveUp, this, &MapTileQuery::tileGiveUp);
-    disconnect(reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
-    reply->deleteLater();
+    requestNextTiles();
 }
 
 void MapTileQuery::tileGiveUp(Viewer3DTileReply::tileInfo_t _tileData)
 {
-    Viewer3DTileReply* reply = qobject_cast<Viewer3DTileReply*>(QObject::sender());
-    disconnect(reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
-    disconnect(reply, &Viewer3DTileReply::tileGiveUp, this, &MapTileQuery::tileGiveUp);
-    disconnect(reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
-    reply->deleteLater();
+    releaseReply(qobject_cast<Viewer3DTileReply*>(QObject::sender()));
+
+    // Leave whatever coarse imagery is already underneath this tile
+    tileFinished(_tileData, false);
+    requestNextTiles();
 }
 
 void MapTileQuery::tileEmpty(Viewer3DTileReply::tileInfo_t _tileData)
 {
-    Viewer3DTileReply* reply = qobject_cast<Viewer3DTileReply*>(QObject::sender());
-    disconnect(reply, &Viewer3DTileReply::tileDone, this, &MapTileQuery::tileDone);
-    disconnect(reply, &Viewer3DTileReply::tileEmpty, this, &MapTileQuery::tileEmpty);
-    reply->deleteLater();
+    releaseReply(qobject_cast<Viewer3DTileReply*>(QObject::sender()));
+
     if(_tileData.zoomLevel > 0 && _tileData.zoomLevel == _zoomLevel){
         _zoomLevel -= 1;
         emit textureGeometryReady(findAndLoadMapTiles(_zoomLevel, _textureCoordinateMin, _textureCoordinateMax));
+        return;
     }
+
+    tileFinished(_tileData, false);
+    requestNextTiles();
 }
 
 QString MapTileQuery::getTileKey(int mapId, int x, int y, int zoomLevel)
@@ -9,8 +9,8 @@
 
 #pragma once
 
-#include <QtGui/QPixmap>
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
 #include <QtGui/QImage>
 #include <QtGui/QPainter>
 #include <QtCore/QDebug>
@@ -22,74 +22,58 @@
 ///     @author Omid Esrafilian <esrafilian.omid@gmail.com>
 
 
+class QTimer;
+
+/// Streams the map tiles of a region into a fixed-size texture atlas. A few coarse tiles covering the whole region are
+/// loaded first so the terrain is textured right away, then the tiles of the detail zoom level refine the atlas as they arrive.
 class MapTileQuery : public QObject
 {
 
 public:
     typedef struct MapTileContainer_s
     {
-        int L = 256; // length of each square image downloaded tile
+        static constexpr int maxAtlasSize = 4096; // max width/height of the texture atlas, tiles are scaled down to fit
+        int L = 256; // length of each square tile inside the atlas
 
         QList<QString> tileList;
         int zoomLevel;
         QPoint tileMinIndex;
         QPoint tileMaxIndex;
-        int currentTileStat;
-
-        QPoint currentTileIndex;
-        QByteArray currentTileData;
 
         QImage mapTextureImage;
-        // QByteArray mapTextureImageData;
         int mapWidth, mapHeight;
         void init(){
-            mapWidth = (tileMaxIndex.x() - tileMinIndex.x() + 1) * L;
-            mapHeight = (tileMaxIndex.y() - tileMinIndex.y() + 1) * L;
-            mapTextureImage = QImage(mapWidth, mapHeight, QImage::Format_RGBA32FPx4);
+            const int tilesX = tileMaxIndex.x() - tileMinIndex.x() + 1;
+            const int tilesY = tileMaxIndex.y() - tileMinIndex.y() + 1;
+            L = qBound(1, maxAtlasSize / qMax(tilesX, tilesY), 256);
+            mapWidth = tilesX * L;
+            mapHeight = tilesY * L;
+            mapTextureImage = QImage(mapWidth, mapHeight, QImage::Format_RGBA8888);
             mapTextureImage.fill(Qt::gray);
-            // mapTextureImageData.resize(mapWidth * mapHeight * 4 * 4); // 4 channnels and each 4 bytes
-            // mapTextureImageData = QByteArray((char*)mapTextureImage.bits(), mapTextureImage.sizeInBytes());
         }
 
-        void setMapTile(){
-            QPixmap tmpPixmap;
-            tmpPixmap.loadFromData(currentTileData);
-            QImage tmpImage = tmpPixmap.toImage().convertToFormat(QImage::Format_RGBA32FPx4);
+        // Paints a tile into the atlas region it covers. Tiles from coarser zoom levels cover several atlas cells.
+        bool setMapTile(int tileZoomLevel, QPoint tileIndex, const QByteArray &tileData){
+            QImage tileImage;
+            if(tileZoomLevel > zoomLevel || !tileImage.loadFromData(tileData)){
+                return false;
+            }
+
+            const int scale = 1 << (zoomLevel - tileZoomLevel);
+            const QRect targetRect((tileIndex.x() * scale - tileMinIndex.x()) * L,
+                                   (tileIndex.y() * scale - tileMinIndex.y()) * L,
+                                   scale * L,
+                                   scale * L);
 
             QPainter painter(&mapTextureImage);
-            int idxX = (currentTileIndex.x() - tileMinIndex.x()) * L;
-            int idxY = (currentTileIndex.y() - tileMinIndex.y()) * L;
-            painter.drawImage(idxX,
-                              idxY,
-                              tmpImage);
-
-            // int startByteIdx = idxX * mapHeight + idxY;
-            // startByteIdx = startByteIdx * 4 * 4;
-            // QByteArray tmpImageData =  QByteArray::fromRawData((const char*)tmpImage.bits(), tmpImage.sizeInBytes());
-            // memcpy(mapTextureImageData.data() + startByteIdx, tmpImageData.constData(), tmpImageData.size());
-            // mapTextureImageData.replace(startByteIdx, tmpImageData.size(), tmpImageData);
-
-            // QByteArray tmpImageData =  QByteArray::fromRawData((const char*)tmpImage.bits(), tmpImage.sizeInBytes());
-            // for(int i_x=0; i_x<tmpImageData.size(); i_x+=16){
-            //     mapTextureImageData.replace(startByteIdx, 4, tmpImageData.sliced(i_x, 4));
-            //     startByteIdx+=4;
-            //     mapTextureImageData.replace(startByteIdx, 4, tmpImageData.sliced(i_x+4, 4));
-            //     startByteIdx+=4;
-            //     mapTextureImageData.replace(startByteIdx, 4, tmpImageData.sliced(i_x+8, 4));
-            //     startByteIdx+=4;
-            //     mapTextureImageData.replace(startByteIdx, 4, tmpImageData.sliced(i_x+12, 4));
-            //     startByteIdx+=4;
-            //     // mapTextureImageData.replace(startByteIdx, 4, _alphaCh);
-            //     // startByteIdx+=4;
-            // }
-            // qDebug() << startByteIdx << mapTextureImageData.size();
+            painter.setRenderHint(QPainter::SmoothPixmapTransform);
+            painter.drawImage(targetRect, tileImage);
+            return true;
         }
 
         QByteArray getMapData(){
-            QByteArray tmpImageData =  QByteArray::fromRawData((const char*)mapTextureImage.bits(), mapTextureImage.sizeInBytes());
-            tmpImageData.data();
-            return tmpImageData;
-            // return mapTextureImageData;
+            // Deep copy since the atlas keeps being painted while the texture is uploaded
+            return QByteArray(reinterpret_cast<const char*>(mapTextureImage.constBits()), mapTextureImage.sizeInBytes());
         }
 
         void clear(){
@@ -117,12 +101,21 @@ class MapTileQuery : public QObject
     int _mapTilesLoadStat;
     MapTileContainer_t _mapToBeLoaded;
     int totalTilesCount, downloadedTilesCount;
+    QQueue<Viewer3DTileReply::tileInfo_t> _pendingTiles;
+    QList<Viewer3DTileReply*> _activeReplies;
+    int _coarseTilesRemaining;
+    QTimer* _textureUpdateTimer;
     int _mapId;
     int _zoomLevel;
     QString _mapType;
     QGeoCoordinate _textureCoordinateMin, _textureCoordinateMax;
 
     void loadMapTiles(int zoomLevel, QPoint tileMinIndex, QPoint tileMaxIndex);
+    void queueTiles(int zoomLevel, QPoint tileMinIndex, QPoint tileMaxIndex);
+    void requestNextTiles();
+    void releaseReply(Viewer3DTileReply* reply);
+    void cancelPendingTiles();
+    void tileFinished(const Viewer3DTileReply::tileInfo_t &tileData, bool painted);
     TileStatistics_t findAndLoadMapTiles(int zoomLevel, QGeoCoordinate coordinate_1, QGeoCoordinate coordinate_2);
     double valueClip(double n, double _minValue, double _maxValue);
     QPoint latLonToPixelXY(QGeoCoordinate pointCoordinate, int zoomLevel);
@@ -137,6 +130,7 @@ class MapTileQuery : public QObject
 
 signals:
     void loadingMapCompleted();
+    void mapTextureUpdated();
     void mapTileDownloaded(float progress);
     void textureGeometryReady(TileStatistics_t tileInfo);
 };
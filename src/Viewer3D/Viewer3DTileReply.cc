@@ -10,7 +10,10 @@
 #include "Viewer3DTileReply.h"
 
 #include <MapProvider.h>
+#include <QGCCacheTile.h>
+#include <QGCMapEngine.h>
 #include <QGCMapUrlEngine.h>
+#include <QGeoFileTileCacheQGC.h>
 #include <QGeoTileFetcherQGC.h>
 
 #include <QtCore/QFile>
@@ -45,10 +48,9 @@ Viewer3DTileReply::Viewer3DTileReply(int zoomLevel, int tileX, int tileY, int ma
     _tile.mapId = mapId;
     _tile.data.clear();
     _mapId = mapId;
-    prepareDownload();
-
-    _timeoutTimer->start(10000);
     connect(_timeoutTimer, &QTimer::timeout, this, &Viewer3DTileReply::timeoutTimerEvent);
+
+    fetchFromCache();
 }
 
 Viewer3DTileReply::~Viewer3DTileReply()
@@ -57,6 +59,50 @@ Viewer3DTileReply::~Viewer3DTileReply()
     delete _timeoutTimer;
 }
 
+void Viewer3DTileReply::fetchFromCache()
+{
+    // Tiles already seen by the 2D map (or offline tile sets) come straight from the QGC tile cache
+    QGCFetchTileTask *task = QGeoFileTileCacheQGC::createFetchTileTask(UrlFactory::getProviderTypeFromQtMapId(_mapId), _tile.x, _tile.y, _tile.zoomLevel);
+    connect(task, &QGCFetchTileTask::tileFetched, this, &Viewer3DTileReply::cacheTileFetched);
+    connect(task, &QGCMapTask::error, this, &Viewer3DTileReply::cacheFetchError);
+    if (!getQGCMapEngine()->addTask(task)) {
+        task->deleteLater();
+        startDownload();
+    }
+}
+
+void Viewer3DTileReply::cacheTileFetched(QGCCacheTile* tile)
+{
+    if(!tile){
+        startDownload();
+        return;
+    }
+
+    _tile.data = tile->img;
+    delete tile;
+
+    if(_tile.data.isEmpty()){
+        startDownload();
+        return;
+    }
+    emit tileDone(_tile);
+}
+
+void Viewer3DTileReply::cacheFetchError(QGCMapTask::TaskType type, const QString &errorString)
+{
+    Q_UNUSED(type);
+    Q_UNUSED(errorString);
+
+    // Not in the cache, fall back to the network
+    startDownload();
+}
+
+void Viewer3DTileReply::startDownload()
+{
+    prepareDownload();
+    _timeoutTimer->start(10000);
+}
+
 void Viewer3DTileReply::prepareDownload()
 {
     const QNetworkRequest request = QGeoTileFetcherQGC::getNetworkRequest(_mapId, _tile.x, _tile.y, _tile.zoomLevel);
@@ -85,6 +131,13 @@ void Viewer3DTileReply::requestFinished()
         emit tileEmpty(_tile);
         return;
     }
+
+    if(mapProvider && !_tile.data.isEmpty()){
+        const QString format = mapProvider->getImageFormat(_tile.data);
+        if(!format.isEmpty()){
+            QGeoFileTileCacheQGC::cacheTile(mapProvider->getMapName(), _tile.x, _tile.y, _tile.zoomLevel, _tile.data, format);
+        }
+    }
     emit tileDone(_tile);
 }
 
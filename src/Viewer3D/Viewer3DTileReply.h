@@ -11,6 +11,9 @@
 
 #include <QtCore/QObject>
 
+#include "QGCMapTasks.h"
+
+struct QGCCacheTile;
 class QNetworkReply;
 class QNetworkAccessManager;
 class QTimer;
@@ -42,6 +45,10 @@ class Viewer3DTileReply : public QObject
     int _timeoutCounter;
     static QByteArray       _bingNoTileImage;
 
+    void fetchFromCache();
+    void cacheTileFetched(QGCCacheTile* tile);
+    void cacheFetchError(QGCMapTask::TaskType type, const QString &errorString);
+    void startDownload();
     void prepareDownload();
     void requestFinished();
     void requestError();
@@ -2,9 +2,11 @@
 #include "ADSBVehicleManager.h"
 #include "ADSBVehicle.h"
 #include "ADSBTCPLink.h"
+#include "ADSBTargetStore.h"
 #include "QmlObjectListModel.h"
 
 #include <QtNetwork/QTcpServer>
+#include <QtPositioning/QGeoRectangle>
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 
@@ -20,7 +22,6 @@ void ADSBTest::_adsbVehicleTest()
 
     ADSBVehicle* const adsbVehicle = new ADSBVehicle(vehicleInfo, this);
     QVERIFY(adsbVehicle != nullptr);
-    QVERIFY(!adsbVehicle->expired());
 
     QCOMPARE(adsbVehicle->icaoAddress(), vehicleInfo.icaoAddress);
     QCOMPARE(adsbVehicle->callsign(), vehicleInfo.callsign);
@@ -51,7 +52,7 @@ void ADSBTest::_adsbTcpLinkTest()
     ADSBTCPLink* const adsbLink = new ADSBTCPLink(QHostAddress::LocalHost, 30003, this);
     QVERIFY(adsbLink);
     QVERIFY(adsbLink->init());
-    // QSignalSpy spy(adsbLink, &ADSBTCPLink::adsbVehicleUpdate);
+    // QSignalSpy spy(adsbLink, &ADSBTCPLink::adsbVehiclesUpdate);
 
     bool timeout = false;
     QVERIFY(server->waitForNewConnection(1000, &timeout));
@@ -69,6 +70,46 @@ void ADSBTest::_adsbTcpLinkTest()
     server->close();
 }
 
+void ADSBTest::_adsbSbsParserTest()
+{
+    const QByteArray stream =
+        "MSG,1,1,1,4840D6,1,2024/01/01,12:00:00.000,2024/01/01,12:00:00.000,KLM1023 ,,,,,,,,,,,\r\n"
+        "MSG,3,1,1,4840D6,1,2024/01/01,12:00:00.000,2024/01/01,12:00:00.000,,38000,,,47.39770,8.54560,,,0,0,0,0\r\n"
+        "MSG,4,1,1,4840D6,1,2024/01/01,12:00:00.000,2024/01/01,12:00:00.000,,,450,90,,,-640,,,,,\r\n"
+        "MSG,3,1,1,3C6586,1,2024/01/01,12:00:00.000,2024/01/01,12:00:00.000,,12000H,,,47.50000,8.60000,,,0,1,0,0\r\n"
+        "MSG,8,1,1,3C6586,1,2024/01/01,12:00:00.000,2024/01/01,12:00:00.000,,,,,,,,,,,,0\r\n"
+        "MSG,3,1,1,4840D6,1,2024/01/01,12:00:00.500,2024/01/01,12:00:00.500,,38000,,,47.39800,8.54600,,,0,0,0,0\r\n"
+        "MSG,3,1,1,3C65";
+
+    QHash<uint32_t, ADSB::VehicleInfo_t> updates;
+    const qsizetype consumed = ADSBTCPLink::parseSBS(stream, updates, 100);
+
+    // The trailing partial line is left for the next read
+    QCOMPARE(consumed, stream.lastIndexOf('\n') + 1);
+
+    // Updates for the same vehicle are merged into a single entry
+    QCOMPARE(updates.count(), 2);
+
+    const ADSB::VehicleInfo_t klm = updates.value(0x4840D6);
+    QCOMPARE(klm.icaoAddress, 0x4840D6U);
+    QCOMPARE(klm.callsign, QStringLiteral("KLM1023"));
+    QCOMPARE(klm.location.latitude(), 47.398);
+    QCOMPARE(klm.location.longitude(), 8.546);
+    QCOMPARE(klm.location.altitude(), 38000 * 0.3048);
+    QCOMPARE(klm.heading, 90.);
+    QVERIFY(klm.availableFlags.testFlags(ADSB::CallsignAvailable | ADSB::LocationAvailable | ADSB::HeadingAvailable | ADSB::VerticalVelAvailable));
+
+    const ADSB::VehicleInfo_t other = updates.value(0x3C6586);
+    QCOMPARE(other.location.altitude(), 12000 * 0.3048);
+    QVERIFY(other.alert);
+    QVERIFY(!other.availableFlags.testFlag(ADSB::CallsignAvailable));
+
+    // Line limit
+    updates.clear();
+    QCOMPARE(ADSBTCPLink::parseSBS(stream, updates, 1), stream.indexOf('\n') + 1);
+    QCOMPARE(updates.count(), 1);
+}
+
 void ADSBTest::_adsbVehicleManagerTest()
 {
     ADSBVehicleManager* const manager = ADSBVehicleManager::instance();
@@ -87,3 +128,106 @@ void ADSBTest::_adsbVehicleManagerTest()
     manager->adsbVehicleUpdate(vehicleInfo);
     QCOMPARE(manager->adsbVehicles()->count(), 1);
 }
+
+void ADSBTest::_adsbVisibleRegionTest()
+{
+    ADSBVehicleManager* const manager = ADSBVehicleManager::instance();
+    const auto publishedTargets = [manager]() {
+        QList<uint32_t> targets;
+        for (int i = 0; i < manager->adsbVehicles()->count(); i++) {
+            targets.append(manager->adsbVehicles()->value<const ADSBVehicle*>(i)->icaoAddress());
+        }
+        return targets;
+    };
+
+    const QGeoCoordinate centerA(47.3977, 8.5456);
+    const QGeoCoordinate centerB(-33.8688, 151.2093);
+    const QGeoRectangle regionA(centerA.atDistanceAndAzimuth(5000., 315.), centerA.atDistanceAndAzimuth(5000., 135.));
+    const QGeoRectangle regionB(centerB.atDistanceAndAzimuth(5000., 315.), centerB.atDistanceAndAzimuth(5000., 135.));
+
+    ADSB::VehicleInfo_t vehicleInfo{};
+    vehicleInfo.availableFlags = ADSB::LocationAvailable;
+    vehicleInfo.icaoAddress = 10;
+    vehicleInfo.location = centerA;
+    manager->adsbVehicleUpdate(vehicleInfo);
+    vehicleInfo.icaoAddress = 11;
+    vehicleInfo.location = centerB;
+    manager->adsbVehicleUpdate(vehicleInfo);
+
+    // Let the throttle window run out so the first region change is published right away
+    QTest::qWait(kPublishSettleMs);
+    manager->setVisibleRegion(regionA);
+    QCOMPARE(publishedTargets(), QList<uint32_t>({ 10 }));
+
+    // A pan inside the throttle window with no new traffic must still be published once the window ends
+    manager->setVisibleRegion(regionB);
+    QTRY_COMPARE_WITH_TIMEOUT(publishedTargets(), QList<uint32_t>({ 11 }), kPublishSettleMs);
+
+    manager->setVisibleRegion(QGeoShape());
+    QTest::qWait(kPublishSettleMs);
+}
+
+void ADSBTest::_adsbTargetStoreTest()
+{
+    ADSBTargetStore store;
+    const QGeoCoordinate center(47.3977, 8.5456);
+
+    ADSB::VehicleInfo_t vehicleInfo{};
+    vehicleInfo.icaoAddress = 1;
+    vehicleInfo.availableFlags = ADSB::CallsignAvailable;
+    vehicleInfo.callsign = QStringLiteral("1");
+
+    // Targets without a location are not tracked
+    QVERIFY(!store.update(vehicleInfo, 0));
+    QCOMPARE(store.count(), 0);
+
+    // 1: 1km north, 2: 20km east, 3: far away in a different cell
+    vehicleInfo.availableFlags = ADSB::LocationAvailable;
+    vehicleInfo.location = center.atDistanceAndAzimuth(1000., 0.);
+    QVERIFY(store.update(vehicleInfo, 0));
+    vehicleInfo.icaoAddress = 2;
+    vehicleInfo.location = center.atDistanceAndAzimuth(20000., 90.);
+    QVERIFY(store.update(vehicleInfo, 0));
+    vehicleInfo.icaoAddress = 3;
+    vehicleInfo.location = QGeoCoordinate(-33.8688, 151.2093);
+    QVERIFY(store.update(vehicleInfo, 1000));
+    QCOMPARE(store.count(), 3);
+
+    // Updates merge fields and do not add
+    vehicleInfo.icaoAddress = 1;
+    vehicleInfo.availableFlags = ADSB::CallsignAvailable;
+    vehicleInfo.callsign = QStringLiteral("ONE");
+    QVERIFY(!store.update(vehicleInfo, 0));
+    QCOMPARE(store.count(), 3);
+    QCOMPARE(store.vehicleInfo(1).callsign, QStringLiteral("ONE"));
+    QVERIFY(store.vehicleInfo(1).availableFlags.testFlag(ADSB::LocationAvailable));
+
+    QList<uint32_t> targets = store.targetsWithinRadius(center, 5000.);
+    QCOMPARE(targets, QList<uint32_t>({ 1 }));
+    targets = store.targetsWithinRadius(center, 25000.);
+    std::sort(targets.begin(), targets.end());
+    QCOMPARE(targets, QList<uint32_t>({ 1, 2 }));
+
+    const QGeoRectangle region(center.atDistanceAndAzimuth(5000., 315.), center.atDistanceAndAzimuth(5000., 135.));
+    QCOMPARE(store.targetsWithinRegion(region), QList<uint32_t>({ 1 }));
+
+    // Moving a target across cells keeps the index up to date
+    vehicleInfo.icaoAddress = 3;
+    vehicleInfo.availableFlags = ADSB::LocationAvailable;
+    vehicleInfo.location = center.atDistanceAndAzimuth(2000., 180.);
+    QVERIFY(!store.update(vehicleInfo, 1000));
+    targets = store.targetsWithinRegion(region);
+    std::sort(targets.begin(), targets.end());
+    QCOMPARE(targets, QList<uint32_t>({ 1, 3 }));
+
+    // Removing from the middle keeps the remaining targets queryable
+    QVERIFY(store.remove(1));
+    QVERIFY(!store.remove(1));
+    QVERIFY(!store.contains(1));
+    QCOMPARE(store.targetsWithinRegion(region), QList<uint32_t>({ 3 }));
+    QCOMPARE(store.vehicleInfo(2).icaoAddress, 2U);
+
+    QCOMPARE(store.removeExpired(1500, 1000), QList<uint32_t>({ 2 }));
+    QCOMPARE(store.count(), 1);
+    QCOMPARE(store.targetsWithinRadius(center, 25000.), QList<uint32_t>({ 3 }));
+}
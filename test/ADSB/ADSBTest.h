@@ -9,5 +9,11 @@ class ADSBTest : public UnitTest
 private slots:
     void _adsbVehicleTest();
     void _adsbTcpLinkTest();
+    void _adsbSbsParserTest();
     void _adsbVehicleManagerTest();
+    void _adsbTargetStoreTest();
+    void _adsbVisibleRegionTest();
+
+private:
+    static constexpr int kPublishSettleMs = 500;    ///< Comfortably longer than the ADSBVehicleManager publish throttle
 };
@@ -59,3 +59,51 @@ void LogDownloadTest::_downloadTest()
 
     (void) QFile::remove(downloadFile);
 }
+
+void LogDownloadTest::_downloadWithLossTest()
+{
+    MultiVehicleManager::instance()->init();
+    MAVLinkProtocol::instance()->init();
+
+    _connectMockLink(MAV_AUTOPILOT_PX4);
+
+    // Larger than a single request window with every 7th packet lost so gaps must be re-requested
+    _mockLink->setLogDownloadFileSize(64 * 1024);
+    _mockLink->setLogDownloadDropInterval(7);
+
+    LogDownloadController *const controller = new LogDownloadController(this);
+    MultiSignalSpyV2 *multiSpyLogDownloadController = new MultiSignalSpyV2(this);
+    QVERIFY(multiSpyLogDownloadController->init(controller));
+
+    controller->refresh();
+    QVERIFY(multiSpyLogDownloadController->waitForSignal("requestingListChanged", 10000));
+    multiSpyLogDownloadController->clearAllSignals();
+    if (controller->_getRequestingList()) {
+        QVERIFY(multiSpyLogDownloadController->waitForSignal("requestingListChanged", 10000));
+        QCOMPARE(controller->_getRequestingList(), false);
+    }
+    multiSpyLogDownloadController->clearAllSignals();
+
+    QmlObjectListModel *const model = controller->_getModel();
+    QVERIFY(model);
+    QGCLogEntry *const entry = model->value<QGCLogEntry*>(0);
+    QCOMPARE(entry->size(), 64u * 1024u);
+    entry->setSelected(true);
+
+    const QString downloadTo = QDir::currentPath();
+    controller->download(downloadTo);
+    QVERIFY(multiSpyLogDownloadController->waitForSignal("downloadingLogsChanged", 10000));
+    multiSpyLogDownloadController->clearAllSignals();
+    if (controller->_getDownloadingLogs()) {
+        QVERIFY(multiSpyLogDownloadController->waitForSignal("downloadingLogsChanged", 30000));
+        QCOMPARE(controller->_getDownloadingLogs(), false);
+    }
+    multiSpyLogDownloadController->clearAllSignals();
+
+    QVERIFY(entry->status().startsWith(QStringLiteral("Downloaded")));
+
+    const QString downloadFile = QDir(downloadTo).filePath("log_0_UnknownDate.ulg");
+    QVERIFY(UnitTest::fileCompare(downloadFile, _mockLink->logDownloadFile()));
+
+    (void) QFile::remove(downloadFile);
+}
@@ -8,4 +8,5 @@ class LogDownloadTest : public UnitTest
 
 private slots:
     void _downloadTest();
+    void _downloadWithLossTest();
 };
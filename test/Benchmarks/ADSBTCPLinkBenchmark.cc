@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ADSBTCPLinkBenchmark.h"
+#include "ADSBTCPLink.h"
+#include "ADSBVehicleManager.h"
+
+#include <QtTest/QTest>
+
+/// Builds an SBS-1 stream with the message mix of busy airspace: position and velocity at 2Hz per aircraft,
+/// identification every 5 seconds, plus surface and squawk messages the parser has to skip
+QByteArray ADSBTCPLinkBenchmark::_buildStream(int aircraftCount, int seconds)
+{
+    QByteArray stream;
+    stream.reserve(static_cast<qsizetype>(aircraftCount) * seconds * 4 * 110);
+
+    const QGeoCoordinate center(47.3977, 8.5456);
+    for (int halfSecond = 0; halfSecond < (seconds * 2); halfSecond++) {
+        const QByteArray time = QStringLiteral("12:%1:%2.%3")
+            .arg(halfSecond / 120, 2, 10, QChar('0'))
+            .arg((halfSecond / 2) % 60, 2, 10, QChar('0'))
+            .arg((halfSecond % 2) * 500, 3, 10, QChar('0')).toLatin1();
+        const QByteArray timestamps = "2024/01/01," + time + ",2024/01/01," + time;
+
+        for (int aircraft = 0; aircraft < aircraftCount; aircraft++) {
+            const QByteArray icao = QByteArray::number(0x400000 + aircraft, 16).toUpper();
+            const QByteArray prefix = "MSG,%1,1,1," + icao + ",1," + timestamps + ",";
+            const double heading = (aircraft * 37) % 360;
+            const QGeoCoordinate position = center.atDistanceAndAzimuth(1000. * (aircraft % 150), aircraft * 7.).atDistanceAndAzimuth(halfSecond * 120., heading);
+
+            if ((halfSecond % 10) == (aircraft % 10)) {
+                stream += QByteArray(prefix).replace("%1", "1") + "QGC" + QByteArray::number(aircraft) + " ,,,,,,,,,,,\r\n";
+            }
+            stream += QByteArray(prefix).replace("%1", "3") + "," + QByteArray::number(1000 + ((aircraft * 100) % 40000)) + ",,,"
+                + QByteArray::number(position.latitude(), 'f', 5) + "," + QByteArray::number(position.longitude(), 'f', 5) + ",,,0,0,0,0\r\n";
+            stream += QByteArray(prefix).replace("%1", "4") + ",,450," + QByteArray::number(heading) + ",,,-640,,,,,\r\n";
+            if ((aircraft % 20) == 0) {
+                stream += QByteArray(prefix).replace("%1", "2") + ",0,12,270,47.45000,8.56000,,,,,,1\r\n";
+                stream += QByteArray(prefix).replace("%1", "6") + ",,,,,,,7000,0,0,0,0\r\n";
+            }
+        }
+    }
+
+    return stream;
+}
+
+void ADSBTCPLinkBenchmark::_benchmarkReplaySBS_data(void)
+{
+    QTest::addColumn<int>("aircraftCount");
+    QTest::addColumn<bool>("updateManager");
+
+    QTest::newRow("parse-300")      << 300  << false;
+    QTest::newRow("parse-1000")     << 1000 << false;
+    QTest::newRow("replay-300")     << 300  << true;
+    QTest::newRow("replay-1000")    << 1000 << true;
+}
+
+/// Replays the stream in processing ticks the same way ADSBTCPLink does, optionally feeding the batched updates to
+/// ADSBVehicleManager
+void ADSBTCPLinkBenchmark::_benchmarkReplaySBS(void)
+{
+    QFETCH(int, aircraftCount);
+    QFETCH(bool, updateManager);
+
+    constexpr int cLinesPerTick = 1000;
+
+    const QByteArray stream = _buildStream(aircraftCount, 30);
+    ADSBVehicleManager* const manager = ADSBVehicleManager::instance();
+
+    QBENCHMARK {
+        QHash<uint32_t, ADSB::VehicleInfo_t> updates;
+        QByteArrayView remaining(stream);
+        while (!remaining.isEmpty()) {
+            const qsizetype consumed = ADSBTCPLink::parseSBS(remaining, updates, cLinesPerTick);
+            QVERIFY(consumed > 0);
+            remaining = remaining.sliced(consumed);
+
+            if (updateManager) {
+                manager->adsbVehiclesUpdate(updates.values());
+            }
+            updates.clear();
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "DecompressionBenchmark.h"
+#include "QGCLZMA.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtTest/QTest>
+
+/// The MockLink component metadata files are representative of what vehicles send
+void DecompressionBenchmark::_addMetaDataFiles(void)
+{
+    QTest::addColumn<QString>("lzmaFilename");
+
+    QTest::newRow("General") << QStringLiteral(":MockLink/General.MetaData.json.xz");
+    QTest::newRow("Parameter") << QStringLiteral(":MockLink/Parameter.MetaData.json.xz");
+}
+
+void DecompressionBenchmark::_benchmarkInflateLZMAFile_data(void)
+{
+    _addMetaDataFiles();
+}
+
+/// Previous path: inflate to a temp file then read it back for parsing
+void DecompressionBenchmark::_benchmarkInflateLZMAFile(void)
+{
+    QFETCH(QString, lzmaFilename);
+
+    const QString decompressedFilename = QDir::temp().absoluteFilePath(QStringLiteral("DecompressionBenchmark.json"));
+
+    QBENCHMARK {
+        QVERIFY(QGCLZMA::inflateLZMAFile(lzmaFilename, decompressedFilename));
+        QFile decompressedFile(decompressedFilename);
+        QVERIFY(decompressedFile.open(QIODevice::ReadOnly));
+        QVERIFY(!QJsonDocument::fromJson(decompressedFile.readAll()).isNull());
+    }
+
+    (void) QFile::remove(decompressedFilename);
+}
+
+void DecompressionBenchmark::_benchmarkInflateLZMAInMemory_data(void)
+{
+    _addMetaDataFiles();
+}
+
+void DecompressionBenchmark::_benchmarkInflateLZMAInMemory(void)
+{
+    QFETCH(QString, lzmaFilename);
+
+    QBENCHMARK {
+        QFile lzmaFile(lzmaFilename);
+        QVERIFY(lzmaFile.open(QIODevice::ReadOnly));
+        bool ok = false;
+        QVERIFY(!QJsonDocument::fromJson(QGCLZMA::inflateLZMA(lzmaFile.readAll(), &ok)).isNull());
+        QVERIFY(ok);
+    }
+}
@@ -0,0 +1,26 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class DecompressionBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkInflateLZMAFile_data(void);
+    void _benchmarkInflateLZMAFile(void);
+    void _benchmarkInflateLZMAInMemory_data(void);
+    void _benchmarkInflateLZMAInMemory(void);
+
+private:
+    static void _addMetaDataFiles(void);
+};
@@ -0,0 +1,108 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "FactBenchmark.h"
+#include "Fact.h"
+
+#include <QtTest/QTest>
+
+void FactBenchmark::_benchmarkSetRawValue_data(void)
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<bool>("typed");
+
+    QTest::newRow("double QVariant") << static_cast<int>(FactMetaData::valueTypeDouble) << false;
+    QTest::newRow("double typed") << static_cast<int>(FactMetaData::valueTypeDouble) << true;
+    QTest::newRow("float QVariant") << static_cast<int>(FactMetaData::valueTypeFloat) << false;
+    QTest::newRow("float typed") << static_cast<int>(FactMetaData::valueTypeFloat) << true;
+    QTest::newRow("int32 QVariant") << static_cast<int>(FactMetaData::valueTypeInt32) << false;
+    QTest::newRow("int32 typed") << static_cast<int>(FactMetaData::valueTypeInt32) << true;
+}
+
+void FactBenchmark::_benchmarkSetRawValue(void)
+{
+    QFETCH(int, type);
+    QFETCH(bool, typed);
+
+    // Every value differs from the previous one so each set goes all the way through to the signals
+    Fact fact(0, QStringLiteral("benchmark"), static_cast<FactMetaData::ValueType_t>(type));
+    QList<double> values;
+    for (int i = 0; i < _valueCount; i++) {
+        values.append(i * 1.5);
+    }
+
+    if (type == FactMetaData::valueTypeInt32) {
+        if (typed) {
+            QBENCHMARK {
+                for (const double value: values) {
+                    fact.setRawValue(static_cast<int>(value));
+                }
+            }
+        } else {
+            QBENCHMARK {
+                for (const double value: values) {
+                    fact.setRawValue(QVariant(static_cast<int>(value)));
+                }
+            }
+        }
+    } else if (typed) {
+        QBENCHMARK {
+            for (const double value: values) {
+                fact.setRawValue(value);
+            }
+        }
+    } else {
+        QBENCHMARK {
+            for (const double value: values) {
+                fact.setRawValue(QVariant(value));
+            }
+        }
+    }
+
+    QCOMPARE(fact.rawValue().toDouble(), (type == FactMetaData::valueTypeInt32) ? static_cast<int>(values.last()) : values.last());
+}
+
+void FactBenchmark::_benchmarkCookedValue_data(void)
+{
+    QTest::addColumn<QString>("units");
+    QTest::addColumn<bool>("typed");
+
+    QTest::newRow("untranslated QVariant") << QString() << false;
+    QTest::newRow("untranslated typed") << QString() << true;
+    QTest::newRow("rad to deg QVariant") << QStringLiteral("rad") << false;
+    QTest::newRow("rad to deg typed") << QStringLiteral("rad") << true;
+}
+
+void FactBenchmark::_benchmarkCookedValue(void)
+{
+    QFETCH(QString, units);
+    QFETCH(bool, typed);
+
+    Fact fact(0, QStringLiteral("benchmark"), FactMetaData::valueTypeDouble);
+    fact.metaData()->setRawUnits(units);
+    fact.setRawValue(0.5);
+
+    double sum = 0;
+    if (typed) {
+        QBENCHMARK {
+            for (int i = 0; i < _valueCount; i++) {
+                sum += fact.cookedValueDouble();
+            }
+        }
+    } else {
+        QBENCHMARK {
+            for (int i = 0; i < _valueCount; i++) {
+                sum += fact.cookedValue().toDouble();
+            }
+        }
+    }
+
+    QCOMPARE(fact.cookedValueDouble(), fact.cookedValue().toDouble());
+    QVERIFY(sum > 0);
+}
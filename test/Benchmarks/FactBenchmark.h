@@ -0,0 +1,26 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class FactBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkSetRawValue_data(void);
+    void _benchmarkSetRawValue(void);
+    void _benchmarkCookedValue_data(void);
+    void _benchmarkCookedValue(void);
+
+private:
+    static constexpr int _valueCount = 1000;
+};
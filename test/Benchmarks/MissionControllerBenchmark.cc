@@ -0,0 +1,75 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MissionControllerBenchmark.h"
+#include "MissionController.h"
+#include "PlanMasterController.h"
+#include "VisualMissionItem.h"
+#include "SettingsManager.h"
+#include "AppSettings.h"
+
+#include <QtTest/QTest>
+
+void MissionControllerBenchmark::init(void)
+{
+    UnitTest::init();
+
+    SettingsManager::instance()->appSettings()->offlineEditingFirmwareClass()->setRawValue(QGCMAVLink::firmwareClass(MAV_AUTOPILOT_PX4));
+    _masterController = new PlanMasterController(this);
+    _masterController->setFlyView(false);
+    _masterController->start();
+    _missionController = _masterController->missionController();
+
+    _masterController->loadFromFile(":/unittest/800Waypoints.mission");
+    QVERIFY(_missionController->visualItems()->count() > 800);
+
+    // Let the initial full recalc complete before measuring
+    QTest::qWait(500);
+}
+
+void MissionControllerBenchmark::cleanup(void)
+{
+    delete _masterController;
+    _masterController   = nullptr;
+    _missionController  = nullptr;
+
+    UnitTest::cleanup();
+}
+
+void MissionControllerBenchmark::_benchmarkWaypointDrag_data(void)
+{
+    QTest::addColumn<double>("itemPosition");
+
+    QTest::newRow("first") << 0.0;
+    QTest::newRow("middle") << 0.5;
+    QTest::newRow("last") << 1.0;
+}
+
+void MissionControllerBenchmark::_benchmarkWaypointDrag(void)
+{
+    QFETCH(double, itemPosition);
+
+    QmlObjectListModel* visualItems = _missionController->visualItems();
+    // The mission ends with an RTL, so walk back to the closest item with a coordinate
+    int itemIndex = qBound(1, static_cast<int>(itemPosition * (visualItems->count() - 1)), visualItems->count() - 1);
+    while (itemIndex > 1 && !visualItems->value<VisualMissionItem*>(itemIndex)->specifiesCoordinate()) {
+        itemIndex--;
+    }
+    VisualMissionItem* item = visualItems->value<VisualMissionItem*>(itemIndex);
+    QVERIFY(item->specifiesCoordinate());
+
+    // Each iteration is a single map drag update: move the waypoint, then run the queued recalcs as a return to the event loop would
+    double azimuth = 0;
+    QBENCHMARK {
+        azimuth = 180 - azimuth;
+        item->setCoordinate(item->coordinate().atDistanceAndAzimuth(1, azimuth));
+        QCoreApplication::sendPostedEvents(_missionController, QEvent::MetaCall);
+    }
+    QVERIFY(_missionController->missionTotalDistance() > 0);
+}
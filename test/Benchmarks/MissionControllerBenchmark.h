@@ -0,0 +1,32 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class MissionController;
+class PlanMasterController;
+
+class MissionControllerBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+protected:
+    void init(void) final;
+    void cleanup(void) final;
+
+private slots:
+    void _benchmarkWaypointDrag_data(void);
+    void _benchmarkWaypointDrag(void);
+
+private:
+    PlanMasterController*   _masterController   = nullptr;
+    MissionController*      _missionController  = nullptr;
+};
@@ -0,0 +1,69 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "SurveyComplexItemBenchmark.h"
+#include "SurveyComplexItem.h"
+#include "QGCMapPolygon.h"
+
+#include <QtTest/QTest>
+
+void SurveyComplexItemBenchmark::init(void)
+{
+    TransectStyleComplexItemTestBase::init();
+
+    // Concave 'E' shaped survey area roughly 1km on a side, which exercises both the single polygon and split polygon paths
+    const QGeoCoordinate origin(47.633550640000003, -122.08982199);
+    static const struct { double x; double y; } rgVertices[] = {
+        { 0, 0 }, { 1000, 0 }, { 1000, 200 }, { 300, 200 }, { 300, 400 }, { 800, 400 }, { 800, 600 },
+        { 300, 600 }, { 300, 800 }, { 1000, 800 }, { 1000, 1000 }, { 0, 1000 },
+    };
+    _polyVertices.clear();
+    for (const auto &vertex: rgVertices) {
+        _polyVertices.append(origin.atDistanceAndAzimuth(vertex.x, 90).atDistanceAndAzimuth(vertex.y, 180));
+    }
+
+    _surveyItem = new SurveyComplexItem(_masterController, false /* flyView */, QString() /* kmlFile */);
+    _surveyItem->surveyAreaPolygon()->appendVertices(_polyVertices);
+    _surveyItem->cameraCalc()->adjustedFootprintSide()->setRawValue(20);
+    _surveyItem->cameraCalc()->adjustedFootprintFrontal()->setRawValue(20);
+    QVERIFY(_surveyItem->_transectCount() > 0);
+}
+
+void SurveyComplexItemBenchmark::cleanup(void)
+{
+    _surveyItem->splitConcavePolygons()->setRawValue(_surveyItem->splitConcavePolygons()->rawDefaultValue());
+
+    TransectStyleComplexItemTestBase::cleanup();
+
+    // Item is deleted when _masterController is deleted
+    _surveyItem = nullptr;
+}
+
+void SurveyComplexItemBenchmark::_benchmarkTransectGeneration_data(void)
+{
+    QTest::addColumn<bool>("splitConcavePolygons");
+
+    QTest::newRow("single") << false;
+    QTest::newRow("split") << true;
+}
+
+void SurveyComplexItemBenchmark::_benchmarkTransectGeneration(void)
+{
+    QFETCH(bool, splitConcavePolygons);
+
+    _surveyItem->splitConcavePolygons()->setRawValue(splitConcavePolygons);
+
+    // Every grid angle change synchronously rebuilds transects, camera shots and flight path segments
+    int gridAngle = 0;
+    QBENCHMARK {
+        gridAngle = (gridAngle + 7) % 180;
+        _surveyItem->gridAngle()->setRawValue(gridAngle);
+    }
+    QVERIFY(_surveyItem->_transectCount() > 0);
+}
@@ -0,0 +1,33 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "TransectStyleComplexItemTestBase.h"
+
+#include <QtPositioning/QGeoCoordinate>
+
+class SurveyComplexItem;
+
+class SurveyComplexItemBenchmark : public TransectStyleComplexItemTestBase
+{
+    Q_OBJECT
+
+protected:
+    void init(void) final;
+    void cleanup(void) final;
+
+private slots:
+    void _benchmarkTransectGeneration_data(void);
+    void _benchmarkTransectGeneration(void);
+
+private:
+    SurveyComplexItem*      _surveyItem = nullptr;
+    QList<QGeoCoordinate>   _polyVertices;
+};
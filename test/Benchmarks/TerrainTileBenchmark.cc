@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TerrainTileBenchmark.h"
+#include "TerrainTile.h"
+
+#include <QtCore/QRandomGenerator>
+#include <QtPositioning/QGeoCoordinate>
+#include <QtTest/QTest>
+
+static constexpr double kSwLat = 47.39;
+static constexpr double kSwLon = 8.54;
+static constexpr double kTileExtentDegrees = 0.01;
+
+/// Builds the serialized form of a gridSize x gridSize tile as stored in the terrain cache
+QByteArray TerrainTileBenchmark::_tileData(int gridSize)
+{
+    TerrainTile::TileInfo_t tileInfo{};
+    tileInfo.swLat = kSwLat;
+    tileInfo.swLon = kSwLon;
+    tileInfo.neLat = kSwLat + kTileExtentDegrees;
+    tileInfo.neLon = kSwLon + kTileExtentDegrees;
+    tileInfo.minElevation = 400;
+    tileInfo.maxElevation = 400 + gridSize + gridSize;
+    tileInfo.avgElevation = 400 + gridSize;
+    tileInfo.gridSizeLat = static_cast<int16_t>(gridSize);
+    tileInfo.gridSizeLon = static_cast<int16_t>(gridSize);
+
+    const int cTileHeaderBytes = static_cast<int>(sizeof(TerrainTile::TileInfo_t));
+    QByteArray result(cTileHeaderBytes + (static_cast<int>(sizeof(int16_t)) * gridSize * gridSize), Qt::Uninitialized);
+    memcpy(result.data(), &tileInfo, cTileHeaderBytes);
+
+    int16_t *const pTileData = reinterpret_cast<int16_t*>(result.data() + cTileHeaderBytes);
+    for (int i = 0; i < gridSize; i++) {
+        for (int j = 0; j < gridSize; j++) {
+            pTileData[(i * gridSize) + j] = static_cast<int16_t>(400 + i + j);
+        }
+    }
+
+    return result;
+}
+
+void TerrainTileBenchmark::_benchmarkConstruct(void)
+{
+    const QByteArray tileData = _tileData(150);
+
+    QBENCHMARK {
+        const TerrainTile tile(tileData);
+        QVERIFY(tile.isValid());
+    }
+}
+
+void TerrainTileBenchmark::_benchmarkElevation(void)
+{
+    constexpr int cLookups = 10000;
+
+    const TerrainTile tile(_tileData(150));
+    QVERIFY(tile.isValid());
+
+    // Fixed seed so every run samples the same coordinates
+    QRandomGenerator random(42);
+    QList<QGeoCoordinate> coordinates;
+    coordinates.reserve(cLookups);
+    for (int i = 0; i < cLookups; i++) {
+        coordinates.append(QGeoCoordinate(kSwLat + (random.generateDouble() * kTileExtentDegrees * 0.999),
+                                          kSwLon + (random.generateDouble() * kTileExtentDegrees * 0.999)));
+    }
+
+    double sum = 0;
+    QBENCHMARK {
+        for (const QGeoCoordinate &coordinate: coordinates) {
+            sum += tile.elevation(coordinate);
+        }
+    }
+    QVERIFY(!qIsNaN(sum));
+}
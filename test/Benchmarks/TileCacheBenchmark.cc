@@ -0,0 +1,120 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TileCacheBenchmark.h"
+#include "QGCTileCacheWorker.h"
+#include "QGCMapTasks.h"
+
+#include <atomic>
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+static const QString kTileType = QStringLiteral("Bing Road");
+static const QString kTileFormat = QStringLiteral("png");
+
+void TileCacheBenchmark::init(void)
+{
+    UnitTest::init();
+
+    // A private worker with its own database. This relies on the application map engine not
+    // having been started (it only starts once a map is shown), since both use the same connection name.
+    _tempDir = new QTemporaryDir();
+    QVERIFY(_tempDir->isValid());
+
+    _worker = new QGCCacheWorker(this);
+    _worker->setDatabaseFile(_tempDir->filePath(QStringLiteral("qgcMapCache.db")));
+
+    QSignalSpy spyTotals(_worker, &QGCCacheWorker::updateTotals);
+    QVERIFY(_worker->enqueueTask(new QGCMapTask(QGCMapTask::TaskType::taskInit)));
+    QVERIFY(!spyTotals.isEmpty() || spyTotals.wait(10000));
+
+    _nextTile = 0;
+}
+
+void TileCacheBenchmark::cleanup(void)
+{
+    _worker->stop();
+    QVERIFY(_worker->wait(10000));
+    delete _worker;
+    _worker = nullptr;
+
+    delete _tempDir;
+    _tempDir = nullptr;
+
+    UnitTest::cleanup();
+}
+
+QString TileCacheBenchmark::_tileHash(int tile)
+{
+    return QString::asprintf("%010d%08d%08d%03d", 1, tile % 1000, tile / 1000, 18);
+}
+
+void TileCacheBenchmark::_saveTiles(int firstTile, int count)
+{
+    // Typical 256x256 png tile size
+    static const QByteArray image(20 * 1024, 'x');
+
+    for (int tile = firstTile; tile < firstTile + count; tile++) {
+        QGCCacheTile *const cacheTile = new QGCCacheTile(_tileHash(tile), image, kTileFormat, kTileType);
+        (void) _worker->enqueueTask(new QGCSaveTileTask(cacheTile));
+    }
+}
+
+/// Tasks are processed in order, so a round trip through the queue means everything before it is done
+bool TileCacheBenchmark::_waitForWorker(void)
+{
+    QGCFetchTileTask *const fenceTask = new QGCFetchTileTask(_tileHash(0));
+    QSignalSpy spyFetched(fenceTask, &QGCFetchTileTask::tileFetched);
+    if (!_worker->enqueueTask(fenceTask)) {
+        return false;
+    }
+    // The worker thread may have already emitted by the time we get here
+    if (spyFetched.isEmpty() && !spyFetched.wait(10000)) {
+        return false;
+    }
+
+    delete spyFetched.at(0).at(0).value<QGCCacheTile*>();
+    return true;
+}
+
+void TileCacheBenchmark::_benchmarkSaveTile(void)
+{
+    QBENCHMARK {
+        _saveTiles(_nextTile, _tilesPerIteration);
+        _nextTile += _tilesPerIteration;
+        QVERIFY(_waitForWorker());
+    }
+}
+
+void TileCacheBenchmark::_benchmarkGetTile(void)
+{
+    constexpr int cTileCount = 1000;
+
+    _saveTiles(0, cTileCount);
+    QVERIFY(_waitForWorker());
+
+    std::atomic_int fetchedCount = 0;
+    int nextTile = 0;
+    QBENCHMARK {
+        fetchedCount = 0;
+        for (int i = 0; i < _tilesPerIteration; i++) {
+            QGCFetchTileTask *const task = new QGCFetchTileTask(_tileHash(nextTile));
+            nextTile = (nextTile + 1) % cTileCount;
+            (void) connect(task, &QGCFetchTileTask::tileFetched, task, [&fetchedCount](QGCCacheTile *tile) {
+                delete tile;
+                fetchedCount++;
+            }, Qt::DirectConnection);
+            (void) _worker->enqueueTask(task);
+        }
+        QVERIFY(_waitForWorker());
+        QCOMPARE(fetchedCount.load(), _tilesPerIteration);
+    }
+}
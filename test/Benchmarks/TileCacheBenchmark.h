@@ -0,0 +1,40 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class QGCCacheWorker;
+class QTemporaryDir;
+
+class TileCacheBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+protected:
+    void init(void) final;
+    void cleanup(void) final;
+
+private slots:
+    void _benchmarkSaveTile(void);
+    void _benchmarkGetTile(void);
+
+private:
+    void _saveTiles     (int firstTile, int count);
+    bool _waitForWorker (void);
+
+    static QString _tileHash(int tile);
+
+    QTemporaryDir*  _tempDir    = nullptr;
+    QGCCacheWorker* _worker     = nullptr;
+    int             _nextTile   = 0;
+
+    static constexpr int _tilesPerIteration = 100;
+};
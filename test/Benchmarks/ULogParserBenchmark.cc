@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ULogParserBenchmark.h"
+#include "ULogParser.h"
+
+#include <QtCore/QtEndian>
+#include <QtTest/QTest>
+
+namespace {
+
+/// Minimal ULog writer, see https://docs.px4.io/main/en/dev_log/ulog_file_format.html
+class ULogBuilder
+{
+public:
+    ULogBuilder()
+    {
+        static constexpr char rgMagic[] = { 'U', 'L', 'o', 'g', 0x01, 0x12, 0x35 };
+        _log.append(rgMagic, sizeof(rgMagic));
+        appendInt<uint8_t>(_log, 1);     // version
+        appendInt<uint64_t>(_log, 0);    // timestamp
+
+        QByteArray flagBits(16, 0);       // compat + incompat flags
+        for (int i = 0; i < 3; i++) {
+            appendInt<uint64_t>(flagBits, 0); // appended offsets
+        }
+        _appendMessage('B', flagBits);
+    }
+
+    void addFormat(const char *format) { _appendMessage('F', QByteArray(format)); }
+
+    void addSubscription(uint16_t msgId, const char *name)
+    {
+        QByteArray payload;
+        appendInt<uint8_t>(payload, 0);  // multi_id
+        appendInt<uint16_t>(payload, msgId);
+        payload.append(name);
+        _appendMessage('A', payload);
+    }
+
+    void addData(uint16_t msgId, const QByteArray &data)
+    {
+        QByteArray payload;
+        appendInt<uint16_t>(payload, msgId);
+        payload.append(data);
+        _appendMessage('D', payload);
+    }
+
+    const QByteArray &log() const { return _log; }
+
+    template<typename T>
+    static void appendInt(QByteArray &buffer, T value)
+    {
+        const T littleEndian = qToLittleEndian(value);
+        buffer.append(reinterpret_cast<const char*>(&littleEndian), sizeof(T));
+    }
+
+    template<typename T>
+    static void appendRaw(QByteArray &buffer, T value)
+    {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+private:
+    void _appendMessage(char type, const QByteArray &payload)
+    {
+        appendInt<uint16_t>(_log, static_cast<uint16_t>(payload.size()));
+        appendInt<uint8_t>(_log, static_cast<uint8_t>(type));
+        _log.append(payload);
+    }
+
+    QByteArray _log;
+};
+
+} // namespace
+
+/// Builds a log with camera_capture samples interleaved with a higher rate topic the parser has to skip over
+QByteArray ULogParserBenchmark::_buildLog(int cameraCaptureCount, int attitudeCount)
+{
+    constexpr uint16_t cCameraCaptureMsgId = 0;
+    constexpr uint16_t cAttitudeMsgId = 1;
+
+    ULogBuilder builder;
+    builder.addFormat("camera_capture:uint64_t timestamp;uint64_t timestamp_utc;uint32_t seq;double lat;double lon;float alt;float ground_distance;float[4] q;uint8_t result;");
+    builder.addFormat("vehicle_attitude:uint64_t timestamp;float[4] q;");
+    builder.addSubscription(cCameraCaptureMsgId, "camera_capture");
+    builder.addSubscription(cAttitudeMsgId, "vehicle_attitude");
+
+    const int attitudePerCapture = qMax(1, attitudeCount / qMax(1, cameraCaptureCount));
+    uint64_t timestamp = 1000000;
+    for (int capture = 0; capture < cameraCaptureCount; capture++) {
+        for (int i = 0; i < attitudePerCapture; i++) {
+            QByteArray attitude;
+            ULogBuilder::appendInt<uint64_t>(attitude, timestamp);
+            for (int j = 0; j < 4; j++) {
+                ULogBuilder::appendRaw<float>(attitude, (j == 0) ? 1.0f : 0.0f);
+            }
+            builder.addData(cAttitudeMsgId, attitude);
+            timestamp += 4000;
+        }
+
+        QByteArray cameraCapture;
+        ULogBuilder::appendInt<uint64_t>(cameraCapture, timestamp);
+        ULogBuilder::appendInt<uint64_t>(cameraCapture, 1700000000000000ULL + timestamp);
+        ULogBuilder::appendInt<uint32_t>(cameraCapture, static_cast<uint32_t>(capture + 1));
+        ULogBuilder::appendRaw<double>(cameraCapture, 47.3977 + (capture * 1e-5));
+        ULogBuilder::appendRaw<double>(cameraCapture, 8.5456);
+        ULogBuilder::appendRaw<float>(cameraCapture, 500.0f);
+        ULogBuilder::appendRaw<float>(cameraCapture, 50.0f);
+        for (int j = 0; j < 4; j++) {
+            ULogBuilder::appendRaw<float>(cameraCapture, (j == 0) ? 1.0f : 0.0f);
+        }
+        ULogBuilder::appendInt<uint8_t>(cameraCapture, 1);
+        builder.addData(cCameraCaptureMsgId, cameraCapture);
+    }
+
+    return builder.log();
+}
+
+void ULogParserBenchmark::_benchmarkGetTagsFromLog(void)
+{
+    constexpr int cCaptures = 1000;
+
+    const QByteArray log = _buildLog(cCaptures, 100 * cCaptures);
+
+    QBENCHMARK {
+        QList<GeoTagWorker::CameraFeedbackPacket> cameraFeedback;
+        QString errorMessage;
+        QVERIFY(ULogParser::getTagsFromLog(log, cameraFeedback, errorMessage));
+        QCOMPARE(cameraFeedback.count(), cCaptures);
+    }
+}
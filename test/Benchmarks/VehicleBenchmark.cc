@@ -0,0 +1,254 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "VehicleBenchmark.h"
+#include "FactGroup.h"
+#include "LinkManager.h"
+#include "MAVLinkProtocol.h"
+#include "MissionManager.h"
+#include "MockLink.h"
+#include "MultiVehicleManager.h"
+#include "ParameterManager.h"
+#include "Vehicle.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+/// Typical high rate telemetry mix as sent by an autopilot
+QList<mavlink_message_t> VehicleBenchmark::_telemetryMessages(uint8_t systemId, int count)
+{
+    // Pack on a private channel so we don't disturb the sequence numbers of real links
+    const uint8_t channel = LinkManager::instance()->allocateMavlinkChannel();
+
+    QList<mavlink_message_t> messages;
+    messages.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const uint32_t timeBootMs = static_cast<uint32_t>(i * 10);
+        mavlink_message_t message{};
+        switch (i % 4) {
+        case 0:
+            (void) mavlink_msg_attitude_pack_chan(systemId, MAV_COMP_ID_AUTOPILOT1, channel, &message,
+                                                  timeBootMs, 0.1f, -0.05f, 1.5f, 0.01f, 0.02f, 0.03f);
+            break;
+        case 1:
+            (void) mavlink_msg_global_position_int_pack_chan(systemId, MAV_COMP_ID_AUTOPILOT1, channel, &message,
+                                                             timeBootMs, 473977420 + i, 85455940, 488000, 10000, 100, 0, 0, 9000);
+            break;
+        case 2:
+            (void) mavlink_msg_vfr_hud_pack_chan(systemId, MAV_COMP_ID_AUTOPILOT1, channel, &message,
+                                                 12.0f, 11.5f, 90, 50, 488.0f, 0.5f);
+            break;
+        default:
+            (void) mavlink_msg_altitude_pack_chan(systemId, MAV_COMP_ID_AUTOPILOT1, channel, &message,
+                                                  timeBootMs * 1000ULL, 488.0f, 488.0f, 10.0f, 10.0f, 9.0f, 10.0f);
+            break;
+        }
+        messages.append(message);
+    }
+
+    LinkManager::instance()->freeMavlinkChannel(channel);
+
+    return messages;
+}
+
+void VehicleBenchmark::_benchmarkReceiveBytes(void)
+{
+    _connectMockLink(MAV_AUTOPILOT_PX4);
+
+    QByteArray stream;
+    for (const mavlink_message_t &message: _telemetryMessages(static_cast<uint8_t>(_mockLink->vehicleId()), _messageCount)) {
+        uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        stream.append(reinterpret_cast<const char*>(buffer), len);
+    }
+
+    // Parse, status/loss accounting and signal fan out to the Vehicle and all other listeners
+    MAVLinkProtocol *const mavlinkProtocol = MAVLinkProtocol::instance();
+    QBENCHMARK {
+        mavlinkProtocol->receiveBytes(_mockLink, stream);
+    }
+}
+
+void VehicleBenchmark::_benchmarkMessageDispatch(void)
+{
+    _connectMockLink(MAV_AUTOPILOT_PX4);
+
+    const QList<mavlink_message_t> messages = _telemetryMessages(static_cast<uint8_t>(_mockLink->vehicleId()), _messageCount);
+
+    QBENCHMARK {
+        for (const mavlink_message_t &message: messages) {
+            _vehicle->_mavlinkMessageReceived(_mockLink, message);
+        }
+    }
+}
+
+void VehicleBenchmark::_connectValueChangedCounter(FactGroup *factGroup)
+{
+    for (const QString &name: factGroup->factNames()) {
+        _notificationConnections.append(connect(factGroup->getFact(name), &Fact::valueChanged, this, [this]() { _notificationCount++; }));
+    }
+    for (FactGroup *const childGroup: factGroup->factGroups()) {
+        _connectValueChangedCounter(childGroup);
+    }
+}
+
+void VehicleBenchmark::_disconnectValueChangedCounters()
+{
+    for (const QMetaObject::Connection &connection: _notificationConnections) {
+        (void) disconnect(connection);
+    }
+    _notificationConnections.clear();
+}
+
+void VehicleBenchmark::_benchmarkFactNotificationRate(void)
+{
+    // Each Fact::valueChanged is a re-evaluation of every QML binding on value/valueString, so the rate of those
+    // signals across all vehicles is what the UI has to keep up with.
+    MultiVehicleManager *const multiVehicleManager = MultiVehicleManager::instance();
+    QSignalSpy spyVehicleAdded(multiVehicleManager, &MultiVehicleManager::vehicleAdded);
+
+    QList<MockLink*> mockLinks;
+    for (int i = 0; i < _notificationVehicleCount; i++) {
+        mockLinks.append(MockLink::startPX4MockLink(false));
+    }
+    while (multiVehicleManager->vehicles()->count() < _notificationVehicleCount) {
+        QVERIFY(spyVehicleAdded.wait(10000));
+    }
+    // Base class cleanup takes care of the first link
+    _mockLink = mockLinks.first();
+
+    _disconnectValueChangedCounters();
+    _notificationCount = 0;
+    QList<QList<mavlink_message_t>> vehicleMessages;
+    for (int i = 0; i < _notificationVehicleCount; i++) {
+        Vehicle *const vehicle = multiVehicleManager->vehicles()->value<Vehicle*>(i);
+        _connectValueChangedCounter(vehicle);
+        vehicleMessages.append(_telemetryMessages(static_cast<uint8_t>(vehicle->id()), _messageCount));
+    }
+
+    int messageIndex = 0;
+    QElapsedTimer measureTimer;
+    measureTimer.start();
+    while (measureTimer.elapsed() < _notificationMeasureMsecs) {
+        for (int i = 0; i < _notificationVehicleCount; i++) {
+            Vehicle *const vehicle = multiVehicleManager->vehicles()->value<Vehicle*>(i);
+            for (int j = 0; j < _notificationMessagesPerTick; j++) {
+                vehicle->_mavlinkMessageReceived(mockLinks[i], vehicleMessages[i][(messageIndex + j) % _messageCount]);
+            }
+        }
+        messageIndex += _notificationMessagesPerTick;
+        QTest::qWait(10);
+    }
+
+    const double notificationsPerSecond = _notificationCount * 1000.0 / measureTimer.elapsed();
+    _disconnectValueChangedCounters();
+    QTest::setBenchmarkResult(notificationsPerSecond, QTest::Events);
+
+    QSignalSpy spyVehicleRemoved(multiVehicleManager, &MultiVehicleManager::vehicleRemoved);
+    for (int i = 1; i < mockLinks.count(); i++) {
+        mockLinks[i]->disconnect();
+    }
+    while (multiVehicleManager->vehicles()->count() > 1) {
+        QVERIFY(spyVehicleRemoved.wait(10000));
+    }
+}
+
+void VehicleBenchmark::_benchmarkParameterLoad_data(void)
+{
+    QTest::addColumn<int>("autopilot");
+
+    QTest::newRow("PX4") << static_cast<int>(MAV_AUTOPILOT_PX4);
+    QTest::newRow("ArduPilot") << static_cast<int>(MAV_AUTOPILOT_ARDUPILOTMEGA);
+}
+
+void VehicleBenchmark::_benchmarkParameterLoad(void)
+{
+    QFETCH(int, autopilot);
+
+    // Time from link start to a parameter ready vehicle. A full load is a single long running
+    // operation so it is only measured once per run.
+    QSignalSpy spyParamsReady(MultiVehicleManager::instance(), &MultiVehicleManager::parameterReadyVehicleAvailableChanged);
+    QBENCHMARK_ONCE {
+        if (autopilot == MAV_AUTOPILOT_PX4) {
+            _mockLink = MockLink::startPX4MockLink(false);
+        } else {
+            _mockLink = MockLink::startAPMArduCopterMockLink(false);
+        }
+        QVERIFY(spyParamsReady.wait(60000));
+    }
+
+    _vehicle = MultiVehicleManager::instance()->activeVehicle();
+    QVERIFY(_vehicle);
+    QVERIFY(_vehicle->parameterManager()->parametersReady());
+}
+
+QList<MissionItem*> VehicleBenchmark::_missionItems(int count)
+{
+    QList<MissionItem*> missionItems;
+    for (int i = 0; i < count; i++) {
+        MissionItem *const missionItem = new MissionItem();
+        missionItem->setSequenceNumber(i);
+        missionItem->setCommand(MAV_CMD_NAV_WAYPOINT);
+        missionItem->setFrame(MAV_FRAME_GLOBAL_RELATIVE_ALT);
+        missionItem->setParam5(47.3769 + (i * 0.0001));
+        missionItem->setParam6(8.549444);
+        missionItem->setParam7(50);
+        missionItems.append(missionItem);
+    }
+
+    return missionItems;
+}
+
+void VehicleBenchmark::_benchmarkMissionTransfer_data(void)
+{
+    QTest::addColumn<int>("autopilot");
+    QTest::addColumn<bool>("download");
+
+    // Generic firmware falls back to the strict one item per round trip protocol
+    QTest::newRow("ArduPilot upload") << static_cast<int>(MAV_AUTOPILOT_ARDUPILOTMEGA) << false;
+    QTest::newRow("ArduPilot download") << static_cast<int>(MAV_AUTOPILOT_ARDUPILOTMEGA) << true;
+    QTest::newRow("Generic upload") << static_cast<int>(MAV_AUTOPILOT_GENERIC) << false;
+    QTest::newRow("Generic download") << static_cast<int>(MAV_AUTOPILOT_GENERIC) << true;
+}
+
+void VehicleBenchmark::_benchmarkMissionTransfer(void)
+{
+    QFETCH(int, autopilot);
+    QFETCH(bool, download);
+
+    static constexpr int transferWaitMsecs = 300000;
+
+    _connectMockLink(static_cast<MAV_AUTOPILOT>(autopilot));
+    _mockLink->setMissionItemLinkSimulation(_missionLinkLatencyMsecs, 0);
+
+    MissionManager *const missionManager = _vehicle->missionManager();
+    QSignalSpy spySendComplete(missionManager, &MissionManager::sendComplete);
+    QSignalSpy spyNewItems(missionManager, &MissionManager::newMissionItemsAvailable);
+
+    if (download) {
+        missionManager->writeMissionItems(_missionItems(_missionItemCount));
+        QVERIFY(spySendComplete.wait(transferWaitMsecs));
+        QCOMPARE(spySendComplete.first().first().toBool(), false);
+
+        QBENCHMARK_ONCE {
+            missionManager->loadFromVehicle();
+            QVERIFY(spyNewItems.wait(transferWaitMsecs));
+        }
+    } else {
+        QBENCHMARK_ONCE {
+            missionManager->writeMissionItems(_missionItems(_missionItemCount));
+            QVERIFY(spySendComplete.wait(transferWaitMsecs));
+        }
+        QCOMPARE(spySendComplete.first().first().toBool(), false);
+    }
+
+    // Only ArduPilot stores the home position as item 0
+    QCOMPARE(missionManager->missionItems().count(), (autopilot == MAV_AUTOPILOT_ARDUPILOTMEGA) ? _missionItemCount : _missionItemCount - 1);
+}
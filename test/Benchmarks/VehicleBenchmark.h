@@ -0,0 +1,50 @@
+/****************************************************************************
+ *
+ * (c) 2009-2020 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+#include "MAVLinkLib.h"
+
+class FactGroup;
+class MissionItem;
+
+class VehicleBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkReceiveBytes(void);
+    void _benchmarkMessageDispatch(void);
+    void _benchmarkFactNotificationRate(void);
+    void _benchmarkParameterLoad_data(void);
+    void _benchmarkParameterLoad(void);
+    void _benchmarkMissionTransfer_data(void);
+    void _benchmarkMissionTransfer(void);
+
+private:
+    static QList<mavlink_message_t> _telemetryMessages(uint8_t systemId, int count);
+    static QList<MissionItem*> _missionItems(int count);
+    /// Counts Fact::valueChanged into _notificationCount, connections are added to _notificationConnections
+    void _connectValueChangedCounter(FactGroup *factGroup);
+    void _disconnectValueChangedCounters();
+
+    /// Multiple of 256 so sequence numbers wrap cleanly when the same stream is fed repeatedly
+    static constexpr int _messageCount = 1024;
+
+    static constexpr int _notificationVehicleCount = 4;
+    static constexpr int _notificationMeasureMsecs = 3000;
+    static constexpr int _notificationMessagesPerTick = 10;  ///< Per vehicle every 10 msecs, so 1000 messages a second
+
+    static constexpr int _missionItemCount = 500;
+    static constexpr int _missionLinkLatencyMsecs = 50;     ///< Each way, so a 100 msec round trip
+
+    int _notificationCount = 0;
+    QList<QMetaObject::Connection> _notificationConnections;
+};
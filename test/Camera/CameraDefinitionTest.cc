@@ -0,0 +1,158 @@
+#include "CameraDefinitionTest.h"
+#include "CameraDefinition.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+namespace {
+
+constexpr const char *kDefinition = R"(<?xml version="1.0" encoding="UTF-8" ?>
+<mavlinkcamera>
+    <definition version="3">
+        <model>SD II</model>
+        <vendor>Super Dupper Industries</vendor>
+    </definition>
+    <parameters>
+        <parameter name="CAM_MODE" type="uint32" default="1" control="0">
+            <description>Camera Mode</description>
+            <updates>
+                <update>CAM_ISO</update>
+            </updates>
+            <options>
+                <option name="Photo" value="0">
+                    <exclusions>
+                        <exclude>CAM_VIDRES</exclude>
+                    </exclusions>
+                </option>
+                <option name="Video" value="1">
+                    <parameterranges>
+                        <parameterrange parameter="CAM_ISO" condition="CAM_EXPMODE=1">
+                            <roption name="100" value="100" />
+                            <roption name="200" value="200" />
+                        </parameterrange>
+                    </parameterranges>
+                </option>
+            </options>
+        </parameter>
+        <parameter name="CAM_WBMODE" type="uint32" default="0">
+            <description>White Balance Mode</description>
+            <options>
+                <option name="Auto" value="0" />
+                <option name="Black &amp; White" value="1" />
+            </options>
+        </parameter>
+    </parameters>
+    <localization>
+        <locale name="pt_BR">
+            <strings original="Camera Mode" translated="Modo de Operação" />
+            <strings original="Auto" translated="Automático" />
+            <strings original="Black &amp; White" translated="Preto e Branco" />
+        </locale>
+    </localization>
+</mavlinkcamera>
+)";
+
+} // namespace
+
+void CameraDefinitionTest::_parseTest()
+{
+    CameraDefinition definition;
+    QString errorString;
+    QVERIFY2(definition.parse(QByteArray(kDefinition), errorString), qPrintable(errorString));
+
+    QCOMPARE(definition.version, 3);
+    QCOMPARE(definition.model, QStringLiteral("SD II"));
+    QCOMPARE(definition.vendor, QStringLiteral("Super Dupper Industries"));
+    QVERIFY(definition.hasParameters);
+    QCOMPARE(definition.parameters.count(), 2);
+
+    const CameraDefinition::Parameter &mode = definition.parameters[0];
+    QCOMPARE(mode.attributes.value(QStringLiteral("name")), QStringLiteral("CAM_MODE"));
+    QCOMPARE(mode.attributes.value(QStringLiteral("control")), QStringLiteral("0"));
+    QCOMPARE(mode.description, QStringLiteral("Camera Mode"));
+    QCOMPARE(mode.updates, QStringList({ QStringLiteral("CAM_ISO") }));
+    QCOMPARE(mode.options.count(), 2);
+    QCOMPARE(mode.options[0].exclusions, QStringList({ QStringLiteral("CAM_VIDRES") }));
+    QCOMPARE(mode.options[1].ranges.count(), 1);
+    QCOMPARE(mode.options[1].ranges[0].parameter, QStringLiteral("CAM_ISO"));
+    QCOMPARE(mode.options[1].ranges[0].condition, QStringLiteral("CAM_EXPMODE=1"));
+    QCOMPARE(mode.options[1].ranges[0].optValues, QStringList({ QStringLiteral("100"), QStringLiteral("200") }));
+
+    QCOMPARE(definition.parameters[1].options[1].name, QStringLiteral("Black & White"));
+    QCOMPARE(definition.locales.count(), 1);
+    QCOMPARE(definition.locales[0].strings.count(), 3);
+}
+
+void CameraDefinitionTest::_malformedTest()
+{
+    CameraDefinition definition;
+    QString errorString;
+
+    QByteArray xml(kDefinition);
+    xml.replace(R"(<option name="Auto" value="0" />)", R"(<option name="Auto" />)");
+    QVERIFY(!definition.parse(xml, errorString));
+    QVERIFY(errorString.contains(QStringLiteral("CAM_WBMODE")));
+
+    xml = QByteArray(kDefinition);
+    xml.replace("</parameters>", "");
+    QVERIFY(!definition.parse(xml, errorString));
+
+    xml = QByteArray(kDefinition);
+    xml.replace(R"(<definition version="3">)", "<definition>");
+    QVERIFY(!definition.parse(xml, errorString));
+}
+
+void CameraDefinitionTest::_localizeTest()
+{
+    CameraDefinition definition;
+    QString errorString;
+    QVERIFY(definition.parse(QByteArray(kDefinition), errorString));
+
+    CameraDefinition english = definition;
+    english.localize(QStringLiteral("en_US"));
+    QCOMPARE(english.parameters[0].description, QStringLiteral("Camera Mode"));
+
+    // No direct match, falls back to the first locale for the language
+    CameraDefinition portuguese = definition;
+    portuguese.localize(QStringLiteral("pt-PT"));
+    QCOMPARE(portuguese.parameters[0].description, QStringLiteral("Modo de Operação"));
+    QCOMPARE(portuguese.parameters[1].options[0].name, QStringLiteral("Automático"));
+    QCOMPARE(portuguese.parameters[1].options[1].name, QStringLiteral("Preto e Branco"));
+    // Only whole values are translated
+    QCOMPARE(portuguese.parameters[1].description, QStringLiteral("White Balance Mode"));
+}
+
+void CameraDefinitionTest::_cacheTest()
+{
+    CameraDefinition definition;
+    QString errorString;
+    QVERIFY(definition.parse(QByteArray(kDefinition), errorString));
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString fileName = tempDir.filePath(QStringLiteral("cache/definition.bin"));
+    QVERIFY(definition.save(fileName));
+
+    CameraDefinition cached;
+    QVERIFY(cached.load(fileName));
+    QCOMPARE(cached.version, definition.version);
+    QCOMPARE(cached.model, definition.model);
+    QCOMPARE(cached.vendor, definition.vendor);
+    QCOMPARE(cached.hasParameters, definition.hasParameters);
+    QCOMPARE(cached.parameters.count(), definition.parameters.count());
+    QCOMPARE(cached.parameters[0].attributes, definition.parameters[0].attributes);
+    QCOMPARE(cached.parameters[0].options[1].ranges[0].optNames, definition.parameters[0].options[1].ranges[0].optNames);
+    QCOMPARE(cached.locales[0].strings, definition.locales[0].strings);
+
+    // Cache files are keyed by uri and version
+    QVERIFY(CameraDefinition::cacheFileName(QStringLiteral("http://camera/def.xml"), 1) != CameraDefinition::cacheFileName(QStringLiteral("http://camera/def.xml"), 2));
+    QVERIFY(CameraDefinition::cacheFileName(QStringLiteral("http://camera/a.xml"), 1) != CameraDefinition::cacheFileName(QStringLiteral("http://camera/b.xml"), 1));
+
+    // Anything which is not a cache file is rejected
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    (void) file.write(kDefinition);
+    file.close();
+    QVERIFY(!cached.load(fileName));
+}
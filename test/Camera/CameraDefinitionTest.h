@@ -0,0 +1,14 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class CameraDefinitionTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _parseTest();
+    void _malformedTest();
+    void _localizeTest();
+    void _cacheTest();
+};
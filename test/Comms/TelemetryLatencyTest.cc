@@ -0,0 +1,93 @@
+#include "TelemetryLatencyTest.h"
+#include "TelemetryLatency.h"
+
+#include <QtCore/QThread>
+#include <QtTest/QTest>
+
+void TelemetryLatencyTest::_histogramTest()
+{
+    TelemetryLatency::Histogram_t histogram;
+    QCOMPARE(histogram.percentileNsecs(0.5), 0);
+
+    // 90 samples of 100us, 10 samples of 5ms
+    for (int i = 0; i < 90; i++) {
+        histogram.add(100 * 1000);
+    }
+    for (int i = 0; i < 10; i++) {
+        histogram.add(5 * 1000 * 1000);
+    }
+
+    QCOMPARE(histogram.count, 100u);
+    QCOMPARE(histogram.maxNsecs, 5 * 1000 * 1000);
+
+    // Percentiles are reported as the upper bound of the log2 usec bucket
+    QCOMPARE(histogram.percentileNsecs(0.50), 128 * 1000);
+    QCOMPARE(histogram.percentileNsecs(0.90), 128 * 1000);
+    QCOMPARE(histogram.percentileNsecs(0.99), 5 * 1000 * 1000);
+
+    TelemetryLatency::Histogram_t merged;
+    merged.merge(histogram);
+    merged.merge(histogram);
+    QCOMPARE(merged.count, 200u);
+    QCOMPARE(merged.percentileNsecs(0.50), 128 * 1000);
+}
+
+void TelemetryLatencyTest::_stageTest()
+{
+    TelemetryLatency latency;
+    latency.setEnabled(true);
+    latency.setChannelName(1, QStringLiteral("Test Link"));
+
+    const qint64 readNsecs = TelemetryLatency::nowNsecs();
+    QThread::msleep(2);
+    latency.messageParsed(1, MAVLINK_MSG_ID_ATTITUDE, readNsecs);
+    latency.messageDispatched();
+    latency.factValueChanged();
+    // Only the first fact change of a message counts
+    latency.factValueChanged();
+    latency.messageDone();
+
+    // Outside of a message nothing is recorded
+    latency.factValueChanged();
+
+    const TelemetryLatency::Histogram_t linkToParser = latency.histogram(1, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::LinkToParser);
+    QCOMPARE(linkToParser.count, 1u);
+    QVERIFY(linkToParser.maxNsecs >= 2 * 1000 * 1000);
+    QCOMPARE(latency.histogram(1, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::ParserToVehicle).count, 1u);
+    QCOMPARE(latency.histogram(1, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::VehicleToFact).count, 1u);
+    QCOMPARE(latency.histogram(1, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::LinkToFact).count, 1u);
+    QVERIFY(latency.histogram(1, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::LinkToFact).maxNsecs >= linkToParser.maxNsecs);
+
+    // Unknown read time skips the link stage
+    latency.messageParsed(2, MAVLINK_MSG_ID_ATTITUDE, 0);
+    latency.messageDispatched();
+    latency.messageDone();
+    QCOMPARE(latency.histogram(2, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::LinkToParser).count, 0u);
+    QCOMPARE(latency.histogram(2, MAVLINK_MSG_ID_ATTITUDE, TelemetryLatency::ParserToVehicle).count, 1u);
+    QCOMPARE(latency.stageHistogram(TelemetryLatency::ParserToVehicle).count, 2u);
+
+    const QString dump = latency.dump();
+    QVERIFY(dump.contains(QStringLiteral("Test Link\tATTITUDE\tLinkToFact\t1\t")));
+    QVERIFY(dump.contains(QStringLiteral("channel 2\tATTITUDE\tParserToVehicle\t1\t")));
+
+    const QVariantList summary = latency.stageSummary();
+    QCOMPARE(summary.count(), static_cast<int>(TelemetryLatency::StageCount));
+    QCOMPARE(summary[TelemetryLatency::ParserToVehicle].toMap()[QStringLiteral("count")].toULongLong(), 2ull);
+
+    latency.reset();
+    QCOMPARE(latency.stageHistogram(TelemetryLatency::ParserToVehicle).count, 0u);
+}
+
+void TelemetryLatencyTest::_disabledTest()
+{
+    TelemetryLatency latency;
+    QVERIFY(!latency.enabled());
+
+    latency.messageParsed(1, MAVLINK_MSG_ID_HEARTBEAT, TelemetryLatency::nowNsecs());
+    latency.messageDispatched();
+    latency.factValueChanged();
+    latency.messageDone();
+
+    QCOMPARE(latency.stageHistogram(TelemetryLatency::ParserToVehicle).count, 0u);
+    QCOMPARE(latency.stageHistogram(TelemetryLatency::LinkToFact).count, 0u);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class TelemetryLatencyTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _histogramTest();
+    void _stageTest();
+    void _disabledTest();
+};
@@ -0,0 +1,78 @@
+#include "FactGroupTest.h"
+#include "FactGroup.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace {
+
+class TestFactGroup : public FactGroup
+{
+public:
+    TestFactGroup()
+        : FactGroup(kUpdateRateMSecs)
+    {
+        _addFact(&changedFact);
+        _addFact(&unchangedFact);
+    }
+
+    Fact changedFact = Fact(0, QStringLiteral("changed"), FactMetaData::valueTypeDouble, this);
+    Fact unchangedFact = Fact(0, QStringLiteral("unchanged"), FactMetaData::valueTypeDouble, this);
+
+    static constexpr int kUpdateRateMSecs = 20;
+};
+
+} // namespace
+
+void FactGroupTest::_deferredChangesTest()
+{
+    TestFactGroup factGroup;
+    QSignalSpy spyChanged(&factGroup.changedFact, &Fact::valueChanged);
+    QSignalSpy spyUnchanged(&factGroup.unchangedFact, &Fact::valueChanged);
+    QSignalSpy spyRawChanged(&factGroup.changedFact, &Fact::rawValueChanged);
+    QSignalSpy spyValuesUpdated(&factGroup, &FactGroup::valuesUpdated);
+
+    for (int i = 1; i <= 10; i++) {
+        factGroup.changedFact.setRawValue(i);
+    }
+
+    // rawValueChanged is never deferred, valueChanged waits for the update timer
+    QCOMPARE(spyRawChanged.count(), 10);
+    QCOMPARE(spyChanged.count(), 0);
+
+    QVERIFY(spyValuesUpdated.wait(1000));
+    QCOMPARE(spyValuesUpdated.count(), 1);
+    QCOMPARE(spyChanged.count(), 1);
+    QCOMPARE(spyChanged.first().first().toDouble(), 10.0);
+    QCOMPARE(spyUnchanged.count(), 0);
+
+    // Nothing changed, so no notification on the next tick
+    QTest::qWait(TestFactGroup::kUpdateRateMSecs * 3);
+    QCOMPARE(spyValuesUpdated.count(), 1);
+    QCOMPARE(spyChanged.count(), 1);
+}
+
+void FactGroupTest::_liveUpdatesTest()
+{
+    TestFactGroup factGroup;
+    QSignalSpy spyChanged(&factGroup.changedFact, &Fact::valueChanged);
+    QSignalSpy spyValuesUpdated(&factGroup, &FactGroup::valuesUpdated);
+
+    factGroup.changedFact.setRawValue(1);
+    QCOMPARE(spyChanged.count(), 0);
+
+    // Switching to live updates sends the pending change right away
+    factGroup.setLiveUpdates(true);
+    QCOMPARE(spyChanged.count(), 1);
+    QCOMPARE(spyValuesUpdated.count(), 1);
+
+    factGroup.changedFact.setRawValue(2);
+    factGroup.changedFact.setRawValue(3);
+    QCOMPARE(spyChanged.count(), 3);
+
+    factGroup.setLiveUpdates(false);
+    factGroup.changedFact.setRawValue(4);
+    QCOMPARE(spyChanged.count(), 3);
+    QVERIFY(spyValuesUpdated.wait(1000));
+    QCOMPARE(spyChanged.count(), 4);
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class FactGroupTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _deferredChangesTest();
+    void _liveUpdatesTest();
+};
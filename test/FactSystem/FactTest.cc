@@ -0,0 +1,126 @@
+#include "FactTest.h"
+#include "Fact.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+#include <limits>
+
+template<typename T>
+void FactTest::_compareWithVariantPath(FactMetaData::ValueType_t type, T value)
+{
+    Fact typedFact(0, QStringLiteral("typed"), type);
+    Fact variantFact(0, QStringLiteral("variant"), type);
+    QSignalSpy spyTyped(&typedFact, &Fact::rawValueChanged);
+    QSignalSpy spyVariant(&variantFact, &Fact::rawValueChanged);
+
+    // Second set of the same value must not notify on either path
+    for (int i = 0; i < 2; i++) {
+        typedFact.setRawValue(value);
+        variantFact.setRawValue(QVariant::fromValue(value));
+    }
+
+    QCOMPARE(typedFact.rawValue().metaType(), variantFact.rawValue().metaType());
+    QCOMPARE(typedFact.rawValue(), variantFact.rawValue());
+    QCOMPARE(spyTyped.count(), spyVariant.count());
+}
+
+void FactTest::_typedRawValueTest()
+{
+    constexpr qint64 int32Overflow = static_cast<qint64>(std::numeric_limits<qint32>::max()) + 1;
+    constexpr qint64 int32Underflow = static_cast<qint64>(std::numeric_limits<qint32>::min()) - 1;
+    constexpr qulonglong int64Overflow = static_cast<qulonglong>(std::numeric_limits<qint64>::max()) + 1;
+
+    // Values which do not fit the Fact type fall back to the QVariant path and must behave exactly like it
+    _compareWithVariantPath(FactMetaData::valueTypeUint8, static_cast<int8_t>(-1));
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeUint8, -1);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeUint32, -1);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeInt32, int32Overflow);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeInt32, int32Underflow);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeUint64, static_cast<qint64>(-1));
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeInt64, int64Overflow);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeInt32, 1.5);
+    QVERIFY(!QTest::currentTestFailed());
+
+    // Values stored in place
+    _compareWithVariantPath(FactMetaData::valueTypeUint8, static_cast<uint8_t>(255));
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeInt32, std::numeric_limits<qint32>::min());
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeUint64, int64Overflow);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeBool, true);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeBool, 5);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeFloat, 1.1);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeFloat, 3);
+    QVERIFY(!QTest::currentTestFailed());
+    _compareWithVariantPath(FactMetaData::valueTypeDouble, 2.5f);
+    QVERIFY(!QTest::currentTestFailed());
+
+    // Above INT64_MAX must survive unchanged in an unsigned 64 bit Fact
+    Fact uint64Fact(0, QStringLiteral("uint64"), FactMetaData::valueTypeUint64);
+    uint64Fact.setRawValue(int64Overflow);
+    QCOMPARE(uint64Fact.rawValue().metaType(), QMetaType::fromType<qulonglong>());
+    QCOMPARE(uint64Fact.rawValue().toULongLong(), int64Overflow);
+
+    Fact boolFact(0, QStringLiteral("bool"), FactMetaData::valueTypeBool);
+    boolFact.setRawValue(2);
+    QCOMPARE(boolFact.rawValue().metaType(), QMetaType::fromType<bool>());
+    QCOMPARE(boolFact.rawValue().toBool(), true);
+
+    Fact floatFact(0, QStringLiteral("float"), FactMetaData::valueTypeFloat);
+    floatFact.setRawValue(0.1);
+    QCOMPARE(floatFact.rawValue().metaType(), QMetaType::fromType<float>());
+    QCOMPARE(floatFact.rawValue().toFloat(), 0.1f);
+}
+
+void FactTest::_typedRawValueNaNTest()
+{
+    for (const FactMetaData::ValueType_t type : { FactMetaData::valueTypeDouble, FactMetaData::valueTypeFloat }) {
+        Fact fact(0, QStringLiteral("nan"), type);
+        QSignalSpy spyRawChanged(&fact, &Fact::rawValueChanged);
+
+        // A repeated NaN is not a change
+        fact.setRawValue(qQNaN());
+        fact.setRawValue(qQNaN());
+        QVERIFY(qIsNaN(fact.rawValue().toDouble()));
+        QVERIFY(qIsNaN(fact.cookedValueDouble()));
+        QCOMPARE(spyRawChanged.count(), 1);
+
+        fact.setRawValue(1.0);
+        QCOMPARE(fact.rawValue().toDouble(), 1.0);
+        QCOMPARE(spyRawChanged.count(), 2);
+
+        fact.setRawValue(qQNaN());
+        QVERIFY(qIsNaN(fact.rawValue().toDouble()));
+        QCOMPARE(spyRawChanged.count(), 3);
+    }
+}
+
+void FactTest::_integralTranslatorTest()
+{
+    // Cooked to raw for integral raw units hands back an int, as the QVariant translators always did
+    FactMetaData centiDegrees(FactMetaData::valueTypeInt32);
+    centiDegrees.setRawUnits(QStringLiteral("centi-degrees"));
+    const QVariant rawDegrees = centiDegrees.cookedTranslator()(QVariant(1.5));
+    QCOMPARE(rawDegrees.metaType(), QMetaType::fromType<int>());
+    QCOMPARE(rawDegrees.toInt(), 150);
+    QCOMPARE(centiDegrees.rawTranslator()(QVariant(150)).toDouble(), 1.5);
+
+    FactMetaData centiCelsius(FactMetaData::valueTypeInt16);
+    centiCelsius.setRawUnits(QStringLiteral("centi-celsius"));
+    const QVariant rawCelsius = centiCelsius.cookedTranslator()(QVariant(-21.25));
+    QCOMPARE(rawCelsius.metaType(), QMetaType::fromType<int>());
+    QCOMPARE(rawCelsius.toInt(), -2125);
+    QCOMPARE(centiCelsius.rawTranslator()(QVariant(-2125)).toDouble(), -21.25);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "UnitTest.h"
+#include "FactMetaData.h"
+
+class FactTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _typedRawValueTest();
+    void _typedRawValueNaNTest();
+    void _integralTranslatorTest();
+
+private:
+    /// Sets value through the typed and the QVariant setRawValue on two Facts of the specified type and checks both end up the same
+    template<typename T>
+    static void _compareWithVariantPath(FactMetaData::ValueType_t type, T value);
+};
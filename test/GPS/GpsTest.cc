@@ -9,11 +9,37 @@
 
 #include "GpsTest.h"
 #include "GPSProvider.h"
+#include "MockLink.h"
 #include "RTCMMavlink.h"
 
+#include <QtTest/QSignalSpy>
 #include <QtTest/QTest>
 
 void GpsTest::_testGpsRTCM()
 {
+    _connectMockLink();
 
+    RTCMMavlink rtcm;
+
+    // Unfragmented frame plus a frame split into three GPS_RTCM_DATA fragments
+    rtcm.RTCMDataUpdate(QByteArray(30, 'a'));
+    rtcm.RTCMDataUpdate(QByteArray((MAVLINK_MSG_GPS_RTCM_DATA_FIELD_DATA_LEN * 2) + 10, 'b'));
+    QTRY_COMPARE(_mockLink->receivedGpsRtcmDataCount(), 4);
+
+    // Reports are produced by the first update after the report interval
+    QSignalSpy spyReports(&rtcm, &RTCMMavlink::linkReportsUpdated);
+    QTest::qWait(RTCMMavlink::kReportIntervalMsecs + 100);
+    rtcm.RTCMDataUpdate(QByteArray(30, 'c'));
+    QCOMPARE(spyReports.count(), 1);
+
+    const QList<RTCMMavlink::LinkReport> reports = rtcm.linkReports();
+    QCOMPARE(reports.count(), 1);
+    QCOMPARE(reports[0].linkName, _mockLink->linkConfiguration()->name());
+    QCOMPARE(reports[0].vehicleCount, 1);
+    QCOMPARE(reports[0].messageCount, static_cast<quint64>(4));
+    QVERIFY(reports[0].bytesPerSecond > 0);
+
+    QTRY_COMPARE(_mockLink->receivedGpsRtcmDataCount(), 5);
+
+    _disconnectMockLink();
 }
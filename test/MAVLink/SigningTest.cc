@@ -9,7 +9,11 @@
 
 #include "SigningTest.h"
 #include "MAVLinkSigning.h"
+#include "MAVLinkSha256.h"
+#include "MAVLinkProtocol.h"
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QRandomGenerator>
 #include <QtTest/QTest>
 
 void SigningTest::_testInitSigning()
@@ -43,3 +47,129 @@ void SigningTest::_testCreateSetupSigning()
     QCOMPARE(setup_signing.target_system, target_system.sysid);
     QCOMPARE(setup_signing.target_component, target_system.compid);
 }
+
+void SigningTest::_testSha256Backends()
+{
+    // Lengths around the block and padding boundaries plus a few multi block buffers
+    const QList<int> lengths({ 0, 1, 3, 55, 56, 63, 64, 65, 119, 120, 128, 1000, 4096 + 7 });
+    for (const bool forcePortable : { false, true }) {
+        MAVLinkSha256::setForcePortable(forcePortable);
+        for (const int length : lengths) {
+            QByteArray data(length, Qt::Uninitialized);
+            for (char &byte : data) {
+                byte = static_cast<char>(QRandomGenerator::global()->bounded(256));
+            }
+
+            const QByteArray expected = QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+            QByteArray digest(32, 0);
+            MAVLinkSha256::sha256(data.constData(), data.size(), reinterpret_cast<uint8_t*>(digest.data()));
+            QCOMPARE(digest, expected);
+
+            // Same data fed in uneven pieces through the mavlink api
+            mavlink_sha256_ctx ctx;
+            mavlink_sha256_init(&ctx);
+            for (int offset = 0, piece = 1; offset < length; offset += piece, piece = (piece * 3) % 97 + 1) {
+                mavlink_sha256_update(&ctx, data.constData() + offset, qMin(piece, length - offset));
+            }
+            uint8_t signature[6];
+            mavlink_sha256_final_48(&ctx, signature);
+            QVERIFY(memcmp(signature, expected.constData(), sizeof(signature)) == 0);
+        }
+    }
+    MAVLinkSha256::setForcePortable(false);
+}
+
+void SigningTest::_testSignedMessageVerification()
+{
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_2, "secret_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_3, "secret_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    mavlink_signing_t *const signing = mavlink_get_channel_status(MAVLINK_COMM_3)->signing;
+
+    const auto parse = [signing](const uint8_t *buffer, uint16_t length) {
+        mavlink_message_t message{};
+        mavlink_status_t status{};
+        uint8_t framing = MAVLINK_FRAMING_INCOMPLETE;
+        signing->last_status = MAVLINK_SIGNING_STATUS_NONE;
+        for (uint16_t i = 0; i < length; i++) {
+            framing = mavlink_parse_char(MAVLINK_COMM_3, buffer[i], &message, &status);
+        }
+        return framing;
+    };
+
+    const mavlink_heartbeat_t heartbeat = {0};
+    mavlink_message_t message;
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+
+    (void) mavlink_msg_heartbeat_encode_chan(1, MAV_COMP_ID_USER1, MAVLINK_COMM_2, &message, &heartbeat);
+    uint16_t length = mavlink_msg_to_send_buffer(buffer, &message);
+    QVERIFY(buffer[2] & MAVLINK_IFLAG_SIGNED);
+    QCOMPARE(parse(buffer, length), static_cast<uint8_t>(MAVLINK_FRAMING_OK));
+    QCOMPARE(static_cast<int>(signing->last_status), static_cast<int>(MAVLINK_SIGNING_STATUS_OK));
+
+    // Corrupt the signature of a fresh message
+    (void) mavlink_msg_heartbeat_encode_chan(1, MAV_COMP_ID_USER1, MAVLINK_COMM_2, &message, &heartbeat);
+    length = mavlink_msg_to_send_buffer(buffer, &message);
+    buffer[length - 1] ^= 0xFF;
+    QCOMPARE(parse(buffer, length), static_cast<uint8_t>(MAVLINK_FRAMING_INCOMPLETE));
+    QCOMPARE(static_cast<int>(signing->last_status), static_cast<int>(MAVLINK_SIGNING_STATUS_BAD_SIGNATURE));
+
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_2, QByteArrayView(), MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_3, QByteArrayView(), MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+}
+
+void SigningTest::_testSigningStatsPerLink()
+{
+    // COMM_0 sends unsigned and COMM_1 signed messages, COMM_2 and COMM_3 receive them as two links which require signing
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_0, QByteArrayView(), MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_1, "secret_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_2, "secret_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(MAVLINK_COMM_3, "secret_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+
+    const auto receive = [](mavlink_channel_t senderChannel, uint32_t messageId, mavlink_channel_t linkChannel, LinkInterface::SigningStats &stats) {
+        mavlink_message_t message;
+        if (messageId == MAVLINK_MSG_ID_RADIO_STATUS) {
+            const mavlink_radio_status_t radioStatus{};
+            (void) mavlink_msg_radio_status_encode_chan(1, MAV_COMP_ID_USER1, senderChannel, &message, &radioStatus);
+        } else {
+            const mavlink_heartbeat_t heartbeat{};
+            (void) mavlink_msg_heartbeat_encode_chan(1, MAV_COMP_ID_USER1, senderChannel, &message, &heartbeat);
+        }
+
+        uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+        const uint16_t length = mavlink_msg_to_send_buffer(buffer, &message);
+        uint8_t framing = MAVLINK_FRAMING_INCOMPLETE;
+        for (uint16_t i = 0; i < length; i++) {
+            mavlink_message_t received{};
+            framing = MAVLinkProtocol::_parseChar(linkChannel, buffer[i], received, stats);
+        }
+        return framing;
+    };
+
+    LinkInterface::SigningStats statsLink2;
+    LinkInterface::SigningStats statsLink3;
+
+    QCOMPARE(receive(MAVLINK_COMM_1, MAVLINK_MSG_ID_HEARTBEAT, MAVLINK_COMM_2, statsLink2), static_cast<uint8_t>(MAVLINK_FRAMING_OK));
+    QCOMPARE(receive(MAVLINK_COMM_1, MAVLINK_MSG_ID_HEARTBEAT, MAVLINK_COMM_3, statsLink3), static_cast<uint8_t>(MAVLINK_FRAMING_OK));
+    QCOMPARE(receive(MAVLINK_COMM_1, MAVLINK_MSG_ID_HEARTBEAT, MAVLINK_COMM_2, statsLink2), static_cast<uint8_t>(MAVLINK_FRAMING_OK));
+
+    // Only RADIO_STATUS may come in unsigned
+    QCOMPARE(receive(MAVLINK_COMM_0, MAVLINK_MSG_ID_RADIO_STATUS, MAVLINK_COMM_2, statsLink2), static_cast<uint8_t>(MAVLINK_FRAMING_OK));
+    QCOMPARE(receive(MAVLINK_COMM_0, MAVLINK_MSG_ID_HEARTBEAT, MAVLINK_COMM_2, statsLink2), static_cast<uint8_t>(MAVLINK_FRAMING_INCOMPLETE));
+    for (int i = 0; i < 3; i++) {
+        QCOMPARE(receive(MAVLINK_COMM_0, MAVLINK_MSG_ID_HEARTBEAT, MAVLINK_COMM_3, statsLink3), static_cast<uint8_t>(MAVLINK_FRAMING_INCOMPLETE));
+    }
+
+    QCOMPARE(statsLink2.signedAccepted, 2u);
+    QCOMPARE(statsLink2.unsignedAccepted, 1u);
+    QCOMPARE(statsLink2.unsignedRejected, 1u);
+    QCOMPARE(statsLink2.badSignature, 0u);
+
+    QCOMPARE(statsLink3.signedAccepted, 1u);
+    QCOMPARE(statsLink3.unsignedAccepted, 0u);
+    QCOMPARE(statsLink3.unsignedRejected, 3u);
+    QCOMPARE(statsLink3.badSignature, 0u);
+
+    for (const mavlink_channel_t channel : { MAVLINK_COMM_0, MAVLINK_COMM_1, MAVLINK_COMM_2, MAVLINK_COMM_3 }) {
+        QVERIFY(MAVLinkSigning::initSigning(channel, QByteArrayView(), MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    }
+}
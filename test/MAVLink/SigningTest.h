@@ -22,4 +22,7 @@ private slots:
     void _testInitSigning();
     void _testCheckSigningLinkId();
     void _testCreateSetupSigning();
+    void _testSha256Backends();
+    void _testSignedMessageVerification();
+    void _testSigningStatsPerLink();
 };
@@ -232,6 +232,39 @@ void MissionControllerTest::_testVehicleYawRecalc(void)
     }
 }
 
+void MissionControllerTest::_testIncrementalFlightStatus(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_PX4);
+
+    const int cMissionItems = 8;
+    QGeoCoordinate currentCoord(0, 0);
+    for (int i=1; i<=cMissionItems; i++) {
+        _missionController->insertSimpleMissionItem(currentCoord, i);
+        currentCoord = currentCoord.atDistanceAndAzimuth(100, 90);
+    }
+
+    QTest::qWait(500); // Recalcs in MissionController are queued to remove dups. Allow return to main message loop.
+
+    // Moving an item only recalcs from that item onward, the results must match a full recalc
+    const int movedIndex = 5;
+    QmlObjectListModel* visualItems = _missionController->visualItems();
+    VisualMissionItem* movedItem = visualItems->value<VisualMissionItem*>(movedIndex);
+    movedItem->setCoordinate(movedItem->coordinate().atDistanceAndAzimuth(100, 0));
+
+    QTest::qWait(500);
+
+    double distanceFromStart = 0;
+    for (int i=2; i<=cMissionItems; i++) {
+        VisualMissionItem* prevItem = visualItems->value<VisualMissionItem*>(i - 1);
+        VisualMissionItem* item = visualItems->value<VisualMissionItem*>(i);
+        double distance = prevItem->coordinate().distanceTo(item->coordinate());
+        distanceFromStart += distance;
+        QVERIFY(qAbs(item->distance() - distance) < 0.01);
+        QVERIFY(qAbs(item->distanceFromStart() - distanceFromStart) < 0.01);
+    }
+    QVERIFY(qAbs(_missionController->missionTotalDistance() - distanceFromStart) < 0.01);
+}
+
 void MissionControllerTest::_testLoadJsonSectionAvailable(void)
 {
     _initForFirmwareType(MAV_AUTOPILOT_PX4);
@@ -355,3 +355,124 @@ void MissionManagerTest::_testErrorAckFailureStrings(void)
     }
 
 }
+
+void MissionManagerTest::_testLossyLinkRoundTripPX4(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_PX4);
+
+    // Enough items to keep the transfer window full while loss forces re-requests in both directions
+    static constexpr int cItems = 250;
+    static constexpr int transferWaitMsecs = 60000;
+
+    // PX4 rejects out of order item requests, so loss must be recovered without ever getting ahead of the vehicle
+    _mockLink->setMissionItemLinkSimulation(20 /* latencyMsecs */, 5 /* dropPercent */);
+    _mockLink->setMissionItemStrictOrdering(true);
+
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<cItems + 1; i++) {
+        // Item 0 is the home position which is not sent to PX4. param1 tags each item so ordering can be validated on the way back.
+        MissionItem* missionItem = new MissionItem(this);
+        missionItem->setSequenceNumber(i);
+        missionItem->setCommand(MAV_CMD_NAV_WAYPOINT);
+        missionItem->setFrame(MAV_FRAME_GLOBAL_RELATIVE_ALT);
+        missionItem->setParam1(i);
+        missionItem->setParam5(47.3769 + (i * 0.0001));
+        missionItem->setParam6(8.549444);
+        missionItem->setParam7(50);
+        missionItems.append(missionItem);
+    }
+
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_missionManager->inProgress());
+    _multiSpyMissionManager->clearAllSignals();
+
+    _multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, transferWaitMsecs);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(sendCompleteSignalMask), true);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(errorSignalMask), false);
+    QCOMPARE(_missionManager->missionItems().count(), cItems);
+    _multiSpyMissionManager->clearAllSignals();
+
+    _missionManager->loadFromVehicle();
+    QVERIFY(_missionManager->inProgress());
+    _multiSpyMissionManager->clearAllSignals();
+
+    _multiSpyMissionManager->waitForSignalByIndex(newMissionItemsAvailableSignalIndex, transferWaitMsecs);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(newMissionItemsAvailableSignalMask), true);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(errorSignalMask), false);
+
+    const QList<MissionItem*>& readItems = _missionManager->missionItems();
+    QCOMPARE(readItems.count(), cItems);
+    for (int i=0; i<readItems.count(); i++) {
+        QCOMPARE(readItems[i]->sequenceNumber(), i);
+        QCOMPARE(readItems[i]->param1(), static_cast<double>(i + 1));
+    }
+
+    _mockLink->setMissionItemLinkSimulation(0, 0);
+    _mockLink->setMissionItemStrictOrdering(false);
+    _multiSpyMissionManager->clearAllSignals();
+}
+
+void MissionManagerTest::_testLossyLinkRoundTripAPM(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_ARDUPILOTMEGA);
+
+    static constexpr int cItems = 250;
+    static constexpr int transferWaitMsecs = 60000;
+
+    // ArduPilot streams a window of items, loss must be recovered by resending the window and re-requesting lost items
+    _mockLink->setMissionItemLinkSimulation(20 /* latencyMsecs */, 10 /* dropPercent */);
+
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<cItems + 1; i++) {
+        // Item 0 is the home position which ArduPilot stores as well. param1 tags each item so ordering can be validated on the way back.
+        MissionItem* missionItem = new MissionItem(this);
+        missionItem->setSequenceNumber(i);
+        missionItem->setCommand(MAV_CMD_NAV_WAYPOINT);
+        missionItem->setFrame(MAV_FRAME_GLOBAL_RELATIVE_ALT);
+        missionItem->setParam1(i);
+        missionItem->setParam5(47.3769 + (i * 0.0001));
+        missionItem->setParam6(8.549444);
+        missionItem->setParam7(50);
+        missionItems.append(missionItem);
+    }
+
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_missionManager->inProgress());
+    QVERIFY(_missionManager->_transferWindowSize > 1);
+    _multiSpyMissionManager->clearAllSignals();
+
+    _multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, transferWaitMsecs);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(sendCompleteSignalMask), true);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(errorSignalMask), false);
+    QCOMPARE(_missionManager->missionItems().count(), cItems + 1);
+
+    // Dropped items must have gone out again
+    bool itemResent = false;
+    for (const int sendCount: _missionManager->_itemSendCount) {
+        itemResent |= (sendCount > 1);
+    }
+    QVERIFY(itemResent);
+    _multiSpyMissionManager->clearAllSignals();
+
+    _missionManager->loadFromVehicle();
+    QVERIFY(_missionManager->inProgress());
+    QVERIFY(_missionManager->_transferWindowSize > 1);
+    _multiSpyMissionManager->clearAllSignals();
+
+    _multiSpyMissionManager->waitForSignalByIndex(newMissionItemsAvailableSignalIndex, transferWaitMsecs);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(newMissionItemsAvailableSignalMask), true);
+    QCOMPARE(_multiSpyMissionManager->checkSignalByMask(errorSignalMask), false);
+
+    // Lost items were requested again after timing out
+    QVERIFY(!_missionManager->_reRequestedItems.isEmpty());
+
+    const QList<MissionItem*>& readItems = _missionManager->missionItems();
+    QCOMPARE(readItems.count(), cItems + 1);
+    for (int i=0; i<readItems.count(); i++) {
+        QCOMPARE(readItems[i]->sequenceNumber(), i);
+        QCOMPARE(readItems[i]->param1(), static_cast<double>(i));
+    }
+
+    _mockLink->setMissionItemLinkSimulation(0, 0);
+    _multiSpyMissionManager->clearAllSignals();
+}
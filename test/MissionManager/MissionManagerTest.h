@@ -24,6 +24,8 @@ private slots:
     void _testReadFailureHandlingPX4(void);
     //void _testReadFailureHandlingAPM(void);
     //void _testErrorAckFailureStrings(void);
+    void _testLossyLinkRoundTripPX4(void);
+    void _testLossyLinkRoundTripAPM(void);
 
 private:
     void _testWriteFailureHandlingPX4(void);
@@ -11,6 +11,7 @@
 #include "TerrainTileManager.h"
 #include "TerrainQuery.h"
 
+#include <QtCore/QPair>
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 
@@ -100,6 +101,13 @@ void UnitTestTerrainQuery::requestCarpetHeights(const QGeoCoordinate &swCoord, c
     emit carpetHeightsReceived(true, min, max, carpet);
 }
 
+qsizetype UnitTestTerrainQuery::pathCoordCount(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord)
+{
+    double distanceBetween;
+    double finalDistanceBetween;
+    return TerrainTileManager::_pathQueryToCoords(fromCoord, toCoord, distanceBetween, finalDistanceBetween).count();
+}
+
 UnitTestTerrainQuery::PathHeightInfo_t UnitTestTerrainQuery::_requestPathHeights(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord)
 {
     PathHeightInfo_t pathHeights;
@@ -140,6 +148,58 @@ QList<double> UnitTestTerrainQuery::_requestCoordinateHeights(const QList<QGeoCo
 
 /*===========================================================================*/
 
+namespace {
+
+/// Holds coordinate requests until the test answers them. A request with any coordinate outside of the flat region fails,
+/// the same way a request touching a tile which can't be loaded does.
+class DeferredTerrainQuery : public TerrainQueryInterface
+{
+public:
+    explicit DeferredTerrainQuery(QObject *parent = nullptr)
+        : TerrainQueryInterface(parent) {}
+
+    void requestCoordinateHeights(const QList<QGeoCoordinate> &coordinates) final { (void) _requests.append(coordinates); }
+
+    qsizetype pendingCount() const { return _requests.count(); }
+    qsizetype pendingCoordCount() const { return _requests.constFirst().count(); }
+
+    /// Answers the oldest outstanding request
+    void replyNext()
+    {
+        const QList<QGeoCoordinate> coordinates = _requests.takeFirst();
+
+        QList<double> heights;
+        for (const QGeoCoordinate &coordinate : coordinates) {
+            if (!UnitTestTerrainQuery::flat10Region.contains(coordinate)) {
+                emit coordinateHeightsReceived(false, QList<double>());
+                return;
+            }
+            (void) heights.append(UnitTestTerrainQuery::Flat10Region::amslElevation);
+        }
+        emit coordinateHeightsReceived(true, heights);
+    }
+
+private:
+    QList<QList<QGeoCoordinate>> _requests;
+};
+
+/// West to east path inside the flat region
+QPair<QGeoCoordinate, QGeoCoordinate> flatPath(double latOffsetDeg, double lengthDeg)
+{
+    const QGeoCoordinate fromCoord(pointNemo.latitude() - latOffsetDeg, pointNemo.longitude() + 0.01);
+    const QGeoCoordinate toCoord(fromCoord.latitude(), fromCoord.longitude() + lengthDeg);
+    return qMakePair(fromCoord, toCoord);
+}
+
+TerrainPathQuery::PathHeightInfo_t pathHeightInfo(const QSignalSpy &spy)
+{
+    return spy.at(0).at(1).value<TerrainPathQuery::PathHeightInfo_t>();
+}
+
+} // namespace
+
+/*===========================================================================*/
+
 void TerrainQueryTest::_testRequestCoordinateHeights()
 {
     UnitTestTerrainQuery* const query = new UnitTestTerrainQuery(this);
@@ -195,6 +255,131 @@ void TerrainQueryTest::_testRequestCarpetHeights()
     QVERIFY(arguments.at(3).toList().constFirst().toList().constFirst().toDouble() == UnitTestTerrainQuery::Flat10Region::amslElevation);
 }
 
+void TerrainQueryTest::_testPathBatch()
+{
+    DeferredTerrainQuery* const terrainQuery = new DeferredTerrainQuery(this);
+    TerrainPathBatchManager batchManager(terrainQuery);
+
+    const auto pathA = flatPath(0.01, 0.02);
+    const auto pathB = flatPath(0.05, 0.04);
+    TerrainPathQuery queryA(false);
+    TerrainPathQuery queryB(false);
+    QSignalSpy spyA(&queryA, &TerrainPathQuery::terrainDataReceived);
+    QSignalSpy spyB(&queryB, &TerrainPathQuery::terrainDataReceived);
+
+    // Both paths go out as a single coordinate request
+    batchManager.addQuery(&queryA, pathA.first, pathA.second);
+    batchManager.addQuery(&queryB, pathB.first, pathB.second);
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    const qsizetype cCoordA = UnitTestTerrainQuery::pathCoordCount(pathA.first, pathA.second);
+    const qsizetype cCoordB = UnitTestTerrainQuery::pathCoordCount(pathB.first, pathB.second);
+    QCOMPARE(terrainQuery->pendingCoordCount(), cCoordA + cCoordB);
+
+    // The heights are split back out per path
+    terrainQuery->replyNext();
+    QCOMPARE(spyA.count(), 1);
+    QCOMPARE(spyB.count(), 1);
+    QVERIFY(spyA.at(0).at(0).toBool());
+    QVERIFY(spyB.at(0).at(0).toBool());
+    QCOMPARE(pathHeightInfo(spyA).heights.count(), cCoordA);
+    QCOMPARE(pathHeightInfo(spyB).heights.count(), cCoordB);
+    QVERIFY(pathHeightInfo(spyA).distanceBetween > 0.);
+    QVERIFY(pathHeightInfo(spyB).distanceBetween > 0.);
+}
+
+void TerrainQueryTest::_testPathBatchFailingTile()
+{
+    DeferredTerrainQuery* const terrainQuery = new DeferredTerrainQuery(this);
+    TerrainPathBatchManager batchManager(terrainQuery);
+
+    const auto pathA = flatPath(0.01, 0.02);
+    const auto pathB = flatPath(0.05, 0.04);
+    const QGeoCoordinate noTerrainFrom(10., 10.);
+    const QGeoCoordinate noTerrainTo(10., 10.01);
+    TerrainPathQuery queryA(false);
+    TerrainPathQuery queryB(false);
+    TerrainPathQuery queryFail(false);
+    QSignalSpy spyA(&queryA, &TerrainPathQuery::terrainDataReceived);
+    QSignalSpy spyB(&queryB, &TerrainPathQuery::terrainDataReceived);
+    QSignalSpy spyFail(&queryFail, &TerrainPathQuery::terrainDataReceived);
+
+    batchManager.addQuery(&queryA, pathA.first, pathA.second);
+    batchManager.addQuery(&queryFail, noTerrainFrom, noTerrainTo);
+    batchManager.addQuery(&queryB, pathB.first, pathB.second);
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    terrainQuery->replyNext();
+
+    // The failed batch is split up, nothing is signalled until each path has been tried on its own
+    QCOMPARE(spyA.count() + spyB.count() + spyFail.count(), 0);
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    QCOMPARE(terrainQuery->pendingCoordCount(), UnitTestTerrainQuery::pathCoordCount(pathA.first, pathA.second));
+    terrainQuery->replyNext();
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    terrainQuery->replyNext();
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    terrainQuery->replyNext();
+
+    // Only the path which touches the failing tile fails
+    QCOMPARE(spyA.count(), 1);
+    QCOMPARE(spyB.count(), 1);
+    QCOMPARE(spyFail.count(), 1);
+    QVERIFY(spyA.at(0).at(0).toBool());
+    QVERIFY(spyB.at(0).at(0).toBool());
+    QVERIFY(!spyFail.at(0).at(0).toBool());
+    QCOMPARE(pathHeightInfo(spyA).heights.count(), UnitTestTerrainQuery::pathCoordCount(pathA.first, pathA.second));
+    QCOMPARE(pathHeightInfo(spyB).heights.count(), UnitTestTerrainQuery::pathCoordCount(pathB.first, pathB.second));
+    QCOMPARE(terrainQuery->pendingCount(), 0);
+}
+
+void TerrainQueryTest::_testPathBatchSupersededRequest()
+{
+    DeferredTerrainQuery* const terrainQuery = new DeferredTerrainQuery(this);
+    TerrainPathBatchManager batchManager(terrainQuery);
+
+    const auto oldPath = flatPath(0.01, 0.02);
+    const auto newPath = flatPath(0.05, 0.04);
+    TerrainPathQuery query(false);
+    QSignalSpy spy(&query, &TerrainPathQuery::terrainDataReceived);
+
+    // Re-requesting before the batch goes out replaces the queued path
+    batchManager.addQuery(&query, oldPath.first, oldPath.second);
+    batchManager.addQuery(&query, newPath.first, newPath.second);
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    const qsizetype cCoordNew = UnitTestTerrainQuery::pathCoordCount(newPath.first, newPath.second);
+    QCOMPARE(terrainQuery->pendingCoordCount(), cCoordNew);
+
+    terrainQuery->replyNext();
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(pathHeightInfo(spy).heights.count(), cCoordNew);
+}
+
+void TerrainQueryTest::_testPathBatchStaleReply()
+{
+    DeferredTerrainQuery* const terrainQuery = new DeferredTerrainQuery(this);
+    TerrainPathBatchManager batchManager(terrainQuery);
+
+    const auto oldPath = flatPath(0.01, 0.02);
+    const auto newPath = flatPath(0.05, 0.04);
+    TerrainPathQuery query(false);
+    QSignalSpy spy(&query, &TerrainPathQuery::terrainDataReceived);
+
+    batchManager.addQuery(&query, oldPath.first, oldPath.second);
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+
+    // Re-requesting while the old path is in flight drops the old reply
+    batchManager.addQuery(&query, newPath.first, newPath.second);
+    terrainQuery->replyNext();
+    QCOMPARE(spy.count(), 0);
+
+    QTRY_COMPARE(terrainQuery->pendingCount(), 1);
+    const qsizetype cCoordNew = UnitTestTerrainQuery::pathCoordCount(newPath.first, newPath.second);
+    QCOMPARE(terrainQuery->pendingCoordCount(), cCoordNew);
+    terrainQuery->replyNext();
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(spy.at(0).at(0).toBool());
+    QCOMPARE(pathHeightInfo(spy).heights.count(), cCoordNew);
+}
+
 // Test Requires Internet, so disable by default.
 // Or, check if internet and elevation server are available?
 #if 0
@@ -30,6 +30,9 @@ class UnitTestTerrainQuery : public TerrainQueryInterface
     void requestPathHeights(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord) final;
     void requestCarpetHeights(const QGeoCoordinate &swCoord, const QGeoCoordinate &neCoord, bool statsOnly) final;
 
+    /// @return Number of coordinates the path is sampled into by the terrain system
+    static qsizetype pathCoordCount(const QGeoCoordinate &fromCoord, const QGeoCoordinate &toCoord);
+
     static constexpr double regionSizeDeg = 0.1;           ///< all regions are 0.1deg (~11km) square
     static constexpr double oneSecondDeg = 1.0 / 3600.;
     static constexpr double earthsRadiusMts = 6371000.;
@@ -88,5 +91,9 @@ private slots:
     void _testRequestCoordinateHeights();
     void _testRequestPathHeights();
     void _testRequestCarpetHeights();
+    void _testPathBatch();
+    void _testPathBatchFailingTile();
+    void _testPathBatchSupersededRequest();
+    void _testPathBatchStaleReply();
     // void _testTerrainAtCoordinateQuery();
 };
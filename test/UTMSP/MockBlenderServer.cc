@@ -0,0 +1,84 @@
+#include "MockBlenderServer.h"
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpSocket>
+
+MockBlenderServer::MockBlenderServer(QObject *parent)
+    : QTcpServer(parent)
+{
+    (void) connect(this, &QTcpServer::newConnection, this, &MockBlenderServer::_newConnection);
+    (void) listen(QHostAddress::LocalHost);
+}
+
+QString MockBlenderServer::url() const
+{
+    return QStringLiteral("http://127.0.0.1:%1").arg(serverPort());
+}
+
+void MockBlenderServer::setResponse(const QByteArray &path, int statusCode, const QByteArray &body)
+{
+    _responses[path] = { statusCode, body };
+}
+
+void MockBlenderServer::_newConnection()
+{
+    while (QTcpSocket *socket = nextPendingConnection()) {
+        const int connection = _connectionCount++;
+        (void) connect(socket, &QTcpSocket::readyRead, this, [this, socket, connection]() {
+            _readRequests(socket, connection);
+        });
+        (void) connect(socket, &QTcpSocket::disconnected, this, [this, socket]() {
+            (void) _buffers.remove(socket);
+            socket->deleteLater();
+        });
+    }
+}
+
+void MockBlenderServer::_readRequests(QTcpSocket *socket, int connection)
+{
+    QByteArray &buffer = _buffers[socket];
+    buffer.append(socket->readAll());
+
+    while (true) {
+        const qsizetype headerEnd = buffer.indexOf("\r\n\r\n");
+        if (headerEnd < 0) {
+            return;
+        }
+
+        Request request;
+        request.connection = connection;
+
+        const QList<QByteArray> lines = buffer.left(headerEnd).split('\n');
+        const QList<QByteArray> requestLine = lines.first().trimmed().split(' ');
+        if (requestLine.count() >= 2) {
+            request.method = requestLine[0];
+            request.path = requestLine[1];
+        }
+        for (qsizetype i = 1; i < lines.count(); i++) {
+            const qsizetype colon = lines[i].indexOf(':');
+            if (colon > 0) {
+                request.headers.insert(lines[i].left(colon).trimmed().toLower(), lines[i].mid(colon + 1).trimmed());
+            }
+        }
+
+        const qsizetype contentLength = request.headers.value("content-length", "0").toLongLong();
+        const qsizetype requestLength = headerEnd + 4 + contentLength;
+        if (buffer.size() < requestLength) {
+            return;
+        }
+        request.body = buffer.mid(headerEnd + 4, contentLength);
+        buffer.remove(0, requestLength);
+
+        const Response response = _responses.value(request.path);
+        _requests.append(request);
+
+        QByteArray reply = QByteArrayLiteral("HTTP/1.1 ") + QByteArray::number(response.statusCode) + QByteArrayLiteral(" Mock\r\n");
+        reply += QByteArrayLiteral("Content-Type: application/json\r\n");
+        reply += QByteArrayLiteral("Content-Length: ") + QByteArray::number(response.body.size()) + QByteArrayLiteral("\r\n");
+        reply += QByteArrayLiteral("Connection: keep-alive\r\n\r\n");
+        reply += response.body;
+        (void) socket->write(reply);
+
+        emit requestReceived();
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QUrl>
+#include <QtNetwork/QTcpServer>
+
+class QTcpSocket;
+
+/// Minimal local stand-in for the Flight Blender and auth servers. Speaks plain HTTP/1.1 with keep-alive, records
+/// every request and the connection it arrived on, and answers with canned responses per path.
+class MockBlenderServer : public QTcpServer
+{
+    Q_OBJECT
+
+public:
+    struct Request {
+        QByteArray method;
+        QByteArray path;
+        QByteArray body;
+        QHash<QByteArray, QByteArray> headers;  ///< Lower case header names
+        int connection = 0;                     ///< Index of the TCP connection the request arrived on
+    };
+
+    explicit MockBlenderServer(QObject *parent = nullptr);
+
+    /// @return Base url to give to UTMSPRestInterface::setHostUrl
+    QString url() const;
+
+    void setResponse(const QByteArray &path, int statusCode, const QByteArray &body);
+
+    const QList<Request> &requests() const { return _requests; }
+    int connectionCount() const { return _connectionCount; }
+
+signals:
+    void requestReceived();
+
+private slots:
+    void _newConnection();
+
+private:
+    void _readRequests(QTcpSocket *socket, int connection);
+
+    struct Response {
+        int statusCode = 200;
+        QByteArray body = "{}";
+    };
+
+    QHash<QByteArray, Response> _responses;
+    QHash<QTcpSocket*, QByteArray> _buffers;
+    QList<Request> _requests;
+    int _connectionCount = 0;
+};
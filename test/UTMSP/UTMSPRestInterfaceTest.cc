@@ -0,0 +1,175 @@
+#include "UTMSPRestInterfaceTest.h"
+#include "MockBlenderServer.h"
+#include "UTMSPBlenderRestInterface.h"
+#include "UTMSPFlightPlanManager.h"
+#include "UTMSPNetworkRemoteIDManager.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+namespace {
+
+const QString kBlenderUrl = UTMSPRestInterface::hostUrl(UTMSPRestInterface::HostTarget::BlenderClient);
+
+} // namespace
+
+void UTMSPRestInterfaceTest::cleanup()
+{
+    UTMSPRestInterface::setHostUrl(UTMSPRestInterface::HostTarget::BlenderClient, kBlenderUrl);
+
+    UnitTest::cleanup();
+}
+
+void UTMSPRestInterfaceTest::_asyncRequestTest()
+{
+    MockBlenderServer server;
+    QVERIFY(server.isListening());
+    server.setResponse("/ping", 200, R"({"message":"pong"})");
+    UTMSPRestInterface::setHostUrl(UTMSPRestInterface::HostTarget::BlenderClient, server.url());
+
+    UTMSPBlenderRestInterface restInterface;
+    bool finished = false;
+    int statusCode = 0;
+    std::string response;
+    restInterface.ping([&](int status, const std::string &body) {
+        finished = true;
+        statusCode = status;
+        response = body;
+    });
+
+    // The request does not block, the response arrives through the event loop
+    QVERIFY(!finished);
+    QCOMPARE(restInterface.pendingRequests(), 1);
+
+    QTRY_VERIFY(finished);
+    QCOMPARE(statusCode, 200);
+    QCOMPARE(QString::fromStdString(response), QStringLiteral(R"({"message":"pong"})"));
+    QCOMPARE(restInterface.pendingRequests(), 0);
+    QCOMPARE(server.requests().count(), 1);
+    QCOMPARE(server.requests().first().method, QByteArray("GET"));
+    // Compression is negotiated by the network manager so replies are decompressed transparently
+    QVERIFY(server.requests().first().headers.value("accept-encoding").contains("gzip"));
+
+    // Destroying the client while a request is in flight drops the handler
+    bool called = false;
+    {
+        UTMSPBlenderRestInterface shortLived;
+        shortLived.ping([&called](int, const std::string &) { called = true; });
+    }
+    QTest::qWait(100);
+    QVERIFY(!called);
+}
+
+void UTMSPRestInterfaceTest::_connectionReuseTest()
+{
+    MockBlenderServer server;
+    QVERIFY(server.isListening());
+    UTMSPRestInterface::setHostUrl(UTMSPRestInterface::HostTarget::BlenderClient, server.url());
+
+    // Setting the host opens the connection ahead of the first request
+    UTMSPBlenderRestInterface restInterface1;
+    QTRY_COMPARE(server.connectionCount(), 1);
+
+    // Separate clients share the same keep-alive connection
+    UTMSPBlenderRestInterface restInterface2;
+
+    constexpr int requestCount = 6;
+    int responses = 0;
+    for (int i = 0; i < requestCount; i++) {
+        UTMSPBlenderRestInterface &restInterface = (i % 2) ? restInterface2 : restInterface1;
+        bool finished = false;
+        restInterface.ping([&](int status, const std::string &) {
+            finished = true;
+            if (status == 200) {
+                responses++;
+            }
+        });
+        QTRY_VERIFY(finished);
+    }
+
+    QCOMPARE(responses, requestCount);
+    QCOMPARE(server.requests().count(), requestCount);
+    QCOMPARE(server.connectionCount(), 1);
+}
+
+void UTMSPRestInterfaceTest::_telemetryBatchTest()
+{
+    MockBlenderServer server;
+    QVERIFY(server.isListening());
+    server.setResponse("/flight_stream/set_telemetry", 201, "{}");
+    UTMSPRestInterface::setHostUrl(UTMSPRestInterface::HostTarget::BlenderClient, server.url());
+
+    UTMSPNetworkRemoteIDManager remoteIDManager(std::make_shared<Dispatcher>());
+    remoteIDManager.getCapabilty("token");
+
+    // The first update goes out right away, the ones made while it is in flight are batched into the next request
+    constexpr int updateCount = 5;
+    for (int i = 0; i < updateCount; i++) {
+        remoteIDManager.startTelemetry(47.0 + (i * 0.001), 8.0, 500, 90, 1, 1, 0, 10, "serial", "operator", "flight");
+    }
+    QCOMPARE(remoteIDManager.pendingObservations(), static_cast<size_t>(updateCount - 1));
+
+    QTRY_COMPARE(server.requests().count(), 2);
+    QTRY_COMPARE(remoteIDManager.pendingRequests(), 0);
+    QCOMPARE(remoteIDManager.pendingObservations(), static_cast<size_t>(0));
+
+    int observations = 0;
+    for (const MockBlenderServer::Request &request : server.requests()) {
+        QCOMPARE(request.method, QByteArray("PUT"));
+        QCOMPARE(request.headers.value("authorization"), QByteArray("Bearer token"));
+        const QJsonObject json = QJsonDocument::fromJson(request.body).object();
+        observations += json.value(QStringLiteral("observations")).toArray().count();
+    }
+    QCOMPARE(observations, updateCount);
+    QCOMPARE(QJsonDocument::fromJson(server.requests().last().body).object().value(QStringLiteral("observations")).toArray().count(), updateCount - 1);
+}
+
+void UTMSPRestInterfaceTest::_flightPlanTest()
+{
+    MockBlenderServer server;
+    QVERIFY(server.isListening());
+    server.setResponse("/flight_declaration_ops/set_flight_declaration", 200, R"({"id":"abc123"})");
+    server.setResponse("/flight_declaration_ops/flight_declaration_state/abc123", 200, "{}");
+    UTMSPRestInterface::setHostUrl(UTMSPRestInterface::HostTarget::BlenderClient, server.url());
+
+    UTMSPFlightPlanManager flightPlanManager;
+    const json boundary = json::array({ json::array({ 47.0, 8.0 }), json::array({ 47.1, 8.0 }), json::array({ 47.1, 8.1 }) });
+
+    bool registerFinished = false;
+    bool registered = false;
+    flightPlanManager.registerFlightPlan("token", boundary, 0, 100, "2024-01-01T00:00:00Z", "2024-01-01T01:00:00Z", [&](bool success) {
+        registerFinished = true;
+        registered = success;
+    });
+    QTRY_VERIFY(registerFinished);
+    QVERIFY(registered);
+    const auto [responseJson, flightID, flag] = flightPlanManager.registerFlightPlanNotification();
+    QCOMPARE(QString::fromStdString(flightID), QStringLiteral("abc123"));
+    QVERIFY(flag);
+
+    bool activateFinished = false;
+    bool activated = false;
+    flightPlanManager.activateFlightPlan("token", [&](bool success) {
+        activateFinished = true;
+        activated = success;
+    });
+    QTRY_VERIFY(activateFinished);
+    QVERIFY(activated);
+
+    QCOMPARE(server.requests().count(), 2);
+    QCOMPARE(server.requests()[0].method, QByteArray("POST"));
+    QCOMPARE(server.requests()[1].method, QByteArray("PUT"));
+    QCOMPARE(server.requests()[1].path, QByteArray("/flight_declaration_ops/flight_declaration_state/abc123"));
+
+    // A failed registration reports failure instead of hanging
+    server.setResponse("/flight_declaration_ops/set_flight_declaration", 400, "{}");
+    registerFinished = false;
+    flightPlanManager.registerFlightPlan("token", boundary, 0, 100, "2024-01-01T00:00:00Z", "2024-01-01T01:00:00Z", [&](bool success) {
+        registerFinished = true;
+        registered = success;
+    });
+    QTRY_VERIFY(registerFinished);
+    QVERIFY(!registered);
+}
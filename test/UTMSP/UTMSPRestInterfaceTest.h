@@ -0,0 +1,16 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class UTMSPRestInterfaceTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void cleanup() final;
+
+    void _asyncRequestTest();
+    void _connectionReuseTest();
+    void _telemetryBatchTest();
+    void _flightPlanTest();
+};
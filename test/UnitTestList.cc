@@ -26,14 +26,18 @@
 // #include "RadioConfigTest.h"
 
 // Camera
+#include "CameraDefinitionTest.h"
 #include "QGCCameraManagerTest.h"
 
 // Comms
 #include "QGCSerialPortInfoTest.h"
+#include "TelemetryLatencyTest.h"
 
 // FactSystem
+#include "FactGroupTest.h"
 #include "FactSystemTestGeneric.h"
 #include "FactSystemTestPX4.h"
+#include "FactTest.h"
 #include "ParameterManagerTest.h"
 
 // FollowMe
@@ -82,6 +86,11 @@
 
 // UI
 
+// UTMSP
+#ifdef QGC_UTM_ADAPTER
+#include "UTMSPRestInterfaceTest.h"
+#endif
+
 // Utilities
 // Audio
 #include "AudioOutputTest.h"
@@ -93,6 +102,9 @@
 #include "GeoTest.h"
 // Shape
 #include "ShapeTest.h"
+// Logging
+#include "QGCLoggingTest.h"
+#include "QGCTraceTest.h"
 
 // Vehicle
 // Components
@@ -105,6 +117,15 @@
 // #include "SendMavCommandWithHandlerTest.h"
 // #include "SendMavCommandWithSignalingTest.h"
 #include "VehicleLinkManagerTest.h"
+// VehicleSetup
+#ifndef QGC_NO_SERIAL_LINK
+#include "BootloaderTest.h"
+#endif
+
+// Viewer3D
+#ifdef QGC_VIEWER3D
+#include "OsmParserTest.h"
+#endif
 
 // Missing
 // #include "FlightGearUnitTest.h"
@@ -112,6 +133,19 @@
 // #include "SendMavCommandTest.h"
 // #include "TCPLinkTest.h"
 
+#ifdef QGC_BENCHMARK_BUILD
+// Benchmarks
+#include "ADSBTCPLinkBenchmark.h"
+#include "DecompressionBenchmark.h"
+#include "FactBenchmark.h"
+#include "MissionControllerBenchmark.h"
+#include "SurveyComplexItemBenchmark.h"
+#include "TerrainTileBenchmark.h"
+#include "TileCacheBenchmark.h"
+#include "ULogParserBenchmark.h"
+#include "VehicleBenchmark.h"
+#endif
+
 int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
 {
     // ADSB
@@ -129,21 +163,25 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     // UT_REGISTER_TEST(RadioConfigTest)
 
     // Camera
+    UT_REGISTER_TEST(CameraDefinitionTest)
     UT_REGISTER_TEST(QGCCameraManagerTest)
 
     // Comms
     UT_REGISTER_TEST(QGCSerialPortInfoTest)
+    UT_REGISTER_TEST(TelemetryLatencyTest)
 
     // FactSystem
+    UT_REGISTER_TEST(FactGroupTest)
     UT_REGISTER_TEST(FactSystemTestGeneric)
     UT_REGISTER_TEST(FactSystemTestPX4)
+    UT_REGISTER_TEST(FactTest)
     UT_REGISTER_TEST(ParameterManagerTest)
 
     // FollowMe
     UT_REGISTER_TEST(FollowMeTest)
 
     // GPS
-    // UT_REGISTER_TEST(GpsTest)
+    UT_REGISTER_TEST(GpsTest)
 
     // MAVLink
     UT_REGISTER_TEST(StatusTextHandlerTest)
@@ -183,6 +221,11 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
 
     // UI
 
+    // UTMSP
+#ifdef QGC_UTM_ADAPTER
+    UT_REGISTER_TEST(UTMSPRestInterfaceTest)
+#endif
+
     // Utilities
     // Audio
     UT_REGISTER_TEST(AudioOutputTest)
@@ -194,6 +237,9 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     UT_REGISTER_TEST(GeoTest)
     // Shape
     UT_REGISTER_TEST(ShapeTest)
+    // Logging
+    UT_REGISTER_TEST(QGCLoggingTest)
+    UT_REGISTER_TEST(QGCTraceTest)
 
     // Vehicle
     // Components
@@ -206,6 +252,15 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     // UT_REGISTER_TEST(SendMavCommandWithHandlerTest)
     // UT_REGISTER_TEST(SendMavCommandWithSignalingTest)
     UT_REGISTER_TEST(VehicleLinkManagerTest)
+    // VehicleSetup
+#ifndef QGC_NO_SERIAL_LINK
+    UT_REGISTER_TEST(BootloaderTest)
+#endif
+
+    // Viewer3D
+#ifdef QGC_VIEWER3D
+    UT_REGISTER_TEST(OsmParserTest)
+#endif
 
     // Missing
     // UT_REGISTER_TEST(FlightGearUnitTest)
@@ -213,6 +268,19 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     // UT_REGISTER_TEST(SendMavCommandTest)
     // UT_REGISTER_TEST(TCPLinkTest)
 
+#ifdef QGC_BENCHMARK_BUILD
+    // Benchmarks, only run when requested specifically
+    UT_REGISTER_TEST_STANDALONE(ADSBTCPLinkBenchmark)
+    UT_REGISTER_TEST_STANDALONE(DecompressionBenchmark)
+    UT_REGISTER_TEST_STANDALONE(FactBenchmark)
+    UT_REGISTER_TEST_STANDALONE(MissionControllerBenchmark)
+    UT_REGISTER_TEST_STANDALONE(SurveyComplexItemBenchmark)
+    UT_REGISTER_TEST_STANDALONE(TerrainTileBenchmark)
+    UT_REGISTER_TEST_STANDALONE(TileCacheBenchmark)
+    UT_REGISTER_TEST_STANDALONE(ULogParserBenchmark)
+    UT_REGISTER_TEST_STANDALONE(VehicleBenchmark)
+#endif
+
     int result = 0;
     for (int i=0; i < (stress ? 20 : 1); i++) {
         int failures = 0;
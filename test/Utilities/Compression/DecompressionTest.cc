@@ -3,8 +3,21 @@
 #include "QGCZlib.h"
 #include "QGCZip.h"
 
+#include <QtCore/QBuffer>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
 #include <QtTest/QTest>
 
+static QByteArray _readAll(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
 void DecompressionTest::_testDecompressGzip()
 {
     const QString gzippedFileName = QStringLiteral(":/unittest/manifest.json.gz");
@@ -28,3 +41,80 @@ void DecompressionTest::_testUnzip()
     const bool result = QGCZip::unzipFile(zipFilename, decompressedPath);
     QVERIFY(result);
 }
+
+void DecompressionTest::_testInflateGzipInMemory()
+{
+    const QString decompressedFilename = QDir::temp().absoluteFilePath(QStringLiteral("manifest.gz.json"));
+    QVERIFY(QGCZlib::inflateGzipFile(QStringLiteral(":/unittest/manifest.json.gz"), decompressedFilename));
+
+    bool ok = false;
+    const QByteArray inflated = QGCZlib::inflateGzip(_readAll(QStringLiteral(":/unittest/manifest.json.gz")), &ok);
+    QVERIFY(ok);
+    QCOMPARE(inflated, _readAll(decompressedFilename));
+    QVERIFY(!QJsonDocument::fromJson(inflated).isNull());
+
+    QFile::remove(decompressedFilename);
+}
+
+void DecompressionTest::_testInflateLZMAInMemory()
+{
+    const QString decompressedFilename = QDir::temp().absoluteFilePath(QStringLiteral("manifest.xz.json"));
+    QVERIFY(QGCLZMA::inflateLZMAFile(QStringLiteral(":/unittest/manifest.json.xz"), decompressedFilename));
+
+    bool ok = false;
+    const QByteArray inflated = QGCLZMA::inflateLZMA(_readAll(QStringLiteral(":/unittest/manifest.json.xz")), &ok);
+    QVERIFY(ok);
+    QCOMPARE(inflated, _readAll(decompressedFilename));
+    QVERIFY(!QJsonDocument::fromJson(inflated).isNull());
+
+    QFile::remove(decompressedFilename);
+}
+
+void DecompressionTest::_testInflateStreamingSink()
+{
+    QFile lzmaFile(QStringLiteral(":MockLink/Parameter.MetaData.json.xz"));
+    QVERIFY(lzmaFile.open(QIODevice::ReadOnly));
+
+    QByteArray streamed;
+    int cChunks = 0;
+    QVERIFY(QGCLZMA::inflateLZMA(&lzmaFile, [&streamed, &cChunks](const char *data, qsizetype size) {
+        streamed.append(data, size);
+        cChunks++;
+        return true;
+    }));
+    const QString decompressedFilename = QDir::temp().absoluteFilePath(QStringLiteral("Parameter.MetaData.json"));
+    QVERIFY(QGCLZMA::inflateLZMAFile(lzmaFile.fileName(), decompressedFilename));
+    QCOMPARE(streamed, _readAll(decompressedFilename));
+    QFile::remove(decompressedFilename);
+    QVERIFY(cChunks > 0);
+
+    // Sink can stop decompression early
+    QVERIFY(lzmaFile.seek(0));
+    QVERIFY(!QGCLZMA::inflateLZMA(&lzmaFile, [](const char *, qsizetype) { return false; }));
+
+    // Gzip through a device which isn't a file
+    QBuffer gzipBuffer;
+    gzipBuffer.setData(_readAll(QStringLiteral(":/unittest/manifest.json.gz")));
+    QVERIFY(gzipBuffer.open(QIODevice::ReadOnly));
+    QByteArray gzipStreamed;
+    QVERIFY(QGCZlib::inflateGzip(&gzipBuffer, [&gzipStreamed](const char *data, qsizetype size) {
+        gzipStreamed.append(data, size);
+        return true;
+    }));
+    QCOMPARE(gzipStreamed, QGCZlib::inflateGzip(_readAll(QStringLiteral(":/unittest/manifest.json.gz"))));
+}
+
+void DecompressionTest::_testInflateCorrupt()
+{
+    QByteArray lzmaBytes = _readAll(QStringLiteral(":/unittest/manifest.json.xz"));
+    QVERIFY(!lzmaBytes.isEmpty());
+
+    bool ok = true;
+    QVERIFY(QGCLZMA::inflateLZMA(lzmaBytes.left(lzmaBytes.size() / 2), &ok).isEmpty());
+    QVERIFY(!ok);
+
+    QByteArray gzipBytes = _readAll(QStringLiteral(":/unittest/manifest.json.gz"));
+    ok = true;
+    QVERIFY(QGCZlib::inflateGzip(gzipBytes.left(gzipBytes.size() / 2), &ok).isEmpty());
+    QVERIFY(!ok);
+}
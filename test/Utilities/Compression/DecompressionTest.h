@@ -10,4 +10,8 @@ private slots:
     void _testDecompressGzip();
     void _testDecompressLZMA();
     void _testUnzip();
+    void _testInflateGzipInMemory();
+    void _testInflateLZMAInMemory();
+    void _testInflateStreamingSink();
+    void _testInflateCorrupt();
 };
@@ -0,0 +1,64 @@
+#include "QGCLoggingTest.h"
+#include "QGCLogging.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+void QGCLoggingTest::_batchedRowsTest()
+{
+    QGCLogging logging;
+    QSignalSpy spyRowsInserted(&logging, &QAbstractItemModel::rowsInserted);
+    QVERIFY(spyRowsInserted.isValid());
+
+    logging.log(QStringLiteral("first"));
+    logging.log(QStringLiteral("second"));
+    logging.log(QStringLiteral("third"));
+
+    // Rows are only announced on the next batch
+    QCOMPARE(logging.rowCount(), 0);
+
+    QVERIFY(spyRowsInserted.wait(1000));
+    QCOMPARE(spyRowsInserted.count(), 1);
+    QCOMPARE(spyRowsInserted.at(0).at(1).toInt(), 0);
+    QCOMPARE(spyRowsInserted.at(0).at(2).toInt(), 2);
+
+    QCOMPARE(logging.rowCount(), 3);
+    QCOMPARE(logging.data(logging.index(0, 0)).toString(), QStringLiteral("first"));
+    QCOMPARE(logging.data(logging.index(2, 0)).toString(), QStringLiteral("third"));
+    QCOMPARE(logging.messages(), QStringList({ QStringLiteral("first"), QStringLiteral("second"), QStringLiteral("third") }));
+}
+
+void QGCLoggingTest::_ringBufferWrapTest()
+{
+    QGCLogging logging;
+    QSignalSpy spyRowsInserted(&logging, &QAbstractItemModel::rowsInserted);
+    QSignalSpy spyRowsRemoved(&logging, &QAbstractItemModel::rowsRemoved);
+
+    // Overflow the buffer within a single batch, only the newest lines are kept
+    constexpr int overflow = 10;
+    for (int i = 0; i < QGCLogging::kMaxLogRows + overflow; i++) {
+        logging.log(QString::number(i));
+    }
+    QVERIFY(spyRowsInserted.wait(1000));
+    QCOMPARE(spyRowsRemoved.count(), 0);
+    QCOMPARE(logging.rowCount(), QGCLogging::kMaxLogRows);
+    QCOMPARE(logging.data(logging.index(0, 0)).toString(), QString::number(overflow));
+    QCOMPARE(logging.data(logging.index(QGCLogging::kMaxLogRows - 1, 0)).toString(), QString::number(QGCLogging::kMaxLogRows + overflow - 1));
+
+    // Appending to a full buffer drops the oldest rows
+    constexpr int appendCount = 5;
+    for (int i = 0; i < appendCount; i++) {
+        logging.log(QStringLiteral("append %1").arg(i));
+    }
+    QVERIFY(spyRowsInserted.wait(1000));
+    QCOMPARE(spyRowsRemoved.count(), 1);
+    QCOMPARE(spyRowsRemoved.at(0).at(2).toInt(), appendCount - 1);
+    QCOMPARE(logging.rowCount(), QGCLogging::kMaxLogRows);
+    QCOMPARE(logging.data(logging.index(0, 0)).toString(), QString::number(overflow + appendCount));
+    QCOMPARE(logging.data(logging.index(QGCLogging::kMaxLogRows - 1, 0)).toString(), QStringLiteral("append %1").arg(appendCount - 1));
+
+    const QStringList messages = logging.messages();
+    QCOMPARE(messages.count(), QGCLogging::kMaxLogRows);
+    QCOMPARE(messages.first(), QString::number(overflow + appendCount));
+    QCOMPARE(messages.last(), QStringLiteral("append %1").arg(appendCount - 1));
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class QGCLoggingTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _batchedRowsTest();
+    void _ringBufferWrapTest();
+};
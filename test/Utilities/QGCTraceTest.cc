@@ -0,0 +1,117 @@
+#include "QGCTraceTest.h"
+#include "QGCTrace.h"
+
+#include <QtCore/QSemaphore>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QThread>
+#include <QtTest/QTest>
+
+void QGCTraceTest::_disabledTest()
+{
+    QVERIFY(!QGCTrace::isRunning());
+
+    // Must be a no-op while tracing is off
+    QGC_TRACE(MAVLinkBytesReceived, 1, 2);
+}
+
+void QGCTraceTest::_roundTripTest()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString tracePath = tempDir.filePath(QStringLiteral("test.qgctrace"));
+
+    QVERIFY(QGCTrace::start(tracePath));
+    QVERIFY(QGCTrace::isRunning());
+
+    constexpr int eventsPerThread = 1000;
+    QGC_TRACE(LinkBytesSent, 3, 280);
+
+    QThread *const thread = QThread::create([]() {
+        for (int i = 0; i < eventsPerThread; i++) {
+            QGC_TRACE(MAVLinkMessageReceived, 1, i);
+        }
+    });
+    thread->start();
+    QVERIFY(thread->wait(5000));
+    delete thread;
+
+    QGCTrace::stop();
+    QVERIFY(!QGCTrace::isRunning());
+
+    QList<QGCTrace::Record_t> records;
+    qint64 startMsecs = 0;
+    QVERIFY(QGCTrace::decodeFile(tracePath, records, startMsecs));
+    QVERIFY(startMsecs > 0);
+    QCOMPARE(records.count(), eventsPerThread + 1);
+
+    int sent = 0;
+    quint64 nextMessage = 0;
+    quint64 lastTimestamp = 0;
+    for (const QGCTrace::Record_t &record : records) {
+        if (record.eventId == static_cast<quint16>(QGCTrace::Event::LinkBytesSent)) {
+            QCOMPARE(record.arg0, 3u);
+            QCOMPARE(record.arg1, 280ull);
+            sent++;
+        } else {
+            QCOMPARE(record.eventId, static_cast<quint16>(QGCTrace::Event::MAVLinkMessageReceived));
+            // Events of a single thread stay in order
+            QCOMPARE(record.arg1, nextMessage++);
+            QVERIFY(record.timestampNsecs >= lastTimestamp);
+            lastTimestamp = record.timestampNsecs;
+        }
+    }
+    QCOMPARE(sent, 1);
+    QCOMPARE(nextMessage, static_cast<quint64>(eventsPerThread));
+}
+
+void QGCTraceTest::_threadLimitTest()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString tracePath = tempDir.filePath(QStringLiteral("limit.qgctrace"));
+
+    QVERIFY(QGCTrace::start(tracePath));
+
+    // More threads alive at once than there are buffers
+    constexpr int threadCount = QGCTrace::kMaxThreads + 8;
+    QSemaphore recorded;
+    QSemaphore exit;
+    QList<QThread*> threads;
+    for (int i = 0; i < threadCount; i++) {
+        QThread *const thread = QThread::create([&recorded, &exit, i]() {
+            QGC_TRACE(MAVLinkMessageReceived, 2, i);
+            recorded.release();
+            exit.acquire();
+        });
+        thread->start();
+        threads.append(thread);
+    }
+    QVERIFY(recorded.tryAcquire(threadCount, 5000));
+    exit.release(threadCount);
+    for (QThread *const thread : threads) {
+        QVERIFY(thread->wait(5000));
+        delete thread;
+    }
+
+    QGCTrace::stop();
+
+    QList<QGCTrace::Record_t> records;
+    qint64 startMsecs = 0;
+    QVERIFY(QGCTrace::decodeFile(tracePath, records, startMsecs));
+
+    // Every event is either recorded against a bounded buffer index or accounted for as dropped
+    quint64 received = 0;
+    quint64 unregisteredDropped = 0;
+    for (const QGCTrace::Record_t &record : records) {
+        if (record.eventId == static_cast<quint16>(QGCTrace::Event::TraceDropped)) {
+            QCOMPARE(record.threadIndex, QGCTrace::kNoThreadIndex);
+            unregisteredDropped += record.arg1;
+        } else {
+            QCOMPARE(record.eventId, static_cast<quint16>(QGCTrace::Event::MAVLinkMessageReceived));
+            QVERIFY(record.threadIndex < QGCTrace::kMaxThreads);
+            received++;
+        }
+    }
+    QVERIFY(unregisteredDropped >= 8);
+    QCOMPARE(received + unregisteredDropped, static_cast<quint64>(threadCount));
+}
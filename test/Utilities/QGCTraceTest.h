@@ -0,0 +1,13 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class QGCTraceTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _disabledTest();
+    void _roundTripTest();
+    void _threadLimitTest();
+};
@@ -15,6 +15,7 @@
 #include "MockLinkFTP.h"
 
 #include <QtCore/QStandardPaths>
+#include <QtCore/QTemporaryFile>
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 
@@ -125,6 +126,65 @@ void FTPManagerTest::_testLostPackets(void)
     _disconnectMockLink();
 }
 
+void FTPManagerTest::_testLossAndLatency(void)
+{
+    _connectMockLinkNoInitialConnectSequence();
+
+    FTPManager* ftpManager  = _vehicle->ftpManager();
+    int         fileSize    = 16 * 1024;
+    QString     filename    = QStringLiteral("%1%2").arg(MockLinkFTP::sizeFilenamePrefix).arg(fileSize);
+
+    QSignalSpy spyDownloadComplete(ftpManager, &FTPManager::downloadComplete);
+
+    // Open is not retried, so latency must stay below the initial unit test timeout
+    _mockLink->mockLinkFTP()->setLinkSimulation(3 /* latencyMsecs */, 10 /* dropPercent */);
+
+    ftpManager->download(MAV_COMP_ID_AUTOPILOT1, filename, QStandardPaths::writableLocation(QStandardPaths::TempLocation));
+
+    QCOMPARE(spyDownloadComplete.wait(30000), true);
+    QCOMPARE(spyDownloadComplete.count(), 1);
+
+    // void downloadComplete   (const QString& file, const QString& errorMsg);
+    QList<QVariant> arguments = spyDownloadComplete.takeFirst();
+    QVERIFY(arguments[1].toString().isEmpty());
+
+    _verifyFileSizeAndDelete(arguments[0].toString(), fileSize);
+
+    _disconnectMockLink();
+}
+
+void FTPManagerTest::_testUpload(void)
+{
+    _connectMockLinkNoInitialConnectSequence();
+
+    FTPManager* ftpManager = _vehicle->ftpManager();
+
+    QByteArray uploadBytes;
+    for (int i=0; i<1000; i++) {
+        uploadBytes.append(static_cast<char>(i % 255));
+    }
+
+    QTemporaryFile uploadFile;
+    QVERIFY(uploadFile.open());
+    QCOMPARE(uploadFile.write(uploadBytes), uploadBytes.size());
+    uploadFile.close();
+
+    QSignalSpy spyUploadComplete(ftpManager, &FTPManager::uploadComplete);
+
+    _mockLink->mockLinkFTP()->enableRandromDrops(true);
+    QVERIFY(ftpManager->upload(MAV_COMP_ID_AUTOPILOT1, "/upload.bin", uploadFile.fileName()));
+
+    QCOMPARE(spyUploadComplete.wait(10000), true);
+    QCOMPARE(spyUploadComplete.count(), 1);
+
+    // void uploadComplete (const QString& file, const QString& errorMsg);
+    QList<QVariant> arguments = spyUploadComplete.takeFirst();
+    QVERIFY(arguments[1].toString().isEmpty());
+    QCOMPARE(_mockLink->mockLinkFTP()->uploadedFile("/upload.bin"), uploadBytes);
+
+    _disconnectMockLink();
+}
+
 void FTPManagerTest::_verifyFileSizeAndDelete(const QString& filename, int expectedSize)
 {
     QFileInfo fileInfo(filename);
@@ -17,6 +17,8 @@ class FTPManagerTest : public UnitTest
 
 private slots:
     void _testLostPackets                               (void);
+    void _testLossAndLatency                            (void);
+    void _testUpload                                    (void);
     void _testListDirectory                             (void);
     void _testListDirectoryNoResponse                   (void);
     void _testListDirectoryNakResponse                  (void);
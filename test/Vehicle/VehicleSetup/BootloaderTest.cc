@@ -0,0 +1,159 @@
+#include "BootloaderTest.h"
+#include "Bootloader.h"
+#include "FirmwareImage.h"
+#include "MockBootloaderPort.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QThread>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+void BootloaderTest::init()
+{
+    UnitTest::init();
+
+    _tempDir = new QTemporaryDir();
+    QVERIFY(_tempDir->isValid());
+
+    _imageBytes.resize(_imageSize);
+    QRandomGenerator::global()->fillRange(reinterpret_cast<quint32*>(_imageBytes.data()), _imageSize / sizeof(quint32));
+
+    const QString fileName = _tempDir->filePath(QStringLiteral("firmware.bin"));
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(_imageBytes), static_cast<qint64>(_imageBytes.size()));
+    file.close();
+
+    _image = new FirmwareImage(this);
+    QVERIFY(_image->load(fileName, _boardID));
+}
+
+void BootloaderTest::cleanup()
+{
+    delete _image;
+    _image = nullptr;
+    delete _tempDir;
+    _tempDir = nullptr;
+
+    UnitTest::cleanup();
+}
+
+void BootloaderTest::_programVerifyTest()
+{
+    Bootloader bootloader(false /* sikRadio */);
+    MockBootloaderPort *port = new MockBootloaderPort(_boardID, _flashSize);
+    QVERIFY(bootloader.open(port));
+
+    uint32_t bootloaderVersion = 0;
+    uint32_t boardID = 0;
+    uint32_t flashSize = 0;
+    QVERIFY2(bootloader.getBoardInfo(bootloaderVersion, boardID, flashSize), qPrintable(bootloader.errorString()));
+    QCOMPARE(boardID, _boardID);
+    QCOMPARE(flashSize, _flashSize);
+
+    QVERIFY(bootloader.initFlashSequence());
+    QVERIFY2(bootloader.erase(), qPrintable(bootloader.errorString()));
+
+    QSignalSpy spyProgress(&bootloader, &Bootloader::updateProgress);
+    QVERIFY2(bootloader.program(_image), qPrintable(bootloader.errorString()));
+    QCOMPARE(port->flash().left(_imageSize), _imageBytes);
+    QCOMPARE(port->flash().mid(_imageSize), QByteArray(_flashSize - _imageSize, static_cast<char>(0xFF)));
+
+    // Several blocks were in flight at once, but no more than the bootloader can buffer
+    QVERIFY(port->maxPendingResponses() > 1);
+    QVERIFY(port->maxPendingResponses() <= 4);
+
+    QVERIFY(spyProgress.count() > 0);
+    QCOMPARE(spyProgress.last().at(0).toInt(), _imageSize);
+    QCOMPARE(spyProgress.last().at(1).toInt(), _imageSize);
+
+    QVERIFY2(bootloader.verify(_image), qPrintable(bootloader.errorString()));
+    QVERIFY(port->rebooted());
+}
+
+void BootloaderTest::_programFailureTest()
+{
+    Bootloader bootloader(false /* sikRadio */);
+    MockBootloaderPort *port = new MockBootloaderPort(_boardID, _flashSize);
+    port->setFailProgramAddress(0x1000);
+    QVERIFY(bootloader.open(port));
+
+    uint32_t bootloaderVersion = 0;
+    uint32_t boardID = 0;
+    uint32_t flashSize = 0;
+    QVERIFY(bootloader.getBoardInfo(bootloaderVersion, boardID, flashSize));
+    QVERIFY(bootloader.erase());
+
+    QVERIFY(!bootloader.program(_image));
+    QVERIFY2(bootloader.errorString().contains(QStringLiteral("PROTO_FAILED")), qPrintable(bootloader.errorString()));
+    QVERIFY2(bootloader.errorString().contains(QStringLiteral("0x00001000")), qPrintable(bootloader.errorString()));
+}
+
+void BootloaderTest::_crcMismatchTest()
+{
+    Bootloader bootloader(false /* sikRadio */);
+    MockBootloaderPort *port = new MockBootloaderPort(_boardID, _flashSize);
+    port->setCorruptAddress(_imageSize / 2);
+    QVERIFY(bootloader.open(port));
+
+    uint32_t bootloaderVersion = 0;
+    uint32_t boardID = 0;
+    uint32_t flashSize = 0;
+    QVERIFY(bootloader.getBoardInfo(bootloaderVersion, boardID, flashSize));
+    QVERIFY(bootloader.erase());
+    QVERIFY(bootloader.program(_image));
+
+    QVERIFY(!bootloader.verify(_image));
+    QVERIFY2(bootloader.errorString().contains(QStringLiteral("CRC mismatch")), qPrintable(bootloader.errorString()));
+}
+
+void BootloaderTest::_flashBoardsTest()
+{
+    const QStringList portNames = { QStringLiteral("mock0"), QStringLiteral("mock1"), QStringLiteral("mock2"), QStringLiteral("mock3"),
+                                    QStringLiteral("otherBoard"), QStringLiteral("smallFlash") };
+
+    QMutex mutex;
+    QList<Qt::HANDLE> threads;
+    const Bootloader::DeviceFactory deviceFactory = [&mutex, &threads](const QString &portName) {
+        {
+            const QMutexLocker locker(&mutex);
+            threads.append(QThread::currentThreadId());
+        }
+
+        if (portName == QStringLiteral("otherBoard")) {
+            return new MockBootloaderPort(_boardID + 1, _flashSize);
+        } else if (portName == QStringLiteral("smallFlash")) {
+            return new MockBootloaderPort(_boardID, _imageSize / 2);
+        }
+
+        MockBootloaderPort *port = new MockBootloaderPort(_boardID, _flashSize);
+        if (portName == QStringLiteral("mock2")) {
+            port->setFailProgramAddress(0);
+        }
+        return port;
+    };
+
+    const QList<Bootloader::FlashResult> results = Bootloader::flashBoards(portNames, _image, deviceFactory);
+    QCOMPARE(results.count(), portNames.count());
+    for (int i = 0; i < results.count(); i++) {
+        QCOMPARE(results[i].portName, portNames[i]);
+        if (results[i].portName == QStringLiteral("mock2")) {
+            QVERIFY(!results[i].success);
+            QVERIFY(!results[i].errorString.isEmpty());
+        } else if (results[i].portName == QStringLiteral("otherBoard")) {
+            QVERIFY(!results[i].success);
+            QVERIFY2(results[i].errorString.contains(QStringLiteral("board id")), qPrintable(results[i].errorString));
+        } else if (results[i].portName == QStringLiteral("smallFlash")) {
+            QVERIFY(!results[i].success);
+            QVERIFY2(results[i].errorString.contains(QStringLiteral("too large")), qPrintable(results[i].errorString));
+        } else {
+            QVERIFY2(results[i].success, qPrintable(results[i].errorString));
+        }
+    }
+
+    // Boards were flashed from the pool, not the calling thread
+    QCOMPARE(threads.count(), portNames.count());
+    QVERIFY(!threads.contains(QThread::currentThreadId()));
+}
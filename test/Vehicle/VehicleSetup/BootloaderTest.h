@@ -0,0 +1,30 @@
+#pragma once
+
+#include "UnitTest.h"
+
+#include <QtCore/QTemporaryDir>
+
+class FirmwareImage;
+
+class BootloaderTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void init() final;
+    void cleanup() final;
+
+    void _programVerifyTest();
+    void _programFailureTest();
+    void _crcMismatchTest();
+    void _flashBoardsTest();
+
+private:
+    QTemporaryDir *_tempDir = nullptr;
+    FirmwareImage *_image = nullptr;
+    QByteArray _imageBytes;
+
+    static constexpr uint32_t _boardID = 50;
+    static constexpr uint32_t _flashSize = 128 * 1024;
+    static constexpr int _imageSize = 10000;    ///< Last PROG_MULTI block is partial
+};
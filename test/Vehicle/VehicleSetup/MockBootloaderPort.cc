@@ -0,0 +1,205 @@
+#include "MockBootloaderPort.h"
+#include "QGC.h"
+
+#include <cstring>
+
+namespace {
+
+// PX4 bootloader protocol bytes
+constexpr uint8_t kInSync = 0x12;
+constexpr uint8_t kEoc = 0x20;
+constexpr uint8_t kOk = 0x10;
+constexpr uint8_t kFailed = 0x11;
+constexpr uint8_t kInvalid = 0x13;
+constexpr uint8_t kGetSync = 0x21;
+constexpr uint8_t kGetDevice = 0x22;
+constexpr uint8_t kChipErase = 0x23;
+constexpr uint8_t kChipVerify = 0x24;
+constexpr uint8_t kProgMulti = 0x27;
+constexpr uint8_t kReadMulti = 0x28;
+constexpr uint8_t kGetCrc = 0x29;
+constexpr uint8_t kBoot = 0x30;
+
+constexpr uint8_t kInfoBootloaderRev = 1;
+constexpr uint8_t kInfoBoardID = 2;
+constexpr uint8_t kInfoBoardRev = 3;
+constexpr uint8_t kInfoFlashSize = 4;
+constexpr uint32_t kBootloaderRev = 5;
+
+QByteArray uint32Bytes(uint32_t value)
+{
+    return QByteArray(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+MockBootloaderPort::MockBootloaderPort(uint32_t boardID, uint32_t flashSize, QObject *parent)
+    : QIODevice(parent)
+    , _boardID(boardID)
+    , _flash(flashSize, static_cast<char>(0xFF))
+{
+    (void) open(QIODevice::ReadWrite | QIODevice::Unbuffered);
+}
+
+qint64 MockBootloaderPort::bytesAvailable() const
+{
+    return _output.size() + QIODevice::bytesAvailable();
+}
+
+bool MockBootloaderPort::waitForReadyRead(int msecs)
+{
+    Q_UNUSED(msecs);
+
+    return !_output.isEmpty();
+}
+
+qint64 MockBootloaderPort::readData(char *data, qint64 maxSize)
+{
+    const qint64 bytes = qMin(maxSize, static_cast<qint64>(_output.size()));
+    memcpy(data, _output.constData(), bytes);
+    _output.remove(0, bytes);
+
+    _readTotal += bytes;
+    while (!_responseEnds.isEmpty() && (_responseEnds.first() <= _readTotal)) {
+        _responseEnds.removeFirst();
+    }
+
+    return bytes;
+}
+
+qint64 MockBootloaderPort::writeData(const char *data, qint64 maxSize)
+{
+    _input.append(data, maxSize);
+
+    while (!_input.isEmpty()) {
+        const qsizetype used = _handleCommand();
+        if (used == 0) {
+            break;
+        }
+        _input.remove(0, used);
+    }
+
+    return maxSize;
+}
+
+void MockBootloaderPort::_respond(const QByteArray &data, bool ok)
+{
+    _respondStatus(data, ok ? kOk : kFailed);
+}
+
+void MockBootloaderPort::_respondInvalid()
+{
+    _respondStatus(QByteArray(), kInvalid);
+}
+
+void MockBootloaderPort::_respondStatus(const QByteArray &data, uint8_t status)
+{
+    _output.append(data);
+    _output.append(static_cast<char>(kInSync));
+    _output.append(static_cast<char>(status));
+
+    _outputTotal += data.size() + 2;
+    _responseEnds.append(_outputTotal);
+    _maxPendingResponses = qMax(_maxPendingResponses, static_cast<int>(_responseEnds.count()));
+}
+
+qsizetype MockBootloaderPort::_handleCommand()
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t*>(_input.constData());
+    const qsizetype count = _input.size();
+
+    // Length of the command including the EOC, which depends on the command
+    qsizetype length = 2;
+    switch (bytes[0]) {
+    case kGetDevice:
+        length = 3;
+        break;
+    case kProgMulti:
+        if (count < 2) {
+            return 0;
+        }
+        length = bytes[1] + 3;
+        break;
+    case kReadMulti:
+        length = 3;
+        break;
+    default:
+        break;
+    }
+    if (count < length) {
+        return 0;
+    }
+
+    if (bytes[length - 1] != kEoc) {
+        _respondInvalid();
+        return length;
+    }
+
+    switch (bytes[0]) {
+    case kGetSync:
+        _respond(QByteArray());
+        break;
+    case kGetDevice:
+        switch (bytes[1]) {
+        case kInfoBootloaderRev:
+            _respond(uint32Bytes(kBootloaderRev));
+            break;
+        case kInfoBoardID:
+            _respond(uint32Bytes(_boardID));
+            break;
+        case kInfoBoardRev:
+            _respond(uint32Bytes(0));
+            break;
+        case kInfoFlashSize:
+            _respond(uint32Bytes(_flash.size()));
+            break;
+        default:
+            _respond(QByteArray(), false);
+            break;
+        }
+        break;
+    case kChipErase:
+        _flash.fill(static_cast<char>(0xFF));
+        _address = 0;
+        _respond(QByteArray());
+        break;
+    case kChipVerify:
+        _address = 0;
+        _respond(QByteArray());
+        break;
+    case kProgMulti:
+    {
+        const int progBytes = bytes[1];
+        if ((_address == _failProgramAddress) || ((_address + progBytes) > static_cast<uint32_t>(_flash.size()))) {
+            _respond(QByteArray(), false);
+            break;
+        }
+        (void) _flash.replace(_address, progBytes, reinterpret_cast<const char*>(&bytes[2]), progBytes);
+        if ((_corruptAddress >= _address) && (_corruptAddress < (_address + progBytes))) {
+            _flash[_corruptAddress] = static_cast<char>(_flash.at(_corruptAddress) ^ 0xFF);
+        }
+        _address += progBytes;
+        _respond(QByteArray());
+        break;
+    }
+    case kReadMulti:
+    {
+        const int readBytes = qMin(static_cast<int>(bytes[1]), static_cast<int>(_flash.size() - _address));
+        _respond(_flash.mid(_address, readBytes));
+        _address += readBytes;
+        break;
+    }
+    case kGetCrc:
+        _respond(uint32Bytes(QGC::crc32(reinterpret_cast<const uint8_t*>(_flash.constData()), _flash.size(), 0)));
+        break;
+    case kBoot:
+        _rebooted = true;
+        _respond(QByteArray());
+        break;
+    default:
+        _respondInvalid();
+        break;
+    }
+
+    return length;
+}
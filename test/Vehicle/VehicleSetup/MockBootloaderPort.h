@@ -0,0 +1,55 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QIODevice>
+#include <QtCore/QList>
+
+/// Serial port stand-in which emulates a PX4 bootloader, so Bootloader can be exercised without a board. Commands
+/// are answered as soon as they are written. Flash contents and the responses still waiting to be read are
+/// tracked so tests can check what was programmed and how far commands were pipelined.
+class MockBootloaderPort : public QIODevice
+{
+    Q_OBJECT
+
+public:
+    explicit MockBootloaderPort(uint32_t boardID, uint32_t flashSize, QObject *parent = nullptr);
+
+    bool isSequential() const final { return true; }
+    qint64 bytesAvailable() const final;
+    bool waitForReadyRead(int msecs) final;
+
+    QByteArray flash() const { return _flash; }
+    bool rebooted() const { return _rebooted; }
+    /// @return Most command responses which were waiting to be read at the same time
+    int maxPendingResponses() const { return _maxPendingResponses; }
+
+    /// Programming at this address fails with PROTO_FAILED
+    void setFailProgramAddress(uint32_t address) { _failProgramAddress = address; }
+    /// Corrupts the byte at this address after it is programmed
+    void setCorruptAddress(uint32_t address) { _corruptAddress = address; }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) final;
+    qint64 writeData(const char *data, qint64 maxSize) final;
+
+private:
+    /// @return Bytes used by the command at the start of _input, 0 if the command is not complete yet
+    qsizetype _handleCommand();
+    void _respond(const QByteArray &data, bool ok = true);
+    void _respondInvalid();
+    void _respondStatus(const QByteArray &data, uint8_t status);
+
+    const uint32_t _boardID;
+    QByteArray _flash;
+    uint32_t _address = 0;
+    bool _rebooted = false;
+    uint32_t _failProgramAddress = UINT32_MAX;
+    uint32_t _corruptAddress = UINT32_MAX;
+
+    QByteArray _input;
+    QByteArray _output;
+    qint64 _outputTotal = 0;            ///< Bytes ever added to _output
+    qint64 _readTotal = 0;              ///< Bytes ever read from _output
+    QList<qint64> _responseEnds;        ///< _outputTotal at the end of each unread response
+    int _maxPendingResponses = 0;
+};
@@ -0,0 +1,103 @@
+#include "OsmParserTest.h"
+#include "OsmParser.h"
+#include "ComponentInformationCache.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace {
+
+// A single three storey building inside the map bounds
+constexpr const char* kOsmFileContents = R"(<?xml version="1.0" encoding="UTF-8"?>
+<osm version="0.6">
+ <bounds minlat="47.3970" minlon="8.5450" maxlat="47.3980" maxlon="8.5460"/>
+ <node id="1" lat="47.3972" lon="8.5452"/>
+ <node id="2" lat="47.3972" lon="8.5455"/>
+ <node id="3" lat="47.3975" lon="8.5455"/>
+ <node id="4" lat="47.3975" lon="8.5452"/>
+ <way id="10">
+  <nd ref="1"/>
+  <nd ref="2"/>
+  <nd ref="3"/>
+  <nd ref="4"/>
+  <nd ref="1"/>
+  <tag k="building" v="yes"/>
+  <tag k="building:levels" v="3"/>
+ </way>
+</osm>
+)";
+
+}
+
+bool OsmParserTest::_writeOsmFile(const QString& fileName)
+{
+    QFile osmFile(fileName);
+    return osmFile.open(QIODevice::WriteOnly) && (osmFile.write(kOsmFileContents) > 0);
+}
+
+void OsmParserTest::_corruptMeshCacheTest()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const QString osmFileName = tempDir.filePath(QStringLiteral("buildings.osm"));
+    QVERIFY(_writeOsmFile(osmFileName));
+
+    OsmParser parser;
+    QSignalSpy spyMapChanged(&parser, &OsmParser::mapChanged);
+    parser.parseOsmFile(osmFileName);
+    QVERIFY(spyMapChanged.wait(kParseTimeoutMs));
+    QVERIFY(parser.mapLoaded());
+
+    const QByteArray vertexData = parser.buildingToMesh();
+    QVERIFY(!vertexData.isEmpty());
+
+    const QString cacheTag = parser.meshCacheTag();
+    const QString cachedFileName = OsmParser::meshCache().access(cacheTag);
+    QVERIFY(!cachedFileName.isEmpty());
+
+    // Corrupt the cached mesh
+    QFile cachedFile(cachedFileName);
+    QVERIFY(cachedFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QVERIFY(cachedFile.write("corrupt") > 0);
+    cachedFile.close();
+
+    // The invalid entry is dropped, the mesh triangulated again and the cache file rewritten
+    QCOMPARE(parser.buildingToMesh(), vertexData);
+    QCOMPARE(QFileInfo(cachedFileName).size(), static_cast<qint64>(sizeof(OsmParser::MeshCacheHeader_t)) + vertexData.size());
+    QCOMPARE(parser.loadCachedMesh(cacheTag), vertexData);
+
+    QVERIFY(OsmParser::meshCache().remove(cacheTag));
+}
+
+void OsmParserTest::_meshCacheHitTest()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const QString osmFileName = tempDir.filePath(QStringLiteral("buildings.osm"));
+    QVERIFY(_writeOsmFile(osmFileName));
+
+    OsmParser parser;
+    QSignalSpy spyMapChanged(&parser, &OsmParser::mapChanged);
+    parser.parseOsmFile(osmFileName);
+    QVERIFY(spyMapChanged.wait(kParseTimeoutMs));
+    const QByteArray vertexData = parser.buildingToMesh();
+    QVERIFY(!vertexData.isEmpty());
+
+    // The same file is served from the mesh cache right away, without parsing it
+    OsmParser cachedParser;
+    QSignalSpy spyCachedMapChanged(&cachedParser, &OsmParser::mapChanged);
+    cachedParser.parseOsmFile(osmFileName);
+    QCOMPARE(spyCachedMapChanged.count(), 1);
+    QVERIFY(cachedParser.mapLoaded());
+    QCOMPARE(cachedParser.getGpsRef(), parser.getGpsRef());
+    QCOMPARE(cachedParser.getMapBoundingBoxCoordinate(), parser.getMapBoundingBoxCoordinate());
+    QCOMPARE(cachedParser.buildingToMesh(), vertexData);
+    QVERIFY(cachedParser._osmParserWorker->mapBuildings.isEmpty());
+
+    QVERIFY(OsmParser::meshCache().remove(parser.meshCacheTag()));
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "UnitTest.h"
+
+class OsmParserTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _corruptMeshCacheTest();
+    void _meshCacheHitTest();
+
+private:
+    static bool _writeOsmFile(const QString& fileName);
+
+    static constexpr int kParseTimeoutMs = 5000;
+};
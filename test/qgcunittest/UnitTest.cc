@@ -19,6 +19,7 @@
 #include "MissionItem.h"
 #include "QGCLoggingCategory.h"
 
+#include <QtCore/QDir>
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 
@@ -67,6 +68,14 @@ int UnitTest::run(QStringView singleTest)
             }
             QStringList args;
             args << "*" << "-maxwarnings" << "0";
+
+            // Machine readable results (including QBENCHMARK measurements) for CI regression tracking
+            const QString resultsDir = qEnvironmentVariable("QGC_TEST_RESULTS_DIR");
+            if (!resultsDir.isEmpty() && QDir().mkpath(resultsDir)) {
+                args << "-o" << QStringLiteral("%1,xml").arg(QDir(resultsDir).filePath(test->objectName() + QStringLiteral(".xml")));
+                args << "-o" << QStringLiteral("-,txt");
+            }
+
             ret += QTest::qExec(test, args);
         }
     }
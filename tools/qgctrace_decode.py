@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Decode a QGroundControl binary trace file (recorded with --trace <file>) into text.
+
+Each line is: time since trace start (seconds), thread index, event name, followed by the
+event arguments. Events with a known argument layout are expanded, see QGCTrace::Event.
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+MAGIC = b"QGCTRACE"
+SUPPORTED_VERSION = 1
+RECORD = struct.Struct("<QHHIQ")
+
+
+def _mavlink_message(arg0, arg1):
+    return "chan={} msgid={} seq={} compid={} sysid={}".format(
+        arg0, arg1 & 0xFFFFFF, (arg1 >> 24) & 0xFF, (arg1 >> 32) & 0xFF, (arg1 >> 40) & 0xFF)
+
+
+def _ftp(arg0, arg1):
+    return "opcode={} req_opcode={} seq={} size={} offset={}".format(
+        arg0 & 0xFF, (arg0 >> 8) & 0xFF, arg1 & 0xFFFF, (arg1 >> 16) & 0xFF, arg1 >> 32)
+
+
+FORMATTERS = {
+    "TraceDropped": lambda arg0, arg1: "thread={} lost={}".format(arg0, arg1),
+    "MAVLinkBytesReceived": lambda arg0, arg1: "chan={} bytes={}".format(arg0, arg1),
+    "MAVLinkMessageReceived": _mavlink_message,
+    "LinkBytesSent": lambda arg0, arg1: "chan={} bytes={}".format(arg0, arg1),
+    "FTPRequestSent": _ftp,
+    "FTPResponseReceived": _ftp,
+}
+
+
+def read_trace(stream):
+    if stream.read(len(MAGIC)) != MAGIC:
+        raise ValueError("not a QGC trace file")
+
+    version, record_size, start_msecs, event_count = struct.unpack("<IIqI", stream.read(20))
+    if version != SUPPORTED_VERSION or record_size != RECORD.size:
+        raise ValueError("unsupported trace version {} record size {}".format(version, record_size))
+
+    names = {}
+    for _ in range(event_count):
+        event_id, name_length = struct.unpack("<HH", stream.read(4))
+        names[event_id] = stream.read(name_length).decode("utf-8")
+
+    def records():
+        while True:
+            data = stream.read(RECORD.size)
+            if len(data) < RECORD.size:
+                return
+            yield RECORD.unpack(data)
+
+    return start_msecs, names, records()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("trace", help="trace file to decode")
+    parser.add_argument("--event", action="append", help="only print the named event, may be repeated")
+    parser.add_argument("--summary", action="store_true", help="print event counts instead of the events")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as stream:
+        start_msecs, names, records = read_trace(stream)
+        start = datetime.datetime.fromtimestamp(start_msecs / 1000.0)
+        print("# trace started {}".format(start.isoformat()))
+
+        counts = {}
+        for timestamp, event_id, thread_index, arg0, arg1 in sorted(records):
+            name = names.get(event_id, "Event{}".format(event_id))
+            if args.event and name not in args.event:
+                continue
+            if args.summary:
+                counts[name] = counts.get(name, 0) + 1
+                continue
+            formatter = FORMATTERS.get(name, lambda a0, a1: "arg0={} arg1={}".format(a0, a1))
+            print("{:.9f} t{} {} {}".format(timestamp / 1e9, thread_index, name, formatter(arg0, arg1)))
+
+        for name, count in sorted(counts.items()):
+            print("{} {}".format(name, count))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())